@@ -56,6 +56,7 @@ typedef enum _zel_structure_type_t
     // This enumeration value is deprecated.
     // Pluse use ZEL_STRUCTURE_TYPE_TRACER_DESC.
     ZEL_STRUCTURE_TYPE_TRACER_EXP_DESC = 0x1  ,///< ::zel_tracer_desc_t
+    ZEL_STRUCTURE_TYPE_TRACER_SAMPLING_DESC = 0x2  ,///< ::zel_tracer_sampling_desc_t
     ZEL_STRUCTURE_TYPE_FORCE_UINT32 = 0x7fffffff
 
 } zel_structure_type_t;
@@ -70,6 +71,51 @@ typedef struct _zel_tracer_desc_t
 
 } zel_tracer_desc_t;
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Selects the calls of an API function a tracer's callbacks are
+///        called for
+typedef enum _zel_tracer_sampling_mode_t
+{
+    ZEL_TRACER_SAMPLING_MODE_ALL = 0,               ///< every call
+    ZEL_TRACER_SAMPLING_MODE_ONE_IN_N = 1,          ///< every rate-th call made by each thread
+    ZEL_TRACER_SAMPLING_MODE_INTERVAL = 2,          ///< the first call made by each thread in each interval of
+                                                    ///< rate nanoseconds
+    ZEL_TRACER_SAMPLING_MODE_FORCE_UINT32 = 0x7fffffff
+
+} zel_tracer_sampling_mode_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Sampling of the calls of one API function
+typedef struct _zel_tracer_api_sampling_t
+{
+    const char* pApiName;                           ///< [in] name of the API function, such as "zeEventQueryStatus"
+    zel_tracer_sampling_mode_t mode;                ///< [in] calls the callbacks are called for
+    uint64_t rate;                                  ///< [in] N of ::ZEL_TRACER_SAMPLING_MODE_ONE_IN_N, or the
+                                                    ///< interval in nanoseconds of ::ZEL_TRACER_SAMPLING_MODE_INTERVAL
+
+} zel_tracer_api_sampling_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Tracer sampling descriptor
+/// 
+/// @details
+///     - May be passed to ::zelTracerCreate through the pNext member of
+///       ::zel_tracer_desc_t.
+///     - Calls that are not sampled by any tracer skip the tracers'
+///       callbacks entirely.
+typedef struct _zel_tracer_sampling_desc_t
+{
+    zel_structure_type_t stype;                     ///< [in] type of this structure
+    const void* pNext;                              ///< [in][optional] pointer to extension-specific structure
+    zel_tracer_sampling_mode_t mode;                ///< [in] calls of API functions not in pApiSamplings that the
+                                                    ///< callbacks are called for
+    uint64_t rate;                                  ///< [in] rate of mode
+    uint32_t apiSamplingCount;                      ///< [in] number of entries in pApiSamplings
+    const zel_tracer_api_sampling_t* pApiSamplings; ///< [in][optional][range(0, apiSamplingCount)] sampling of
+                                                    ///< individual API functions
+
+} zel_tracer_sampling_desc_t;
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Creates a tracer
 /// 
@@ -86,6 +132,12 @@ typedef struct _zel_tracer_desc_t
 ///         + `nullptr == desc`
 ///         + `nullptr == desc->pUserData`
 ///         + `nullptr == phTracer`
+///     - ::ZE_RESULT_ERROR_INVALID_ARGUMENT
+///         + a ::zel_tracer_sampling_desc_t in the pNext chain names an
+///           unknown API function, or has a rate of 0 for a sampled mode
+///     - ::ZE_RESULT_ERROR_INVALID_ENUMERATION
+///         + a ::zel_tracer_sampling_desc_t in the pNext chain has an unknown
+///           sampling mode
 ///     - ::ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY
 ZE_APIEXPORT ze_result_t ZE_APICALL
 zelTracerCreate(
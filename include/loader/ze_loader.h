@@ -64,6 +64,33 @@ zelLoaderTranslateHandle(
    void *handleIn,                  //Input: handle to translate from loader handle to driver handle
    void **handleOut);                //Output: Pointer to handleOut is set to driver handle if successful
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Optional driver export, named "zelDriverGetDispatchableHandleSupport",
+///        advertising dispatchable handles.
+///
+/// A driver reporting support reserves the first pointer-sized word of every
+/// handle it returns. The loader stores its dispatch table pointer there and
+/// returns the driver's handles to the application without wrapping them.
+typedef ze_result_t (ZE_APICALL *zel_pfnDriverGetDispatchableHandleSupport_t)(
+   ze_api_version_t version,        //Input: API version of the loader
+   ze_bool_t *pSupported);          //Output: set to true if handles reserve the dispatch word
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Optional driver exports, named "zeGetAllProcAddrTables",
+///        "zetGetAllProcAddrTables" and "zesGetAllProcAddrTables", filling
+///        several DDI tables of an API in a single call.
+///
+/// ppTableNames[i] names the zeGet*ProcAddrTable export whose table is
+/// written to ppTables[i], with the layout that export gives it for version.
+/// A driver that does not know one of the tables returns
+/// ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, and the loader then looks each table
+/// up through its own export.
+typedef ze_result_t (ZE_APICALL *zel_pfnGetAllProcAddrTables_t)(
+   ze_api_version_t version,        //Input: API version requested
+   uint32_t count,                  //Input: number of tables
+   const char **ppTableNames,       //Input: export name of each table
+   void **ppTables);                //Output: tables filled as their exports would
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Exported function for handling calls to released drivers in teardown.
 ///
@@ -12,6 +12,7 @@
 
 #include <memory>
 #include <fstream>
+#include <limits>
 
 
 class L0ComputeTest {
@@ -0,0 +1,136 @@
+/*
+ *
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// TEST DESCRIPTION: zeInit flags select the drivers of matching device types
+//
+// Loads the null driver copies tagged as GPU and VPU and calls zeInit once for
+// each flag given on the command line (gpu, vpu or all). After each call it
+// checks that exactly one driver per device type admitted so far is exposed,
+// and none of the others, and that the library of a type not admitted yet was
+// never opened. A later call admitting another type adds its driver:
+//     test9 gpu && test9 vpu && test9 all && test9 gpu vpu
+
+#include <stdlib.h>
+#include "zello_init.h"
+
+#include <map>
+#if !defined(_WIN32)
+#include <dlfcn.h>
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+static void set_env(const char *name, const char *value)
+{
+#if defined(_WIN32)
+    _putenv_s(name, value);
+#else
+    setenv(name, value, 1);
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Returns false when the library is known not to be loaded in the process
+static bool library_loaded(const char *path)
+{
+#if defined(_WIN32)
+    // the loader does not filter drivers by name on Windows
+    return true;
+#else
+    void *handle = dlopen(path, RTLD_LAZY | RTLD_NOLOAD);
+    if (handle == nullptr)
+        return false;
+    dlclose(handle);
+    return true;
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////
+static bool check_drivers(const std::string &mode, bool gpuAdmitted, bool vpuAdmitted)
+{
+    uint32_t driverCount = 0;
+    zeDriverGet(&driverCount, nullptr);
+    std::vector<ze_driver_handle_t> driverHandles(driverCount);
+    zeDriverGet(&driverCount, driverHandles.data());
+
+    std::map<ze_device_type_t, uint32_t> driversPerType;
+    for (auto driverHandle : driverHandles) {
+        uint32_t deviceCount = 0;
+        zeDeviceGet(driverHandle, &deviceCount, nullptr);
+        std::vector<ze_device_handle_t> devices(deviceCount);
+        zeDeviceGet(driverHandle, &deviceCount, devices.data());
+        if (deviceCount == 0)
+            continue;
+
+        ze_device_properties_t deviceProperties = {};
+        deviceProperties.stype = ZE_STRUCTURE_TYPE_DEVICE_PROPERTIES;
+        zeDeviceGetProperties(devices[0], &deviceProperties);
+        driversPerType[deviceProperties.type]++;
+    }
+
+    uint32_t gpuDrivers = driversPerType[ZE_DEVICE_TYPE_GPU];
+    uint32_t vpuDrivers = driversPerType[ZE_DEVICE_TYPE_VPU];
+    std::cout << "flags " << mode << ": " << driverCount << " drivers, "
+        << gpuDrivers << " GPU, " << vpuDrivers << " VPU" << std::endl;
+
+    if (gpuDrivers != (gpuAdmitted ? 1u : 0u) || vpuDrivers != (vpuAdmitted ? 1u : 0u) ||
+        driverCount != gpuDrivers + vpuDrivers)
+        return false;
+
+    if ((!gpuAdmitted && library_loaded(NULL_GPU_DRIVER_PATH)) ||
+        (!vpuAdmitted && library_loaded(NULL_VPU_DRIVER_PATH))) {
+        std::cout << "a driver excluded by the flags was loaded" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> modes;
+    for (int i = 1; i < argc; ++i)
+        modes.push_back(argv[i]);
+    if (modes.empty())
+        modes.push_back("all");
+
+    // only the tagged drivers take part, whatever the environment enables
+    std::string drivers = std::string(NULL_GPU_DRIVER_PATH) + "," + NULL_VPU_DRIVER_PATH;
+    set_env("ZE_ENABLE_ALT_DRIVERS", drivers.c_str());
+    set_env("ZE_ENABLE_NULL_DRIVER", "0");
+    set_env("ZE_ENABLE_LOADER_DRIVER_CACHE", "0");
+
+    bool gpuAdmitted = false;
+    bool vpuAdmitted = false;
+    for (auto &mode : modes) {
+        ze_init_flags_t flags = 0;
+        if (mode == "gpu")
+            flags = ZE_INIT_FLAG_GPU_ONLY;
+        else if (mode == "vpu")
+            flags = ZE_INIT_FLAG_VPU_ONLY;
+        else if (mode != "all") {
+            std::cout << "usage: " << argv[0] << " [gpu|vpu|all]..." << std::endl;
+            return 1;
+        }
+
+        ze_result_t result = zeInit(flags);
+        if (result != ZE_RESULT_SUCCESS) {
+            std::cout << "zeInit failed: " << to_string(result) << std::endl;
+            std::cout << "FAILED" << std::endl;
+            return 1;
+        }
+
+        gpuAdmitted = gpuAdmitted || (flags == 0) || (flags & ZE_INIT_FLAG_GPU_ONLY);
+        vpuAdmitted = vpuAdmitted || (flags == 0) || (flags & ZE_INIT_FLAG_VPU_ONLY);
+        if (!check_drivers(mode, gpuAdmitted, vpuAdmitted)) {
+            std::cout << "FAILED" << std::endl;
+            return 1;
+        }
+    }
+
+    std::cout << "PASSED" << std::endl;
+    return 0;
+}
@@ -0,0 +1,710 @@
+/*
+ *
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// BENCHMARK DESCRIPTION: loader and layer overheads on the null driver
+//
+// Runs one scenario per process, with its parameters given as name=value:
+//     zello_bench <scenario> [layers=...] [name=value]...
+// layers selects the loader and layer configuration being measured, as a
+// comma-separated list of intercept, validation, lifetime and tracing, or
+// none; each scenario has its own default. Run without arguments for the
+// list of scenarios and their parameters.
+
+#include <stdlib.h>
+#include "zello_init.h"
+#include "layers/zel_tracing_api.h"
+#include "layers/zel_tracing_register_cb.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <thread>
+
+//////////////////////////////////////////////////////////////////////////
+#define BENCH_CHECK(call)                                                  \
+    do {                                                                   \
+        ze_result_t result_ = (call);                                      \
+        if (result_ != ZE_RESULT_SUCCESS) {                                \
+            std::cout << #call << " failed: " << to_string(result_)        \
+                      << std::endl;                                        \
+            std::exit(1);                                                  \
+        }                                                                  \
+    } while (0)
+
+//////////////////////////////////////////////////////////////////////////
+static void bench_setenv(const char *name, const char *value, bool overwrite = true)
+{
+    if (!overwrite && getenv(name) != nullptr)
+        return;
+#if defined(_WIN32)
+    _putenv_s(name, value);
+#else
+    setenv(name, value, 1);
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////
+static double bench_elapsed_ns(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::nano>(
+        std::chrono::steady_clock::now() - start).count();
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Scenarios run against the null driver; the environment set before
+/// zeInit selects the loader and layer configuration being measured.
+struct bench_context_t
+{
+    ze_driver_handle_t driver = nullptr;
+    ze_device_handle_t device = nullptr;
+    ze_context_handle_t context = nullptr;
+};
+
+static bench_context_t bench_init()
+{
+    bench_setenv("ZE_ENABLE_NULL_DRIVER", "1", false);
+    BENCH_CHECK(zeInit(0));
+
+    bench_context_t bench;
+    uint32_t count = 1;
+    BENCH_CHECK(zeDriverGet(&count, &bench.driver));
+    count = 1;
+    BENCH_CHECK(zeDeviceGet(bench.driver, &count, &bench.device));
+
+    ze_context_desc_t contextDesc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC, nullptr, 0};
+    BENCH_CHECK(zeContextCreate(bench.driver, &contextDesc, &bench.context));
+    return bench;
+}
+
+static void bench_fini(bench_context_t &bench)
+{
+    BENCH_CHECK(zeContextDestroy(bench.context));
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Creates a kernel from a placeholder module, which the null driver accepts
+static ze_kernel_handle_t bench_create_kernel(bench_context_t &bench, ze_module_handle_t *phModule)
+{
+    static const uint8_t il[] = {0x03, 0x02, 0x23, 0x07};
+    ze_module_desc_t moduleDesc = {};
+    moduleDesc.stype = ZE_STRUCTURE_TYPE_MODULE_DESC;
+    moduleDesc.format = ZE_MODULE_FORMAT_IL_SPIRV;
+    moduleDesc.inputSize = sizeof(il);
+    moduleDesc.pInputModule = il;
+    BENCH_CHECK(zeModuleCreate(bench.context, bench.device, &moduleDesc, phModule, nullptr));
+
+    ze_kernel_desc_t kernelDesc = {ZE_STRUCTURE_TYPE_KERNEL_DESC, nullptr, 0, "bench"};
+    ze_kernel_handle_t kernel;
+    BENCH_CHECK(zeKernelCreate(*phModule, &kernelDesc, &kernel));
+    return kernel;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Returns the best time per zeCommandListAppendLaunchKernel, in ns, over
+/// five rounds of launches each signaling one event and waiting on waitCount
+static double bench_launch_ns(bench_context_t &bench, uint32_t waitCount, int launches)
+{
+    ze_module_handle_t module;
+    ze_kernel_handle_t kernel = bench_create_kernel(bench, &module);
+
+    ze_event_pool_desc_t poolDesc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC, nullptr, 0, waitCount + 1};
+    ze_event_pool_handle_t pool;
+    BENCH_CHECK(zeEventPoolCreate(bench.context, &poolDesc, 1, &bench.device, &pool));
+    std::vector<ze_event_handle_t> events(waitCount + 1);
+    for (uint32_t i = 0; i <= waitCount; ++i) {
+        ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC, nullptr, i, 0, 0};
+        BENCH_CHECK(zeEventCreate(pool, &eventDesc, &events[i]));
+    }
+
+    ze_command_list_desc_t listDesc = {ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC, nullptr, 0, 0};
+    ze_command_list_handle_t list;
+    BENCH_CHECK(zeCommandListCreate(bench.context, bench.device, &listDesc, &list));
+
+    ze_group_count_t groupCount = {1, 1, 1};
+    double best = 0;
+    for (int round = 0; round < 5; ++round) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < launches; ++i)
+            zeCommandListAppendLaunchKernel(list, kernel, &groupCount, events[0],
+                                            waitCount, events.data() + 1);
+        double ns = bench_elapsed_ns(start) / launches;
+        if (round == 0 || ns < best)
+            best = ns;
+    }
+
+    BENCH_CHECK(zeCommandListDestroy(list));
+    for (auto event : events)
+        BENCH_CHECK(zeEventDestroy(event));
+    BENCH_CHECK(zeEventPoolDestroy(pool));
+    BENCH_CHECK(zeKernelDestroy(kernel));
+    BENCH_CHECK(zeModuleDestroy(module));
+    return best;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// name=value parameters of a scenario
+class bench_args_t
+{
+public:
+    bench_args_t(const char *program, int argc, char *argv[])
+        : program(program)
+    {
+        for (int i = 0; i < argc; ++i) {
+            std::string arg = argv[i];
+            auto equals = arg.find('=');
+            if (equals == std::string::npos) {
+                std::cout << "parameters are given as name=value: " << arg << std::endl;
+                std::exit(1);
+            }
+            values[arg.substr(0, equals)] = arg.substr(equals + 1);
+        }
+    }
+
+    std::string str(const char *name, const char *value) const
+    {
+        auto it = values.find(name);
+        return (it != values.end()) ? it->second : value;
+    }
+
+    long get(const char *name, long value) const
+    {
+        auto it = values.find(name);
+        return (it != values.end()) ? atol(it->second.c_str()) : value;
+    }
+
+    /// comma-separated list of values, such as waits=0,1,8
+    std::vector<uint32_t> list(const char *name, const char *value) const
+    {
+        std::vector<uint32_t> result;
+        std::stringstream items(str(name, value));
+        std::string item;
+        while (std::getline(items, item, ','))
+            result.push_back(static_cast<uint32_t>(atol(item.c_str())));
+        return result;
+    }
+
+    const std::string program;  ///< path the benchmark was started with
+
+private:
+    std::map<std::string, std::string> values;
+};
+
+//////////////////////////////////////////////////////////////////////////
+static void bench_select_layers(const std::string &layers)
+{
+    std::stringstream items(layers);
+    std::string layer;
+    while (std::getline(items, layer, ',')) {
+        if (layer == "intercept") {
+            bench_setenv("ZE_ENABLE_LOADER_INTERCEPT", "1");
+        } else if (layer == "validation") {
+            bench_setenv("ZE_ENABLE_VALIDATION_LAYER", "1");
+        } else if (layer == "lifetime") {
+            bench_setenv("ZE_ENABLE_VALIDATION_LAYER", "1");
+            bench_setenv("ZE_ENABLE_HANDLE_LIFETIME", "1");
+        } else if (layer == "tracing") {
+            bench_setenv("ZE_ENABLE_TRACING_LAYER", "1");
+        } else if (layer != "none") {
+            std::cout << "unknown layer " << layer << std::endl;
+            std::exit(1);
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Each thread repeatedly creates and destroys events and a command list, so
+/// that with the loader intercepting calls every create and destroy goes
+/// through the loader's handle factories. Runs 1, 2, 4, ... up to the given
+/// number of threads and reports create/destroy pairs per second.
+static int bench_churn(const bench_args_t &args)
+{
+    int maxThreads = static_cast<int>(args.get("threads", 8));
+    long iterations = args.get("iterations", 20000);
+    bench_context_t bench = bench_init();
+
+    const uint32_t eventsPerThread = 8;
+    for (int threadCount = 1; threadCount <= maxThreads; threadCount *= 2) {
+        auto start = std::chrono::steady_clock::now();
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < threadCount; ++t) {
+            threads.emplace_back([&] {
+                ze_event_pool_desc_t poolDesc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC, nullptr, 0, eventsPerThread};
+                ze_event_pool_handle_t pool;
+                BENCH_CHECK(zeEventPoolCreate(bench.context, &poolDesc, 1, &bench.device, &pool));
+                ze_command_list_desc_t listDesc = {ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC, nullptr, 0, 0};
+
+                for (long i = 0; i < iterations; ++i) {
+                    ze_event_handle_t events[eventsPerThread];
+                    for (uint32_t e = 0; e < eventsPerThread; ++e) {
+                        ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC, nullptr, e, 0, 0};
+                        BENCH_CHECK(zeEventCreate(pool, &eventDesc, &events[e]));
+                    }
+                    ze_command_list_handle_t list;
+                    BENCH_CHECK(zeCommandListCreate(bench.context, bench.device, &listDesc, &list));
+
+                    BENCH_CHECK(zeCommandListDestroy(list));
+                    for (uint32_t e = 0; e < eventsPerThread; ++e)
+                        BENCH_CHECK(zeEventDestroy(events[e]));
+                }
+                BENCH_CHECK(zeEventPoolDestroy(pool));
+            });
+        }
+        for (auto &thread : threads)
+            thread.join();
+
+        double ns = bench_elapsed_ns(start);
+        double pairs = double(threadCount) * iterations * (eventsPerThread + 1);
+        std::cout << "threads " << threadCount << ": "
+                  << pairs / ns * 1000.0 << " M create/destroy per second" << std::endl;
+    }
+
+    bench_fini(bench);
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Appends kernel launches waiting on each given number of events to a
+/// command list, so that with the loader intercepting calls each launch
+/// translates its wait list through the loader's handle-array buffers, and
+/// with handle lifetime tracking validates the command list, kernel and
+/// event handles. Reports the time and rate of launches for each wait-list
+/// size.
+static int bench_launch(const bench_args_t &args)
+{
+    int launches = static_cast<int>(args.get("launches", 1000000));
+    bench_context_t bench = bench_init();
+
+    for (uint32_t waitCount : args.list("waits", "0,1,8,64")) {
+        double ns = bench_launch_ns(bench, waitCount, launches);
+        std::cout << "wait events " << waitCount << ": " << ns << " ns/launch, "
+                  << 1000.0 / ns << " M launches per second" << std::endl;
+    }
+
+    bench_fini(bench);
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Loads the null driver and its copies tagged as GPU and VPU, each delaying
+/// its zeInit by the given number of milliseconds, and reports how long the
+/// loader's zeInit takes compared to initializing the drivers one after the
+/// other. zeInit runs once per process, so each measurement is a separate run.
+static int bench_init_drivers(const bench_args_t &args)
+{
+    std::string delayMs = args.str("delay", "200");
+
+    std::string drivers = std::string(NULL_GPU_DRIVER_PATH) + "," + NULL_VPU_DRIVER_PATH;
+    bench_setenv("ZE_ENABLE_ALT_DRIVERS", drivers.c_str());
+    bench_setenv("ZE_ENABLE_NULL_DRIVER", "1");
+    bench_setenv("ZE_NULL_DRIVER_INIT_DELAY_MS", delayMs.c_str());
+
+    auto start = std::chrono::steady_clock::now();
+    BENCH_CHECK(zeInit(0));
+    double ms = bench_elapsed_ns(start) / 1000000.0;
+
+    uint32_t driverCount = 0;
+    BENCH_CHECK(zeDriverGet(&driverCount, nullptr));
+
+    double serialMs = driverCount * atof(delayMs.c_str());
+    std::cout << "drivers " << driverCount << ": zeInit " << ms << " ms, "
+              << serialMs << " ms of driver initialization" << std::endl;
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Has each thread repeatedly create events and a command list, append kernel
+/// launches waiting on the events, then execute and destroy everything, so
+/// that with handle lifetime tracking the tracked handles are added, looked
+/// up and removed from all threads at once. Every call must succeed; reports
+/// the launch rate.
+static int bench_stress(const bench_args_t &args)
+{
+    long threadCount = args.get("threads", 4);
+    long iterations = args.get("iterations", 2000);
+    long launchesPerList = args.get("launches", 64);
+    bench_context_t bench = bench_init();
+
+    ze_module_handle_t module;
+    ze_kernel_handle_t kernel = bench_create_kernel(bench, &module);
+
+    const uint32_t eventsPerList = 8;
+    std::atomic<long> launches{0};
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> threads;
+    for (long t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&] {
+            ze_event_pool_desc_t poolDesc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC, nullptr, 0, eventsPerList};
+            ze_event_pool_handle_t pool;
+            BENCH_CHECK(zeEventPoolCreate(bench.context, &poolDesc, 1, &bench.device, &pool));
+            ze_command_queue_desc_t queueDesc = {};
+            queueDesc.stype = ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC;
+            ze_command_queue_handle_t queue;
+            BENCH_CHECK(zeCommandQueueCreate(bench.context, bench.device, &queueDesc, &queue));
+            ze_command_list_desc_t listDesc = {ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC, nullptr, 0, 0};
+            ze_group_count_t groupCount = {1, 1, 1};
+
+            for (long i = 0; i < iterations; ++i) {
+                ze_event_handle_t events[eventsPerList];
+                for (uint32_t e = 0; e < eventsPerList; ++e) {
+                    ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC, nullptr, e, 0, 0};
+                    BENCH_CHECK(zeEventCreate(pool, &eventDesc, &events[e]));
+                }
+                ze_command_list_handle_t list;
+                BENCH_CHECK(zeCommandListCreate(bench.context, bench.device, &listDesc, &list));
+
+                for (long l = 0; l < launchesPerList; ++l)
+                    BENCH_CHECK(zeCommandListAppendLaunchKernel(list, kernel, &groupCount, events[0],
+                                                                eventsPerList - 1, &events[1]));
+                BENCH_CHECK(zeCommandListClose(list));
+                BENCH_CHECK(zeCommandQueueExecuteCommandLists(queue, 1, &list, nullptr));
+
+                BENCH_CHECK(zeCommandListDestroy(list));
+                for (uint32_t e = 0; e < eventsPerList; ++e)
+                    BENCH_CHECK(zeEventDestroy(events[e]));
+                launches += launchesPerList;
+            }
+
+            BENCH_CHECK(zeCommandQueueDestroy(queue));
+            BENCH_CHECK(zeEventPoolDestroy(pool));
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+    double ns = bench_elapsed_ns(start);
+
+    std::cout << "threads " << threadCount << ": " << launches.load() << " launches, "
+              << launches.load() / ns * 1000.0 << " M launches per second" << std::endl;
+
+    BENCH_CHECK(zeKernelDestroy(kernel));
+    BENCH_CHECK(zeModuleDestroy(module));
+    bench_fini(bench);
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+static long epilogueCount = 0;
+
+static void signalPrologue(ze_event_host_signal_params_t *params, ze_result_t result,
+                           void *pTracerUserData, void **ppTracerInstanceUserData)
+{
+    *ppTracerInstanceUserData = pTracerUserData;
+}
+
+static void signalEpilogue(ze_event_host_signal_params_t *params, ze_result_t result,
+                           void *pTracerUserData, void **ppTracerInstanceUserData)
+{
+    ++*static_cast<long *>(*ppTracerInstanceUserData);
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Times zeEventHostSignal, which does no work of its own on the null driver,
+/// with each given number of tracers, each registering a prologue that passes
+/// per-call user data to its epilogue, and checks every callback ran. Then
+/// checks that a call made after zelSetDriverTeardown is rejected rather
+/// than dispatched. Tracers need layers=tracing.
+static int bench_call(const bench_args_t &args)
+{
+    long calls = args.get("calls", 10000000);
+    bench_context_t bench = bench_init();
+
+    ze_event_pool_desc_t poolDesc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC, nullptr, 0, 1};
+    ze_event_pool_handle_t pool;
+    BENCH_CHECK(zeEventPoolCreate(bench.context, &poolDesc, 1, &bench.device, &pool));
+    ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC, nullptr, 0, 0, 0};
+    ze_event_handle_t event;
+    BENCH_CHECK(zeEventCreate(pool, &eventDesc, &event));
+
+    std::vector<zel_tracer_handle_t> tracers;
+    for (uint32_t tracerCount : args.list("tracers", "0")) {
+        while (tracers.size() < tracerCount) {
+            zel_tracer_desc_t tracerDesc = {ZEL_STRUCTURE_TYPE_TRACER_EXP_DESC, nullptr, &epilogueCount};
+            zel_tracer_handle_t tracer;
+            BENCH_CHECK(zelTracerCreate(&tracerDesc, &tracer));
+            BENCH_CHECK(zelTracerEventHostSignalRegisterCallback(tracer, ZEL_REGISTER_PROLOGUE, signalPrologue));
+            BENCH_CHECK(zelTracerEventHostSignalRegisterCallback(tracer, ZEL_REGISTER_EPILOGUE, signalEpilogue));
+            BENCH_CHECK(zelTracerSetEnabled(tracer, true));
+            tracers.push_back(tracer);
+        }
+
+        double best = 0;
+        for (int round = 0; round < 5; ++round) {
+            epilogueCount = 0;
+            auto start = std::chrono::steady_clock::now();
+            for (long i = 0; i < calls; ++i)
+                zeEventHostSignal(event);
+            double ns = bench_elapsed_ns(start) / calls;
+            if (round == 0 || ns < best)
+                best = ns;
+
+            if (epilogueCount != calls * static_cast<long>(tracers.size())) {
+                std::cout << "expected " << calls * tracers.size() << " epilogues, got "
+                          << epilogueCount << std::endl;
+                return 1;
+            }
+        }
+        std::cout << "tracers " << tracers.size() << ": " << best << " ns/call" << std::endl;
+    }
+
+    for (auto tracer : tracers) {
+        BENCH_CHECK(zelTracerSetEnabled(tracer, false));
+        BENCH_CHECK(zelTracerDestroy(tracer));
+    }
+
+    zelSetDriverTeardown();
+    if (zeEventHostSignal(event) == ZE_RESULT_SUCCESS) {
+        std::cout << "call after teardown was dispatched" << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+static std::atomic<long> prologueCount{0};
+
+static void countingPrologue(ze_event_host_signal_params_t *params, ze_result_t result,
+                             void *pTracerUserData, void **ppTracerInstanceUserData)
+{
+    if (pTracerUserData != nullptr)
+        prologueCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+/// enabled tracer counting the calls it sees when pUserData is not null
+static zel_tracer_handle_t bench_create_tracer(void *pUserData)
+{
+    zel_tracer_desc_t tracerDesc = {ZEL_STRUCTURE_TYPE_TRACER_EXP_DESC, nullptr, pUserData};
+    zel_tracer_handle_t tracer;
+    BENCH_CHECK(zelTracerCreate(&tracerDesc, &tracer));
+    BENCH_CHECK(zelTracerEventHostSignalRegisterCallback(tracer, ZEL_REGISTER_PROLOGUE, countingPrologue));
+    BENCH_CHECK(zelTracerSetEnabled(tracer, true));
+    return tracer;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Starts the given number of threads making traced zeEventHostSignal calls,
+/// then repeatedly enables a second tracer, disables and destroys it, and
+/// reports the median and worst time of the disable and destroy.
+static int bench_tracer_destroy(const bench_args_t &args)
+{
+    long threadCount = args.get("threads", 1000);
+    long repetitions = args.get("repetitions", 20);
+    bench_context_t bench = bench_init();
+
+    ze_event_pool_desc_t poolDesc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC, nullptr, 0, 1};
+    ze_event_pool_handle_t pool;
+    BENCH_CHECK(zeEventPoolCreate(bench.context, &poolDesc, 1, &bench.device, &pool));
+    ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC, nullptr, 0, 0, 0};
+    ze_event_handle_t event;
+    BENCH_CHECK(zeEventCreate(pool, &eventDesc, &event));
+
+    zel_tracer_handle_t baseTracer = bench_create_tracer(&prologueCount);
+
+    std::atomic<bool> stop{false};
+    std::vector<std::thread> threads;
+    for (long t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&] {
+            while (!stop.load(std::memory_order_relaxed)) {
+                for (int i = 0; i < 100; ++i)
+                    zeEventHostSignal(event);
+                std::this_thread::yield();
+            }
+        });
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+    std::vector<double> latencies;
+    for (long r = 0; r < repetitions; ++r) {
+        zel_tracer_handle_t tracer = bench_create_tracer(&prologueCount);
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+        auto start = std::chrono::steady_clock::now();
+        BENCH_CHECK(zelTracerSetEnabled(tracer, false));
+        BENCH_CHECK(zelTracerDestroy(tracer));
+        latencies.push_back(bench_elapsed_ns(start) / 1000.0);
+    }
+
+    stop = true;
+    for (auto &thread : threads)
+        thread.join();
+
+    std::sort(latencies.begin(), latencies.end());
+    std::cout << "threads " << threadCount << ": disable and destroy median "
+              << latencies[latencies.size() / 2] << " us, worst " << latencies.back()
+              << " us (" << prologueCount.load() << " traced calls)" << std::endl;
+
+    BENCH_CHECK(zelTracerSetEnabled(baseTracer, false));
+    BENCH_CHECK(zelTracerDestroy(baseTracer));
+    BENCH_CHECK(zeEventDestroy(event));
+    BENCH_CHECK(zeEventPoolDestroy(pool));
+    bench_fini(bench);
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Has several spawning threads each start and join a series of short-lived
+/// threads that make a few traced zeEventHostSignal calls, so that every
+/// thread registers with the tracing layer and leaves it. Meanwhile another
+/// tracer is enabled and disabled in a loop. Reports the time per short-lived
+/// thread and checks that all of their calls were traced.
+static int bench_thread_churn(const bench_args_t &args)
+{
+    long spawners = args.get("spawners", 4);
+    long threadsPerSpawner = args.get("threads", 5000);
+    long callsPerThread = args.get("calls", 10);
+    bench_context_t bench = bench_init();
+
+    ze_event_pool_desc_t poolDesc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC, nullptr, 0, 1};
+    ze_event_pool_handle_t pool;
+    BENCH_CHECK(zeEventPoolCreate(bench.context, &poolDesc, 1, &bench.device, &pool));
+    ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC, nullptr, 0, 0, 0};
+    ze_event_handle_t event;
+    BENCH_CHECK(zeEventCreate(pool, &eventDesc, &event));
+
+    prologueCount = 0;
+    zel_tracer_handle_t tracer = bench_create_tracer(&prologueCount);
+
+    // retiring the toggled tracer's callbacks scans the registered threads
+    std::atomic<bool> stop{false};
+    std::thread toggler([&] {
+        while (!stop) {
+            zel_tracer_handle_t toggled = bench_create_tracer(nullptr);
+            BENCH_CHECK(zelTracerSetEnabled(toggled, false));
+            BENCH_CHECK(zelTracerDestroy(toggled));
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+    });
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> spawnerThreads;
+    for (long s = 0; s < spawners; ++s) {
+        spawnerThreads.emplace_back([&] {
+            for (long i = 0; i < threadsPerSpawner; ++i) {
+                std::thread([&] {
+                    for (long c = 0; c < callsPerThread; ++c)
+                        zeEventHostSignal(event);
+                }).join();
+            }
+        });
+    }
+    for (auto &thread : spawnerThreads)
+        thread.join();
+    double ns = bench_elapsed_ns(start);
+
+    stop = true;
+    toggler.join();
+
+    long threadCount = spawners * threadsPerSpawner;
+    std::cout << "threads " << threadCount << ": " << ns / threadCount / 1000.0
+              << " us per thread" << std::endl;
+
+    BENCH_CHECK(zelTracerSetEnabled(tracer, false));
+    BENCH_CHECK(zelTracerDestroy(tracer));
+    BENCH_CHECK(zeEventDestroy(event));
+    BENCH_CHECK(zeEventPoolDestroy(pool));
+    bench_fini(bench);
+
+    if (prologueCount != threadCount * callsPerThread) {
+        std::cout << "expected " << threadCount * callsPerThread << " traced calls, got "
+                  << prologueCount << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+#if !defined(_WIN32)
+//////////////////////////////////////////////////////////////////////////
+static double bench_median_ms(std::vector<double> &times)
+{
+    std::sort(times.begin(), times.end());
+    return times[times.size() / 2] / 1000000.0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Runs itself repeatedly as a child process that only calls zeInit on the
+/// null driver, with the loader's driver-discovery cache enabled, and reports
+/// the median wall time of the children started without a cache file and of
+/// those started once the cache records the absent known drivers.
+static int bench_startup(const bench_args_t &args)
+{
+    if (args.get("child", 0)) {
+        bench_setenv("ZE_ENABLE_NULL_DRIVER", "1");
+        return (zeInit(0) == ZE_RESULT_SUCCESS) ? 0 : 1;
+    }
+
+    long runs = args.get("runs", 20);
+
+    std::string cachePath = args.program + ".driver_cache";
+    bench_setenv("ZE_ENABLE_LOADER_DRIVER_CACHE", "1");
+    bench_setenv("ZE_LOADER_DRIVER_CACHE_PATH", cachePath.c_str());
+
+    std::string child = "\"" + args.program + "\" startup child=1";
+    std::vector<double> coldTimes, warmTimes;
+    for (long run = 0; run < runs; ++run) {
+        for (bool warm : {false, true}) {
+            if (!warm)
+                remove(cachePath.c_str());
+            auto start = std::chrono::steady_clock::now();
+            if (system(child.c_str()) != 0) {
+                std::cout << "child zeInit failed" << std::endl;
+                return 1;
+            }
+            (warm ? warmTimes : coldTimes).push_back(bench_elapsed_ns(start));
+        }
+    }
+    remove(cachePath.c_str());
+
+    std::cout << "cold cache: " << bench_median_ms(coldTimes) << " ms, warm cache: "
+              << bench_median_ms(warmTimes) << " ms per process" << std::endl;
+    return 0;
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+struct bench_scenario_t
+{
+    const char *name;
+    const char *layers;     ///< layers measured unless given
+    const char *parameters; ///< parameters and their defaults
+    int (*run)(const bench_args_t &args);
+};
+
+static const bench_scenario_t scenarios[] = {
+    {"churn", "intercept", "threads=8 iterations=20000", bench_churn},
+    {"launch", "intercept", "launches=1000000 waits=0,1,8,64", bench_launch},
+    {"stress", "lifetime", "threads=4 iterations=2000 launches=64", bench_stress},
+    {"call", "none", "calls=10000000 tracers=0", bench_call},
+    {"tracer_destroy", "tracing", "threads=1000 repetitions=20", bench_tracer_destroy},
+    {"thread_churn", "tracing", "spawners=4 threads=5000 calls=10", bench_thread_churn},
+    {"init", "none", "delay=200", bench_init_drivers},
+#if !defined(_WIN32)
+    {"startup", "none", "runs=20", bench_startup},
+#endif
+};
+
+int main(int argc, char *argv[])
+{
+    for (auto &scenario : scenarios) {
+        if (argc < 2 || scenario.name != std::string(argv[1]))
+            continue;
+
+        bench_args_t args(argv[0], argc - 2, argv + 2);
+        bench_select_layers(args.str("layers", scenario.layers));
+        return scenario.run(args);
+    }
+
+    std::cout << "usage: " << argv[0] << " <scenario> [layers=...] [name=value]..." << std::endl;
+    for (auto &scenario : scenarios)
+        std::cout << "    " << scenario.name << " layers=" << scenario.layers << " "
+                  << scenario.parameters << std::endl;
+    return 1;
+}
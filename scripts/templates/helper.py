@@ -1611,6 +1611,7 @@ def make_tracing_func_name(namespace, tags, obj):
     x_tag = tags['$x']
     tags['$x'] = '' #temporaly remove namespace tag so funx doesn't contain "ze"
     fname =  subt(namespace, tags, "%s%s"%(cname, obj['name']), cpp=False)
+    fname = fname[0].upper() + fname[1:] # i.e., "zesDeviceGet" -> "ZesDeviceGet"
     fname = "zelTracer" + fname + "RegisterCallback" 
     tags['$x'] = x_tag
     return fname
@@ -1825,7 +1826,10 @@ def get_zel_pfncbtables(specs, meta, namespace, tags):
         objs = get_class_function_objs(specs, cname, 1.0, 9999)
         if len(objs) > 0:
             name = get_table_name(namespace, tags, {'class': cname})
-            table = "zel_%s_callbacks_t"%(_camel_to_snake(name))
+            if namespace == tags['$x']:
+                table = "zel_%s_callbacks_t"%(_camel_to_snake(name))
+            else:
+                table = "zel_%s_%s_callbacks_t"%(namespace, _camel_to_snake(name))
             tables.append({
                 'name': name, 
                 'type': table,
@@ -1834,6 +1838,23 @@ def get_zel_pfncbtables(specs, meta, namespace, tags):
     return tables
 
 
+"""
+Public:
+    returns the group of the tracing layer's callbacks holding a namespace's
+    callbacks, i.e., "core", "tools" or "sysman"
+"""
+def get_tracing_callbacks_group(namespace):
+    return {"ze": "core", "zet": "tools", "zes": "sysman"}[namespace]
+
+"""
+Public:
+    returns the name of the header declaring a namespace's tracing callbacks
+"""
+def get_tracing_register_cb_header(namespace, tags):
+    if namespace == tags['$x']:
+        return "zel_tracing_register_cb"
+    return "zel_tracing_register_cb_%s"%namespace
+
 """
 Public:
     returns a list of dict of each pfntables for all APIs introduced after 1.0
@@ -1890,6 +1911,59 @@ def get_loader_prologue(namespace, tags, obj, meta):
 
     return prologue
 
+"""
+Public:
+    returns the names of the handles passed by value to a function, at most
+    max_count, as recorded by the tracing layer's trace recorder
+"""
+def get_trace_handle_params(namespace, tags, obj, max_count=4):
+    names = []
+    for item in obj['params']:
+        if (type_traits.is_handle(item['type']) and
+                not type_traits.is_ipc_handle(item['type']) and
+                not type_traits.is_pointer(item['type'])):
+            names.append(subt(namespace, tags, item['name']))
+    return names[:max_count]
+
+"""
+Public:
+    returns the indices of the parameters pointing to a single output handle,
+    which the tracing layer copies for asynchronous epilogues, or None if the
+    function has other pointer outputs
+"""
+def get_epilogue_out_handle_params(namespace, tags, obj):
+    indices = []
+    for i, item in enumerate(obj['params']):
+        if not (param_traits.is_output(item) or param_traits.is_inoutput(item)):
+            continue
+        if (param_traits.is_output(item) and
+                not param_traits.is_range(item) and
+                type_traits.is_handle(item['type']) and
+                not type_traits.is_ipc_handle(item['type']) and
+                re.match(r"^\$?\w+handle_t\*$", item['type'])):
+            indices.append(i)
+        else:
+            return None
+    return indices
+
+"""
+Public:
+    returns the indices of the input parameters pointing to caller-owned
+    structures, arrays or strings, which asynchronous epilogues receive as
+    nullptr; void pointers keep their address
+"""
+def get_epilogue_in_pointer_params(namespace, tags, obj):
+    indices = []
+    for i, item in enumerate(obj['params']):
+        if param_traits.is_output(item) or param_traits.is_inoutput(item):
+            continue
+        if not type_traits.is_pointer(item['type']):
+            continue
+        if re.match(r"^(const\s+)?void\*$", item['type']):
+            continue
+        indices.append(i)
+    return indices
+
 """
 Public:
     returns a list of dict for converting loader output parameters
@@ -1931,6 +2005,50 @@ def get_loader_epilogue(namespace, tags, obj, meta):
 
     return epilogue
 
+"""
+Public:
+    returns the name of the input handle owning the objects created by the
+    function, or None; loader handles of owned objects are released along
+    with the loader handle of their owner
+"""
+def get_loader_owner(namespace, tags, obj, meta):
+    if not re.match(r"\w+(Create|Open)\w*$", make_func_name(namespace, tags, obj)):
+        return None
+
+    prologue = get_loader_prologue(namespace, tags, obj, meta)
+    if not prologue or 'range' in prologue[0] or prologue[0]['optional']:
+        return None
+
+    # drivers and devices are enumerated, never destroyed
+    if re.match(r"\w+_(driver|device)_object_t$", prologue[0]['obj']):
+        return None
+
+    return prologue[0]['name']
+
+"""
+Public:
+    returns the link the loader keeps in the objects of the given handle type:
+    owners keep a list of the objects created under them, objects created
+    under an owner only link to it, and all other objects keep none
+"""
+def get_loader_link_type(namespace, tags, specs, meta, handle_type):
+    owners = set()
+    owned = set()
+    for obj in extract_objs(specs, r"function"):
+        if not get_loader_owner(namespace, tags, obj, meta):
+            continue
+        owners.add(get_loader_prologue(namespace, tags, obj, meta)[0]['obj'])
+        for item in get_loader_epilogue(namespace, tags, obj, meta):
+            if not item['release']:
+                owned.add(item['obj'])
+
+    obj_type = re.sub(r"(\w+)_handle_t", r"\1_object_t", handle_type)
+    if obj_type in owners:
+        return "object_owner_link_t"
+    if obj_type in owned:
+        return "object_link_t"
+    return "void"
+
 """
 Public:
     returns true if proc table is added after 1.0
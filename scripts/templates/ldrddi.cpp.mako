@@ -34,6 +34,28 @@ namespace loader
     ///////////////////////////////////////////////////////////////////////////////
     std::unordered_map<ze_image_object_t *, ze_image_handle_t>            image_handle_map;
     std::unordered_map<ze_sampler_object_t *, ze_sampler_handle_t>        sampler_handle_map;
+    std::mutex                                                            handle_map_mutex; ///< guards both maps
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// images and samplers released along with their context also leave the
+    /// kernel argument maps
+    static void releaseImageLink( object_link_t* _link )
+    {
+        {
+            std::lock_guard<std::mutex> lock( handle_map_mutex );
+            image_handle_map.erase( ze_image_object_t::fromLink( _link ) );
+        }
+        ze_image_object_t::releaseLink( _link );
+    }
+
+    static void releaseSamplerLink( object_link_t* _link )
+    {
+        {
+            std::lock_guard<std::mutex> lock( handle_map_mutex );
+            sampler_handle_map.erase( ze_sampler_object_t::fromLink( _link ) );
+        }
+        ze_sampler_object_t::releaseLink( _link );
+    }
     %endif
 
     %for obj in th.extract_objs(specs, r"function"):
@@ -51,7 +73,6 @@ namespace loader
     {
         ${x}_result_t result = ${X}_RESULT_SUCCESS;<%
         add_local = False
-        arrays_to_delete = []
     %>
 
         %if re.match(r"Init", obj['name']):
@@ -60,9 +81,16 @@ namespace loader
         {
             if(drv.initStatus != ZE_RESULT_SUCCESS)
                 continue;
+            %if n == "ze":
+            // a driver stays in use when a later call admits other device
+            // types only; the first call's rejections were dropped by the loader
+            if(drv.dditable.${n}.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} ) == ZE_RESULT_SUCCESS)
+                atLeastOneDriverValid = true;
+            %else:
             drv.initStatus = drv.dditable.${n}.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
             if(drv.initStatus == ZE_RESULT_SUCCESS)
                 atLeastOneDriverValid = true;
+            %endif
         }
 
         if(!atLeastOneDriverValid)
@@ -96,8 +124,8 @@ namespace loader
                 {
                     for( uint32_t i = 0; i < library_driver_handle_count; ++i ) {
                         uint32_t driver_index = total_driver_handle_count + i;
-                        ${obj['params'][1]['name']}[ driver_index ] = reinterpret_cast<${n}_driver_handle_t>(
-                            ${n}_driver_factory.getInstance( ${obj['params'][1]['name']}[ driver_index ], &drv.dditable ) );
+                        ${obj['params'][1]['name']}[ driver_index ] = ${n}_driver_object_t::wrap(
+                            ${n}_driver_factory, ${obj['params'][1]['name']}[ driver_index ], &drv.dditable );
                     }
                 }
                 catch( std::bad_alloc& )
@@ -113,6 +141,11 @@ namespace loader
             *${obj['params'][0]['name']} = total_driver_handle_count;
 
         %else:
+<%
+        owner = th.get_loader_owner(n, tags, obj, meta)
+        owner_arg = ", %s::owner( %sLoader, dditable )" % (th.get_loader_prologue(n, tags, obj, meta)[0]['obj'], owner) if owner else ""
+        released = [item['name'] for item in th.get_loader_epilogue(n, tags, obj, meta) if item['release']]
+%>\
         %for i, item in enumerate(th.get_loader_prologue(n, tags, obj, meta)):
         %if 0 == i:
         // extract driver's function pointer table
@@ -125,26 +158,35 @@ namespace loader
         %if 'range' in item:
         <%
         add_local = True%>// convert loader handles to driver handles
-        auto ${item['name']}Local = new ${item['type']} [${item['range'][1]}];
-        <%
-        arrays_to_delete.append(item['name']+ 'Local')
-        %>for( size_t i = ${item['range'][0]}; ( nullptr != ${item['name']} ) && ( i < ${item['range'][1]} ); ++i )
-            ${item['name']}Local[ i ] = reinterpret_cast<${item['obj']}*>( ${item['name']}[ i ] )->handle;
+        handle_array_t<${item['type']}> ${item['name']}Local( ${item['range'][1]} );
+        for( size_t i = ${item['range'][0]}; ( nullptr != ${item['name']} ) && ( i < ${item['range'][1]} ); ++i )
+            ${item['name']}Local[ i ] = ${item['obj']}::unwrap( ${item['name']}[ i ], dditable );
         %else:
         %if item['optional']:
         // convert loader handle to driver handle
-        ${item['name']} = ( ${item['name']} ) ? reinterpret_cast<${item['obj']}*>( ${item['name']} )->handle : nullptr;
+        ${item['name']} = ( ${item['name']} ) ? ${item['obj']}::unwrap( ${item['name']}, dditable ) : nullptr;
         %else:
         %if re.match(r"\w+ImageDestroy$", th.make_func_name(n, tags, obj)):
         // remove the handle from the kernel arugment map
-        image_handle_map.erase(reinterpret_cast<ze_image_object_t*>(hImage));
+        {
+            std::lock_guard<std::mutex> lock( handle_map_mutex );
+            image_handle_map.erase(reinterpret_cast<ze_image_object_t*>(hImage));
+        }
         %endif
         %if re.match(r"\w+SamplerDestroy$", th.make_func_name(n, tags, obj)):
         // remove the handle from the kernel arugment map
-        sampler_handle_map.erase(reinterpret_cast<ze_sampler_object_t*>(hSampler));
+        {
+            std::lock_guard<std::mutex> lock( handle_map_mutex );
+            sampler_handle_map.erase(reinterpret_cast<ze_sampler_object_t*>(hSampler));
+        }
+        %endif
+        %if item['name'] == owner or item['name'] in released:
+        // keep the loader handle, which tracks the loader handles created under it
+        auto ${item['name']}Loader = ${item['name']};
+
         %endif
         // convert loader handle to driver handle
-        ${item['name']} = reinterpret_cast<${item['obj']}*>( ${item['name']} )->handle;
+        ${item['name']} = ${item['obj']}::unwrap( ${item['name']}, dditable );
         %endif
         %endif
 
@@ -152,23 +194,29 @@ namespace loader
         %if re.match(r"\w+KernelSetArgumentValue$", th.make_func_name(n, tags, obj)):
         // convert pArgValue to correct handle if applicable
         void *internalArgValue = const_cast<void *>(pArgValue);
-        if (pArgValue) {
-            // check if the arg value is a translated handle
+        void *internalHandle = nullptr;
+        if( pArgValue && !dditable->dispatchable ) {
+            // check if the arg value is a translated handle; the driver handle
+            // is copied out, since the map may change once the lock is dropped
             ze_image_object_t **imageHandle = static_cast<ze_image_object_t **>(internalArgValue);
             ze_sampler_object_t **samplerHandle = static_cast<ze_sampler_object_t **>(internalArgValue);
-            if( image_handle_map.find(*imageHandle) != image_handle_map.end() ) {
-                internalArgValue = &image_handle_map[*imageHandle];
-            } else if( sampler_handle_map.find(*samplerHandle) != sampler_handle_map.end() ) {
-                internalArgValue = &sampler_handle_map[*samplerHandle];
+            std::lock_guard<std::mutex> lock( handle_map_mutex );
+            auto image = image_handle_map.find(*imageHandle);
+            if( image != image_handle_map.end() ) {
+                internalHandle = image->second;
+                internalArgValue = &internalHandle;
+            } else {
+                auto sampler = sampler_handle_map.find(*samplerHandle);
+                if( sampler != sampler_handle_map.end() ) {
+                    internalHandle = sampler->second;
+                    internalArgValue = &internalHandle;
+                }
             }
         }
         %endif
         // forward to device-driver
         %if add_local:
         result = ${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name", "local"]))} );
-        %for array_name in arrays_to_delete:
-        delete []${array_name};
-        %endfor
         %else:
         %if re.match(r"\w+KernelSetArgumentValue$", th.make_func_name(n, tags, obj)):
         result = pfnSetArgumentValue( hKernel, argIndex, argSize, const_cast<const void *>(internalArgValue) );
@@ -177,7 +225,6 @@ namespace loader
         %endif
         %endif
 <%
-        del arrays_to_delete
         del add_local%>
         %for i, item in enumerate(th.get_loader_epilogue(n, tags, obj, meta)):
         %if 0 == i:
@@ -187,34 +234,43 @@ namespace loader
         %endif
         %if item['release']:
         // release loader handle
-        ${item['factory']}.release( ${item['name']} );
+        ${item['obj']}::release( ${item['factory']}, ${item['name']}Loader, dditable );
         %else:
         try
         {
             %if 'range' in item:
             // convert driver handles to loader handles
             for( size_t i = ${item['range'][0]}; ( nullptr != ${item['name']} ) && ( i < ${item['range'][1]} ); ++i )
-                ${item['name']}[ i ] = reinterpret_cast<${item['type']}>(
-                    ${item['factory']}.getInstance( ${item['name']}[ i ], dditable ) );
+                ${item['name']}[ i ] = ${item['obj']}::wrap( ${item['factory']}, ${item['name']}[ i ], dditable );
             %else:
             // convert driver handle to loader handle
             %if item['optional']:
             if( nullptr != ${item['name']} )
-                *${item['name']} = reinterpret_cast<${item['type']}>(
-                    ${item['factory']}.getInstance( *${item['name']}, dditable ) );
+                *${item['name']} = ${item['obj']}::wrap( ${item['factory']}, *${item['name']}, dditable${owner_arg} );
             %else:
             %if re.match(r"\w+ImageCreate$", th.make_func_name(n, tags, obj)) or re.match(r"\w+SamplerCreate$", th.make_func_name(n, tags, obj)) or re.match(r"\w+ImageViewCreateExp$", th.make_func_name(n, tags, obj)):
             ${item['type']} internalHandlePtr = *${item['name']};
             %endif
-            *${item['name']} = reinterpret_cast<${item['type']}>(
-                ${item['factory']}.getInstance( *${item['name']}, dditable ) );
+            %if re.match(r"\w+ImageCreate$", th.make_func_name(n, tags, obj)) or re.match(r"\w+ImageViewCreateExp$", th.make_func_name(n, tags, obj)):
+            *${item['name']} = ${item['obj']}::wrap( ${item['factory']}, *${item['name']}, dditable${owner_arg if owner else ", nullptr"}, releaseImageLink );
+            %elif re.match(r"\w+SamplerCreate$", th.make_func_name(n, tags, obj)):
+            *${item['name']} = ${item['obj']}::wrap( ${item['factory']}, *${item['name']}, dditable${owner_arg if owner else ", nullptr"}, releaseSamplerLink );
+            %else:
+            *${item['name']} = ${item['obj']}::wrap( ${item['factory']}, *${item['name']}, dditable${owner_arg} );
+            %endif
             %if re.match(r"\w+ImageCreate$", th.make_func_name(n, tags, obj)) or re.match(r"\w+ImageViewCreateExp$", th.make_func_name(n, tags, obj)):
             // convert loader handle to driver handle and store in map
-            image_handle_map.insert({ze_image_factory.getInstance( internalHandlePtr, dditable ), internalHandlePtr});
+            if( !dditable->dispatchable ) {
+                std::lock_guard<std::mutex> lock( handle_map_mutex );
+                image_handle_map[reinterpret_cast<ze_image_object_t*>( *${item['name']} )] = internalHandlePtr;
+            }
             %endif
             %if re.match(r"\w+SamplerCreate$", th.make_func_name(n, tags, obj)):
             // convert loader handle to driver handle and store in map
-            sampler_handle_map.insert({ze_sampler_factory.getInstance( internalHandlePtr, dditable ), internalHandlePtr});
+            if( !dditable->dispatchable ) {
+                std::lock_guard<std::mutex> lock( handle_map_mutex );
+                sampler_handle_map[reinterpret_cast<ze_sampler_object_t*>( *${item['name']} )] = internalHandlePtr;
+            }
             %endif
             %endif
             %endif
@@ -234,6 +290,53 @@ namespace loader
     %endif
 
     %endfor
+    ///////////////////////////////////////////////////////////////////////////////
+    /// fills the ${n} tables of a driver through its optional bulk export, once,
+    /// when they are first requested; tables of drivers without it are looked
+    /// up one by one
+    static void ${n}LoadAllDriverTables( driver_t& drv )
+    {
+        if( drv.${n}AllTablesRequested )
+            return;
+        drv.${n}AllTablesRequested = true;
+
+        auto getAllTables = reinterpret_cast<zel_pfnGetAllProcAddrTables_t>(
+            GET_FUNCTION_PTR( drv.handle, "${n}GetAllProcAddrTables") );
+        if( !getAllTables )
+            return;
+
+        const char *tableNames[] = {
+            %for tbl in th.get_pfntables(specs, meta, n, tags):
+            "${tbl['export']['name']}",
+            %endfor
+        };
+        void *tables[] = {
+            %for tbl in th.get_pfntables(specs, meta, n, tags):
+            &drv.dditable.${n}.${tbl['name']},
+            %endfor
+        };
+        auto count = static_cast<uint32_t>( sizeof( tables ) / sizeof( tables[ 0 ] ) );
+        drv.${n}TablesLoaded = ( ${X}_RESULT_SUCCESS == getAllTables( loader::context->version, count, tableNames, tables ) );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// fills the tables of a driver loaded by a later zeInit, after the
+    /// exports below may already have run
+    void ${n}LoadDriverTables( driver_t& drv )
+    {
+        ${n}LoadAllDriverTables( drv );
+        if( drv.${n}TablesLoaded )
+            return;
+
+        %for tbl in th.get_pfntables(specs, meta, n, tags):
+        auto get${tbl['name']}Table = reinterpret_cast<${tbl['pfn']}>(
+            GET_FUNCTION_PTR( drv.handle, "${tbl['export']['name']}") );
+        if( get${tbl['name']}Table )
+            get${tbl['name']}Table( loader::context->version, &drv.dditable.${n}.${tbl['name']} );
+        %endfor
+        drv.${n}TablesLoaded = true;
+    }
+
 } // namespace loader
 
 #if defined(__cplusplus)
@@ -274,6 +377,13 @@ ${tbl['export']['name']}(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::${n}LoadAllDriverTables( drv );
+        if(drv.${n}TablesLoaded)
+        {
+            // already filled by the driver's ${n}GetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<${tbl['pfn']}>(
             GET_FUNCTION_PTR( drv.handle, "${tbl['export']['name']}") );
         if(!getTable) 
@@ -304,7 +414,7 @@ ${tbl['export']['name']}(
 
     if( ${X}_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             %for obj in tbl['functions']:
@@ -337,8 +447,10 @@ ${tbl['export']['name']}(
     }
 
     %if namespace == "ze":
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
-    if(( ${X}_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    // If the API tracing layer is enabled, then intercept the loader's DDIs,
+    // unless ze_lib is filling its pass-through tables
+    if(( ${X}_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ) &&
+        !loader::context_t::passThroughTables )
     {
         auto getTable = reinterpret_cast<${tbl['pfn']}>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "${tbl['export']['name']}") );
@@ -27,9 +27,12 @@ namespace loader
         _handle_t = th.subt(n, tags, obj['name'])
         _object_t = re.sub(r"(\w+)_handle_t", r"\1_object_t", _handle_t)
         _factory_t = re.sub(r"(\w+)_handle_t", r"\1_factory_t", _handle_t)
-    %>using ${th.append_ws(_object_t, 35)} = object_t < ${_handle_t} >;
+        _link_t = th.get_loader_link_type(n, tags, specs, meta, _handle_t)
+    %>using ${th.append_ws(_object_t, 35)} = object_t < ${_handle_t}, ${_link_t} >;
     using ${th.append_ws(_factory_t, 35)} = singleton_factory_t < ${_object_t}, ${_handle_t} >;
 
     %endif
     %endfor
+    struct driver_t;
+    void ${n}LoadDriverTables( driver_t& drv );
 }
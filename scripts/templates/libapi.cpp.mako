@@ -55,29 +55,49 @@ ${th.make_func_name(n, tags, obj)}(
     )
 {
 %if re.match("Init", obj['name']):
-    static ${x}_result_t result = ${X}_RESULT_SUCCESS;
-    std::call_once(${x}_lib::context->initOnce, [flags]() {
-%if re.match("zes", n): 
-        result = ${x}_lib::context->Init(flags, true);
+%if re.match("zes", n):
+    bool sysmanOnly = true;
 %else:
-        result = ${x}_lib::context->Init(flags, false);
+    bool sysmanOnly = false;
 %endif
-
+    static ${x}_result_t result = ${X}_RESULT_SUCCESS;
+    bool initialized = false;
+    std::call_once(${x}_lib::context->initOnce, [flags, sysmanOnly, &initialized]() {
+        result = ${x}_lib::context->Init(flags, sysmanOnly);
+        initialized = true;
     });
 
     if( ${X}_RESULT_SUCCESS != result )
         return result;
 
+    // a later call may admit drivers the flags of the first one excluded
+    if( !initialized ) {
+        auto checkResult = ${x}_lib::context->CheckDrivers(flags, sysmanOnly);
+        if( ${X}_RESULT_SUCCESS != checkResult )
+            return checkResult;
+    }
+
 %endif
     if(ze_lib::context->inTeardown) {
         return ${X}_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto ${th.make_pfn_name(n, tags, obj)} = ${x}_lib::context->${n}DdiTable.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)};
+    auto ${th.make_pfn_name(n, tags, obj)} = ${x}_lib::context->${n}ActiveDdiTable.load( std::memory_order_acquire )->${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)};
     if( nullptr == ${th.make_pfn_name(n, tags, obj)} ) {
         if(!ze_lib::context->isInitialized)
             return ${X}_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ${x}_lib::context->${n}TablesFilled() )
+            return ${X}_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ${x}_lib::context->${n}LoadTables();
+        if( ${X}_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        ${th.make_pfn_name(n, tags, obj)} = ${x}_lib::context->${n}ActiveDdiTable.load( std::memory_order_acquire )->${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)};
+        if( nullptr == ${th.make_pfn_name(n, tags, obj)} )
             return ${X}_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -19,6 +19,9 @@ from templates import helper as th
 #include "${x}_lib.h"
 #ifndef DYNAMIC_LOAD_LOADER
 #include "${n}_ddi.h"
+%if n == "ze":
+#include "../loader/ze_loader_api.h"
+%endif
 #endif
 
 namespace ${x}_lib
@@ -29,6 +32,14 @@ namespace ${x}_lib
     __zedlllocal ${x}_result_t context_t::${n}Init()
     {
         ${x}_result_t result = ${X}_RESULT_SUCCESS;
+    %if n == "ze":
+
+        // the loader's exports leave the tracing layer to ${n}TracingInit
+        typedef void (ZE_APICALL *setPassThroughTables_t)(ze_bool_t);
+        auto setPassThroughTables = reinterpret_cast<setPassThroughTables_t>(
+            GET_FUNCTION_PTR(loader, "zeLoaderSetPassThroughTables") );
+        setPassThroughTables( true );
+    %endif
 
     %for tbl in th.get_pfntables(specs, meta, n, tags):
         if( ${X}_RESULT_SUCCESS == result )
@@ -39,12 +50,24 @@ namespace ${x}_lib
         }
 
     %endfor
+    %if n == "ze":
+        setPassThroughTables( false );
+
+    %endif
+        if( ( ${X}_RESULT_SUCCESS == result ) && ( nullptr != tracing_lib ) )
+            result = ${n}TracingInit();
+
         return result;
     }
 #else
     __zedlllocal ${x}_result_t context_t::${n}Init()
     {
         ${x}_result_t result = ${X}_RESULT_SUCCESS;
+    %if n == "ze":
+
+        // the loader's exports leave the tracing layer to ${n}TracingInit
+        zeLoaderSetPassThroughTables( true );
+    %endif
 
     %for tbl in th.get_pfntables(specs, meta, n, tags):
         if( ${X}_RESULT_SUCCESS == result )
@@ -53,8 +76,44 @@ namespace ${x}_lib
         }
 
     %endfor
+    %if n == "ze":
+        zeLoaderSetPassThroughTables( false );
+
+    %endif
+        if( ( ${X}_RESULT_SUCCESS == result ) && ( nullptr != tracing_lib ) )
+            result = ${n}TracingInit();
+
         return result;
     }
 #endif
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// fills ${n}TracingDdiTable with the tracing layer's intercepts of a copy of
+    /// ${n}DdiTable; the exported functions switch to it while a tracer is enabled
+    __zedlllocal ${x}_result_t context_t::${n}TracingInit()
+    {
+        ${x}_result_t result = ${X}_RESULT_SUCCESS;
+        ${n}TracingDdiTable = ${n}DdiTable;
+
+    %for tbl in th.get_pfntables(specs, meta, n, tags):
+        if( ${X}_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<${tbl['pfn']}>(
+                GET_FUNCTION_PTR(tracing_lib, "${tbl['export']['name']}") );
+            if( nullptr == getTable )
+                return ${X}_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ${X}_API_VERSION_CURRENT, &${n}TracingDdiTable.${tbl['name']} );
+        }
+
+    %endfor
+        if( ${X}_RESULT_SUCCESS == result )
+        {
+            std::lock_guard<std::mutex> lock( tracingMutex );
+            ${n}TracingTablesLoaded = true;
+            updateActiveTables();
+        }
+
+        return result;
+    }
+
 } // namespace ${x}_lib
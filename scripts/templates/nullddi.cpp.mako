@@ -17,6 +17,7 @@ from templates import helper as th
  *
  */
 #include "${x}_null.h"
+#include <cstring>
 
 namespace driver
 {
@@ -114,6 +115,61 @@ ${tbl['export']['name']}(
 }
 
 %endfor
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling several of the application's ${n}
+///        tables with current process' addresses in a single call
+///
+/// @returns
+///     - ::${X}_RESULT_SUCCESS
+///     - ::${X}_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::${X}_RESULT_ERROR_UNSUPPORTED_VERSION
+///     - ::${X}_RESULT_ERROR_UNSUPPORTED_FEATURE
+${X}_DLLEXPORT ${x}_result_t ${X}_APICALL
+${n}GetAllProcAddrTables(
+    ${x}_api_version_t version,                     ///< [in] API version requested
+    uint32_t count,                                 ///< [in] number of tables
+    const char** ppTableNames,                      ///< [in][range(0, count)] export name of each table
+    void** ppTables                                 ///< [in,out][range(0, count)] pointer to each table of DDI function pointers
+    )
+{
+    if( ( 0 != count ) && ( ( nullptr == ppTableNames ) || ( nullptr == ppTables ) ) )
+        return ${X}_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if( driver::context.version < version )
+        return ${X}_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    // the tables are filled here rather than through the per-table exports,
+    // which may be interposed by the loader's exports of the same name
+    for( uint32_t i = 0; i < count; ++i )
+    {
+        if( ( nullptr == ppTableNames[ i ] ) || ( nullptr == ppTables[ i ] ) )
+            return ${X}_RESULT_ERROR_INVALID_NULL_POINTER;
+        %for tbl in th.get_pfntables(specs, meta, n, tags):
+
+        ${"if" if loop.first else "else if"}( 0 == strcmp( ppTableNames[ i ], "${tbl['export']['name']}" ) )
+        {
+            auto pDdiTable = static_cast<${tbl['type']}*>( ppTables[ i ] );
+            %for obj in tbl['functions']:
+            %if 'condition' in obj:
+#if ${th.subt(n, tags, obj['condition'])}
+            %endif
+            pDdiTable->${th.append_ws(th.make_pfn_name(n, tags, obj), 41)} = driver::${th.make_func_name(n, tags, obj)};
+            %if 'condition' in obj:
+#else
+            pDdiTable->${th.append_ws(th.make_pfn_name(n, tags, obj), 41)} = nullptr;
+#endif
+            %endif
+            %endfor
+        }
+        %endfor
+
+        else
+            return ${X}_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    return ${X}_RESULT_SUCCESS;
+}
+
 #if defined(__cplusplus)
 };
 #endif
@@ -22,8 +22,8 @@ from templates import helper as th
 #pragma once
 #endif
 
-#include "${x}_api.h"
-#include "layers/zel_tracing_register_cb.h"
+#include "${n}_api.h"
+#include "layers/${th.get_tracing_register_cb_header(n, tags)}.h"
 
 
 
@@ -40,12 +40,12 @@ typedef struct _${tbl['type']}
 %endfor
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Container for all callbacks
-typedef struct _zel_all_core_callbacks_t
+typedef struct _zel_all_${th.get_tracing_callbacks_group(n)}_callbacks_t
 {
 %for tbl in th.get_zel_pfncbtables(specs, meta, n, tags):
     ${th.append_ws(tbl['type'], 35)} ${tbl['name']};
 %endfor
-} zel_all_core_callbacks_t;
+} zel_all_${th.get_tracing_callbacks_group(n)}_callbacks_t;
 
 
 
@@ -20,12 +20,12 @@ from templates import helper as th
 #include "ze_lib.h"
 #include "layers/zel_tracing_api.h"
 #include "layers/zel_tracing_ddi.h"
-#include "layers/zel_tracing_register_cb.h"
-#include "${x}_api.h"
+#include "layers/${th.get_tracing_register_cb_header(n, tags)}.h"
+#include "${n}_api.h"
 
 extern "C" { 
 
-/// APIs to register callbacks for each core API
+/// APIs to register callbacks for each ${th.get_tracing_callbacks_group(n)} API
 %for s in specs:
 %for obj in th.filter_items(s['objects'], 'type', 'function'):
 
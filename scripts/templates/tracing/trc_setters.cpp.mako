@@ -21,12 +21,12 @@ from templates import helper as th
 #include "ze_tracing_layer.h"
 #include "layers/zel_tracing_api.h"
 #include "layers/zel_tracing_ddi.h"
-#include "layers/zel_tracing_register_cb.h"
-#include "${x}_api.h"
+#include "layers/${th.get_tracing_register_cb_header(n, tags)}.h"
+#include "${n}_api.h"
 
 extern "C" { 
 
-/// APIs to register callbacks for each core API
+/// APIs to register callbacks for each ${th.get_tracing_callbacks_group(n)} API
 %for s in specs:
 %for obj in th.filter_items(s['objects'], 'type', 'function'):
 
@@ -40,7 +40,7 @@ ${th.make_tracing_func_name(n, tags, obj)}(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.${th.get_callback_table_name(n, tags, obj)}.${th.make_pfncb_name(n, tags, obj)} = ${th.make_pfncb_name(n, tags, obj)};
+        cbs.${th.get_tracing_callbacks_group(n)}.${th.get_callback_table_name(n, tags, obj)}.${th.make_pfncb_name(n, tags, obj)} = ${th.make_pfncb_name(n, tags, obj)};
 
     return result;
 }
@@ -7,6 +7,12 @@ from templates import helper as th
 
     x=tags['$x']
     X=x.upper()
+
+    # callbacks of core APIs of spec 1.0 are declared in ze_api.h
+    if n == x:
+        cbtables = th.get_new_pfncbtables(specs, meta, n, tags)
+    else:
+        cbtables = th.get_zel_pfncbtables(specs, meta, n, tags)
 %>/*
  *
  * Copyright (C) 2021-2022 Intel Corporation
@@ -22,13 +28,19 @@ from templates import helper as th
 #pragma once
 #endif
 
+%if n == x:
 #include "../${x}_api.h"
+%else:
+#include "../${n}_api.h"
+#include "${th.get_tracing_register_cb_header(x, tags)}.h"
+%endif
 
 
 #if defined(__cplusplus)
 extern "C" {
 #endif
 
+%if n == x:
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Handle of tracer object
 typedef struct _zel_tracer_handle_t *zel_tracer_handle_t;
@@ -36,7 +48,11 @@ typedef struct _zel_tracer_handle_t *zel_tracer_handle_t;
 /// Callback definitions for all API released in LevelZero spec 1.1 or newer
 /// Callbacks for APIs included in spec 1.0 are contained in ze_api.helper
 
-%for tbl in th.get_new_pfncbtables(specs, meta, n, tags):
+%else:
+/// Callback definitions for all ${n} APIs
+
+%endif
+%for tbl in cbtables:
 %for obj in tbl['functions']:
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Callback function parameters for ${th.make_func_name(n, tags, obj)}
@@ -68,6 +84,7 @@ typedef void (${X}_APICALL *${th.make_pfncb_type(n, tags, obj)})(
 %endfor
 %endfor
 
+%if n == x:
 typedef enum _zel_tracer_reg_t
 {
     ZEL_REGISTER_PROLOGUE = 0,
@@ -75,6 +92,9 @@ typedef enum _zel_tracer_reg_t
 } zel_tracer_reg_t;
 
 /// APIs to register callbacks for each core API
+%else:
+/// APIs to register callbacks for each ${n} API
+%endif
 %for s in specs:
 %for obj in th.filter_items(s['objects'], 'type', 'function'):
 
@@ -87,9 +107,11 @@ ${th.make_tracing_func_name(n, tags, obj)}(
 
 %endfor
 %endfor #s in specs:
+%if n == x:
 
 ${X}_APIEXPORT ${x}_result_t ${X}_APICALL
 zelTracerResetAllCallbacks(zel_tracer_handle_t hTracer);
+%endif
 
 
 #if defined(__cplusplus)
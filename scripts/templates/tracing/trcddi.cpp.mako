@@ -40,7 +40,13 @@ namespace tracing_layer
         if( nullptr == ${th.make_pfn_name(n, tags, obj)})
             return ${X}_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.${n}DdiTable.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)}, ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))});
+        const size_t apiIndex = ${N}_TRACER_API_INDEX(${th.get_callback_table_name(n, tags, obj)}, ${th.make_pfncb_name(n, tags, obj)});
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex${"".join(", " + h for h in th.get_trace_handle_params(n, tags, obj))});
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.${n}DdiTable.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)}, ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))});
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.${n}DdiTable.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)}, ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))});
 
         // capture parameters
         ${th.make_pfncb_param_type(n, tags, obj)} tracerParams = {
@@ -49,21 +55,43 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<${th.make_pfncb_type(n, tags, obj)}> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ${th.make_pfncb_type(n, tags, obj)}, ${th.get_callback_table_name(n, tags, obj)}, ${th.make_pfncb_name(n, tags, obj)});
-
-
-        return tracing_layer::APITracerWrapperImp(context.${n}DdiTable.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)},
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ${th.make_pfncb_type(n, tags, obj)}, apiIndex);
+
+<%
+    out_handles = th.get_epilogue_out_handle_params(n, tags, obj)
+    if out_handles is None:
+        epilogue_args = "false"
+    else:
+        in_pointers = th.get_epilogue_in_pointer_params(n, tags, obj)
+        epilogue_args = "true, tracing_layer::epilogue_arg_indices<%s>, tracing_layer::epilogue_arg_indices<%s>" % (
+            ", ".join([str(i) for i in in_pointers]), ", ".join([str(i) for i in out_handles]))
+%>
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<${epilogue_args}>>(context.${n}DdiTable.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)},
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
-                                                  *tracerParams.p${",\n                                                  *tracerParams.p".join(th.make_param_lines(n, tags, obj, format=["name"]))});
+                                                  apiCallbackData,
+                                                  *tracerParams.p${",\n                                                  *tracerParams.p".join(th.make_param_lines(n, tags, obj, format=["name"]))}));
     }
     %if 'condition' in obj:
     #endif // ${th.subt(n, tags, obj['condition'])}
     %endif
 
     %endfor
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief APIs described in the trace recorder's file header
+    const trace_api_desc_t ${n}TraceApiDescs[] = {
+    %for obj in th.extract_objs(specs, r"function"):
+    %if 'condition' in obj:
+    #if ${th.subt(n, tags, obj['condition'])}
+    %endif
+        { ${N}_TRACER_API_INDEX(${th.get_callback_table_name(n, tags, obj)}, ${th.make_pfncb_name(n, tags, obj)}), "${th.make_func_name(n, tags, obj)}", ${len(th.get_trace_handle_params(n, tags, obj))} },
+    %if 'condition' in obj:
+    #endif // ${th.subt(n, tags, obj['condition'])}
+    %endif
+    %endfor
+    };
+
+    const size_t ${n}TraceApiDescCount = sizeof(${n}TraceApiDescs) / sizeof(${n}TraceApiDescs[0]);
+
 } // namespace tracing_layer
 
 #if defined(__cplusplus)
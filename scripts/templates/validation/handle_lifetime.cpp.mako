@@ -46,8 +46,17 @@ namespace validation_layer
         %else:
         %for i, item in enumerate(th.get_loader_prologue(n, tags, obj, meta)):
         %if not 'range' in item:
+        %if re.match(r"\w+CommandListAppend\w+$", func_name) and (0 == i) : ## i = 0, first parameter is command list
+        ## the state lookup also checks the command list is valid
+        zel_handle_state_t ${item['name']}State;
+        if ( !context.handleLifetime->getState( ${item['name']}, ${item['name']}State )){
+                return ${X}_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+        if (!${item['name']}State.is_open){
+            return ${X}_RESULT_ERROR_INVALID_ARGUMENT;
+        }
         ## if item is optional, check if it is not null before checking if it is valid
-        %if item['optional']:
+        %elif item['optional']:
         if (${item['name']} && !context.handleLifetime->isHandleValid( ${item['name']} )){
                 return ${X}_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
@@ -56,11 +65,6 @@ namespace validation_layer
                 return ${X}_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
         %endif ## if item['optional']
-        %if re.match(r"\w+CommandListAppend\w+$", func_name) and (0 == i) : ## i = 0, first parameter is command list
-        if (!context.handleLifetime->isOpen( ${item['name']} )){
-            return ${X}_RESULT_ERROR_INVALID_ARGUMENT;
-        }
-        %endif
         %if re.match(r"\w+CommandListClose$", func_name):
         context.handleLifetime->close( ${item['name']} );
         %endif
@@ -1,6 +1,6 @@
 /*
  *
- * Copyright (C) 2019-2021 Intel Corporation
+ * Copyright (C) 2019-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,8 @@
  *
  */
 #include "ze_null.h"
+#include <chrono>
+#include <thread>
 
 namespace driver
 {
@@ -17,6 +19,39 @@ namespace driver
     //////////////////////////////////////////////////////////////////////////
     context_t::context_t()
     {
+        // the instrumented tracer hands out indices as handles, which
+        // cannot hold the loader's dispatch word
+        dispatchableHandles = getenv_tobool( "ZE_NULL_DRIVER_DISPATCHABLE_HANDLES" )
+            && !getenv_tobool( "ZET_ENABLE_API_TRACING_EXP" );
+
+        // builds tagged with a device type, for testing zeInit flag
+        // filtering, only initialize for flags that admit that type
+#if defined(ZE_NULL_DRIVER_DEVICE_TYPE)
+        deviceType = ZE_NULL_DRIVER_DEVICE_TYPE;
+        if( ZE_DEVICE_TYPE_GPU == deviceType )
+            deviceInitFlag = ZE_INIT_FLAG_GPU_ONLY;
+        else if( ZE_DEVICE_TYPE_VPU == deviceType )
+            deviceInitFlag = ZE_INIT_FLAG_VPU_ONLY;
+#endif
+
+        // artificial latency on the first zeInit, for measuring loader startup
+        initDelayMs = getenv_toulong( "ZE_NULL_DRIVER_INIT_DELAY_MS", 0 );
+        if( 0 != initDelayMs || 0 != deviceInitFlag )
+        {
+            zeDdiTable.Global.pfnInit = [](
+                ze_init_flags_t flags )
+            {
+                if( 0 != flags && 0 != context.deviceInitFlag && 0 == ( flags & context.deviceInitFlag ) )
+                    return ZE_RESULT_ERROR_UNINITIALIZED;
+
+                static std::once_flag delayOnce;
+                std::call_once( delayOnce, []() {
+                    std::this_thread::sleep_for( std::chrono::milliseconds( context.initDelayMs ) );
+                } );
+                return ZE_RESULT_SUCCESS;
+            };
+        }
+
         zesDdiTable.Driver.pfnGet = [](
             uint32_t* pCount,
             ze_driver_handle_t* phDrivers )
@@ -137,7 +172,7 @@ namespace driver
         {
             ze_device_properties_t deviceProperties = {};
             deviceProperties.stype = ZE_STRUCTURE_TYPE_DEVICE_PROPERTIES;
-            deviceProperties.type = ZE_DEVICE_TYPE_GPU;
+            deviceProperties.type = context.deviceType;
 #if defined(_WIN32)
             strcpy_s( deviceProperties.name, "Null Device" );
 #else
@@ -363,6 +398,20 @@ namespace driver
             return ZE_RESULT_SUCCESS;
         };
     }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// dispatchable handles point at a pointer-sized slot for the loader;
+    /// slots are carved out of blocks that live as long as the driver
+    void* context_t::getDispatchable( void )
+    {
+        std::lock_guard<std::mutex> lock( handleMutex );
+        if( handlesPerBlock == handlesUsed )
+        {
+            handleBlocks.emplace_back( new void*[ handlesPerBlock ]() );
+            handlesUsed = 0;
+        }
+        return &handleBlocks.back()[ handlesUsed++ ];
+    }
 } // namespace driver
 
 namespace instrumented
@@ -428,3 +477,30 @@ namespace instrumented
         }
     }
 } // namespace instrumented
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function advertising dispatchable handles to the loader
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zelDriverGetDispatchableHandleSupport(
+    ze_api_version_t version,
+    ze_bool_t* pSupported
+    )
+{
+    if( nullptr == pSupported )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    *pSupported = driver::context.dispatchableHandles;
+    return ZE_RESULT_SUCCESS;
+}
+
+#if defined(__cplusplus)
+};
+#endif
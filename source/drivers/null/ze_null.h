@@ -1,6 +1,6 @@
 /*
  *
- * Copyright (C) 2019-2021 Intel Corporation
+ * Copyright (C) 2019-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,6 +10,9 @@
 #pragma once
 #include <stdlib.h>
 #include <vector>
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include "ze_ddi.h"
 #include "zet_ddi.h"
 #include "zes_ddi.h"
@@ -29,11 +32,35 @@ namespace driver
         context_t();
         ~context_t() = default;
 
+        bool dispatchableHandles = false;   ///< handles reserve their first word for the loader
+        unsigned long initDelayMs = 0;      ///< artificial delay added to zeInit
+        ze_device_type_t deviceType = ZE_DEVICE_TYPE_GPU;
+        ze_init_flags_t deviceInitFlag = 0; ///< zeInit flag the device type needs; 0 accepts any flags
+
+#if defined(ZE_NULL_DRIVER_DEVICE_TYPE)
+        // builds tagged with a device type are loaded side by side, so their
+        // handles must not collide
+        static constexpr uint64_t handleBase = 0x80800000 + ( uint64_t( ZE_NULL_DRIVER_DEVICE_TYPE ) << 32 );
+#else
+        static constexpr uint64_t handleBase = 0x80800000;
+#endif
+
         void* get( void )
         {
-            static uint64_t count = 0x80800000;
+            static std::atomic<uint64_t> count( handleBase );
+            if( dispatchableHandles )
+                return getDispatchable();
             return reinterpret_cast<void*>( ++count );
         }
+
+    protected:
+        static constexpr size_t handlesPerBlock = 4096;
+
+        std::mutex handleMutex;
+        std::vector< std::unique_ptr< void*[] > > handleBlocks;
+        size_t handlesUsed = handlesPerBlock;
+
+        void* getDispatchable( void );
     };
 
     extern context_t context;
@@ -8,6 +8,7 @@
  *
  */
 #include "ze_null.h"
+#include <cstring>
 
 namespace driver
 {
@@ -5071,6 +5072,315 @@ zeGetFabricVertexExpProcAddrTable(
     return result;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling several of the application's ze
+///        tables with current process' addresses in a single call
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_FEATURE
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zeGetAllProcAddrTables(
+    ze_api_version_t version,                     ///< [in] API version requested
+    uint32_t count,                                 ///< [in] number of tables
+    const char** ppTableNames,                      ///< [in][range(0, count)] export name of each table
+    void** ppTables                                 ///< [in,out][range(0, count)] pointer to each table of DDI function pointers
+    )
+{
+    if( ( 0 != count ) && ( ( nullptr == ppTableNames ) || ( nullptr == ppTables ) ) )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if( driver::context.version < version )
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    // the tables are filled here rather than through the per-table exports,
+    // which may be interposed by the loader's exports of the same name
+    for( uint32_t i = 0; i < count; ++i )
+    {
+        if( ( nullptr == ppTableNames[ i ] ) || ( nullptr == ppTables[ i ] ) )
+            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+        if( 0 == strcmp( ppTableNames[ i ], "zeGetGlobalProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<ze_global_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnInit                                   = driver::zeInit;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zeGetDriverProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<ze_driver_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnGet                                    = driver::zeDriverGet;
+            pDdiTable->pfnGetApiVersion                          = driver::zeDriverGetApiVersion;
+            pDdiTable->pfnGetProperties                          = driver::zeDriverGetProperties;
+            pDdiTable->pfnGetIpcProperties                       = driver::zeDriverGetIpcProperties;
+            pDdiTable->pfnGetExtensionProperties                 = driver::zeDriverGetExtensionProperties;
+            pDdiTable->pfnGetExtensionFunctionAddress            = driver::zeDriverGetExtensionFunctionAddress;
+            pDdiTable->pfnGetLastErrorDescription                = driver::zeDriverGetLastErrorDescription;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zeGetDeviceProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<ze_device_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnGet                                    = driver::zeDeviceGet;
+            pDdiTable->pfnGetSubDevices                          = driver::zeDeviceGetSubDevices;
+            pDdiTable->pfnGetProperties                          = driver::zeDeviceGetProperties;
+            pDdiTable->pfnGetComputeProperties                   = driver::zeDeviceGetComputeProperties;
+            pDdiTable->pfnGetModuleProperties                    = driver::zeDeviceGetModuleProperties;
+            pDdiTable->pfnGetCommandQueueGroupProperties         = driver::zeDeviceGetCommandQueueGroupProperties;
+            pDdiTable->pfnGetMemoryProperties                    = driver::zeDeviceGetMemoryProperties;
+            pDdiTable->pfnGetMemoryAccessProperties              = driver::zeDeviceGetMemoryAccessProperties;
+            pDdiTable->pfnGetCacheProperties                     = driver::zeDeviceGetCacheProperties;
+            pDdiTable->pfnGetImageProperties                     = driver::zeDeviceGetImageProperties;
+            pDdiTable->pfnGetExternalMemoryProperties            = driver::zeDeviceGetExternalMemoryProperties;
+            pDdiTable->pfnGetP2PProperties                       = driver::zeDeviceGetP2PProperties;
+            pDdiTable->pfnCanAccessPeer                          = driver::zeDeviceCanAccessPeer;
+            pDdiTable->pfnGetStatus                              = driver::zeDeviceGetStatus;
+            pDdiTable->pfnGetGlobalTimestamps                    = driver::zeDeviceGetGlobalTimestamps;
+            pDdiTable->pfnReserveCacheExt                        = driver::zeDeviceReserveCacheExt;
+            pDdiTable->pfnSetCacheAdviceExt                      = driver::zeDeviceSetCacheAdviceExt;
+            pDdiTable->pfnPciGetPropertiesExt                    = driver::zeDevicePciGetPropertiesExt;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zeGetDeviceExpProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<ze_device_exp_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnGetFabricVertexExp                     = driver::zeDeviceGetFabricVertexExp;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zeGetContextProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<ze_context_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnCreate                                 = driver::zeContextCreate;
+            pDdiTable->pfnDestroy                                = driver::zeContextDestroy;
+            pDdiTable->pfnGetStatus                              = driver::zeContextGetStatus;
+            pDdiTable->pfnSystemBarrier                          = driver::zeContextSystemBarrier;
+            pDdiTable->pfnMakeMemoryResident                     = driver::zeContextMakeMemoryResident;
+            pDdiTable->pfnEvictMemory                            = driver::zeContextEvictMemory;
+            pDdiTable->pfnMakeImageResident                      = driver::zeContextMakeImageResident;
+            pDdiTable->pfnEvictImage                             = driver::zeContextEvictImage;
+            pDdiTable->pfnCreateEx                               = driver::zeContextCreateEx;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zeGetCommandQueueProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<ze_command_queue_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnCreate                                 = driver::zeCommandQueueCreate;
+            pDdiTable->pfnDestroy                                = driver::zeCommandQueueDestroy;
+            pDdiTable->pfnExecuteCommandLists                    = driver::zeCommandQueueExecuteCommandLists;
+            pDdiTable->pfnSynchronize                            = driver::zeCommandQueueSynchronize;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zeGetCommandListProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<ze_command_list_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnCreate                                 = driver::zeCommandListCreate;
+            pDdiTable->pfnCreateImmediate                        = driver::zeCommandListCreateImmediate;
+            pDdiTable->pfnDestroy                                = driver::zeCommandListDestroy;
+            pDdiTable->pfnClose                                  = driver::zeCommandListClose;
+            pDdiTable->pfnReset                                  = driver::zeCommandListReset;
+            pDdiTable->pfnAppendWriteGlobalTimestamp             = driver::zeCommandListAppendWriteGlobalTimestamp;
+            pDdiTable->pfnAppendBarrier                          = driver::zeCommandListAppendBarrier;
+            pDdiTable->pfnAppendMemoryRangesBarrier              = driver::zeCommandListAppendMemoryRangesBarrier;
+            pDdiTable->pfnAppendMemoryCopy                       = driver::zeCommandListAppendMemoryCopy;
+            pDdiTable->pfnAppendMemoryFill                       = driver::zeCommandListAppendMemoryFill;
+            pDdiTable->pfnAppendMemoryCopyRegion                 = driver::zeCommandListAppendMemoryCopyRegion;
+            pDdiTable->pfnAppendMemoryCopyFromContext            = driver::zeCommandListAppendMemoryCopyFromContext;
+            pDdiTable->pfnAppendImageCopy                        = driver::zeCommandListAppendImageCopy;
+            pDdiTable->pfnAppendImageCopyRegion                  = driver::zeCommandListAppendImageCopyRegion;
+            pDdiTable->pfnAppendImageCopyToMemory                = driver::zeCommandListAppendImageCopyToMemory;
+            pDdiTable->pfnAppendImageCopyFromMemory              = driver::zeCommandListAppendImageCopyFromMemory;
+            pDdiTable->pfnAppendMemoryPrefetch                   = driver::zeCommandListAppendMemoryPrefetch;
+            pDdiTable->pfnAppendMemAdvise                        = driver::zeCommandListAppendMemAdvise;
+            pDdiTable->pfnAppendSignalEvent                      = driver::zeCommandListAppendSignalEvent;
+            pDdiTable->pfnAppendWaitOnEvents                     = driver::zeCommandListAppendWaitOnEvents;
+            pDdiTable->pfnAppendEventReset                       = driver::zeCommandListAppendEventReset;
+            pDdiTable->pfnAppendQueryKernelTimestamps            = driver::zeCommandListAppendQueryKernelTimestamps;
+            pDdiTable->pfnAppendLaunchKernel                     = driver::zeCommandListAppendLaunchKernel;
+            pDdiTable->pfnAppendLaunchCooperativeKernel          = driver::zeCommandListAppendLaunchCooperativeKernel;
+            pDdiTable->pfnAppendLaunchKernelIndirect             = driver::zeCommandListAppendLaunchKernelIndirect;
+            pDdiTable->pfnAppendLaunchMultipleKernelsIndirect    = driver::zeCommandListAppendLaunchMultipleKernelsIndirect;
+            pDdiTable->pfnAppendImageCopyToMemoryExt             = driver::zeCommandListAppendImageCopyToMemoryExt;
+            pDdiTable->pfnAppendImageCopyFromMemoryExt           = driver::zeCommandListAppendImageCopyFromMemoryExt;
+            pDdiTable->pfnHostSynchronize                        = driver::zeCommandListHostSynchronize;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zeGetEventProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<ze_event_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnCreate                                 = driver::zeEventCreate;
+            pDdiTable->pfnDestroy                                = driver::zeEventDestroy;
+            pDdiTable->pfnHostSignal                             = driver::zeEventHostSignal;
+            pDdiTable->pfnHostSynchronize                        = driver::zeEventHostSynchronize;
+            pDdiTable->pfnQueryStatus                            = driver::zeEventQueryStatus;
+            pDdiTable->pfnHostReset                              = driver::zeEventHostReset;
+            pDdiTable->pfnQueryKernelTimestamp                   = driver::zeEventQueryKernelTimestamp;
+            pDdiTable->pfnQueryKernelTimestampsExt               = driver::zeEventQueryKernelTimestampsExt;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zeGetEventExpProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<ze_event_exp_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnQueryTimestampsExp                     = driver::zeEventQueryTimestampsExp;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zeGetEventPoolProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<ze_event_pool_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnCreate                                 = driver::zeEventPoolCreate;
+            pDdiTable->pfnDestroy                                = driver::zeEventPoolDestroy;
+            pDdiTable->pfnGetIpcHandle                           = driver::zeEventPoolGetIpcHandle;
+            pDdiTable->pfnOpenIpcHandle                          = driver::zeEventPoolOpenIpcHandle;
+            pDdiTable->pfnCloseIpcHandle                         = driver::zeEventPoolCloseIpcHandle;
+            pDdiTable->pfnPutIpcHandle                           = driver::zeEventPoolPutIpcHandle;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zeGetFenceProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<ze_fence_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnCreate                                 = driver::zeFenceCreate;
+            pDdiTable->pfnDestroy                                = driver::zeFenceDestroy;
+            pDdiTable->pfnHostSynchronize                        = driver::zeFenceHostSynchronize;
+            pDdiTable->pfnQueryStatus                            = driver::zeFenceQueryStatus;
+            pDdiTable->pfnReset                                  = driver::zeFenceReset;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zeGetImageProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<ze_image_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnGetProperties                          = driver::zeImageGetProperties;
+            pDdiTable->pfnCreate                                 = driver::zeImageCreate;
+            pDdiTable->pfnDestroy                                = driver::zeImageDestroy;
+            pDdiTable->pfnGetAllocPropertiesExt                  = driver::zeImageGetAllocPropertiesExt;
+            pDdiTable->pfnViewCreateExt                          = driver::zeImageViewCreateExt;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zeGetImageExpProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<ze_image_exp_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnGetMemoryPropertiesExp                 = driver::zeImageGetMemoryPropertiesExp;
+            pDdiTable->pfnViewCreateExp                          = driver::zeImageViewCreateExp;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zeGetKernelProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<ze_kernel_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnCreate                                 = driver::zeKernelCreate;
+            pDdiTable->pfnDestroy                                = driver::zeKernelDestroy;
+            pDdiTable->pfnSetCacheConfig                         = driver::zeKernelSetCacheConfig;
+            pDdiTable->pfnSetGroupSize                           = driver::zeKernelSetGroupSize;
+            pDdiTable->pfnSuggestGroupSize                       = driver::zeKernelSuggestGroupSize;
+            pDdiTable->pfnSuggestMaxCooperativeGroupCount        = driver::zeKernelSuggestMaxCooperativeGroupCount;
+            pDdiTable->pfnSetArgumentValue                       = driver::zeKernelSetArgumentValue;
+            pDdiTable->pfnSetIndirectAccess                      = driver::zeKernelSetIndirectAccess;
+            pDdiTable->pfnGetIndirectAccess                      = driver::zeKernelGetIndirectAccess;
+            pDdiTable->pfnGetSourceAttributes                    = driver::zeKernelGetSourceAttributes;
+            pDdiTable->pfnGetProperties                          = driver::zeKernelGetProperties;
+            pDdiTable->pfnGetName                                = driver::zeKernelGetName;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zeGetKernelExpProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<ze_kernel_exp_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnSetGlobalOffsetExp                     = driver::zeKernelSetGlobalOffsetExp;
+            pDdiTable->pfnSchedulingHintExp                      = driver::zeKernelSchedulingHintExp;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zeGetMemProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<ze_mem_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnAllocShared                            = driver::zeMemAllocShared;
+            pDdiTable->pfnAllocDevice                            = driver::zeMemAllocDevice;
+            pDdiTable->pfnAllocHost                              = driver::zeMemAllocHost;
+            pDdiTable->pfnFree                                   = driver::zeMemFree;
+            pDdiTable->pfnGetAllocProperties                     = driver::zeMemGetAllocProperties;
+            pDdiTable->pfnGetAddressRange                        = driver::zeMemGetAddressRange;
+            pDdiTable->pfnGetIpcHandle                           = driver::zeMemGetIpcHandle;
+            pDdiTable->pfnOpenIpcHandle                          = driver::zeMemOpenIpcHandle;
+            pDdiTable->pfnCloseIpcHandle                         = driver::zeMemCloseIpcHandle;
+            pDdiTable->pfnFreeExt                                = driver::zeMemFreeExt;
+            pDdiTable->pfnPutIpcHandle                           = driver::zeMemPutIpcHandle;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zeGetMemExpProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<ze_mem_exp_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnGetIpcHandleFromFileDescriptorExp      = driver::zeMemGetIpcHandleFromFileDescriptorExp;
+            pDdiTable->pfnGetFileDescriptorFromIpcHandleExp      = driver::zeMemGetFileDescriptorFromIpcHandleExp;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zeGetModuleProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<ze_module_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnCreate                                 = driver::zeModuleCreate;
+            pDdiTable->pfnDestroy                                = driver::zeModuleDestroy;
+            pDdiTable->pfnDynamicLink                            = driver::zeModuleDynamicLink;
+            pDdiTable->pfnGetNativeBinary                        = driver::zeModuleGetNativeBinary;
+            pDdiTable->pfnGetGlobalPointer                       = driver::zeModuleGetGlobalPointer;
+            pDdiTable->pfnGetKernelNames                         = driver::zeModuleGetKernelNames;
+            pDdiTable->pfnGetProperties                          = driver::zeModuleGetProperties;
+            pDdiTable->pfnGetFunctionPointer                     = driver::zeModuleGetFunctionPointer;
+            pDdiTable->pfnInspectLinkageExt                      = driver::zeModuleInspectLinkageExt;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zeGetModuleBuildLogProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<ze_module_build_log_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnDestroy                                = driver::zeModuleBuildLogDestroy;
+            pDdiTable->pfnGetString                              = driver::zeModuleBuildLogGetString;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zeGetPhysicalMemProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<ze_physical_mem_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnCreate                                 = driver::zePhysicalMemCreate;
+            pDdiTable->pfnDestroy                                = driver::zePhysicalMemDestroy;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zeGetSamplerProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<ze_sampler_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnCreate                                 = driver::zeSamplerCreate;
+            pDdiTable->pfnDestroy                                = driver::zeSamplerDestroy;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zeGetVirtualMemProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<ze_virtual_mem_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnReserve                                = driver::zeVirtualMemReserve;
+            pDdiTable->pfnFree                                   = driver::zeVirtualMemFree;
+            pDdiTable->pfnQueryPageSize                          = driver::zeVirtualMemQueryPageSize;
+            pDdiTable->pfnMap                                    = driver::zeVirtualMemMap;
+            pDdiTable->pfnUnmap                                  = driver::zeVirtualMemUnmap;
+            pDdiTable->pfnSetAccessAttribute                     = driver::zeVirtualMemSetAccessAttribute;
+            pDdiTable->pfnGetAccessAttribute                     = driver::zeVirtualMemGetAccessAttribute;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zeGetFabricEdgeExpProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<ze_fabric_edge_exp_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnGetExp                                 = driver::zeFabricEdgeGetExp;
+            pDdiTable->pfnGetVerticesExp                         = driver::zeFabricEdgeGetVerticesExp;
+            pDdiTable->pfnGetPropertiesExp                       = driver::zeFabricEdgeGetPropertiesExp;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zeGetFabricVertexExpProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<ze_fabric_vertex_exp_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnGetExp                                 = driver::zeFabricVertexGetExp;
+            pDdiTable->pfnGetSubVerticesExp                      = driver::zeFabricVertexGetSubVerticesExp;
+            pDdiTable->pfnGetPropertiesExp                       = driver::zeFabricVertexGetPropertiesExp;
+            pDdiTable->pfnGetDeviceExp                           = driver::zeFabricVertexGetDeviceExp;
+        }
+
+        else
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    return ZE_RESULT_SUCCESS;
+}
+
 #if defined(__cplusplus)
 };
 #endif
@@ -8,6 +8,7 @@
  *
  */
 #include "ze_null.h"
+#include <cstring>
 
 namespace driver
 {
@@ -4108,6 +4109,262 @@ zesGetTemperatureProcAddrTable(
     return result;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling several of the application's zes
+///        tables with current process' addresses in a single call
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_FEATURE
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zesGetAllProcAddrTables(
+    ze_api_version_t version,                     ///< [in] API version requested
+    uint32_t count,                                 ///< [in] number of tables
+    const char** ppTableNames,                      ///< [in][range(0, count)] export name of each table
+    void** ppTables                                 ///< [in,out][range(0, count)] pointer to each table of DDI function pointers
+    )
+{
+    if( ( 0 != count ) && ( ( nullptr == ppTableNames ) || ( nullptr == ppTables ) ) )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if( driver::context.version < version )
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    // the tables are filled here rather than through the per-table exports,
+    // which may be interposed by the loader's exports of the same name
+    for( uint32_t i = 0; i < count; ++i )
+    {
+        if( ( nullptr == ppTableNames[ i ] ) || ( nullptr == ppTables[ i ] ) )
+            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+        if( 0 == strcmp( ppTableNames[ i ], "zesGetGlobalProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<zes_global_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnInit                                   = driver::zesInit;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zesGetDeviceProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<zes_device_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnGetProperties                          = driver::zesDeviceGetProperties;
+            pDdiTable->pfnGetState                               = driver::zesDeviceGetState;
+            pDdiTable->pfnReset                                  = driver::zesDeviceReset;
+            pDdiTable->pfnProcessesGetState                      = driver::zesDeviceProcessesGetState;
+            pDdiTable->pfnPciGetProperties                       = driver::zesDevicePciGetProperties;
+            pDdiTable->pfnPciGetState                            = driver::zesDevicePciGetState;
+            pDdiTable->pfnPciGetBars                             = driver::zesDevicePciGetBars;
+            pDdiTable->pfnPciGetStats                            = driver::zesDevicePciGetStats;
+            pDdiTable->pfnEnumDiagnosticTestSuites               = driver::zesDeviceEnumDiagnosticTestSuites;
+            pDdiTable->pfnEnumEngineGroups                       = driver::zesDeviceEnumEngineGroups;
+            pDdiTable->pfnEventRegister                          = driver::zesDeviceEventRegister;
+            pDdiTable->pfnEnumFabricPorts                        = driver::zesDeviceEnumFabricPorts;
+            pDdiTable->pfnEnumFans                               = driver::zesDeviceEnumFans;
+            pDdiTable->pfnEnumFirmwares                          = driver::zesDeviceEnumFirmwares;
+            pDdiTable->pfnEnumFrequencyDomains                   = driver::zesDeviceEnumFrequencyDomains;
+            pDdiTable->pfnEnumLeds                               = driver::zesDeviceEnumLeds;
+            pDdiTable->pfnEnumMemoryModules                      = driver::zesDeviceEnumMemoryModules;
+            pDdiTable->pfnEnumPerformanceFactorDomains           = driver::zesDeviceEnumPerformanceFactorDomains;
+            pDdiTable->pfnEnumPowerDomains                       = driver::zesDeviceEnumPowerDomains;
+            pDdiTable->pfnGetCardPowerDomain                     = driver::zesDeviceGetCardPowerDomain;
+            pDdiTable->pfnEnumPsus                               = driver::zesDeviceEnumPsus;
+            pDdiTable->pfnEnumRasErrorSets                       = driver::zesDeviceEnumRasErrorSets;
+            pDdiTable->pfnEnumSchedulers                         = driver::zesDeviceEnumSchedulers;
+            pDdiTable->pfnEnumStandbyDomains                     = driver::zesDeviceEnumStandbyDomains;
+            pDdiTable->pfnEnumTemperatureSensors                 = driver::zesDeviceEnumTemperatureSensors;
+            pDdiTable->pfnEccAvailable                           = driver::zesDeviceEccAvailable;
+            pDdiTable->pfnEccConfigurable                        = driver::zesDeviceEccConfigurable;
+            pDdiTable->pfnGetEccState                            = driver::zesDeviceGetEccState;
+            pDdiTable->pfnSetEccState                            = driver::zesDeviceSetEccState;
+            pDdiTable->pfnGet                                    = driver::zesDeviceGet;
+            pDdiTable->pfnSetOverclockWaiver                     = driver::zesDeviceSetOverclockWaiver;
+            pDdiTable->pfnGetOverclockDomains                    = driver::zesDeviceGetOverclockDomains;
+            pDdiTable->pfnGetOverclockControls                   = driver::zesDeviceGetOverclockControls;
+            pDdiTable->pfnResetOverclockSettings                 = driver::zesDeviceResetOverclockSettings;
+            pDdiTable->pfnReadOverclockState                     = driver::zesDeviceReadOverclockState;
+            pDdiTable->pfnEnumOverclockDomains                   = driver::zesDeviceEnumOverclockDomains;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zesGetDriverProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<zes_driver_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnEventListen                            = driver::zesDriverEventListen;
+            pDdiTable->pfnEventListenEx                          = driver::zesDriverEventListenEx;
+            pDdiTable->pfnGet                                    = driver::zesDriverGet;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zesGetDiagnosticsProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<zes_diagnostics_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnGetProperties                          = driver::zesDiagnosticsGetProperties;
+            pDdiTable->pfnGetTests                               = driver::zesDiagnosticsGetTests;
+            pDdiTable->pfnRunTests                               = driver::zesDiagnosticsRunTests;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zesGetEngineProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<zes_engine_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnGetProperties                          = driver::zesEngineGetProperties;
+            pDdiTable->pfnGetActivity                            = driver::zesEngineGetActivity;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zesGetFabricPortProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<zes_fabric_port_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnGetProperties                          = driver::zesFabricPortGetProperties;
+            pDdiTable->pfnGetLinkType                            = driver::zesFabricPortGetLinkType;
+            pDdiTable->pfnGetConfig                              = driver::zesFabricPortGetConfig;
+            pDdiTable->pfnSetConfig                              = driver::zesFabricPortSetConfig;
+            pDdiTable->pfnGetState                               = driver::zesFabricPortGetState;
+            pDdiTable->pfnGetThroughput                          = driver::zesFabricPortGetThroughput;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zesGetFanProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<zes_fan_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnGetProperties                          = driver::zesFanGetProperties;
+            pDdiTable->pfnGetConfig                              = driver::zesFanGetConfig;
+            pDdiTable->pfnSetDefaultMode                         = driver::zesFanSetDefaultMode;
+            pDdiTable->pfnSetFixedSpeedMode                      = driver::zesFanSetFixedSpeedMode;
+            pDdiTable->pfnSetSpeedTableMode                      = driver::zesFanSetSpeedTableMode;
+            pDdiTable->pfnGetState                               = driver::zesFanGetState;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zesGetFirmwareProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<zes_firmware_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnGetProperties                          = driver::zesFirmwareGetProperties;
+            pDdiTable->pfnFlash                                  = driver::zesFirmwareFlash;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zesGetFrequencyProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<zes_frequency_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnGetProperties                          = driver::zesFrequencyGetProperties;
+            pDdiTable->pfnGetAvailableClocks                     = driver::zesFrequencyGetAvailableClocks;
+            pDdiTable->pfnGetRange                               = driver::zesFrequencyGetRange;
+            pDdiTable->pfnSetRange                               = driver::zesFrequencySetRange;
+            pDdiTable->pfnGetState                               = driver::zesFrequencyGetState;
+            pDdiTable->pfnGetThrottleTime                        = driver::zesFrequencyGetThrottleTime;
+            pDdiTable->pfnOcGetCapabilities                      = driver::zesFrequencyOcGetCapabilities;
+            pDdiTable->pfnOcGetFrequencyTarget                   = driver::zesFrequencyOcGetFrequencyTarget;
+            pDdiTable->pfnOcSetFrequencyTarget                   = driver::zesFrequencyOcSetFrequencyTarget;
+            pDdiTable->pfnOcGetVoltageTarget                     = driver::zesFrequencyOcGetVoltageTarget;
+            pDdiTable->pfnOcSetVoltageTarget                     = driver::zesFrequencyOcSetVoltageTarget;
+            pDdiTable->pfnOcSetMode                              = driver::zesFrequencyOcSetMode;
+            pDdiTable->pfnOcGetMode                              = driver::zesFrequencyOcGetMode;
+            pDdiTable->pfnOcGetIccMax                            = driver::zesFrequencyOcGetIccMax;
+            pDdiTable->pfnOcSetIccMax                            = driver::zesFrequencyOcSetIccMax;
+            pDdiTable->pfnOcGetTjMax                             = driver::zesFrequencyOcGetTjMax;
+            pDdiTable->pfnOcSetTjMax                             = driver::zesFrequencyOcSetTjMax;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zesGetLedProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<zes_led_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnGetProperties                          = driver::zesLedGetProperties;
+            pDdiTable->pfnGetState                               = driver::zesLedGetState;
+            pDdiTable->pfnSetState                               = driver::zesLedSetState;
+            pDdiTable->pfnSetColor                               = driver::zesLedSetColor;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zesGetMemoryProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<zes_memory_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnGetProperties                          = driver::zesMemoryGetProperties;
+            pDdiTable->pfnGetState                               = driver::zesMemoryGetState;
+            pDdiTable->pfnGetBandwidth                           = driver::zesMemoryGetBandwidth;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zesGetOverclockProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<zes_overclock_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnGetDomainProperties                    = driver::zesOverclockGetDomainProperties;
+            pDdiTable->pfnGetDomainVFProperties                  = driver::zesOverclockGetDomainVFProperties;
+            pDdiTable->pfnGetDomainControlProperties             = driver::zesOverclockGetDomainControlProperties;
+            pDdiTable->pfnGetControlCurrentValue                 = driver::zesOverclockGetControlCurrentValue;
+            pDdiTable->pfnGetControlPendingValue                 = driver::zesOverclockGetControlPendingValue;
+            pDdiTable->pfnSetControlUserValue                    = driver::zesOverclockSetControlUserValue;
+            pDdiTable->pfnGetControlState                        = driver::zesOverclockGetControlState;
+            pDdiTable->pfnGetVFPointValues                       = driver::zesOverclockGetVFPointValues;
+            pDdiTable->pfnSetVFPointValues                       = driver::zesOverclockSetVFPointValues;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zesGetPerformanceFactorProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<zes_performance_factor_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnGetProperties                          = driver::zesPerformanceFactorGetProperties;
+            pDdiTable->pfnGetConfig                              = driver::zesPerformanceFactorGetConfig;
+            pDdiTable->pfnSetConfig                              = driver::zesPerformanceFactorSetConfig;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zesGetPowerProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<zes_power_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnGetProperties                          = driver::zesPowerGetProperties;
+            pDdiTable->pfnGetEnergyCounter                       = driver::zesPowerGetEnergyCounter;
+            pDdiTable->pfnGetLimits                              = driver::zesPowerGetLimits;
+            pDdiTable->pfnSetLimits                              = driver::zesPowerSetLimits;
+            pDdiTable->pfnGetEnergyThreshold                     = driver::zesPowerGetEnergyThreshold;
+            pDdiTable->pfnSetEnergyThreshold                     = driver::zesPowerSetEnergyThreshold;
+            pDdiTable->pfnGetLimitsExt                           = driver::zesPowerGetLimitsExt;
+            pDdiTable->pfnSetLimitsExt                           = driver::zesPowerSetLimitsExt;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zesGetPsuProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<zes_psu_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnGetProperties                          = driver::zesPsuGetProperties;
+            pDdiTable->pfnGetState                               = driver::zesPsuGetState;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zesGetRasProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<zes_ras_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnGetProperties                          = driver::zesRasGetProperties;
+            pDdiTable->pfnGetConfig                              = driver::zesRasGetConfig;
+            pDdiTable->pfnSetConfig                              = driver::zesRasSetConfig;
+            pDdiTable->pfnGetState                               = driver::zesRasGetState;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zesGetSchedulerProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<zes_scheduler_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnGetProperties                          = driver::zesSchedulerGetProperties;
+            pDdiTable->pfnGetCurrentMode                         = driver::zesSchedulerGetCurrentMode;
+            pDdiTable->pfnGetTimeoutModeProperties               = driver::zesSchedulerGetTimeoutModeProperties;
+            pDdiTable->pfnGetTimesliceModeProperties             = driver::zesSchedulerGetTimesliceModeProperties;
+            pDdiTable->pfnSetTimeoutMode                         = driver::zesSchedulerSetTimeoutMode;
+            pDdiTable->pfnSetTimesliceMode                       = driver::zesSchedulerSetTimesliceMode;
+            pDdiTable->pfnSetExclusiveMode                       = driver::zesSchedulerSetExclusiveMode;
+            pDdiTable->pfnSetComputeUnitDebugMode                = driver::zesSchedulerSetComputeUnitDebugMode;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zesGetStandbyProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<zes_standby_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnGetProperties                          = driver::zesStandbyGetProperties;
+            pDdiTable->pfnGetMode                                = driver::zesStandbyGetMode;
+            pDdiTable->pfnSetMode                                = driver::zesStandbySetMode;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zesGetTemperatureProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<zes_temperature_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnGetProperties                          = driver::zesTemperatureGetProperties;
+            pDdiTable->pfnGetConfig                              = driver::zesTemperatureGetConfig;
+            pDdiTable->pfnSetConfig                              = driver::zesTemperatureSetConfig;
+            pDdiTable->pfnGetState                               = driver::zesTemperatureGetState;
+        }
+
+        else
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    return ZE_RESULT_SUCCESS;
+}
+
 #if defined(__cplusplus)
 };
 #endif
@@ -8,6 +8,7 @@
  *
  */
 #include "ze_null.h"
+#include <cstring>
 
 namespace driver
 {
@@ -1555,6 +1556,149 @@ zetGetTracerExpProcAddrTable(
     return result;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling several of the application's zet
+///        tables with current process' addresses in a single call
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_FEATURE
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zetGetAllProcAddrTables(
+    ze_api_version_t version,                     ///< [in] API version requested
+    uint32_t count,                                 ///< [in] number of tables
+    const char** ppTableNames,                      ///< [in][range(0, count)] export name of each table
+    void** ppTables                                 ///< [in,out][range(0, count)] pointer to each table of DDI function pointers
+    )
+{
+    if( ( 0 != count ) && ( ( nullptr == ppTableNames ) || ( nullptr == ppTables ) ) )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if( driver::context.version < version )
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    // the tables are filled here rather than through the per-table exports,
+    // which may be interposed by the loader's exports of the same name
+    for( uint32_t i = 0; i < count; ++i )
+    {
+        if( ( nullptr == ppTableNames[ i ] ) || ( nullptr == ppTables[ i ] ) )
+            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+        if( 0 == strcmp( ppTableNames[ i ], "zetGetDeviceProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<zet_device_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnGetDebugProperties                     = driver::zetDeviceGetDebugProperties;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zetGetContextProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<zet_context_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnActivateMetricGroups                   = driver::zetContextActivateMetricGroups;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zetGetCommandListProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<zet_command_list_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnAppendMetricStreamerMarker             = driver::zetCommandListAppendMetricStreamerMarker;
+            pDdiTable->pfnAppendMetricQueryBegin                 = driver::zetCommandListAppendMetricQueryBegin;
+            pDdiTable->pfnAppendMetricQueryEnd                   = driver::zetCommandListAppendMetricQueryEnd;
+            pDdiTable->pfnAppendMetricMemoryBarrier              = driver::zetCommandListAppendMetricMemoryBarrier;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zetGetKernelProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<zet_kernel_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnGetProfileInfo                         = driver::zetKernelGetProfileInfo;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zetGetModuleProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<zet_module_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnGetDebugInfo                           = driver::zetModuleGetDebugInfo;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zetGetDebugProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<zet_debug_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnAttach                                 = driver::zetDebugAttach;
+            pDdiTable->pfnDetach                                 = driver::zetDebugDetach;
+            pDdiTable->pfnReadEvent                              = driver::zetDebugReadEvent;
+            pDdiTable->pfnAcknowledgeEvent                       = driver::zetDebugAcknowledgeEvent;
+            pDdiTable->pfnInterrupt                              = driver::zetDebugInterrupt;
+            pDdiTable->pfnResume                                 = driver::zetDebugResume;
+            pDdiTable->pfnReadMemory                             = driver::zetDebugReadMemory;
+            pDdiTable->pfnWriteMemory                            = driver::zetDebugWriteMemory;
+            pDdiTable->pfnGetRegisterSetProperties               = driver::zetDebugGetRegisterSetProperties;
+            pDdiTable->pfnReadRegisters                          = driver::zetDebugReadRegisters;
+            pDdiTable->pfnWriteRegisters                         = driver::zetDebugWriteRegisters;
+            pDdiTable->pfnGetThreadRegisterSetProperties         = driver::zetDebugGetThreadRegisterSetProperties;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zetGetMetricProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<zet_metric_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnGet                                    = driver::zetMetricGet;
+            pDdiTable->pfnGetProperties                          = driver::zetMetricGetProperties;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zetGetMetricGroupProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<zet_metric_group_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnGet                                    = driver::zetMetricGroupGet;
+            pDdiTable->pfnGetProperties                          = driver::zetMetricGroupGetProperties;
+            pDdiTable->pfnCalculateMetricValues                  = driver::zetMetricGroupCalculateMetricValues;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zetGetMetricGroupExpProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<zet_metric_group_exp_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnCalculateMultipleMetricValuesExp       = driver::zetMetricGroupCalculateMultipleMetricValuesExp;
+            pDdiTable->pfnGetGlobalTimestampsExp                 = driver::zetMetricGroupGetGlobalTimestampsExp;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zetGetMetricQueryProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<zet_metric_query_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnCreate                                 = driver::zetMetricQueryCreate;
+            pDdiTable->pfnDestroy                                = driver::zetMetricQueryDestroy;
+            pDdiTable->pfnReset                                  = driver::zetMetricQueryReset;
+            pDdiTable->pfnGetData                                = driver::zetMetricQueryGetData;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zetGetMetricQueryPoolProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<zet_metric_query_pool_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnCreate                                 = driver::zetMetricQueryPoolCreate;
+            pDdiTable->pfnDestroy                                = driver::zetMetricQueryPoolDestroy;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zetGetMetricStreamerProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<zet_metric_streamer_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnOpen                                   = driver::zetMetricStreamerOpen;
+            pDdiTable->pfnClose                                  = driver::zetMetricStreamerClose;
+            pDdiTable->pfnReadData                               = driver::zetMetricStreamerReadData;
+        }
+
+        else if( 0 == strcmp( ppTableNames[ i ], "zetGetTracerExpProcAddrTable" ) )
+        {
+            auto pDdiTable = static_cast<zet_tracer_exp_dditable_t*>( ppTables[ i ] );
+            pDdiTable->pfnCreate                                 = driver::zetTracerExpCreate;
+            pDdiTable->pfnDestroy                                = driver::zetTracerExpDestroy;
+            pDdiTable->pfnSetPrologues                           = driver::zetTracerExpSetPrologues;
+            pDdiTable->pfnSetEpilogues                           = driver::zetTracerExpSetEpilogues;
+            pDdiTable->pfnSetEnabled                             = driver::zetTracerExpSetEnabled;
+        }
+
+        else
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    return ZE_RESULT_SUCCESS;
+}
+
 #if defined(__cplusplus)
 };
 #endif
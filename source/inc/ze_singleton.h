@@ -1,17 +1,28 @@
 /*
  *
- * Copyright (C) 2019-2021 Intel Corporation
+ * Copyright (C) 2019-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 #pragma once
 #include <memory>
-#include <unordered_map>
 #include <mutex>
+#include <type_traits>
+#include <vector>
+
+#include "ze_slab.h"
 
 //////////////////////////////////////////////////////////////////////////
 /// a abstract factory for creation of singleton objects
+///
+/// instances are spread across a fixed number of independently locked
+/// shards, selected by a hash of the key, so that threads creating and
+/// releasing unrelated handles do not serialize on a single mutex
+///
+/// each shard keeps its instances inline in hash nodes carved out of a
+/// slab allocator; released nodes are recycled and the whole shard is
+/// torn down by dropping its slabs
 template<typename _singleton_t, typename _key_t>
 class singleton_factory_t
 {
@@ -19,11 +30,70 @@ protected:
     using singleton_t = _singleton_t;
     using key_t = typename std::conditional<std::is_pointer<_key_t>::value, size_t, _key_t>::type;
 
-    using ptr_t = std::unique_ptr < singleton_t >;
-    using map_t = std::unordered_map < key_t, ptr_t >;
+    static constexpr size_t shard_count = 32; ///< must be a power of two
+    static_assert( 0 == ( shard_count & ( shard_count - 1 ) ), "shard_count must be a power of two" );
+
+    //////////////////////////////////////////////////////////////////////////
+    /// hash chain node holding a single instance of singleton
+    struct node_t
+    {
+        node_t* next;
+        key_t key;
+        singleton_t value;
+
+        template<typename... Ts>
+        node_t( key_t _key, Ts&&... _params )
+            : next( nullptr ), key( _key ), value( std::forward<Ts>( _params )... )
+        {
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    /// each shard sits on its own cache line to avoid false sharing
+    struct alignas( 64 ) shard_t
+    {
+        std::mutex mut;                     ///< lock for thread-safety
+        std::vector<node_t*> buckets;       ///< hash chains; size is a power of two
+        size_t count = 0;                   ///< number of live instances
+        slab_allocator_t<node_t> nodes;     ///< backing storage for all nodes
+
+        ~shard_t()
+        {
+            // trivially destructible instances need no per-node work;
+            // the slabs are dropped wholesale by the allocator
+            if( std::is_trivially_destructible<singleton_t>::value )
+                return;
+            for( auto node : buckets )
+                while( node )
+                {
+                    auto next = node->next;
+                    nodes.destroy( node );
+                    node = next;
+                }
+        }
+
+        node_t** bucket( size_t hash )
+        {
+            return &buckets[ ( hash / shard_count ) & ( buckets.size() - 1 ) ];
+        }
+
+        void grow()
+        {
+            std::vector<node_t*> rehashed( buckets.empty() ? 16 : buckets.size() * 2, nullptr );
+            buckets.swap( rehashed );
+            for( auto node : rehashed )
+                while( node )
+                {
+                    auto next = node->next;
+                    auto head = bucket( getHash( node->key ) );
+                    node->next = *head;
+                    *head = node;
+                    node = next;
+                }
+        }
+    };
 
-    std::mutex mut; ///< lock for thread-safety
-    map_t map;      ///< single instance of singleton for each unique key
+    shard_t shards[ shard_count ];
 
     //////////////////////////////////////////////////////////////////////////
     /// extract the key from parameter list and if necessary, convert type
@@ -33,6 +103,22 @@ protected:
         return reinterpret_cast<key_t>( _key );
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    /// handles are usually pointers, so the low alignment bits are folded
+    /// into the rest of the value; the bits above the shard index select
+    /// the bucket within the shard
+    static size_t getHash( key_t key )
+    {
+        size_t hash = std::hash<key_t>()( key );
+        hash ^= ( hash >> 4 ) ^ ( hash >> 12 ) ^ ( hash >> 20 );
+        return hash;
+    }
+
+    shard_t& getShard( size_t hash )
+    {
+        return shards[ hash & ( shard_count - 1 ) ];
+    }
+
 public:
     //////////////////////////////////////////////////////////////////////////
     /// default ctor/dtor
@@ -52,22 +138,50 @@ public:
         if(key == 0) // No zero keys allowed in map
             return static_cast<_singleton_t*>(0);
 
-        std::lock_guard<std::mutex> lk( mut );
-        auto iter = map.find( key );
+        auto hash = getHash( key );
+        auto& shard = getShard( hash );
 
-        if( map.end() == iter )
+        std::lock_guard<std::mutex> lk( shard.mut );
+        if( !shard.buckets.empty() )
         {
-            auto ptr = std::make_unique<singleton_t>( std::forward<Ts>( _params )... );
-            iter = map.emplace( key, std::move( ptr ) ).first;
+            for( auto node = *shard.bucket( hash ); node; node = node->next )
+                if( node->key == key )
+                    return &node->value;
         }
-        return iter->second.get();
+
+        if( shard.count >= shard.buckets.size() )
+            shard.grow();
+
+        auto node = shard.nodes.create( key, std::forward<Ts>( _params )... );
+        auto head = shard.bucket( hash );
+        node->next = *head;
+        *head = node;
+        ++shard.count;
+        return &node->value;
     }
 
     //////////////////////////////////////////////////////////////////////////
     /// once the key is no longer valid, release the singleton
     void release( _key_t _key )
     {
-        std::lock_guard<std::mutex> lk( mut );
-        map.erase( getKey( _key ) );
+        auto key = getKey( _key );
+        auto hash = getHash( key );
+        auto& shard = getShard( hash );
+
+        std::lock_guard<std::mutex> lk( shard.mut );
+        if( shard.buckets.empty() )
+            return;
+
+        for( auto link = shard.bucket( hash ); *link; link = &( *link )->next )
+        {
+            auto node = *link;
+            if( node->key == key )
+            {
+                *link = node->next;
+                shard.nodes.destroy( node );
+                --shard.count;
+                return;
+            }
+        }
     }
 };
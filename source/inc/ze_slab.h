@@ -0,0 +1,102 @@
+/*
+ *
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#pragma once
+#include <cstddef>
+#include <new>
+#include <utility>
+
+//////////////////////////////////////////////////////////////////////////
+/// fixed-size element allocator backed by cache-line aligned slabs
+///
+/// elements are packed back to back inside each slab; released elements
+/// are recycled through an intrusive free list and all slabs are returned
+/// in one sweep when the allocator is destroyed
+///
+/// the allocator is not thread-safe; callers serialize access
+template<typename _value_t, size_t _elements_per_slab = 512>
+class slab_allocator_t
+{
+protected:
+    static constexpr size_t cache_line_size = 64;
+
+    union element_t
+    {
+        element_t* next;                                        ///< link while on the free list
+        alignas( _value_t ) unsigned char storage[ sizeof( _value_t ) ];
+    };
+
+    struct slab_t
+    {
+        slab_t* next;                                           ///< previously allocated slab
+        void* allocation;                                       ///< unaligned pointer returned by operator new
+        element_t* elements() { return reinterpret_cast<element_t*>( reinterpret_cast<unsigned char*>( this ) + header_size ); }
+    };
+
+    static constexpr size_t header_size = ( sizeof( slab_t ) + cache_line_size - 1 ) & ~( cache_line_size - 1 );
+    static constexpr size_t slab_size = header_size + sizeof( element_t ) * _elements_per_slab + cache_line_size;
+
+    slab_t* slabs = nullptr;        ///< singly linked list of all slabs
+    element_t* freeList = nullptr;  ///< released elements available for reuse
+    size_t used = _elements_per_slab; ///< elements handed out from the newest slab
+
+public:
+    //////////////////////////////////////////////////////////////////////////
+    slab_allocator_t() = default;
+    slab_allocator_t( const slab_allocator_t& ) = delete;
+    slab_allocator_t& operator=( const slab_allocator_t& ) = delete;
+
+    //////////////////////////////////////////////////////////////////////////
+    /// drops all slabs at once; live elements are not destroyed
+    ~slab_allocator_t()
+    {
+        while( slabs )
+        {
+            auto next = slabs->next;
+            ::operator delete( slabs->allocation );
+            slabs = next;
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// constructs a new element, reusing released storage when available
+    template<typename... Ts>
+    _value_t* create( Ts&&... _params )
+    {
+        element_t* element = freeList;
+        if( element )
+        {
+            freeList = element->next;
+        }
+        else
+        {
+            if( _elements_per_slab == used )
+            {
+                // align the slab so the elements start on a cache line boundary
+                void* allocation = ::operator new( slab_size );
+                auto address = ( reinterpret_cast<size_t>( allocation ) + cache_line_size - 1 ) & ~( cache_line_size - 1 );
+                auto slab = reinterpret_cast<slab_t*>( address );
+                slab->allocation = allocation;
+                slab->next = slabs;
+                slabs = slab;
+                used = 0;
+            }
+            element = slabs->elements() + used++;
+        }
+        return new( element->storage ) _value_t( std::forward<Ts>( _params )... );
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// destroys the element and returns its storage to the free list
+    void destroy( _value_t* value )
+    {
+        value->~_value_t();
+        auto element = reinterpret_cast<element_t*>( value );
+        element->next = freeList;
+        freeList = element;
+    }
+};
@@ -1,6 +1,6 @@
 /*
  *
- * Copyright (C) 2019-2021 Intel Corporation
+ * Copyright (C) 2019-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -118,3 +118,26 @@ inline bool getenv_tobool( const char* name )
         return false;
     return ( 0 == strcmp( "1", env ) );
 }
+
+///////////////////////////////////////////////////////////////////////////////
+inline unsigned long getenv_toulong( const char* name, unsigned long defaultValue )
+{
+    const char* env = nullptr;
+
+#if defined(_WIN32)
+    char buffer[24];
+    auto rc = GetEnvironmentVariable(name, buffer, 24);
+    if (0 != rc && rc <= 24) {
+        env = buffer;
+    }
+#else
+    env = getenv(name);
+#endif
+
+    if( ( nullptr == env ) || ( '\0' == *env ) )
+        return defaultValue;
+
+    char* end = nullptr;
+    auto value = strtoul( env, &end, 10 );
+    return ( '\0' == *end ) ? value : defaultValue;
+}
@@ -0,0 +1,244 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "api_profiler.h"
+#include "trace_recorder.h"
+#include "ze_util.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace tracing_layer {
+
+std::atomic<APIProfiler *> pGlobalAPIProfiler;
+
+//
+// profile of the calling thread; the holder marks it retired when the
+// thread exits, after which its counts are merged and it is freed
+//
+static thread_local thread_profile_t *currentThreadProfile = nullptr;
+
+struct ThreadProfileHolder {
+    thread_profile_t *profile = nullptr;
+    ~ThreadProfileHolder() {
+        if (profile != nullptr)
+            profile->retired.store(true, std::memory_order_release);
+    }
+};
+static thread_local ThreadProfileHolder threadProfileHolder;
+
+static uint64_t readProfileNanoseconds() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+APIProfiler *APIProfiler::create() {
+    if (!getenv_tobool("ZE_ENABLE_TRACING_PROFILER"))
+        return nullptr;
+
+    APIProfiler *profiler = new APIProfiler;
+    forEachTraceApiDesc([&](const trace_api_desc_t &desc) {
+        profiler->apiSlotCount = std::max(profiler->apiSlotCount, desc.id + 1);
+    });
+    profiler->retiredTotals.resize(profiler->apiSlotCount);
+
+    const char *pathEnv = getenv("ZE_TRACING_PROFILER_FILE");
+    if (pathEnv != nullptr)
+        profiler->outputPath = pathEnv;
+
+    profiler->startTimestamp = readTraceTimestamp();
+    profiler->startNanoseconds = readProfileNanoseconds();
+    pGlobalAPIProfiler.store(profiler, std::memory_order_release);
+    return profiler;
+}
+
+//
+// Profiles of threads still alive are left allocated, since those threads
+// mark them retired when they exit.
+//
+APIProfiler::~APIProfiler() { stop(); }
+
+//
+// Stop profiling and write the report.
+//
+void APIProfiler::stop() {
+    {
+        std::lock_guard<std::mutex> lock(profilesMutex);
+        if (stopped)
+            return;
+        stopped = true;
+    }
+    pGlobalAPIProfiler.store(nullptr, std::memory_order_release);
+
+    FILE *out = stderr;
+    if (!outputPath.empty()) {
+        out = fopen(outputPath.c_str(), "w");
+        if (out == nullptr)
+            out = stderr;
+    }
+    report(out);
+    if (out != stderr)
+        fclose(out);
+}
+
+thread_profile_t *APIProfiler::createThreadProfile() {
+    thread_profile_t *profile = new thread_profile_t;
+    profile->apis.reset(new std::atomic<api_profile_t *>[apiSlotCount]);
+    for (size_t i = 0; i < apiSlotCount; i++)
+        profile->apis[i].store(nullptr, std::memory_order_relaxed);
+    profile->retired.store(false, std::memory_order_relaxed);
+
+    // threads are created rarely compared to calls, so this is where the
+    // profiles of exited threads are merged
+    reclaimRetiredProfiles();
+
+    std::lock_guard<std::mutex> lock(profilesMutex);
+    profiles.push_back(profile);
+    threadCount++;
+    return profile;
+}
+
+api_profile_t *APIProfiler::createApiProfile(thread_profile_t *profile,
+                                             size_t apiId) {
+    api_profile_t *apiProfile = new api_profile_t;
+    apiProfile->count.store(0, std::memory_order_relaxed);
+    apiProfile->totalTicks.store(0, std::memory_order_relaxed);
+    apiProfile->maxTicks.store(0, std::memory_order_relaxed);
+    for (auto &bucket : apiProfile->buckets)
+        bucket.store(0, std::memory_order_relaxed);
+    profile->apis[apiId].store(apiProfile, std::memory_order_release);
+    return apiProfile;
+}
+
+void APIProfiler::recordCall(size_t apiId, uint64_t ticks) {
+    thread_profile_t *profile = currentThreadProfile;
+    if (profile == nullptr) {
+        profile = createThreadProfile();
+        currentThreadProfile = profile;
+        threadProfileHolder.profile = profile;
+    }
+    if (apiId >= apiSlotCount)
+        return;
+
+    api_profile_t *apiProfile = profile->apis[apiId].load(std::memory_order_relaxed);
+    if (apiProfile == nullptr)
+        apiProfile = createApiProfile(profile, apiId);
+
+    // single writer, no read-modify-write needed
+    auto &bucket = apiProfile->buckets[getProfileBucket(ticks)];
+    bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    apiProfile->count.store(apiProfile->count.load(std::memory_order_relaxed) + 1,
+                            std::memory_order_relaxed);
+    apiProfile->totalTicks.store(
+        apiProfile->totalTicks.load(std::memory_order_relaxed) + ticks,
+        std::memory_order_relaxed);
+    if (ticks > apiProfile->maxTicks.load(std::memory_order_relaxed))
+        apiProfile->maxTicks.store(ticks, std::memory_order_relaxed);
+}
+
+void APIProfiler::mergeThreadProfile(thread_profile_t *profile,
+                                     std::vector<api_profile_totals_t> &totals) {
+    for (size_t i = 0; i < apiSlotCount; i++) {
+        api_profile_t *apiProfile = profile->apis[i].load(std::memory_order_acquire);
+        if (apiProfile == nullptr)
+            continue;
+
+        api_profile_totals_t &apiTotals = totals[i];
+        if (apiTotals.buckets.empty())
+            apiTotals.buckets.resize(profileBucketCount, 0);
+        apiTotals.count += apiProfile->count.load(std::memory_order_relaxed);
+        apiTotals.totalTicks += apiProfile->totalTicks.load(std::memory_order_relaxed);
+        apiTotals.maxTicks = std::max(
+            apiTotals.maxTicks, apiProfile->maxTicks.load(std::memory_order_relaxed));
+        for (uint32_t b = 0; b < profileBucketCount; b++)
+            apiTotals.buckets[b] += apiProfile->buckets[b].load(std::memory_order_relaxed);
+    }
+}
+
+void APIProfiler::reclaimRetiredProfiles() {
+    std::lock_guard<std::mutex> lock(profilesMutex);
+    auto itr = profiles.begin();
+    while (itr != profiles.end()) {
+        thread_profile_t *profile = *itr;
+        if (!profile->retired.load(std::memory_order_acquire)) {
+            itr++;
+            continue;
+        }
+        mergeThreadProfile(profile, retiredTotals);
+        for (size_t i = 0; i < apiSlotCount; i++)
+            delete profile->apis[i].load(std::memory_order_relaxed);
+        delete profile;
+        itr = profiles.erase(itr);
+    }
+}
+
+//
+// Merge the counts of all threads so far and write them as a table sorted
+// by total time. Threads may keep calling while the report is made.
+//
+void APIProfiler::report(FILE *out) {
+    reclaimRetiredProfiles();
+
+    std::vector<api_profile_totals_t> totals;
+    size_t threads;
+    {
+        std::lock_guard<std::mutex> lock(profilesMutex);
+        totals = retiredTotals;
+        for (auto profile : profiles)
+            mergeThreadProfile(profile, totals);
+        threads = threadCount;
+    }
+
+    double ticksPerNanosecond = 1.0;
+    uint64_t elapsedTicks = readTraceTimestamp() - startTimestamp;
+    uint64_t elapsedNanoseconds = readProfileNanoseconds() - startNanoseconds;
+    if (elapsedNanoseconds != 0 && elapsedTicks != 0)
+        ticksPerNanosecond = static_cast<double>(elapsedTicks) / elapsedNanoseconds;
+
+    std::vector<const trace_api_desc_t *> apis;
+    forEachTraceApiDesc([&](const trace_api_desc_t &desc) {
+        if (totals[desc.id].count != 0)
+            apis.push_back(&desc);
+    });
+    std::sort(apis.begin(), apis.end(),
+              [&](const trace_api_desc_t *a, const trace_api_desc_t *b) {
+                  return totals[a->id].totalTicks > totals[b->id].totalTicks;
+              });
+
+    auto toNanoseconds = [&](uint64_t ticks) {
+        return static_cast<double>(ticks) / ticksPerNanosecond;
+    };
+    auto percentile = [&](const api_profile_totals_t &apiTotals, double fraction) {
+        uint64_t rank = static_cast<uint64_t>(fraction * apiTotals.count);
+        if (rank == 0)
+            rank = 1;
+        uint64_t seen = 0;
+        for (uint32_t b = 0; b < profileBucketCount; b++) {
+            seen += apiTotals.buckets[b];
+            if (seen >= rank)
+                return std::min(getProfileBucketLimit(b), apiTotals.maxTicks);
+        }
+        return apiTotals.maxTicks;
+    };
+
+    fprintf(out, "Level Zero API profile, %zu threads\n", threads);
+    fprintf(out, "%-48s %12s %14s %12s %12s %12s\n", "API", "Calls", "Total (us)",
+            "p50 (ns)", "p99 (ns)", "Max (ns)");
+    for (auto api : apis) {
+        const api_profile_totals_t &apiTotals = totals[api->id];
+        fprintf(out, "%-48s %12llu %14.1f %12.0f %12.0f %12.0f\n", api->name,
+                static_cast<unsigned long long>(apiTotals.count),
+                toNanoseconds(apiTotals.totalTicks) / 1000.0,
+                toNanoseconds(percentile(apiTotals, 0.50)),
+                toNanoseconds(percentile(apiTotals, 0.99)),
+                toNanoseconds(apiTotals.maxTicks));
+    }
+    fflush(out);
+}
+
+} // namespace tracing_layer
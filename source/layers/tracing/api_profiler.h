@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace tracing_layer {
+
+//
+// Built-in profiler of API calls, enabled with ZE_ENABLE_TRACING_PROFILER.
+// Each thread counts its calls and their latencies per API without locks;
+// the counts of all threads are merged into a table of calls, total time
+// and p50/p99/max latency per API, written when the tracing layer unloads
+// to the file named by ZE_TRACING_PROFILER_FILE, or to stderr.
+//
+// Latencies are kept in log-linear histograms: 16 buckets per power of two,
+// so a reported percentile is within 1/16 of the exact value.
+//
+
+const uint32_t profileSubBucketBits = 4;
+const uint32_t profileSubBucketCount = 1u << profileSubBucketBits;
+// latencies of 2^40 timestamp ticks and more share the last bucket
+const uint32_t profileMaxExponent = 40;
+const uint32_t profileBucketCount =
+    (profileMaxExponent - profileSubBucketBits + 2) * profileSubBucketCount;
+
+inline uint32_t getProfileBucket(uint64_t ticks) {
+    if (ticks < profileSubBucketCount)
+        return static_cast<uint32_t>(ticks);
+#if defined(_MSC_VER)
+    unsigned long exponent;
+    _BitScanReverse64(&exponent, ticks);
+#else
+    uint32_t exponent = 63 - __builtin_clzll(ticks);
+#endif
+    if (exponent > profileMaxExponent)
+        return profileBucketCount - 1;
+    uint32_t mantissa = static_cast<uint32_t>(
+        (ticks >> (exponent - profileSubBucketBits)) & (profileSubBucketCount - 1));
+    return (static_cast<uint32_t>(exponent) - profileSubBucketBits + 1) *
+               profileSubBucketCount +
+           mantissa;
+}
+
+// highest latency, in ticks, counted by a bucket
+inline uint64_t getProfileBucketLimit(uint32_t bucket) {
+    if (bucket < profileSubBucketCount)
+        return bucket;
+    uint32_t shift = bucket / profileSubBucketCount - 1;
+    uint64_t mantissa = profileSubBucketCount + bucket % profileSubBucketCount;
+    return ((mantissa + 1) << shift) - 1;
+}
+
+//
+// latencies of one API on one thread; only the owning thread writes them,
+// so updates are plain loads and stores that a report may read at any time
+//
+typedef struct api_profile {
+    std::atomic<uint64_t> count;
+    std::atomic<uint64_t> totalTicks;
+    std::atomic<uint64_t> maxTicks;
+    std::atomic<uint64_t> buckets[profileBucketCount];
+} api_profile_t;
+
+typedef struct thread_profile {
+    std::unique_ptr<std::atomic<api_profile_t *>[]> apis; // by API id
+    std::atomic<bool> retired;
+} thread_profile_t;
+
+// latencies of one API merged over threads
+typedef struct api_profile_totals {
+    uint64_t count = 0;
+    uint64_t totalTicks = 0;
+    uint64_t maxTicks = 0;
+    std::vector<uint64_t> buckets;
+} api_profile_totals_t;
+
+class APIProfiler {
+  public:
+    static APIProfiler *create();
+    ~APIProfiler();
+
+    void recordCall(size_t apiId, uint64_t ticks);
+
+    void report(FILE *out);
+    void stop();
+
+  private:
+    APIProfiler() = default;
+
+    thread_profile_t *createThreadProfile();
+    api_profile_t *createApiProfile(thread_profile_t *profile, size_t apiId);
+    void mergeThreadProfile(thread_profile_t *profile,
+                            std::vector<api_profile_totals_t> &totals);
+    void reclaimRetiredProfiles();
+
+    size_t apiSlotCount = 0;
+    uint64_t startTimestamp = 0;
+    uint64_t startNanoseconds = 0;
+    std::string outputPath;
+
+    std::mutex profilesMutex;
+    std::vector<thread_profile_t *> profiles;
+    std::vector<api_profile_totals_t> retiredTotals; // by API id
+    size_t threadCount = 0;
+    bool stopped = false;
+};
+
+// set while the profiler runs
+extern std::atomic<APIProfiler *> pGlobalAPIProfiler;
+
+} // namespace tracing_layer
@@ -0,0 +1,226 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "epilogue_worker.h"
+#include "tracing_imp.h"
+#include "ze_util.h"
+
+#include <chrono>
+#include <new>
+
+namespace tracing_layer {
+
+std::atomic<EpilogueWorker *> pGlobalEpilogueWorker;
+
+//
+// queue of the calling thread; the holder marks it retired when the
+// thread exits, after which the worker drains and frees it
+//
+static thread_local epilogue_queue_t *currentEpilogueQueue = nullptr;
+
+struct EpilogueQueueHolder {
+    epilogue_queue_t *queue = nullptr;
+    ~EpilogueQueueHolder() {
+        if (queue != nullptr)
+            queue->retired.store(true, std::memory_order_release);
+    }
+};
+static thread_local EpilogueQueueHolder epilogueQueueHolder;
+
+// longest time an idle worker leaves a queued entry undelivered
+static const std::chrono::milliseconds epiloguePollInterval(5);
+
+EpilogueWorker *EpilogueWorker::create() {
+    if (!getenv_tobool("ZE_TRACING_ASYNC_EPILOGUES"))
+        return nullptr;
+
+    EpilogueWorker *epilogueWorker = new EpilogueWorker;
+    epilogueWorker->worker = std::thread(&EpilogueWorker::workerLoop, epilogueWorker);
+    pGlobalEpilogueWorker.store(epilogueWorker, std::memory_order_release);
+    return epilogueWorker;
+}
+
+//
+// Queues of threads still alive are left allocated, since those threads
+// mark them retired when they exit.
+//
+EpilogueWorker::~EpilogueWorker() { stop(); }
+
+//
+// Deliver the entries queued so far and stop the worker. Threads call
+// their epilogues themselves from then on.
+//
+void EpilogueWorker::stop() {
+    if (!worker.joinable())
+        return;
+
+    pGlobalEpilogueWorker.store(nullptr, std::memory_order_release);
+    stopped.store(true, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> lock(workerMutex);
+        stopping = true;
+    }
+    workerCondition.notify_all();
+    worker.join();
+
+    // entries committed by calls that began before the stop and ended after
+    // the worker's last pass
+    auto inProgress = tracingInProgress;
+    tracingInProgress = 1;
+    deliverQueues();
+    tracingInProgress = inProgress;
+}
+
+epilogue_queue_t *EpilogueWorker::createQueue() {
+    epilogue_queue_t *queue = new epilogue_queue_t;
+    for (auto &block : queue->blocks)
+        block = nullptr;
+    queue->head.store(0, std::memory_order_relaxed);
+    queue->cachedTail = 0;
+    queue->tail.store(0, std::memory_order_relaxed);
+    queue->retired.store(false, std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> lock(queuesMutex);
+    queues.push_back(queue);
+    return queue;
+}
+
+void EpilogueWorker::deleteQueue(epilogue_queue_t *queue) {
+    for (auto block : queue->blocks)
+        delete[] block;
+    delete queue;
+}
+
+//
+// Return the next entry of the calling thread's queue, or nullptr when the
+// worker is stopped or no entry could be allocated, in which case the
+// caller calls the epilogue itself. The entry is published by commitEntry.
+//
+epilogue_entry_t *EpilogueWorker::beginEntry() {
+    if (stopped.load(std::memory_order_acquire))
+        return nullptr;
+
+    epilogue_queue_t *queue = currentEpilogueQueue;
+    if (queue == nullptr) {
+        queue = createQueue();
+        currentEpilogueQueue = queue;
+        epilogueQueueHolder.queue = queue;
+    }
+
+    uint64_t head = queue->head.load(std::memory_order_relaxed);
+    if (head - queue->cachedTail >= epilogue_queue_t::entryCount) {
+        queue->cachedTail = queue->tail.load(std::memory_order_acquire);
+        while (head - queue->cachedTail >= epilogue_queue_t::entryCount) {
+            if (stopped.load(std::memory_order_acquire))
+                return nullptr;
+            wake();
+            std::this_thread::yield();
+            queue->cachedTail = queue->tail.load(std::memory_order_acquire);
+        }
+    }
+
+    // the worker reads a block only after the head published with it
+    auto &block = queue->blocks[(head % epilogue_queue_t::entryCount) /
+                                epilogue_queue_t::blockEntryCount];
+    if (block == nullptr) {
+        block = new (std::nothrow) epilogue_entry_t[epilogue_queue_t::blockEntryCount];
+        if (block == nullptr)
+            return nullptr;
+    }
+    return &queue->entry(head);
+}
+
+//
+// The worker polls idle queues, so a thread only wakes it once every half
+// queue of entries, which keeps the wakeup off most calls.
+//
+void EpilogueWorker::commitEntry() {
+    epilogue_queue_t *queue = currentEpilogueQueue;
+    uint64_t head = queue->head.load(std::memory_order_relaxed) + 1;
+    queue->head.store(head, std::memory_order_release);
+    if (head - queue->cachedTail == epilogue_queue_t::entryCount / 2)
+        wake();
+}
+
+void EpilogueWorker::wake() {
+    std::lock_guard<std::mutex> lock(workerMutex);
+    workerCondition.notify_one();
+}
+
+//
+// Wait until the worker has delivered the entries that threads published
+// before the call; a pass of the worker that starts after the call reads
+// every such entry.
+//
+void EpilogueWorker::flush() {
+    std::unique_lock<std::mutex> lock(workerMutex);
+    if (stopping)
+        return;
+    uint64_t pass = startedPasses + 1;
+    workerCondition.notify_one();
+    flushCondition.wait(lock, [&]() { return completedPasses >= pass || stopping; });
+}
+
+void EpilogueWorker::workerLoop() {
+    // calls made from epilogues are not traced
+    tracingInProgress = 1;
+
+    std::unique_lock<std::mutex> lock(workerMutex);
+    for (;;) {
+        uint64_t pass = ++startedPasses;
+        bool stop = stopping;
+        lock.unlock();
+        size_t delivered = deliverQueues();
+        lock.lock();
+        completedPasses = pass;
+        flushCondition.notify_all();
+        if (stop)
+            break;
+        if (delivered == 0)
+            workerCondition.wait_for(lock, epiloguePollInterval);
+    }
+}
+
+//
+// Deliver the published entries of each queue, freeing the queues of
+// exited threads once they are drained.
+//
+size_t EpilogueWorker::deliverQueues() {
+    std::vector<epilogue_queue_t *> snapshot;
+    {
+        std::lock_guard<std::mutex> lock(queuesMutex);
+        snapshot = queues;
+    }
+
+    size_t delivered = 0;
+    for (auto queue : snapshot) {
+        bool retired = queue->retired.load(std::memory_order_acquire);
+        uint64_t tail = queue->tail.load(std::memory_order_relaxed);
+        uint64_t head = queue->head.load(std::memory_order_acquire);
+        for (; tail != head; tail++) {
+            epilogue_entry_t &entry = queue->entry(tail);
+            entry.deliver(entry);
+            // free each entry at once for threads blocked on a full queue
+            queue->tail.store(tail + 1, std::memory_order_release);
+            delivered++;
+        }
+        if (!retired)
+            continue;
+
+        std::lock_guard<std::mutex> lock(queuesMutex);
+        for (auto itr = queues.begin(); itr != queues.end(); itr++) {
+            if (*itr == queue) {
+                queues.erase(itr);
+                break;
+            }
+        }
+        deleteQueue(queue);
+    }
+    return delivered;
+}
+
+} // namespace tracing_layer
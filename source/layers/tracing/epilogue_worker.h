@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "ze_api.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace tracing_layer {
+
+//
+// Asynchronous epilogues, enabled with ZE_TRACING_ASYNC_EPILOGUES. Instead
+// of calling the epilogues of a traced call, the calling thread copies the
+// call's arguments and result into its own queue, and a worker thread calls
+// the epilogues from there, in the order the thread made its calls. The
+// epilogues see the call's values, handles returned through [out] arguments
+// and the result; pointers to the caller's input structures, arrays and
+// strings are passed as nullptr. Calls with pointer outputs other than single
+// [out] handles keep calling their epilogues before they return, and so do
+// calls made once the worker is stopped. A thread whose queue is full waits
+// for the worker.
+//
+
+// size of the arguments of any traced API
+const size_t maxEpilogueArgsSize = 128;
+
+typedef struct epilogue_entry {
+    // calls the epilogue with parameters pointing into args
+    void (*deliver)(struct epilogue_entry &entry);
+    void (*epilogue)(void);
+    void *pUserData;
+    void *pInstanceUserData;
+    ze_result_t result;
+    alignas(8) uint8_t args[maxEpilogueArgsSize];
+} epilogue_entry_t;
+
+//
+// ring of entries written by one thread and read by the worker; the owning
+// thread's indices and the worker's tail are kept on separate cache lines.
+// The ring's blocks of entries are allocated by the owning thread when it
+// first reaches them, so a thread with few calls in flight uses one block.
+//
+typedef struct epilogue_queue {
+    static const size_t entryCount = 2048;
+    static const size_t blockEntryCount = 64;
+    static const size_t blockCount = entryCount / blockEntryCount;
+
+    epilogue_entry_t *blocks[blockCount];
+    std::atomic<uint64_t> head;
+    uint64_t cachedTail; // tail as last read by the owning thread
+    char padding[64 - sizeof(std::atomic<uint64_t>) - sizeof(uint64_t)];
+    std::atomic<uint64_t> tail;
+    std::atomic<bool> retired;
+
+    epilogue_entry_t &entry(uint64_t index) {
+        return blocks[(index % entryCount) / blockEntryCount][index % blockEntryCount];
+    }
+} epilogue_queue_t;
+
+class EpilogueWorker {
+  public:
+    static EpilogueWorker *create();
+    ~EpilogueWorker();
+
+    epilogue_entry_t *beginEntry();
+    void commitEntry();
+
+    void flush();
+    void stop();
+
+  private:
+    EpilogueWorker() = default;
+
+    epilogue_queue_t *createQueue();
+    static void deleteQueue(epilogue_queue_t *queue);
+    void wake();
+    void workerLoop();
+    size_t deliverQueues();
+
+    std::mutex queuesMutex;
+    std::vector<epilogue_queue_t *> queues;
+
+    std::thread worker;
+    std::mutex workerMutex;
+    std::condition_variable workerCondition;
+    std::condition_variable flushCondition;
+    uint64_t startedPasses = 0;
+    uint64_t completedPasses = 0;
+    bool stopping = false;
+    std::atomic<bool> stopped{false};
+};
+
+// set while asynchronous epilogues are enabled
+extern std::atomic<EpilogueWorker *> pGlobalEpilogueWorker;
+
+} // namespace tracing_layer
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#include "../trace_recorder.h"
+
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace tracing_layer {
+
+// the mapping grows by doubling, starting with this size
+static const size_t initialTraceFileSize = 4 * 1024 * 1024;
+
+bool TraceFile::open(const std::string &path) {
+    fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    return fd >= 0;
+}
+
+bool TraceFile::write(const uint8_t *data, size_t size) {
+    if (fd < 0)
+        return false;
+
+    if (used + size > mappingSize) {
+        size_t newSize = mappingSize ? mappingSize : initialTraceFileSize;
+        while (used + size > newSize)
+            newSize *= 2;
+
+        if (mapping != nullptr)
+            munmap(mapping, mappingSize);
+        mapping = nullptr;
+        mappingSize = 0;
+
+        if (ftruncate(fd, newSize) != 0)
+            return false;
+        void *newMapping =
+            mmap(nullptr, newSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (newMapping == MAP_FAILED)
+            return false;
+        mapping = static_cast<uint8_t *>(newMapping);
+        mappingSize = newSize;
+    }
+
+    memcpy(mapping + used, data, size);
+    used += size;
+    return true;
+}
+
+void TraceFile::close() {
+    if (fd < 0)
+        return;
+    if (mapping != nullptr)
+        munmap(mapping, mappingSize);
+    mapping = nullptr;
+    mappingSize = 0;
+    if (ftruncate(fd, used) != 0) {
+        // the file keeps its zero filled tail
+    }
+    ::close(fd);
+    fd = -1;
+}
+
+uint64_t getTraceProcessId() { return static_cast<uint64_t>(getpid()); }
+
+uint64_t getTraceThreadId() {
+    return static_cast<uint64_t>(syscall(SYS_gettid));
+}
+
+} // namespace tracing_layer
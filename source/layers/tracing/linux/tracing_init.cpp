@@ -9,11 +9,21 @@
 
 namespace tracing_layer
 {
+    static TraceRecorder *traceRecorder = nullptr;
+    static APIProfiler *apiProfiler = nullptr;
+    static EpilogueWorker *epilogueWorker = nullptr;
+
     void __attribute__((constructor)) createAPITracerContextImp() {
         pGlobalAPITracerContextImp = new struct APITracerContextImp;
+        traceRecorder = TraceRecorder::create();
+        apiProfiler = APIProfiler::create();
+        epilogueWorker = EpilogueWorker::create();
     }
 
     void __attribute__((destructor)) deleteAPITracerContextImp() {
+        delete epilogueWorker;
+        delete apiProfiler;
+        delete traceRecorder;
         delete pGlobalAPITracerContextImp;
     }
 }
@@ -0,0 +1,167 @@
+#! /usr/bin/env python3
+"""
+ Copyright (C) 2023 Intel Corporation
+
+ SPDX-License-Identifier: MIT
+
+ Converts a file written by the tracing layer's trace recorder
+ (ZE_ENABLE_TRACING_RECORDER) to the Chrome trace event format, which
+ chrome://tracing and https://ui.perfetto.dev open.
+"""
+import argparse
+import json
+import struct
+import sys
+
+MAGIC = b"ZETRACE1"
+TAG_BLOCK = 1
+TAG_TRAILER = 2
+
+"""
+    reads the values of a recorder file in order
+"""
+class Reader:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def done(self):
+        return self.pos >= len(self.data)
+
+    def u8(self):
+        value = self.data[self.pos]
+        self.pos += 1
+        return value
+
+    def fixed64(self):
+        value, = struct.unpack_from("<Q", self.data, self.pos)
+        self.pos += 8
+        return value
+
+    def varint(self):
+        value = 0
+        shift = 0
+        while True:
+            byte = self.u8()
+            value |= (byte & 0x7f) << shift
+            if byte < 0x80:
+                return value
+            shift += 7
+
+    def signed_varint(self):
+        value = self.varint()
+        return (value >> 1) ^ -(value & 1)
+
+    def bytes(self, count):
+        value = self.data[self.pos:self.pos + count]
+        self.pos += count
+        return value
+
+"""
+    returns the header, the blocks and the dropped record count of a file
+"""
+def parse(data):
+    reader = Reader(data)
+    if reader.bytes(len(MAGIC)) != MAGIC:
+        raise ValueError("not a trace recorder file")
+
+    header = {'timestamp': reader.fixed64(), 'ns': reader.fixed64(), 'apis': {}}
+    for _ in range(reader.varint()):
+        api_id = reader.varint()
+        name = reader.bytes(reader.varint()).decode()
+        header['apis'][api_id] = (name, reader.u8())
+
+    blocks = []
+    dropped = None
+    while not reader.done():
+        tag = reader.u8()
+        if tag == TAG_TRAILER:
+            dropped = reader.varint()
+            break
+        if tag != TAG_BLOCK:
+            # a zero filled tail is left when the process did not exit cleanly
+            break
+
+        block = {'timestamp': reader.fixed64(), 'ns': reader.fixed64(),
+                 'tid': reader.varint(), 'records': []}
+        entry = 0
+        handles = [0] * 4
+        for _ in range(reader.varint()):
+            entry += reader.signed_varint()
+            duration = reader.varint()
+            api_id = reader.varint()
+            result = reader.varint()
+            name, handle_count = header['apis'].get(api_id, ("api%d" % api_id, 0))
+            for h in range(handle_count):
+                handles[h] = (handles[h] + reader.signed_varint()) & 0xffffffffffffffff
+            block['records'].append((entry & 0xffffffffffffffff, duration, name, result,
+                                     handles[:handle_count]))
+        blocks.append(block)
+
+    return header, blocks, dropped
+
+"""
+    returns the events of the Chrome trace event format
+"""
+def convert(header, blocks, dropped, pid):
+    # timestamps are processor ticks where available; the block with the
+    # latest clock reading gives their rate
+    ticks_per_ns = 1.0
+    if blocks:
+        last = max(blocks, key=lambda b: b['ns'])
+        elapsed_ns = last['ns'] - header['ns']
+        if elapsed_ns > 0 and last['timestamp'] > header['timestamp']:
+            ticks_per_ns = (last['timestamp'] - header['timestamp']) / elapsed_ns
+
+    def to_us(ticks):
+        return ticks / ticks_per_ns / 1000.0
+
+    events = []
+    for block in blocks:
+        for entry, duration, name, result, handles in block['records']:
+            events.append({
+                'name': name,
+                'ph': "X",
+                'ts': to_us(entry - header['timestamp']),
+                'dur': to_us(duration),
+                'pid': pid,
+                'tid': block['tid'],
+                'args': {
+                    'result': "0x%x" % result,
+                    'handles': ["0x%x" % h for h in handles]
+                }
+            })
+    events.sort(key=lambda e: e['ts'])
+
+    trace = {'traceEvents': events, 'displayTimeUnit': "ns"}
+    if dropped:
+        trace['otherData'] = {'droppedRecords': dropped}
+    return trace
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", help="file written by the trace recorder")
+    parser.add_argument("output", nargs="?", help="JSON file, standard output by default")
+    parser.add_argument("--pid", type=int, default=0, help="process id shown in the trace")
+    args = parser.parse_args()
+
+    with open(args.input, "rb") as f:
+        header, blocks, dropped = parse(f.read())
+
+    trace = convert(header, blocks, dropped, args.pid)
+    if dropped is None:
+        print("warning: trace has no trailer, the process did not stop the recorder",
+              file=sys.stderr)
+    elif dropped:
+        print("warning: %d calls were dropped, the ring buffers were full" % dropped,
+              file=sys.stderr)
+
+    if args.output:
+        with open(args.output, "w") as f:
+            json.dump(trace, f)
+    else:
+        json.dump(trace, sys.stdout)
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,274 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "trace_recorder.h"
+#include "ze_util.h"
+
+#include <chrono>
+#include <cstring>
+
+namespace tracing_layer {
+
+std::atomic<TraceRecorder *> pGlobalTraceRecorder;
+
+//
+// buffer of the calling thread; the holder marks it retired when the
+// thread exits, after which the flushing thread drains and frees it
+//
+static thread_local trace_thread_buffer_t *currentTraceBuffer = nullptr;
+
+struct TraceThreadBufferHolder {
+    trace_thread_buffer_t *buffer = nullptr;
+    ~TraceThreadBufferHolder() {
+        if (buffer != nullptr)
+            buffer->retired.store(true, std::memory_order_release);
+    }
+};
+static thread_local TraceThreadBufferHolder traceThreadBufferHolder;
+
+static uint64_t readTraceNanoseconds() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+static void encodeVarint(std::vector<uint8_t> &out, uint64_t value) {
+    uint8_t bytes[10];
+    size_t count = 0;
+    while (value >= 0x80) {
+        bytes[count++] = static_cast<uint8_t>(value | 0x80);
+        value >>= 7;
+    }
+    bytes[count++] = static_cast<uint8_t>(value);
+    out.insert(out.end(), bytes, bytes + count);
+}
+
+static void encodeSignedVarint(std::vector<uint8_t> &out, uint64_t delta) {
+    int64_t value = static_cast<int64_t>(delta);
+    encodeVarint(out, (static_cast<uint64_t>(value) << 1) ^
+                          static_cast<uint64_t>(value >> 63));
+}
+
+static void encodeFixed64(std::vector<uint8_t> &out, uint64_t value) {
+    uint8_t bytes[8];
+    for (int i = 0; i < 8; i++)
+        bytes[i] = static_cast<uint8_t>(value >> (8 * i));
+    out.insert(out.end(), bytes, bytes + 8);
+}
+
+TraceRecorder *TraceRecorder::create() {
+    if (!getenv_tobool("ZE_ENABLE_TRACING_RECORDER"))
+        return nullptr;
+
+    std::string path;
+    const char *pathEnv = getenv("ZE_TRACING_RECORDER_FILE");
+    if (pathEnv != nullptr && *pathEnv != '\0')
+        path = pathEnv;
+    else
+        path = "ze_trace." + std::to_string(getTraceProcessId()) + ".bin";
+
+    TraceRecorder *recorder = new TraceRecorder;
+    if (!recorder->start(path)) {
+        delete recorder;
+        return nullptr;
+    }
+    return recorder;
+}
+
+bool TraceRecorder::start(const std::string &path) {
+    if (!file.open(path))
+        return false;
+
+    const char magic[] = "ZETRACE1";
+    encoded.assign(magic, magic + 8);
+    encodeFixed64(encoded, readTraceTimestamp());
+    encodeFixed64(encoded, readTraceNanoseconds());
+    encodeVarint(encoded, zeTraceApiDescCount + zetTraceApiDescCount +
+                              zesTraceApiDescCount);
+    forEachTraceApiDesc([&](const trace_api_desc_t &desc) {
+        if (handleCounts.size() <= desc.id)
+            handleCounts.resize(desc.id + 1, 0);
+        handleCounts[desc.id] = desc.handleCount;
+
+        size_t nameLength = strlen(desc.name);
+        encodeVarint(encoded, desc.id);
+        encodeVarint(encoded, nameLength);
+        encoded.insert(encoded.end(), desc.name, desc.name + nameLength);
+        encoded.push_back(desc.handleCount);
+    });
+    if (!file.write(encoded.data(), encoded.size())) {
+        file.close();
+        return false;
+    }
+
+    flusher = std::thread(&TraceRecorder::flushLoop, this);
+    pGlobalTraceRecorder.store(this, std::memory_order_release);
+    return true;
+}
+
+//
+// Buffers of threads still alive are left allocated, since those threads
+// mark them retired when they exit.
+//
+TraceRecorder::~TraceRecorder() { stop(); }
+
+//
+// Stop recording and write what the threads have published so far. Calls
+// still running keep writing to their buffers, which are no longer read.
+//
+void TraceRecorder::stop() {
+    if (!flusher.joinable())
+        return;
+
+    pGlobalTraceRecorder.store(nullptr, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> lock(flusherMutex);
+        stopping = true;
+    }
+    flusherCondition.notify_all();
+    flusher.join();
+
+    flushBuffers();
+
+    uint64_t dropped = retiredDropped;
+    {
+        std::lock_guard<std::mutex> lock(buffersMutex);
+        for (auto buffer : buffers)
+            dropped += buffer->dropped.load(std::memory_order_relaxed);
+    }
+    encoded.assign(1, 2);
+    encodeVarint(encoded, dropped);
+    file.write(encoded.data(), encoded.size());
+    file.close();
+}
+
+trace_thread_buffer_t *TraceRecorder::createThreadBuffer() {
+    trace_thread_buffer_t *buffer = new trace_thread_buffer_t;
+    buffer->reserved = 0;
+    buffer->depth = 0;
+    buffer->head.store(0, std::memory_order_relaxed);
+    buffer->tail.store(0, std::memory_order_relaxed);
+    buffer->dropped.store(0, std::memory_order_relaxed);
+    buffer->retired.store(false, std::memory_order_relaxed);
+    buffer->threadId = getTraceThreadId();
+
+    std::lock_guard<std::mutex> lock(buffersMutex);
+    buffers.push_back(buffer);
+    return buffer;
+}
+
+//
+// Reserve the next record of the calling thread's buffer, or return
+// nullptr and count the call as dropped when the buffer is full.
+//
+api_record_t *TraceRecorder::beginRecord(uint32_t apiId) {
+    trace_thread_buffer_t *buffer = currentTraceBuffer;
+    if (buffer == nullptr) {
+        buffer = createThreadBuffer();
+        currentTraceBuffer = buffer;
+        traceThreadBufferHolder.buffer = buffer;
+    }
+
+    buffer->depth++;
+    if (buffer->reserved - buffer->tail.load(std::memory_order_acquire) >=
+        trace_thread_buffer_t::recordCount) {
+        buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    api_record_t *record =
+        &buffer->records[buffer->reserved % trace_thread_buffer_t::recordCount];
+    buffer->reserved++;
+    record->apiId = apiId;
+    return record;
+}
+
+//
+// Records of nested calls, made from tracer callbacks, are published
+// together with the call that contains them.
+//
+void TraceRecorder::endRecord() {
+    trace_thread_buffer_t *buffer = currentTraceBuffer;
+    if (--buffer->depth == 0)
+        buffer->head.store(buffer->reserved, std::memory_order_release);
+}
+
+void TraceRecorder::flushLoop() {
+    std::unique_lock<std::mutex> lock(flusherMutex);
+    while (!stopping) {
+        flusherCondition.wait_for(lock, std::chrono::milliseconds(10));
+        lock.unlock();
+        flushBuffers();
+        lock.lock();
+    }
+}
+
+//
+// Append the published records of each thread to the file, freeing the
+// buffers of exited threads once they are drained.
+//
+void TraceRecorder::flushBuffers() {
+    std::vector<trace_thread_buffer_t *> snapshot;
+    {
+        std::lock_guard<std::mutex> lock(buffersMutex);
+        snapshot = buffers;
+    }
+
+    for (auto buffer : snapshot) {
+        bool retired = buffer->retired.load(std::memory_order_acquire);
+        writeBlock(buffer);
+        if (!retired)
+            continue;
+
+        std::lock_guard<std::mutex> lock(buffersMutex);
+        for (auto itr = buffers.begin(); itr != buffers.end(); itr++) {
+            if (*itr == buffer) {
+                buffers.erase(itr);
+                break;
+            }
+        }
+        retiredDropped += buffer->dropped.load(std::memory_order_relaxed);
+        delete buffer;
+    }
+}
+
+void TraceRecorder::writeBlock(trace_thread_buffer_t *buffer) {
+    uint64_t tail = buffer->tail.load(std::memory_order_relaxed);
+    uint64_t head = buffer->head.load(std::memory_order_acquire);
+    if (head == tail)
+        return;
+
+    encoded.assign(1, 1);
+    encodeFixed64(encoded, readTraceTimestamp());
+    encodeFixed64(encoded, readTraceNanoseconds());
+    encodeVarint(encoded, buffer->threadId);
+    encodeVarint(encoded, head - tail);
+
+    uint64_t previousEntry = 0;
+    uint64_t previousHandles[maxRecordedHandles] = {};
+    for (uint64_t i = tail; i != head; i++) {
+        const api_record_t &record =
+            buffer->records[i % trace_thread_buffer_t::recordCount];
+        encodeSignedVarint(encoded, record.entryTimestamp - previousEntry);
+        encodeVarint(encoded, record.exitTimestamp - record.entryTimestamp);
+        encodeVarint(encoded, record.apiId);
+        encodeVarint(encoded, record.result);
+        previousEntry = record.entryTimestamp;
+
+        uint8_t handleCount =
+            record.apiId < handleCounts.size() ? handleCounts[record.apiId] : 0;
+        for (uint8_t h = 0; h < handleCount; h++) {
+            encodeSignedVarint(encoded, record.handles[h] - previousHandles[h]);
+            previousHandles[h] = record.handles[h];
+        }
+    }
+
+    file.write(encoded.data(), encoded.size());
+    buffer->tail.store(head, std::memory_order_release);
+}
+
+} // namespace tracing_layer
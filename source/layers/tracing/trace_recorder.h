@@ -0,0 +1,213 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "api_profiler.h"
+#include "ze_api.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+
+namespace tracing_layer {
+
+//
+// Built-in recorder of API calls, enabled with ZE_ENABLE_TRACING_RECORDER.
+// Calls are captured into per-thread ring buffers without locks, and a
+// background thread appends them to the file named by
+// ZE_TRACING_RECORDER_FILE, ze_trace.<pid>.bin by default.
+//
+// File format, little endian; varints are LEB128, signed values zigzag
+// encoded:
+//   header  "ZETRACE1", u64 timestamp, u64 nanoseconds, varint api count,
+//           then per API: varint id, varint name length, name, u8 handles
+//   block   u8 1, u64 timestamp, u64 nanoseconds, varint thread id,
+//           varint record count, then per record: signed varint entry
+//           timestamp delta, varint duration, varint api id, varint
+//           result, signed varint delta of each handle
+//   trailer u8 2, varint dropped record count
+// Deltas are taken from the previous record of the block, starting at 0.
+// The (timestamp, nanoseconds) pairs relate timestamps to time.
+//
+
+const size_t maxRecordedHandles = 4;
+
+typedef struct api_record {
+    uint64_t entryTimestamp;
+    uint64_t exitTimestamp;
+    uint64_t handles[maxRecordedHandles];
+    uint32_t apiId;
+    uint32_t result;
+} api_record_t;
+
+//
+// ring of records written by one thread and read by the flushing thread;
+// reserved and depth are only used by the owning thread, which publishes
+// head when its outermost call returns
+//
+typedef struct trace_thread_buffer {
+    static const size_t recordCount = 16384;
+    api_record_t records[recordCount];
+    uint64_t reserved;
+    uint32_t depth;
+    std::atomic<uint64_t> head;
+    std::atomic<uint64_t> tail;
+    std::atomic<uint64_t> dropped;
+    std::atomic<bool> retired;
+    uint64_t threadId;
+} trace_thread_buffer_t;
+
+// description of a traced API written to the file header
+typedef struct trace_api_desc {
+    size_t id;
+    const char *name;
+    uint8_t handleCount;
+} trace_api_desc_t;
+
+// generated with the intercepts of each namespace
+extern const trace_api_desc_t zeTraceApiDescs[];
+extern const size_t zeTraceApiDescCount;
+extern const trace_api_desc_t zetTraceApiDescs[];
+extern const size_t zetTraceApiDescCount;
+extern const trace_api_desc_t zesTraceApiDescs[];
+extern const size_t zesTraceApiDescCount;
+
+template <typename TFunction>
+void forEachTraceApiDesc(TFunction function) {
+    for (size_t i = 0; i < zeTraceApiDescCount; i++)
+        function(zeTraceApiDescs[i]);
+    for (size_t i = 0; i < zetTraceApiDescCount; i++)
+        function(zetTraceApiDescs[i]);
+    for (size_t i = 0; i < zesTraceApiDescCount; i++)
+        function(zesTraceApiDescs[i]);
+}
+
+inline uint64_t readTraceTimestamp() {
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+#endif
+}
+
+// output file of the recorder, memory mapped where the platform allows
+class TraceFile {
+  public:
+    bool open(const std::string &path);
+    bool write(const uint8_t *data, size_t size);
+    void close();
+
+  private:
+    int fd = -1;            // Linux
+    void *stream = nullptr; // Windows
+    uint8_t *mapping = nullptr;
+    size_t mappingSize = 0;
+    size_t used = 0;
+};
+
+uint64_t getTraceProcessId();
+uint64_t getTraceThreadId();
+
+class TraceRecorder {
+  public:
+    static TraceRecorder *create();
+    ~TraceRecorder();
+
+    api_record_t *beginRecord(uint32_t apiId);
+    void endRecord();
+
+    void stop();
+
+  private:
+    TraceRecorder() = default;
+    bool start(const std::string &path);
+
+    trace_thread_buffer_t *createThreadBuffer();
+    void flushLoop();
+    void flushBuffers();
+    void writeBlock(trace_thread_buffer_t *buffer);
+
+    TraceFile file;
+    std::vector<uint8_t> handleCounts; // by API id
+    std::vector<uint8_t> encoded;
+    uint64_t retiredDropped = 0;
+
+    std::mutex buffersMutex;
+    std::vector<trace_thread_buffer_t *> buffers;
+
+    std::thread flusher;
+    std::mutex flusherMutex;
+    std::condition_variable flusherCondition;
+    bool stopping = false;
+};
+
+// set while the recorder runs
+extern std::atomic<TraceRecorder *> pGlobalTraceRecorder;
+
+//
+// Records one intercepted call for the recorder and the profiler, when they
+// run; every return path of the intercept passes its result through exit().
+//
+class APIRecordScope {
+  public:
+    template <typename... THandles>
+    APIRecordScope(size_t apiId, THandles... handles) : apiId(apiId) {
+        recorder = pGlobalTraceRecorder.load(std::memory_order_acquire);
+        profiler = pGlobalAPIProfiler.load(std::memory_order_acquire);
+        if (recorder == nullptr && profiler == nullptr)
+            return;
+        if (recorder != nullptr) {
+            record = recorder->beginRecord(static_cast<uint32_t>(apiId));
+            if (record != nullptr) {
+                const void *handleValues[] = {nullptr, handles...};
+                for (size_t i = 0; i < sizeof...(handles) && i < maxRecordedHandles; i++)
+                    record->handles[i] = reinterpret_cast<uintptr_t>(handleValues[i + 1]);
+            }
+        }
+        entryTimestamp = readTraceTimestamp();
+    }
+
+    ze_result_t exit(ze_result_t result) {
+        if (recorder == nullptr && profiler == nullptr)
+            return result;
+        uint64_t exitTimestamp = readTraceTimestamp();
+        if (record != nullptr) {
+            record->entryTimestamp = entryTimestamp;
+            record->exitTimestamp = exitTimestamp;
+            record->result = static_cast<uint32_t>(result);
+        }
+        if (recorder != nullptr)
+            recorder->endRecord();
+        if (profiler != nullptr)
+            profiler->recordCall(apiId, exitTimestamp - entryTimestamp);
+        return result;
+    }
+
+  private:
+    size_t apiId;
+    uint64_t entryTimestamp = 0;
+    TraceRecorder *recorder = nullptr;
+    APIProfiler *profiler = nullptr;
+    api_record_t *record = nullptr;
+};
+
+} // namespace tracing_layer
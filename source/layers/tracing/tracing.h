@@ -11,12 +11,21 @@
 #include "layers/zel_tracing_api.h"
 #include "layers/zel_tracing_register_cb.h"
 #include "ze_tracing_cb_structs.h"
+#include "zet_tracing_cb_structs.h"
+#include "zes_tracing_cb_structs.h"
 
 struct _zel_tracer_handle_t {};
 
 #define TRACING_COMP_NAME "tracing layer"
 namespace tracing_layer {
 
+// callbacks of a tracer for every traced API
+typedef struct tracer_callbacks {
+    zel_all_core_callbacks_t core;
+    zel_all_tools_callbacks_t tools;
+    zel_all_sysman_callbacks_t sysman;
+} tracer_callbacks_t;
+
 struct APITracer : _zel_tracer_handle_t {
     static APITracer *create();
     virtual ~APITracer() = default;
@@ -25,7 +34,7 @@ struct APITracer : _zel_tracer_handle_t {
     virtual ze_result_t destroyTracer(zel_tracer_handle_t phTracer) = 0;
     virtual ze_result_t setPrologues(zel_core_callbacks_t *pCoreCbs) = 0;
     virtual ze_result_t setEpilogues(zel_core_callbacks_t *pCoreCbs) = 0;
-    virtual zel_all_core_callbacks_t& getProEpilogues(zel_tracer_reg_t callback_type, ze_result_t& result) = 0;
+    virtual tracer_callbacks_t& getProEpilogues(zel_tracer_reg_t callback_type, ze_result_t& result) = 0;
     virtual ze_result_t resetAllCallbacks() = 0;
     virtual ze_result_t enableTracer(ze_bool_t enable) = 0;
 };
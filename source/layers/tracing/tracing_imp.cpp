@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2021 Intel Corporation
+ * Copyright (C) 2020-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,16 +7,116 @@
 
 #include "tracing_imp.h"
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
 namespace tracing_layer {
 
 thread_local ze_bool_t tracingInProgress = 0;
 
+std::atomic<uint64_t> tracedApiMask[tracedApiMaskWords];
+std::atomic<uint64_t> sampledApiMask[tracedApiMaskWords];
+api_sampling_t apiSamplings[tracerApiCount];
+
+thread_local api_sample_state_t *threadSampleStates = nullptr;
+
+struct ThreadSampleStatesHolder {
+    api_sample_state_t *states = nullptr;
+    ~ThreadSampleStatesHolder() {
+        delete[] states;
+        threadSampleStates = nullptr;
+    }
+};
+static thread_local ThreadSampleStatesHolder threadSampleStatesHolder;
+
 struct APITracerContextImp *pGlobalAPITracerContextImp;
 
+api_sample_state_t *createThreadSampleStates() {
+    threadSampleStates = new api_sample_state_t[tracerApiCount]();
+    threadSampleStatesHolder.states = threadSampleStates;
+    return threadSampleStates;
+}
+
+static uint64_t getSamplingGcd(uint64_t a, uint64_t b) {
+    while (b != 0) {
+        uint64_t remainder = a % b;
+        a = b;
+        b = remainder;
+    }
+    return a;
+}
+
+static ze_result_t checkTracerSampling(zel_tracer_sampling_mode_t mode,
+                                       uint64_t rate) {
+    switch (mode) {
+    case ZEL_TRACER_SAMPLING_MODE_ALL:
+        return ZE_RESULT_SUCCESS;
+    case ZEL_TRACER_SAMPLING_MODE_ONE_IN_N:
+    case ZEL_TRACER_SAMPLING_MODE_INTERVAL:
+        return rate == 0 ? ZE_RESULT_ERROR_INVALID_ARGUMENT : ZE_RESULT_SUCCESS;
+    default:
+        return ZE_RESULT_ERROR_INVALID_ENUMERATION;
+    }
+}
+
+//
+// Take the sampling of the tracer from the zel_tracer_sampling_desc_t in
+// the pNext chain of its descriptor, if any.
+//
+static ze_result_t setTracerSampling(APITracerImp *tracer,
+                                     const zel_tracer_desc_t *desc) {
+    const void *pNext = desc->pNext;
+    while (pNext != nullptr) {
+        // every descriptor starts with its type and pNext
+        const zel_tracer_desc_t *pBase =
+            static_cast<const zel_tracer_desc_t *>(pNext);
+        pNext = pBase->pNext;
+        if (pBase->stype != ZEL_STRUCTURE_TYPE_TRACER_SAMPLING_DESC)
+            continue;
+
+        const zel_tracer_sampling_desc_t *pSampling =
+            static_cast<const zel_tracer_sampling_desc_t *>(
+                static_cast<const void *>(pBase));
+        ze_result_t result = checkTracerSampling(pSampling->mode, pSampling->rate);
+        if (result != ZE_RESULT_SUCCESS)
+            return result;
+        tracer->sampling = {pSampling->mode, pSampling->rate};
+        if (pSampling->apiSamplingCount == 0)
+            continue;
+        if (pSampling->pApiSamplings == nullptr)
+            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+        tracer->apiSamplings.assign(tracerApiCount, tracer->sampling);
+        for (uint32_t i = 0; i < pSampling->apiSamplingCount; i++) {
+            const zel_tracer_api_sampling_t &apiSampling =
+                pSampling->pApiSamplings[i];
+            result = checkTracerSampling(apiSampling.mode, apiSampling.rate);
+            if (result != ZE_RESULT_SUCCESS)
+                return result;
+            if (apiSampling.pApiName == nullptr)
+                return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+            bool found = false;
+            forEachTraceApiDesc([&](const trace_api_desc_t &apiDesc) {
+                if (0 == strcmp(apiDesc.name, apiSampling.pApiName)) {
+                    tracer->apiSamplings[apiDesc.id] = {apiSampling.mode,
+                                                        apiSampling.rate};
+                    found = true;
+                }
+            });
+            if (!found)
+                return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
 APITracer *APITracer::create() {
     APITracerImp *tracer = new APITracerImp;
     tracer->tracingState = disabledState;
     tracer->tracerFunctions = {};
+    tracer->sampling = {ZEL_TRACER_SAMPLING_MODE_ALL, 0};
     UNRECOVERABLE_IF(tracer == nullptr);
     return tracer;
 }
@@ -32,6 +132,12 @@ ze_result_t createAPITracer(const zel_tracer_desc_t *desc,
 
     tracer->tracerFunctions.pUserData = desc->pUserData;
 
+    ze_result_t result = setTracerSampling(tracer, desc);
+    if (result != ZE_RESULT_SUCCESS) {
+        delete tracer;
+        return result;
+    }
+
     *phTracer = tracer->toHandle();
     return ZE_RESULT_SUCCESS;
 }
@@ -40,12 +146,19 @@ ze_result_t createAPITracer(const zel_tracer_desc_t *desc,
 // Hence, this function is executing in a single threaded environment,
 // and requires no mutex.
 APITracerContextImp::~APITracerContextImp() {
-    std::list<ThreadPrivateTracerData *>::iterator itr =
-        threadTracerDataList.begin();
-    while (itr != threadTracerDataList.end()) {
-        (*itr)->clearThreadTracerDataOnList();
-        itr = threadTracerDataList.erase(itr);
+    thread_tracer_slot_chunk_t *chunk =
+        threadSlotChunks.load(std::memory_order_relaxed);
+    while (chunk != nullptr) {
+        uint64_t usedSlots = chunk->usedSlots.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < thread_tracer_slot_chunk_t::slotCount; i++) {
+            if (usedSlots & (uint64_t(1) << i))
+                chunk->slots[i].owner->clearThreadTracerDataOnList();
+        }
+        thread_tracer_slot_chunk_t *next = chunk->next;
+        delete chunk;
+        chunk = next;
     }
+    threadSlotChunks.store(nullptr, std::memory_order_relaxed);
 }
 
 ze_result_t APITracerImp::destroyTracer(zel_tracer_handle_t phTracer) {
@@ -55,6 +168,11 @@ ze_result_t APITracerImp::destroyTracer(zel_tracer_handle_t phTracer) {
     ze_result_t result =
         pGlobalAPITracerContextImp->finalizeDisableImpTracingWait(tracer);
     if (result == ZE_RESULT_SUCCESS) {
+        // queued epilogues of the tracer may still use its user data
+        EpilogueWorker *epilogueWorker =
+            pGlobalEpilogueWorker.load(std::memory_order_acquire);
+        if (epilogueWorker != nullptr)
+            epilogueWorker->flush();
         delete tracing_layer::APITracer::fromHandle(phTracer);
     }
     return result;
@@ -66,7 +184,7 @@ ze_result_t APITracerImp::setPrologues(zel_core_callbacks_t *pCoreCbs) {
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
 
-    copyCoreCbsToAllCbs(this->tracerFunctions.corePrologues, *pCoreCbs);
+    copyCoreCbsToAllCbs(this->tracerFunctions.prologues.core, *pCoreCbs);
 
     return ZE_RESULT_SUCCESS;
 }
@@ -77,12 +195,12 @@ ze_result_t APITracerImp::setEpilogues(zel_core_callbacks_t *pCoreCbs) {
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
 
-    copyCoreCbsToAllCbs(this->tracerFunctions.coreEpilogues, *pCoreCbs);
+    copyCoreCbsToAllCbs(this->tracerFunctions.epilogues.core, *pCoreCbs);
 
     return ZE_RESULT_SUCCESS;
 }
 
-zel_all_core_callbacks_t& APITracerImp::getProEpilogues(zel_tracer_reg_t callback_type, ze_result_t& result) {
+tracer_callbacks_t& APITracerImp::getProEpilogues(zel_tracer_reg_t callback_type, ze_result_t& result) {
 
     result = ZE_RESULT_SUCCESS;
 
@@ -90,9 +208,9 @@ zel_all_core_callbacks_t& APITracerImp::getProEpilogues(zel_tracer_reg_t callbac
         result = ZE_RESULT_ERROR_INVALID_ARGUMENT;
 
     if (callback_type == ZEL_REGISTER_PROLOGUE)
-        return this->tracerFunctions.corePrologues;
+        return this->tracerFunctions.prologues;
     else
-        return this->tracerFunctions.coreEpilogues;
+        return this->tracerFunctions.epilogues;
 }
 
 ze_result_t APITracerImp::resetAllCallbacks() {
@@ -101,8 +219,8 @@ ze_result_t APITracerImp::resetAllCallbacks() {
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
 
-    this->tracerFunctions.corePrologues = {};
-    this->tracerFunctions.coreEpilogues = {};
+    this->tracerFunctions.prologues = {};
+    this->tracerFunctions.epilogues = {};
 
     return ZE_RESULT_SUCCESS;
 }
@@ -236,18 +354,68 @@ void APITracerImp::copyCoreCbsToAllCbs(zel_all_core_callbacks_t& allCbs, zel_cor
 
 }
     
+//
+// Claim a free slot of the registry for the thread, adding a chunk of
+// slots when all are in use.
+//
 void APITracerContextImp::addThreadTracerDataToList(
     ThreadPrivateTracerData *threadDataP) {
-    std::lock_guard<std::mutex> lock(threadTracerDataListMutex);
-    threadTracerDataList.push_back(threadDataP);
+    for (;;) {
+        thread_tracer_slot_chunk_t *head =
+            threadSlotChunks.load(std::memory_order_seq_cst);
+        for (thread_tracer_slot_chunk_t *chunk = head; chunk != nullptr;
+             chunk = chunk->next) {
+            uint64_t usedSlots = chunk->usedSlots.load(std::memory_order_relaxed);
+            while (~usedSlots != 0) {
+                size_t i = 0;
+                while (usedSlots & (uint64_t(1) << i))
+                    i++;
+                if (chunk->usedSlots.compare_exchange_weak(
+                        usedSlots, usedSlots | (uint64_t(1) << i),
+                        std::memory_order_acquire, std::memory_order_relaxed)) {
+                    chunk->slots[i].owner = threadDataP;
+                    threadDataP->slot = &chunk->slots[i];
+                    threadDataP->slotChunk = chunk;
+                    return;
+                }
+            }
+        }
+
+        thread_tracer_slot_chunk_t *chunk = new thread_tracer_slot_chunk_t;
+        for (size_t i = 0; i < thread_tracer_slot_chunk_t::slotCount; i++) {
+            chunk->slots[i].epoch.store(0, std::memory_order_relaxed);
+            chunk->slots[i].owner = nullptr;
+        }
+        chunk->slots[0].owner = threadDataP;
+        chunk->usedSlots.store(1, std::memory_order_relaxed);
+        chunk->next = head;
+        //
+        // Publishing the chunk is ordered before the thread's first epoch
+        // store, so a reclaiming thread that misses the chunk cannot miss
+        // an array reference made from it.
+        //
+        if (threadSlotChunks.compare_exchange_strong(head, chunk,
+                                                     std::memory_order_seq_cst)) {
+            threadDataP->slot = &chunk->slots[0];
+            threadDataP->slotChunk = chunk;
+            return;
+        }
+        delete chunk;
+    }
 }
 
+//
+// Release the thread's slot for reuse by threads created later.
+//
 void APITracerContextImp::removeThreadTracerDataFromList(
     ThreadPrivateTracerData *threadDataP) {
-    std::lock_guard<std::mutex> lock(threadTracerDataListMutex);
-    if (threadTracerDataList.empty())
-        return;
-    threadTracerDataList.remove(threadDataP);
+    thread_tracer_slot_chunk_t *chunk = threadDataP->slotChunk;
+    size_t i = threadDataP->slot - chunk->slots;
+    threadDataP->slot->epoch.store(0, std::memory_order_relaxed);
+    threadDataP->slot->owner = nullptr;
+    chunk->usedSlots.fetch_and(~(uint64_t(1) << i), std::memory_order_release);
+    threadDataP->slot = nullptr;
+    threadDataP->slotChunk = nullptr;
 }
 
 thread_local ThreadPrivateTracerData myThreadPrivateTracerData;
@@ -255,7 +423,8 @@ thread_local ThreadPrivateTracerData myThreadPrivateTracerData;
 ThreadPrivateTracerData::ThreadPrivateTracerData() {
     isInitialized = false;
     onList = false;
-    tracerArrayPointer.store(nullptr, std::memory_order_relaxed);
+    slot = nullptr;
+    slotChunk = nullptr;
 }
 
 ThreadPrivateTracerData::~ThreadPrivateTracerData() {
@@ -263,7 +432,6 @@ ThreadPrivateTracerData::~ThreadPrivateTracerData() {
         pGlobalAPITracerContextImp->removeThreadTracerDataFromList(this);
         onList = false;
     }
-    tracerArrayPointer.store(nullptr, std::memory_order_relaxed);
 }
 
 void ThreadPrivateTracerData::removeThreadTracerDataFromList(void) {
@@ -271,7 +439,6 @@ void ThreadPrivateTracerData::removeThreadTracerDataFromList(void) {
         pGlobalAPITracerContextImp->removeThreadTracerDataFromList(this);
         onList = false;
     }
-    tracerArrayPointer.store(nullptr, std::memory_order_relaxed);
 }
 
 bool ThreadPrivateTracerData::testAndSetThreadTracerDataInitializedAndOnList(
@@ -290,69 +457,152 @@ bool ThreadPrivateTracerData::testAndSetThreadTracerDataInitializedAndOnList(
 bool APITracerContextImp::isTracingEnabled() { return true; }
 
 //
-// Walk the list of per-thread private data structures, testing
-// whether any of them reference this array.
-//
-// Return 1 if a reference is found.  Otherwise return 0.
+// Walk the slots of the thread registry, returning the oldest epoch a
+// thread entered its current traced call at, or the largest epoch if no
+// thread is inside a traced call. Free slots hold epoch 0.
 //
-ze_bool_t
-APITracerContextImp::testForTracerArrayReferences(tracer_array_t *tracerArray) {
-    std::lock_guard<std::mutex> lock(threadTracerDataListMutex);
-    std::list<ThreadPrivateTracerData *>::iterator itr;
-    for (itr = threadTracerDataList.begin(); itr != threadTracerDataList.end();
-         itr++) {
-        if ((*itr)->tracerArrayPointer.load(std::memory_order_relaxed) ==
-            tracerArray)
-            return 1;
+uint64_t APITracerContextImp::oldestActiveEpoch() {
+    uint64_t oldestEpoch = std::numeric_limits<uint64_t>::max();
+    for (thread_tracer_slot_chunk_t *chunk =
+             threadSlotChunks.load(std::memory_order_seq_cst);
+         chunk != nullptr; chunk = chunk->next) {
+        for (size_t i = 0; i < thread_tracer_slot_chunk_t::slotCount; i++) {
+            uint64_t threadEpoch =
+                chunk->slots[i].epoch.load(std::memory_order_seq_cst);
+            if (threadEpoch != 0 && threadEpoch < oldestEpoch)
+                oldestEpoch = threadEpoch;
+        }
     }
-    return 0;
+    return oldestEpoch;
 }
 
 //
-// Walk the retiring_tracer_array_list, checking each member of the list for
-// references by per thread tracer array pointer. Delete and free
-// each tracer array that has no per-thread references.
+// Delete and free each tracer array on the retiring_tracer_array_list
+// that was retired no later than the oldest epoch still in use, in a
+// single walk of the per-thread data.
 //
 // Return the number of entries on the retiring tracer array list.
 //
 size_t APITracerContextImp::testAndFreeRetiredTracers() {
+    if (this->retiringTracerArrayList.empty())
+        return 0;
+
+    uint64_t oldestEpoch = oldestActiveEpoch();
     std::list<tracer_array_t *>::iterator itr =
         this->retiringTracerArrayList.begin();
     while (itr != this->retiringTracerArrayList.end()) {
         tracer_array_t *retiringTracerArray = *itr;
-        itr++;
-        if (testForTracerArrayReferences(retiringTracerArray))
+        if (retiringTracerArray->retireEpoch > oldestEpoch) {
+            itr++;
             continue;
-        this->retiringTracerArrayList.remove(retiringTracerArray);
-        delete[] retiringTracerArray->tracerArrayEntries;
+        }
+        itr = this->retiringTracerArrayList.erase(itr);
+        delete[] retiringTracerArray->apiRanges;
+        delete[] retiringTracerArray->apiCallbacks;
         delete retiringTracerArray;
     }
     return this->retiringTracerArrayList.size();
 }
 
+uint64_t APITracerContextImp::readSampleNanoseconds() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+//
+// Convert a sampling interval to timestamp ticks. The tick rate is measured
+// once, over at least a millisecond since the tracing layer was loaded.
+//
+uint64_t APITracerContextImp::getSampleIntervalTicks(uint64_t nanoseconds) {
+    if (ticksPerNanosecond == 0.0) {
+        const uint64_t minimumNanoseconds = 1000000;
+        uint64_t elapsedNanoseconds = readSampleNanoseconds() - startNanoseconds;
+        if (elapsedNanoseconds < minimumNanoseconds)
+            std::this_thread::sleep_for(std::chrono::nanoseconds(
+                minimumNanoseconds - elapsedNanoseconds));
+        uint64_t elapsedTicks = readTraceTimestamp() - startTimestamp;
+        elapsedNanoseconds = readSampleNanoseconds() - startNanoseconds;
+        ticksPerNanosecond = static_cast<double>(elapsedTicks) / elapsedNanoseconds;
+    }
+    return std::max<uint64_t>(
+        1, static_cast<uint64_t>(nanoseconds * ticksPerNanosecond));
+}
+
 size_t APITracerContextImp::updateTracerArrays() {
     tracer_array_t *newTracerArray;
     size_t newTracerArrayCount = this->enabledTracerImpList.size();
+    uint64_t newTracedApiMask[tracedApiMaskWords] = {};
+    uint64_t newSampledApiMask[tracedApiMaskWords] = {};
 
     if (newTracerArrayCount != 0) {
 
         newTracerArray = new tracer_array_t;
 
         newTracerArray->tracerArrayCount = newTracerArrayCount;
-        newTracerArray->tracerArrayEntries =
-            new tracer_array_entry_t[newTracerArrayCount];
+        newTracerArray->retireEpoch = 0;
+        newTracerArray->apiRanges = new tracer_api_range_t[tracerApiCount];
         //
-        // iterate over the list of enabled tracers, copying their entries into the
-        // new tracer array
+        // for each API, gather the callbacks of the enabled tracers that
+        // registered one, so that traced calls walk them in place
         //
-        size_t i = 0;
-        std::list<struct APITracerImp *>::iterator itr;
-        for (itr = enabledTracerImpList.begin(); itr != enabledTracerImpList.end();
-             itr++) {
-            newTracerArray->tracerArrayEntries[i] = (*itr)->tracerFunctions;
-            i++;
+        std::vector<tracer_api_callback_t> apiCallbacks;
+        for (size_t api = 0; api < tracerApiCount; api++) {
+            tracer_api_range_t &apiRange = newTracerArray->apiRanges[api];
+            apiRange.first = static_cast<uint32_t>(apiCallbacks.size());
+            uint64_t period = 0;
+            uint64_t interval = 0;
+            bool sampled = false;
+            std::list<struct APITracerImp *>::iterator itr;
+            for (itr = enabledTracerImpList.begin();
+                 itr != enabledTracerImpList.end(); itr++) {
+                const tracer_array_entry_t &entry = (*itr)->tracerFunctions;
+                tracer_api_callback_t callback;
+                callback.prologue = reinterpret_cast<const tracer_callback_fn_t *>(
+                    &entry.prologues)[api];
+                callback.epilogue = reinterpret_cast<const tracer_callback_fn_t *>(
+                    &entry.epilogues)[api];
+                callback.pUserData = entry.pUserData;
+                callback.sampling = (*itr)->apiSamplings.empty()
+                                        ? (*itr)->sampling
+                                        : (*itr)->apiSamplings[api];
+                if (callback.prologue == nullptr && callback.epilogue == nullptr)
+                    continue;
+                if (callback.sampling.mode == ZEL_TRACER_SAMPLING_MODE_INTERVAL)
+                    callback.sampling.rate =
+                        getSampleIntervalTicks(callback.sampling.rate);
+                apiCallbacks.push_back(callback);
+
+                switch (callback.sampling.mode) {
+                case ZEL_TRACER_SAMPLING_MODE_ONE_IN_N:
+                    period = getSamplingGcd(period, callback.sampling.rate);
+                    sampled = true;
+                    break;
+                case ZEL_TRACER_SAMPLING_MODE_INTERVAL:
+                    interval = getSamplingGcd(interval, callback.sampling.rate);
+                    sampled = true;
+                    break;
+                default:
+                    period = 1;
+                    break;
+                }
+            }
+            apiRange.count =
+                static_cast<uint32_t>(apiCallbacks.size()) - apiRange.first;
+            if (apiRange.count != 0)
+                newTracedApiMask[api / 64] |= uint64_t(1) << (api % 64);
+            if (sampled) {
+                newSampledApiMask[api / 64] |= uint64_t(1) << (api % 64);
+                apiSamplings[api].period.store(period, std::memory_order_relaxed);
+                apiSamplings[api].interval.store(interval, std::memory_order_relaxed);
+            }
         }
 
+        newTracerArray->apiCallbacks =
+            new tracer_api_callback_t[apiCallbacks.size()];
+        std::copy(apiCallbacks.begin(), apiCallbacks.end(),
+                  newTracerArray->apiCallbacks);
+
     } else {
         newTracerArray = &emptyTracerArray;
     }
@@ -363,15 +613,25 @@ size_t APITracerContextImp::updateTracerArrays() {
     //
     tracer_array_t *active_tracer_array_shadow =
         activeTracerArray.load(std::memory_order_relaxed);
+    //
+    // The new array must be visible before the epoch advances: a thread
+    // that reads the advanced epoch on entry then loads the new array.
+    //
+    activeTracerArray.store(newTracerArray, std::memory_order_seq_cst);
     if (active_tracer_array_shadow != &emptyTracerArray) {
+        active_tracer_array_shadow->retireEpoch =
+            globalEpoch.fetch_add(1, std::memory_order_seq_cst) + 1;
         retiringTracerArrayList.push_back(active_tracer_array_shadow);
     }
     //
-    // This active_tracer_array.store must use memory_order_release.
-    // This store DOES signal a logical transfer of tracer state information
-    // from this thread to the tracing threads.
+    // Calls that still see a stale bit either take the wrapper with no
+    // callbacks or miss a tracer enabled concurrently with them, which is
+    // no different from reading the previous tracer array.
     //
-    activeTracerArray.store(newTracerArray, std::memory_order_release);
+    for (size_t i = 0; i < tracedApiMaskWords; i++) {
+        sampledApiMask[i].store(newSampledApiMask[i], std::memory_order_release);
+        tracedApiMask[i].store(newTracedApiMask[i], std::memory_order_release);
+    }
     return testAndFreeRetiredTracers();
 }
 
@@ -439,13 +699,23 @@ ze_result_t APITracerContextImp::finalizeDisableImpTracingWait(
         result = ZE_RESULT_ERROR_HANDLE_OBJECT_IN_USE;
         break;
 
-    case disabledWaitingState:
-        while (testAndFreeRetiredTracers() != 0) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(1));
-        }
+    case disabledWaitingState: {
+        //
+        // Threads leaving a call entered before the last retire epoch wake
+        // this thread, which then tests the retired arrays again.
+        //
+        std::unique_lock<std::mutex> reclaimLock(reclaimMutex);
+        if (!retiringTracerArrayList.empty())
+            reclaimEpoch.store(retiringTracerArrayList.back()->retireEpoch,
+                               std::memory_order_seq_cst);
+        reclaimCondition.wait(reclaimLock, [this]() {
+            return testAndFreeRetiredTracers() == 0;
+        });
+        reclaimEpoch.store(0, std::memory_order_relaxed);
         tracerImp->tracingState = disabledState;
         result = ZE_RESULT_SUCCESS;
         break;
+    }
 
     default:
         result = ZE_RESULT_ERROR_UNINITIALIZED;
@@ -457,29 +727,32 @@ ze_result_t APITracerContextImp::finalizeDisableImpTracingWait(
 }
 
 void *APITracerContextImp::getActiveTracersList() {
-    tracer_array_t *stableTracerArray = nullptr;
-
     if (!myThreadPrivateTracerData
              .testAndSetThreadTracerDataInitializedAndOnList()) {
         return nullptr;
     }
 
-    do {
-        stableTracerArray = pGlobalAPITracerContextImp->activeTracerArray.load(
-            std::memory_order_acquire);
-        myThreadPrivateTracerData.tracerArrayPointer.store(
-            stableTracerArray, std::memory_order_relaxed);
-    } while (stableTracerArray !=
-             pGlobalAPITracerContextImp->activeTracerArray.load(
-                 std::memory_order_relaxed));
-    return (void *)stableTracerArray;
+    //
+    // The epoch store must be ordered before the array load, so that a
+    // reclaiming thread either sees this thread inside the call or this
+    // thread sees the array that replaced the retired one.
+    //
+    myThreadPrivateTracerData.slot->epoch.store(
+        globalEpoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+    return (void *)activeTracerArray.load(std::memory_order_seq_cst);
 }
 
 void APITracerContextImp::releaseActivetracersList() {
-    if (myThreadPrivateTracerData
-            .testAndSetThreadTracerDataInitializedAndOnList())
-        myThreadPrivateTracerData.tracerArrayPointer.store(
-            nullptr, std::memory_order_relaxed);
+    if (!myThreadPrivateTracerData
+             .testAndSetThreadTracerDataInitializedAndOnList())
+        return;
+
+    uint64_t threadEpoch =
+        myThreadPrivateTracerData.slot->epoch.exchange(0, std::memory_order_seq_cst);
+    if (threadEpoch < reclaimEpoch.load(std::memory_order_seq_cst)) {
+        std::lock_guard<std::mutex> lock(reclaimMutex);
+        reclaimCondition.notify_all();
+    }
 }
 
 } // namespace tracing_layer
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2021 Intel Corporation
+ * Copyright (C) 2020-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,16 +7,24 @@
 
 #pragma once
 
+#include "epilogue_worker.h"
+#include "trace_recorder.h"
 #include "tracing.h"
 #include "ze_api.h"
 #include "ze_tracing_cb_structs.h"
 
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstddef>
 #include <iostream>
 #include <list>
+#include <memory>
 #include <mutex>
 #include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #define UNRECOVERABLE_IF(expression)                             \
@@ -33,14 +41,158 @@ extern thread_local ze_bool_t tracingInProgress;
 extern struct APITracerContextImp *pGlobalAPITracerContextImp;
 
 typedef struct tracer_array_entry {
-    zel_all_core_callbacks_t corePrologues;
-    zel_all_core_callbacks_t coreEpilogues;
+    tracer_callbacks_t prologues;
+    tracer_callbacks_t epilogues;
     void *pUserData;
 } tracer_array_entry_t;
 
+//
+// tracer_callbacks_t is walked as a flat array of callbacks, one per API,
+// so that the callbacks of each API can be gathered generically
+//
+typedef void (*tracer_callback_fn_t)(void);
+
+constexpr size_t tracerApiCount =
+    sizeof(tracer_callbacks_t) / sizeof(tracer_callback_fn_t);
+
+#define ZE_TRACER_API_INDEX(callbackCategory, callbackFunction)                \
+    (offsetof(tracing_layer::tracer_callbacks_t,                               \
+              core.callbackCategory.callbackFunction) /                        \
+     sizeof(tracing_layer::tracer_callback_fn_t))
+
+#define ZET_TRACER_API_INDEX(callbackCategory, callbackFunction)               \
+    (offsetof(tracing_layer::tracer_callbacks_t,                               \
+              tools.callbackCategory.callbackFunction) /                       \
+     sizeof(tracing_layer::tracer_callback_fn_t))
+
+#define ZES_TRACER_API_INDEX(callbackCategory, callbackFunction)               \
+    (offsetof(tracing_layer::tracer_callbacks_t,                               \
+              sysman.callbackCategory.callbackFunction) /                      \
+     sizeof(tracing_layer::tracer_callback_fn_t))
+
+//
+// one bit per API, set while any enabled tracer has a prologue or an
+// epilogue for it; maintained by updateTracerArrays
+//
+constexpr size_t tracedApiMaskWords = (tracerApiCount + 63) / 64;
+extern std::atomic<uint64_t> tracedApiMask[tracedApiMaskWords];
+
+inline bool isApiTraced(size_t api) {
+    return 0 != (tracedApiMask[api / 64].load(std::memory_order_relaxed) &
+                 (uint64_t(1) << (api % 64)));
+}
+
+// calls of an API a tracer's callbacks are called for
+typedef struct tracer_sampling {
+    zel_tracer_sampling_mode_t mode;
+    uint64_t rate;
+} tracer_sampling_t;
+
+// callbacks of one enabled tracer for one API
+typedef struct tracer_api_callback {
+    tracer_callback_fn_t prologue;
+    tracer_callback_fn_t epilogue;
+    void *pUserData;
+    tracer_sampling_t sampling; // intervals in timestamp ticks
+} tracer_api_callback_t;
+
+//
+// Sampling is applied in two steps. Before any callback state is built,
+// a traced call of an API that an enabled tracer samples passes a filter
+// keeping every call any such tracer could want: the calls whose count is
+// a multiple of the gcd of the tracers' N, and the first calls of the
+// intervals whose length is the gcd of the tracers' intervals. The wrapper
+// then calls the callbacks of each tracer only for the calls it samples.
+//
+// one bit per API, set while an enabled tracer samples it
+extern std::atomic<uint64_t> sampledApiMask[tracedApiMaskWords];
+
+typedef struct api_sampling {
+    std::atomic<uint64_t> period;   // gcd of the N, 1 if a tracer takes all
+    std::atomic<uint64_t> interval; // gcd of the intervals, 0 if none,
+                                    // in timestamp ticks
+} api_sampling_t;
+extern api_sampling_t apiSamplings[tracerApiCount];
+
+// calls of one API made by one thread
+typedef struct api_sample_state {
+    uint64_t count;
+    uint64_t nextCount;    // next count the filter keeps
+    uint64_t time;         // timestamp of the current call
+    uint64_t previousTime; // timestamp of the previous call
+    uint64_t nextTime;     // next timestamp the filter keeps
+} api_sample_state_t;
+
+// tracerApiCount entries, allocated by the thread's first sampled call
+extern thread_local api_sample_state_t *threadSampleStates;
+
+api_sample_state_t *createThreadSampleStates();
+
+inline bool isApiCallInSampleInterval(api_sample_state_t &state,
+                                      uint64_t interval) {
+    state.previousTime = state.time;
+    state.time = readTraceTimestamp();
+    if (state.time < state.nextTime)
+        return false;
+    state.nextTime = (state.time / interval + 1) * interval;
+    return true;
+}
+
+inline bool isApiCallSampled(size_t api) {
+    if (0 == (sampledApiMask[api / 64].load(std::memory_order_relaxed) &
+              (uint64_t(1) << (api % 64))))
+        return true;
+
+    api_sample_state_t *states = threadSampleStates;
+    if (states == nullptr)
+        states = createThreadSampleStates();
+    api_sample_state_t &state = states[api];
+    bool sampled = false;
+    state.count++;
+    if (state.count >= state.nextCount) {
+        uint64_t period = apiSamplings[api].period.load(std::memory_order_relaxed);
+        if (period != 0) {
+            sampled = true;
+            state.nextCount = (state.count / period + 1) * period;
+        }
+    }
+    uint64_t interval = apiSamplings[api].interval.load(std::memory_order_relaxed);
+    if (interval != 0 && isApiCallInSampleInterval(state, interval))
+        sampled = true;
+    return sampled;
+}
+
+inline bool isTracerCallSampled(const tracer_sampling_t &sampling,
+                                const api_sample_state_t *state) {
+    if (state == nullptr)
+        return true;
+    switch (sampling.mode) {
+    case ZEL_TRACER_SAMPLING_MODE_ONE_IN_N:
+        return state->count % sampling.rate == 0;
+    case ZEL_TRACER_SAMPLING_MODE_INTERVAL:
+        return state->time / sampling.rate != state->previousTime / sampling.rate;
+    default:
+        return true;
+    }
+}
+
+// range of the callbacks array holding the tracers of one API
+typedef struct tracer_api_range {
+    uint32_t first;
+    uint32_t count;
+} tracer_api_range_t;
+
+//
+// snapshot of the enabled tracers, built by updateTracerArrays: for each
+// API, the tracers that registered a prologue or an epilogue for it are
+// stored contiguously in enabling order
+//
 typedef struct tracerArray {
     size_t tracerArrayCount;
-    tracer_array_entry_t *tracerArrayEntries;
+    tracer_api_range_t *apiRanges;       // tracerApiCount entries
+    tracer_api_callback_t *apiCallbacks; // indexed by apiRanges
+    uint64_t retireEpoch; // threads entering a call at this epoch or later
+                          // can no longer see the array
 } tracer_array_t;
 
 typedef enum tracingState {
@@ -53,18 +205,45 @@ struct APITracerImp : APITracer {
     ze_result_t destroyTracer(zel_tracer_handle_t phTracer) override;
     ze_result_t setPrologues(zel_core_callbacks_t *pCoreCbs) override;
     ze_result_t setEpilogues(zel_core_callbacks_t *pCoreCbs) override;
-    zel_all_core_callbacks_t& getProEpilogues(zel_tracer_reg_t callback_type, ze_result_t& result) override;
+    tracer_callbacks_t& getProEpilogues(zel_tracer_reg_t callback_type, ze_result_t& result) override;
     ze_result_t resetAllCallbacks() override;
     ze_result_t enableTracer(ze_bool_t enable) override;
 
     tracer_array_entry_t tracerFunctions;
     tracingState_t tracingState;
+    tracer_sampling_t sampling;
+    std::vector<tracer_sampling_t> apiSamplings; // by API, empty if none
 
   private:
 
     void copyCoreCbsToAllCbs(zel_all_core_callbacks_t& allCbs, zel_core_callbacks_t& Cbs);
 };
 
+class ThreadPrivateTracerData;
+
+//
+// registry slot of one thread; the slot is reused once its thread exits.
+// Other threads scan the epochs while reclaiming retired tracer arrays, so
+// the padding keeps the epochs of two slots off the same cache line.
+//
+typedef struct thread_tracer_slot {
+    // global epoch when the thread entered a traced call, 0 outside of one
+    std::atomic<uint64_t> epoch;
+    ThreadPrivateTracerData *owner;
+    char padding[64 - sizeof(std::atomic<uint64_t>) - sizeof(void *)];
+} thread_tracer_slot_t;
+
+//
+// slots are claimed and released through the chunk's bitmap without locks;
+// chunks are only ever added to the registry, at its head
+//
+typedef struct thread_tracer_slot_chunk {
+    static const size_t slotCount = 64;
+    thread_tracer_slot_t slots[slotCount];
+    std::atomic<uint64_t> usedSlots;
+    struct thread_tracer_slot_chunk *next;
+} thread_tracer_slot_chunk_t;
+
 class ThreadPrivateTracerData {
   public:
     void clearThreadTracerDataOnList(void) { onList = false; }
@@ -75,7 +254,8 @@ class ThreadPrivateTracerData {
     ThreadPrivateTracerData();
     ~ThreadPrivateTracerData();
 
-    std::atomic<tracer_array_t *> tracerArrayPointer;
+    thread_tracer_slot_t *slot;
+    thread_tracer_slot_chunk_t *slotChunk;
 
   private:
     ThreadPrivateTracerData(const ThreadPrivateTracerData &);
@@ -86,6 +266,9 @@ struct APITracerContextImp : APITracerContext {
   public:
     APITracerContextImp() {
         activeTracerArray.store(&emptyTracerArray, std::memory_order_relaxed);
+        globalEpoch.store(1, std::memory_order_relaxed);
+        reclaimEpoch.store(0, std::memory_order_relaxed);
+        threadSlotChunks.store(nullptr, std::memory_order_relaxed);
     };
 
     ~APITracerContextImp() override;
@@ -106,120 +289,239 @@ struct APITracerContextImp : APITracerContext {
 
   private:
     std::mutex traceTableMutex;
-    tracer_array_t emptyTracerArray = {0, NULL};
+    tracer_array_t emptyTracerArray = {0, NULL, NULL, 0};
     std::atomic<tracer_array_t *> activeTracerArray;
 
     //
     // a list of tracer arrays that were once active, but
     // have been replaced by a new active array.  These
     // once-active tracer arrays may continue for some time
-    // to have references to them among the per-thread
-    // tracer array pointers.
+    // to be used by threads that entered a traced call
+    // before their retire epoch.
     //
     std::list<tracer_array_t *> retiringTracerArrayList;
 
     std::list<struct APITracerImp *> enabledTracerImpList;
 
-    ze_bool_t testForTracerArrayReferences(tracer_array_t *tracerArray);
+    //
+    // advanced each time a tracer array is retired; threads publish the
+    // epoch they entered a traced call at before loading the active array
+    //
+    std::atomic<uint64_t> globalEpoch;
+
+    //
+    // retire epoch a destroying thread waits for, 0 when none waits;
+    // threads leaving a traced call entered before it notify the waiter
+    //
+    std::atomic<uint64_t> reclaimEpoch;
+    std::mutex reclaimMutex;
+    std::condition_variable reclaimCondition;
+
+    uint64_t oldestActiveEpoch();
     size_t testAndFreeRetiredTracers();
     size_t updateTracerArrays();
 
-    std::list<ThreadPrivateTracerData *> threadTracerDataList;
-    std::mutex threadTracerDataListMutex;
+    std::atomic<thread_tracer_slot_chunk_t *> threadSlotChunks;
+
+    // relate timestamps to time for interval sampling
+    uint64_t startTimestamp = readTraceTimestamp();
+    uint64_t startNanoseconds = readSampleNanoseconds();
+    double ticksPerNanosecond = 0.0;
+    uint64_t getSampleIntervalTicks(uint64_t nanoseconds);
+    static uint64_t readSampleNanoseconds();
 };
 
 extern thread_local ThreadPrivateTracerData myThreadPrivateTracerData;
 
-template <class T>
-class APITracerCallbackStateImp {
-  public:
-    T current_api_callback;
-    void *pUserData;
-};
-
 template <class T>
 class APITracerCallbackDataImp {
   public:
-    T apiOrdinal = nullptr;
-    std::vector<tracing_layer::APITracerCallbackStateImp<T>> prologCallbacks;
-    std::vector<tracing_layer::APITracerCallbackStateImp<T>> epilogCallbacks;
+    const tracer_api_callback_t *callbacks = nullptr;
+    size_t callbackCount = 0;
+    const api_sample_state_t *sampleState = nullptr;
 };
 
-#define ZE_HANDLE_TRACER_RECURSION(ze_api_ptr, ...) \
-    do {                                            \
-        if (tracing_layer::tracingInProgress) {     \
-            return ze_api_ptr(__VA_ARGS__);         \
-        }                                           \
-        tracing_layer::tracingInProgress = 1;       \
+// state of one tracer in one traced call
+typedef struct tracer_call_state {
+    void *pInstanceUserData;
+    bool sampled;
+} tracer_call_state_t;
+
+// tracers whose call state fits on the stack of a traced call
+constexpr size_t maxStackTracers = 16;
+
+#define ZE_HANDLE_UNTRACED_API(recordScope, apiIndex, ze_api_ptr, ...) \
+    do {                                                              \
+        if (!tracing_layer::isApiTraced(apiIndex) ||                  \
+            !tracing_layer::isApiCallSampled(apiIndex)) {             \
+            return recordScope.exit(ze_api_ptr(__VA_ARGS__));         \
+        }                                                             \
     } while (0)
 
-#define ZE_GEN_TRACER_ARRAY_ENTRY(callbackPtr, tracerArray, tracerArrayIndex, \
-                                  callbackType, callbackCategory,             \
-                                  callbackFunction)                           \
-    do {                                                                      \
-        callbackPtr = tracerArray->tracerArrayEntries[tracerArrayIndex]       \
-                          .callbackType.callbackCategory.callbackFunction;    \
+#define ZE_HANDLE_TRACER_RECURSION(recordScope, ze_api_ptr, ...) \
+    do {                                                         \
+        if (tracing_layer::tracingInProgress) {                  \
+            return recordScope.exit(ze_api_ptr(__VA_ARGS__));    \
+        }                                                        \
+        tracing_layer::tracingInProgress = 1;                    \
     } while (0)
 
-#define ZE_GEN_PER_API_CALLBACK_STATE(perApiCallbackData, tracerType,               \
-                                      callbackCategory, callbackFunctionType)       \
+#define ZE_GEN_PER_API_CALLBACK_STATE(perApiCallbackData, tracerType, apiIndex) \
     tracing_layer::tracer_array_t *currentTracerArray;                              \
     currentTracerArray =                                                            \
         (tracing_layer::tracer_array_t *)                                           \
             tracing_layer::pGlobalAPITracerContextImp->getActiveTracersList();      \
-    if (currentTracerArray) {                                                       \
-        for (size_t i = 0; i < currentTracerArray->tracerArrayCount; i++) {         \
-            tracerType prologueCallbackPtr;                                         \
-            tracerType epilogue_callback_ptr;                                       \
-            ZE_GEN_TRACER_ARRAY_ENTRY(prologueCallbackPtr, currentTracerArray, i,   \
-                                      corePrologues, callbackCategory,              \
-                                      callbackFunctionType);                        \
-            ZE_GEN_TRACER_ARRAY_ENTRY(epilogue_callback_ptr, currentTracerArray, i, \
-                                      coreEpilogues, callbackCategory,              \
-                                      callbackFunctionType);                        \
-                                                                                    \
-            tracing_layer::APITracerCallbackStateImp<tracerType> prologCallback;    \
-            prologCallback.current_api_callback = prologueCallbackPtr;              \
-            prologCallback.pUserData =                                              \
-                currentTracerArray->tracerArrayEntries[i].pUserData;                \
-            perApiCallbackData.prologCallbacks.push_back(prologCallback);           \
-                                                                                    \
-            tracing_layer::APITracerCallbackStateImp<tracerType> epilogCallback;    \
-            epilogCallback.current_api_callback = epilogue_callback_ptr;            \
-            epilogCallback.pUserData =                                              \
-                currentTracerArray->tracerArrayEntries[i].pUserData;                \
-            perApiCallbackData.epilogCallbacks.push_back(epilogCallback);           \
-        }                                                                           \
+    if (currentTracerArray && currentTracerArray->tracerArrayCount) {               \
+        const tracing_layer::tracer_api_range_t &apiRange =                         \
+            currentTracerArray->apiRanges[apiIndex];                                \
+        perApiCallbackData.callbacks =                                              \
+            currentTracerArray->apiCallbacks + apiRange.first;                      \
+        perApiCallbackData.callbackCount = apiRange.count;                          \
+        if (tracing_layer::threadSampleStates != nullptr)                           \
+            perApiCallbackData.sampleState =                                        \
+                &tracing_layer::threadSampleStates[apiIndex];                       \
+    }
+
+//
+// Pointer arguments of a traced API, as seen by asynchronous epilogues. With
+// async set, TInPointers are the indices of the arguments pointing to input
+// structures, arrays or strings, which the epilogue receives as nullptr, and
+// TOutHandles those of the arguments pointing to a single [out] handle. APIs
+// with other pointer outputs leave async unset and have their epilogues
+// called before the call returns.
+//
+template <size_t... I>
+struct epilogue_arg_indices {};
+
+template <bool Async, typename TInPointers = epilogue_arg_indices<>,
+          typename TOutHandles = epilogue_arg_indices<>>
+struct epilogue_args {
+    static constexpr bool async = Async;
+};
+
+//
+// Calls a queued epilogue with a parameter structure pointing to the
+// arguments copied into its entry. The handles returned through [out]
+// arguments are copied into the entry as well, and the copied arguments point
+// to them. Pointers to inputs owned by the caller are cleared, since the
+// caller may have freed them by the time the epilogue runs; void pointers
+// keep the address they held.
+//
+template <typename TArgs, typename TParams, typename TTracer, typename... TCallArgs>
+struct EpilogueDelivery;
+
+template <bool Async, size_t... InPointers, size_t... OutHandles, typename TParams,
+          typename TTracer, typename... TArgs>
+struct EpilogueDelivery<epilogue_args<Async, epilogue_arg_indices<InPointers...>,
+                                      epilogue_arg_indices<OutHandles...>>,
+                        TParams, TTracer, TArgs...> {
+    typedef typename std::remove_pointer<TParams>::type params_t;
+    typedef std::tuple<TArgs...> args_t;
+    typedef std::tuple<typename std::remove_pointer<
+        typename std::tuple_element<OutHandles, args_t>::type>::type...>
+        outs_t;
+
+    struct stored_t {
+        args_t args;
+        outs_t outs;
+    };
+
+    static_assert(sizeof(stored_t) <= maxEpilogueArgsSize,
+                  "arguments too large for an epilogue entry");
+    static_assert(std::is_trivially_destructible<stored_t>::value,
+                  "arguments of an epilogue entry are never destroyed");
+
+    template <typename... TCallArgs>
+    static void capture(epilogue_entry_t &entry, TCallArgs &&... args) {
+        stored_t *stored = new (entry.args) stored_t{args_t(args...), outs_t()};
+        int expand[] = {0, (std::get<InPointers>(stored->args) = nullptr, 0)...};
+        (void)expand;
+        copyOutputs(*stored, std::make_index_sequence<sizeof...(OutHandles)>());
+        entry.deliver = &EpilogueDelivery::deliver;
+    }
+
+    template <size_t... J>
+    static void copyOutputs(stored_t &stored, std::index_sequence<J...>) {
+        int expand[] = {0, (copyOutput<OutHandles, J>(stored), 0)...};
+        (void)expand;
     }
 
-template <typename TFunction_pointer, typename TParams, typename TTracer,
-          typename TTracerPrologCallbacks, typename TTracerEpilogCallbacks,
-          typename... Args>
+    template <size_t I, size_t J>
+    static void copyOutput(stored_t &stored) {
+        auto &arg = std::get<I>(stored.args);
+        if (arg == nullptr)
+            return;
+        std::get<J>(stored.outs) = *arg;
+        arg = &std::get<J>(stored.outs);
+    }
+
+    static void deliver(epilogue_entry_t &entry) {
+        deliverArgs(entry, std::index_sequence_for<TArgs...>());
+    }
+
+    template <size_t... I>
+    static void deliverArgs(epilogue_entry_t &entry, std::index_sequence<I...>) {
+        args_t &args = reinterpret_cast<stored_t *>(entry.args)->args;
+        params_t params = {&std::get<I>(args)...};
+        static_assert(sizeof(params_t) == sizeof...(TArgs) * sizeof(void *),
+                      "parameter structure does not match the arguments");
+        reinterpret_cast<TTracer>(entry.epilogue)(
+            &params, entry.result, entry.pUserData, &entry.pInstanceUserData);
+    }
+};
+
+template <typename TEpilogueArgs, typename TFunction_pointer, typename TParams,
+          typename TTracer, typename... Args>
 ze_result_t
 APITracerWrapperImp(TFunction_pointer zeApiPtr, TParams paramsStruct,
-                    TTracer apiOrdinal, TTracerPrologCallbacks prologCallbacks,
-                    TTracerEpilogCallbacks epilogCallbacks, Args &&... args) {
+                    const APITracerCallbackDataImp<TTracer> &callbackData,
+                    Args &&... args) {
     ze_result_t ret = ZE_RESULT_SUCCESS;
-    std::vector<APITracerCallbackStateImp<TTracer>> *callbacks_prologs =
-        &prologCallbacks;
-
-    std::vector<void *> ppTracerInstanceUserData;
-    ppTracerInstanceUserData.resize(callbacks_prologs->size());
+    const tracer_api_callback_t *callbacks = callbackData.callbacks;
+    const size_t callbackCount = callbackData.callbackCount;
+
+    tracer_call_state_t stackTracerCallStates[maxStackTracers];
+    std::unique_ptr<tracer_call_state_t[]> heapTracerCallStates;
+    tracer_call_state_t *tracerCallStates = stackTracerCallStates;
+    if (callbackCount > maxStackTracers) {
+        heapTracerCallStates.reset(new tracer_call_state_t[callbackCount]);
+        tracerCallStates = heapTracerCallStates.get();
+    }
 
-    for (size_t i = 0; i < callbacks_prologs->size(); i++) {
-        if (callbacks_prologs->at(i).current_api_callback != nullptr)
-            callbacks_prologs->at(i).current_api_callback(
-                paramsStruct, ret, callbacks_prologs->at(i).pUserData,
-                &ppTracerInstanceUserData[i]);
+    // decided before the prologues, whose own calls advance the sample state
+    for (size_t i = 0; i < callbackCount; i++) {
+        tracerCallStates[i].pInstanceUserData = nullptr;
+        tracerCallStates[i].sampled =
+            isTracerCallSampled(callbacks[i].sampling, callbackData.sampleState);
+    }
+    for (size_t i = 0; i < callbackCount; i++) {
+        if (callbacks[i].prologue != nullptr && tracerCallStates[i].sampled)
+            reinterpret_cast<TTracer>(callbacks[i].prologue)(
+                paramsStruct, ret, callbacks[i].pUserData,
+                &tracerCallStates[i].pInstanceUserData);
     }
     ret = zeApiPtr(args...);
-    std::vector<APITracerCallbackStateImp<TTracer>> *callbacksEpilogs =
-        &epilogCallbacks;
-    for (size_t i = 0; i < callbacksEpilogs->size(); i++) {
-        if (callbacksEpilogs->at(i).current_api_callback != nullptr)
-            callbacksEpilogs->at(i).current_api_callback(
-                paramsStruct, ret, callbacksEpilogs->at(i).pUserData,
-                &ppTracerInstanceUserData[i]);
+    EpilogueWorker *epilogueWorker =
+        pGlobalEpilogueWorker.load(std::memory_order_acquire);
+    for (size_t i = 0; i < callbackCount; i++) {
+        if (callbacks[i].epilogue == nullptr || !tracerCallStates[i].sampled)
+            continue;
+        epilogue_entry_t *entry = nullptr;
+        if (epilogueWorker != nullptr && TEpilogueArgs::async)
+            entry = epilogueWorker->beginEntry();
+        if (entry == nullptr) {
+            reinterpret_cast<TTracer>(callbacks[i].epilogue)(
+                paramsStruct, ret, callbacks[i].pUserData,
+                &tracerCallStates[i].pInstanceUserData);
+            continue;
+        }
+        EpilogueDelivery<TEpilogueArgs, TParams, TTracer,
+                         typename std::decay<Args>::type...>::capture(*entry, args...);
+        entry->epilogue = callbacks[i].epilogue;
+        entry->pUserData = callbacks[i].pUserData;
+        entry->pInstanceUserData = tracerCallStates[i].pInstanceUserData;
+        entry->result = ret;
+        epilogueWorker->commitEntry();
     }
     tracing_layer::tracingInProgress = 0;
     tracing_layer::pGlobalAPITracerContextImp->releaseActivetracersList();
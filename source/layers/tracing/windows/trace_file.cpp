@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#include "../trace_recorder.h"
+
+#include <cstdio>
+#include <Windows.h>
+
+namespace tracing_layer {
+
+// written through stdio, the mapping is not used on Windows
+bool TraceFile::open(const std::string &path) {
+    FILE *file = nullptr;
+    if (fopen_s(&file, path.c_str(), "wb") != 0)
+        return false;
+    stream = file;
+    return true;
+}
+
+bool TraceFile::write(const uint8_t *data, size_t size) {
+    if (stream == nullptr)
+        return false;
+    if (fwrite(data, 1, size, static_cast<FILE *>(stream)) != size)
+        return false;
+    used += size;
+    return true;
+}
+
+void TraceFile::close() {
+    if (stream == nullptr)
+        return;
+    fclose(static_cast<FILE *>(stream));
+    stream = nullptr;
+}
+
+uint64_t getTraceProcessId() { return GetCurrentProcessId(); }
+
+uint64_t getTraceThreadId() { return GetCurrentThreadId(); }
+
+} // namespace tracing_layer
@@ -9,11 +9,21 @@
 #include <Windows.h>
 
 namespace tracing_layer {
+static TraceRecorder *traceRecorder = nullptr;
+static APIProfiler *apiProfiler = nullptr;
+static EpilogueWorker *epilogueWorker = nullptr;
+
 extern "C" BOOL APIENTRY DllMain(HINSTANCE hinstDLL, DWORD fdwReason, LPVOID lpvReserved) {
     if (fdwReason == DLL_PROCESS_DETACH) {
+      delete epilogueWorker;
+      delete apiProfiler;
+      delete traceRecorder;
       delete pGlobalAPITracerContextImp;
     } else if (fdwReason == DLL_PROCESS_ATTACH) {
       pGlobalAPITracerContextImp = new APITracerContextImp;
+      traceRecorder = TraceRecorder::create();
+      apiProfiler = APIProfiler::create();
+      epilogueWorker = EpilogueWorker::create();
     }
    return TRUE;
 }
@@ -29,7 +29,7 @@ zelTracerInitRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Global.pfnInitCb = pfnInitCb;
+        cbs.core.Global.pfnInitCb = pfnInitCb;
 
     return result;
 }
@@ -45,7 +45,7 @@ zelTracerDriverGetRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Driver.pfnGetCb = pfnGetCb;
+        cbs.core.Driver.pfnGetCb = pfnGetCb;
 
     return result;
 }
@@ -61,7 +61,7 @@ zelTracerDriverGetApiVersionRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Driver.pfnGetApiVersionCb = pfnGetApiVersionCb;
+        cbs.core.Driver.pfnGetApiVersionCb = pfnGetApiVersionCb;
 
     return result;
 }
@@ -77,7 +77,7 @@ zelTracerDriverGetPropertiesRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Driver.pfnGetPropertiesCb = pfnGetPropertiesCb;
+        cbs.core.Driver.pfnGetPropertiesCb = pfnGetPropertiesCb;
 
     return result;
 }
@@ -93,7 +93,7 @@ zelTracerDriverGetIpcPropertiesRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Driver.pfnGetIpcPropertiesCb = pfnGetIpcPropertiesCb;
+        cbs.core.Driver.pfnGetIpcPropertiesCb = pfnGetIpcPropertiesCb;
 
     return result;
 }
@@ -109,7 +109,7 @@ zelTracerDriverGetExtensionPropertiesRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Driver.pfnGetExtensionPropertiesCb = pfnGetExtensionPropertiesCb;
+        cbs.core.Driver.pfnGetExtensionPropertiesCb = pfnGetExtensionPropertiesCb;
 
     return result;
 }
@@ -125,7 +125,7 @@ zelTracerDriverGetExtensionFunctionAddressRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Driver.pfnGetExtensionFunctionAddressCb = pfnGetExtensionFunctionAddressCb;
+        cbs.core.Driver.pfnGetExtensionFunctionAddressCb = pfnGetExtensionFunctionAddressCb;
 
     return result;
 }
@@ -141,7 +141,7 @@ zelTracerDriverGetLastErrorDescriptionRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Driver.pfnGetLastErrorDescriptionCb = pfnGetLastErrorDescriptionCb;
+        cbs.core.Driver.pfnGetLastErrorDescriptionCb = pfnGetLastErrorDescriptionCb;
 
     return result;
 }
@@ -157,7 +157,7 @@ zelTracerDeviceGetRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Device.pfnGetCb = pfnGetCb;
+        cbs.core.Device.pfnGetCb = pfnGetCb;
 
     return result;
 }
@@ -173,7 +173,7 @@ zelTracerDeviceGetSubDevicesRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Device.pfnGetSubDevicesCb = pfnGetSubDevicesCb;
+        cbs.core.Device.pfnGetSubDevicesCb = pfnGetSubDevicesCb;
 
     return result;
 }
@@ -189,7 +189,7 @@ zelTracerDeviceGetPropertiesRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Device.pfnGetPropertiesCb = pfnGetPropertiesCb;
+        cbs.core.Device.pfnGetPropertiesCb = pfnGetPropertiesCb;
 
     return result;
 }
@@ -205,7 +205,7 @@ zelTracerDeviceGetComputePropertiesRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Device.pfnGetComputePropertiesCb = pfnGetComputePropertiesCb;
+        cbs.core.Device.pfnGetComputePropertiesCb = pfnGetComputePropertiesCb;
 
     return result;
 }
@@ -221,7 +221,7 @@ zelTracerDeviceGetModulePropertiesRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Device.pfnGetModulePropertiesCb = pfnGetModulePropertiesCb;
+        cbs.core.Device.pfnGetModulePropertiesCb = pfnGetModulePropertiesCb;
 
     return result;
 }
@@ -237,7 +237,7 @@ zelTracerDeviceGetCommandQueueGroupPropertiesRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Device.pfnGetCommandQueueGroupPropertiesCb = pfnGetCommandQueueGroupPropertiesCb;
+        cbs.core.Device.pfnGetCommandQueueGroupPropertiesCb = pfnGetCommandQueueGroupPropertiesCb;
 
     return result;
 }
@@ -253,7 +253,7 @@ zelTracerDeviceGetMemoryPropertiesRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Device.pfnGetMemoryPropertiesCb = pfnGetMemoryPropertiesCb;
+        cbs.core.Device.pfnGetMemoryPropertiesCb = pfnGetMemoryPropertiesCb;
 
     return result;
 }
@@ -269,7 +269,7 @@ zelTracerDeviceGetMemoryAccessPropertiesRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Device.pfnGetMemoryAccessPropertiesCb = pfnGetMemoryAccessPropertiesCb;
+        cbs.core.Device.pfnGetMemoryAccessPropertiesCb = pfnGetMemoryAccessPropertiesCb;
 
     return result;
 }
@@ -285,7 +285,7 @@ zelTracerDeviceGetCachePropertiesRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Device.pfnGetCachePropertiesCb = pfnGetCachePropertiesCb;
+        cbs.core.Device.pfnGetCachePropertiesCb = pfnGetCachePropertiesCb;
 
     return result;
 }
@@ -301,7 +301,7 @@ zelTracerDeviceGetImagePropertiesRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Device.pfnGetImagePropertiesCb = pfnGetImagePropertiesCb;
+        cbs.core.Device.pfnGetImagePropertiesCb = pfnGetImagePropertiesCb;
 
     return result;
 }
@@ -317,7 +317,7 @@ zelTracerDeviceGetExternalMemoryPropertiesRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Device.pfnGetExternalMemoryPropertiesCb = pfnGetExternalMemoryPropertiesCb;
+        cbs.core.Device.pfnGetExternalMemoryPropertiesCb = pfnGetExternalMemoryPropertiesCb;
 
     return result;
 }
@@ -333,7 +333,7 @@ zelTracerDeviceGetP2PPropertiesRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Device.pfnGetP2PPropertiesCb = pfnGetP2PPropertiesCb;
+        cbs.core.Device.pfnGetP2PPropertiesCb = pfnGetP2PPropertiesCb;
 
     return result;
 }
@@ -349,7 +349,7 @@ zelTracerDeviceCanAccessPeerRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Device.pfnCanAccessPeerCb = pfnCanAccessPeerCb;
+        cbs.core.Device.pfnCanAccessPeerCb = pfnCanAccessPeerCb;
 
     return result;
 }
@@ -365,7 +365,7 @@ zelTracerDeviceGetStatusRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Device.pfnGetStatusCb = pfnGetStatusCb;
+        cbs.core.Device.pfnGetStatusCb = pfnGetStatusCb;
 
     return result;
 }
@@ -381,7 +381,7 @@ zelTracerDeviceGetGlobalTimestampsRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Device.pfnGetGlobalTimestampsCb = pfnGetGlobalTimestampsCb;
+        cbs.core.Device.pfnGetGlobalTimestampsCb = pfnGetGlobalTimestampsCb;
 
     return result;
 }
@@ -397,7 +397,7 @@ zelTracerContextCreateRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Context.pfnCreateCb = pfnCreateCb;
+        cbs.core.Context.pfnCreateCb = pfnCreateCb;
 
     return result;
 }
@@ -413,7 +413,7 @@ zelTracerContextCreateExRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Context.pfnCreateExCb = pfnCreateExCb;
+        cbs.core.Context.pfnCreateExCb = pfnCreateExCb;
 
     return result;
 }
@@ -429,7 +429,7 @@ zelTracerContextDestroyRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Context.pfnDestroyCb = pfnDestroyCb;
+        cbs.core.Context.pfnDestroyCb = pfnDestroyCb;
 
     return result;
 }
@@ -445,7 +445,7 @@ zelTracerContextGetStatusRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Context.pfnGetStatusCb = pfnGetStatusCb;
+        cbs.core.Context.pfnGetStatusCb = pfnGetStatusCb;
 
     return result;
 }
@@ -461,7 +461,7 @@ zelTracerCommandQueueCreateRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.CommandQueue.pfnCreateCb = pfnCreateCb;
+        cbs.core.CommandQueue.pfnCreateCb = pfnCreateCb;
 
     return result;
 }
@@ -477,7 +477,7 @@ zelTracerCommandQueueDestroyRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.CommandQueue.pfnDestroyCb = pfnDestroyCb;
+        cbs.core.CommandQueue.pfnDestroyCb = pfnDestroyCb;
 
     return result;
 }
@@ -493,7 +493,7 @@ zelTracerCommandQueueExecuteCommandListsRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.CommandQueue.pfnExecuteCommandListsCb = pfnExecuteCommandListsCb;
+        cbs.core.CommandQueue.pfnExecuteCommandListsCb = pfnExecuteCommandListsCb;
 
     return result;
 }
@@ -509,7 +509,7 @@ zelTracerCommandQueueSynchronizeRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.CommandQueue.pfnSynchronizeCb = pfnSynchronizeCb;
+        cbs.core.CommandQueue.pfnSynchronizeCb = pfnSynchronizeCb;
 
     return result;
 }
@@ -525,7 +525,7 @@ zelTracerCommandListCreateRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.CommandList.pfnCreateCb = pfnCreateCb;
+        cbs.core.CommandList.pfnCreateCb = pfnCreateCb;
 
     return result;
 }
@@ -541,7 +541,7 @@ zelTracerCommandListCreateImmediateRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.CommandList.pfnCreateImmediateCb = pfnCreateImmediateCb;
+        cbs.core.CommandList.pfnCreateImmediateCb = pfnCreateImmediateCb;
 
     return result;
 }
@@ -557,7 +557,7 @@ zelTracerCommandListDestroyRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.CommandList.pfnDestroyCb = pfnDestroyCb;
+        cbs.core.CommandList.pfnDestroyCb = pfnDestroyCb;
 
     return result;
 }
@@ -573,7 +573,7 @@ zelTracerCommandListCloseRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.CommandList.pfnCloseCb = pfnCloseCb;
+        cbs.core.CommandList.pfnCloseCb = pfnCloseCb;
 
     return result;
 }
@@ -589,7 +589,7 @@ zelTracerCommandListResetRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.CommandList.pfnResetCb = pfnResetCb;
+        cbs.core.CommandList.pfnResetCb = pfnResetCb;
 
     return result;
 }
@@ -605,7 +605,7 @@ zelTracerCommandListAppendWriteGlobalTimestampRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.CommandList.pfnAppendWriteGlobalTimestampCb = pfnAppendWriteGlobalTimestampCb;
+        cbs.core.CommandList.pfnAppendWriteGlobalTimestampCb = pfnAppendWriteGlobalTimestampCb;
 
     return result;
 }
@@ -621,7 +621,7 @@ zelTracerCommandListHostSynchronizeRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.CommandList.pfnHostSynchronizeCb = pfnHostSynchronizeCb;
+        cbs.core.CommandList.pfnHostSynchronizeCb = pfnHostSynchronizeCb;
 
     return result;
 }
@@ -637,7 +637,7 @@ zelTracerCommandListAppendBarrierRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.CommandList.pfnAppendBarrierCb = pfnAppendBarrierCb;
+        cbs.core.CommandList.pfnAppendBarrierCb = pfnAppendBarrierCb;
 
     return result;
 }
@@ -653,7 +653,7 @@ zelTracerCommandListAppendMemoryRangesBarrierRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.CommandList.pfnAppendMemoryRangesBarrierCb = pfnAppendMemoryRangesBarrierCb;
+        cbs.core.CommandList.pfnAppendMemoryRangesBarrierCb = pfnAppendMemoryRangesBarrierCb;
 
     return result;
 }
@@ -669,7 +669,7 @@ zelTracerContextSystemBarrierRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Context.pfnSystemBarrierCb = pfnSystemBarrierCb;
+        cbs.core.Context.pfnSystemBarrierCb = pfnSystemBarrierCb;
 
     return result;
 }
@@ -685,7 +685,7 @@ zelTracerCommandListAppendMemoryCopyRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.CommandList.pfnAppendMemoryCopyCb = pfnAppendMemoryCopyCb;
+        cbs.core.CommandList.pfnAppendMemoryCopyCb = pfnAppendMemoryCopyCb;
 
     return result;
 }
@@ -701,7 +701,7 @@ zelTracerCommandListAppendMemoryFillRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.CommandList.pfnAppendMemoryFillCb = pfnAppendMemoryFillCb;
+        cbs.core.CommandList.pfnAppendMemoryFillCb = pfnAppendMemoryFillCb;
 
     return result;
 }
@@ -717,7 +717,7 @@ zelTracerCommandListAppendMemoryCopyRegionRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.CommandList.pfnAppendMemoryCopyRegionCb = pfnAppendMemoryCopyRegionCb;
+        cbs.core.CommandList.pfnAppendMemoryCopyRegionCb = pfnAppendMemoryCopyRegionCb;
 
     return result;
 }
@@ -733,7 +733,7 @@ zelTracerCommandListAppendMemoryCopyFromContextRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.CommandList.pfnAppendMemoryCopyFromContextCb = pfnAppendMemoryCopyFromContextCb;
+        cbs.core.CommandList.pfnAppendMemoryCopyFromContextCb = pfnAppendMemoryCopyFromContextCb;
 
     return result;
 }
@@ -749,7 +749,7 @@ zelTracerCommandListAppendImageCopyRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.CommandList.pfnAppendImageCopyCb = pfnAppendImageCopyCb;
+        cbs.core.CommandList.pfnAppendImageCopyCb = pfnAppendImageCopyCb;
 
     return result;
 }
@@ -765,7 +765,7 @@ zelTracerCommandListAppendImageCopyRegionRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.CommandList.pfnAppendImageCopyRegionCb = pfnAppendImageCopyRegionCb;
+        cbs.core.CommandList.pfnAppendImageCopyRegionCb = pfnAppendImageCopyRegionCb;
 
     return result;
 }
@@ -781,7 +781,7 @@ zelTracerCommandListAppendImageCopyToMemoryRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.CommandList.pfnAppendImageCopyToMemoryCb = pfnAppendImageCopyToMemoryCb;
+        cbs.core.CommandList.pfnAppendImageCopyToMemoryCb = pfnAppendImageCopyToMemoryCb;
 
     return result;
 }
@@ -797,7 +797,7 @@ zelTracerCommandListAppendImageCopyFromMemoryRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.CommandList.pfnAppendImageCopyFromMemoryCb = pfnAppendImageCopyFromMemoryCb;
+        cbs.core.CommandList.pfnAppendImageCopyFromMemoryCb = pfnAppendImageCopyFromMemoryCb;
 
     return result;
 }
@@ -813,7 +813,7 @@ zelTracerCommandListAppendMemoryPrefetchRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.CommandList.pfnAppendMemoryPrefetchCb = pfnAppendMemoryPrefetchCb;
+        cbs.core.CommandList.pfnAppendMemoryPrefetchCb = pfnAppendMemoryPrefetchCb;
 
     return result;
 }
@@ -829,7 +829,7 @@ zelTracerCommandListAppendMemAdviseRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.CommandList.pfnAppendMemAdviseCb = pfnAppendMemAdviseCb;
+        cbs.core.CommandList.pfnAppendMemAdviseCb = pfnAppendMemAdviseCb;
 
     return result;
 }
@@ -845,7 +845,7 @@ zelTracerEventPoolCreateRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.EventPool.pfnCreateCb = pfnCreateCb;
+        cbs.core.EventPool.pfnCreateCb = pfnCreateCb;
 
     return result;
 }
@@ -861,7 +861,7 @@ zelTracerEventPoolDestroyRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.EventPool.pfnDestroyCb = pfnDestroyCb;
+        cbs.core.EventPool.pfnDestroyCb = pfnDestroyCb;
 
     return result;
 }
@@ -877,7 +877,7 @@ zelTracerEventCreateRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Event.pfnCreateCb = pfnCreateCb;
+        cbs.core.Event.pfnCreateCb = pfnCreateCb;
 
     return result;
 }
@@ -893,7 +893,7 @@ zelTracerEventDestroyRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Event.pfnDestroyCb = pfnDestroyCb;
+        cbs.core.Event.pfnDestroyCb = pfnDestroyCb;
 
     return result;
 }
@@ -909,7 +909,7 @@ zelTracerEventPoolGetIpcHandleRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.EventPool.pfnGetIpcHandleCb = pfnGetIpcHandleCb;
+        cbs.core.EventPool.pfnGetIpcHandleCb = pfnGetIpcHandleCb;
 
     return result;
 }
@@ -925,7 +925,7 @@ zelTracerEventPoolPutIpcHandleRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.EventPool.pfnPutIpcHandleCb = pfnPutIpcHandleCb;
+        cbs.core.EventPool.pfnPutIpcHandleCb = pfnPutIpcHandleCb;
 
     return result;
 }
@@ -941,7 +941,7 @@ zelTracerEventPoolOpenIpcHandleRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.EventPool.pfnOpenIpcHandleCb = pfnOpenIpcHandleCb;
+        cbs.core.EventPool.pfnOpenIpcHandleCb = pfnOpenIpcHandleCb;
 
     return result;
 }
@@ -957,7 +957,7 @@ zelTracerEventPoolCloseIpcHandleRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.EventPool.pfnCloseIpcHandleCb = pfnCloseIpcHandleCb;
+        cbs.core.EventPool.pfnCloseIpcHandleCb = pfnCloseIpcHandleCb;
 
     return result;
 }
@@ -973,7 +973,7 @@ zelTracerCommandListAppendSignalEventRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.CommandList.pfnAppendSignalEventCb = pfnAppendSignalEventCb;
+        cbs.core.CommandList.pfnAppendSignalEventCb = pfnAppendSignalEventCb;
 
     return result;
 }
@@ -989,7 +989,7 @@ zelTracerCommandListAppendWaitOnEventsRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.CommandList.pfnAppendWaitOnEventsCb = pfnAppendWaitOnEventsCb;
+        cbs.core.CommandList.pfnAppendWaitOnEventsCb = pfnAppendWaitOnEventsCb;
 
     return result;
 }
@@ -1005,7 +1005,7 @@ zelTracerEventHostSignalRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Event.pfnHostSignalCb = pfnHostSignalCb;
+        cbs.core.Event.pfnHostSignalCb = pfnHostSignalCb;
 
     return result;
 }
@@ -1021,7 +1021,7 @@ zelTracerEventHostSynchronizeRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Event.pfnHostSynchronizeCb = pfnHostSynchronizeCb;
+        cbs.core.Event.pfnHostSynchronizeCb = pfnHostSynchronizeCb;
 
     return result;
 }
@@ -1037,7 +1037,7 @@ zelTracerEventQueryStatusRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Event.pfnQueryStatusCb = pfnQueryStatusCb;
+        cbs.core.Event.pfnQueryStatusCb = pfnQueryStatusCb;
 
     return result;
 }
@@ -1053,7 +1053,7 @@ zelTracerCommandListAppendEventResetRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.CommandList.pfnAppendEventResetCb = pfnAppendEventResetCb;
+        cbs.core.CommandList.pfnAppendEventResetCb = pfnAppendEventResetCb;
 
     return result;
 }
@@ -1069,7 +1069,7 @@ zelTracerEventHostResetRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Event.pfnHostResetCb = pfnHostResetCb;
+        cbs.core.Event.pfnHostResetCb = pfnHostResetCb;
 
     return result;
 }
@@ -1085,7 +1085,7 @@ zelTracerEventQueryKernelTimestampRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Event.pfnQueryKernelTimestampCb = pfnQueryKernelTimestampCb;
+        cbs.core.Event.pfnQueryKernelTimestampCb = pfnQueryKernelTimestampCb;
 
     return result;
 }
@@ -1101,7 +1101,7 @@ zelTracerCommandListAppendQueryKernelTimestampsRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.CommandList.pfnAppendQueryKernelTimestampsCb = pfnAppendQueryKernelTimestampsCb;
+        cbs.core.CommandList.pfnAppendQueryKernelTimestampsCb = pfnAppendQueryKernelTimestampsCb;
 
     return result;
 }
@@ -1117,7 +1117,7 @@ zelTracerFenceCreateRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Fence.pfnCreateCb = pfnCreateCb;
+        cbs.core.Fence.pfnCreateCb = pfnCreateCb;
 
     return result;
 }
@@ -1133,7 +1133,7 @@ zelTracerFenceDestroyRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Fence.pfnDestroyCb = pfnDestroyCb;
+        cbs.core.Fence.pfnDestroyCb = pfnDestroyCb;
 
     return result;
 }
@@ -1149,7 +1149,7 @@ zelTracerFenceHostSynchronizeRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Fence.pfnHostSynchronizeCb = pfnHostSynchronizeCb;
+        cbs.core.Fence.pfnHostSynchronizeCb = pfnHostSynchronizeCb;
 
     return result;
 }
@@ -1165,7 +1165,7 @@ zelTracerFenceQueryStatusRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Fence.pfnQueryStatusCb = pfnQueryStatusCb;
+        cbs.core.Fence.pfnQueryStatusCb = pfnQueryStatusCb;
 
     return result;
 }
@@ -1181,7 +1181,7 @@ zelTracerFenceResetRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Fence.pfnResetCb = pfnResetCb;
+        cbs.core.Fence.pfnResetCb = pfnResetCb;
 
     return result;
 }
@@ -1197,7 +1197,7 @@ zelTracerImageGetPropertiesRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Image.pfnGetPropertiesCb = pfnGetPropertiesCb;
+        cbs.core.Image.pfnGetPropertiesCb = pfnGetPropertiesCb;
 
     return result;
 }
@@ -1213,7 +1213,7 @@ zelTracerImageCreateRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Image.pfnCreateCb = pfnCreateCb;
+        cbs.core.Image.pfnCreateCb = pfnCreateCb;
 
     return result;
 }
@@ -1229,7 +1229,7 @@ zelTracerImageDestroyRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Image.pfnDestroyCb = pfnDestroyCb;
+        cbs.core.Image.pfnDestroyCb = pfnDestroyCb;
 
     return result;
 }
@@ -1245,7 +1245,7 @@ zelTracerMemAllocSharedRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Mem.pfnAllocSharedCb = pfnAllocSharedCb;
+        cbs.core.Mem.pfnAllocSharedCb = pfnAllocSharedCb;
 
     return result;
 }
@@ -1261,7 +1261,7 @@ zelTracerMemAllocDeviceRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Mem.pfnAllocDeviceCb = pfnAllocDeviceCb;
+        cbs.core.Mem.pfnAllocDeviceCb = pfnAllocDeviceCb;
 
     return result;
 }
@@ -1277,7 +1277,7 @@ zelTracerMemAllocHostRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Mem.pfnAllocHostCb = pfnAllocHostCb;
+        cbs.core.Mem.pfnAllocHostCb = pfnAllocHostCb;
 
     return result;
 }
@@ -1293,7 +1293,7 @@ zelTracerMemFreeRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Mem.pfnFreeCb = pfnFreeCb;
+        cbs.core.Mem.pfnFreeCb = pfnFreeCb;
 
     return result;
 }
@@ -1309,7 +1309,7 @@ zelTracerMemGetAllocPropertiesRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Mem.pfnGetAllocPropertiesCb = pfnGetAllocPropertiesCb;
+        cbs.core.Mem.pfnGetAllocPropertiesCb = pfnGetAllocPropertiesCb;
 
     return result;
 }
@@ -1325,7 +1325,7 @@ zelTracerMemGetAddressRangeRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Mem.pfnGetAddressRangeCb = pfnGetAddressRangeCb;
+        cbs.core.Mem.pfnGetAddressRangeCb = pfnGetAddressRangeCb;
 
     return result;
 }
@@ -1341,7 +1341,7 @@ zelTracerMemGetIpcHandleRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Mem.pfnGetIpcHandleCb = pfnGetIpcHandleCb;
+        cbs.core.Mem.pfnGetIpcHandleCb = pfnGetIpcHandleCb;
 
     return result;
 }
@@ -1357,7 +1357,7 @@ zelTracerMemGetIpcHandleFromFileDescriptorExpRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Mem.pfnGetIpcHandleFromFileDescriptorExpCb = pfnGetIpcHandleFromFileDescriptorExpCb;
+        cbs.core.Mem.pfnGetIpcHandleFromFileDescriptorExpCb = pfnGetIpcHandleFromFileDescriptorExpCb;
 
     return result;
 }
@@ -1373,7 +1373,7 @@ zelTracerMemGetFileDescriptorFromIpcHandleExpRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Mem.pfnGetFileDescriptorFromIpcHandleExpCb = pfnGetFileDescriptorFromIpcHandleExpCb;
+        cbs.core.Mem.pfnGetFileDescriptorFromIpcHandleExpCb = pfnGetFileDescriptorFromIpcHandleExpCb;
 
     return result;
 }
@@ -1389,7 +1389,7 @@ zelTracerMemPutIpcHandleRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Mem.pfnPutIpcHandleCb = pfnPutIpcHandleCb;
+        cbs.core.Mem.pfnPutIpcHandleCb = pfnPutIpcHandleCb;
 
     return result;
 }
@@ -1405,7 +1405,7 @@ zelTracerMemOpenIpcHandleRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Mem.pfnOpenIpcHandleCb = pfnOpenIpcHandleCb;
+        cbs.core.Mem.pfnOpenIpcHandleCb = pfnOpenIpcHandleCb;
 
     return result;
 }
@@ -1421,7 +1421,7 @@ zelTracerMemCloseIpcHandleRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Mem.pfnCloseIpcHandleCb = pfnCloseIpcHandleCb;
+        cbs.core.Mem.pfnCloseIpcHandleCb = pfnCloseIpcHandleCb;
 
     return result;
 }
@@ -1437,7 +1437,7 @@ zelTracerModuleCreateRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Module.pfnCreateCb = pfnCreateCb;
+        cbs.core.Module.pfnCreateCb = pfnCreateCb;
 
     return result;
 }
@@ -1453,7 +1453,7 @@ zelTracerModuleDestroyRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Module.pfnDestroyCb = pfnDestroyCb;
+        cbs.core.Module.pfnDestroyCb = pfnDestroyCb;
 
     return result;
 }
@@ -1469,7 +1469,7 @@ zelTracerModuleDynamicLinkRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Module.pfnDynamicLinkCb = pfnDynamicLinkCb;
+        cbs.core.Module.pfnDynamicLinkCb = pfnDynamicLinkCb;
 
     return result;
 }
@@ -1485,7 +1485,7 @@ zelTracerModuleBuildLogDestroyRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.ModuleBuildLog.pfnDestroyCb = pfnDestroyCb;
+        cbs.core.ModuleBuildLog.pfnDestroyCb = pfnDestroyCb;
 
     return result;
 }
@@ -1501,7 +1501,7 @@ zelTracerModuleBuildLogGetStringRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.ModuleBuildLog.pfnGetStringCb = pfnGetStringCb;
+        cbs.core.ModuleBuildLog.pfnGetStringCb = pfnGetStringCb;
 
     return result;
 }
@@ -1517,7 +1517,7 @@ zelTracerModuleGetNativeBinaryRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Module.pfnGetNativeBinaryCb = pfnGetNativeBinaryCb;
+        cbs.core.Module.pfnGetNativeBinaryCb = pfnGetNativeBinaryCb;
 
     return result;
 }
@@ -1533,7 +1533,7 @@ zelTracerModuleGetGlobalPointerRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Module.pfnGetGlobalPointerCb = pfnGetGlobalPointerCb;
+        cbs.core.Module.pfnGetGlobalPointerCb = pfnGetGlobalPointerCb;
 
     return result;
 }
@@ -1549,7 +1549,7 @@ zelTracerModuleGetKernelNamesRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Module.pfnGetKernelNamesCb = pfnGetKernelNamesCb;
+        cbs.core.Module.pfnGetKernelNamesCb = pfnGetKernelNamesCb;
 
     return result;
 }
@@ -1565,7 +1565,7 @@ zelTracerModuleGetPropertiesRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Module.pfnGetPropertiesCb = pfnGetPropertiesCb;
+        cbs.core.Module.pfnGetPropertiesCb = pfnGetPropertiesCb;
 
     return result;
 }
@@ -1581,7 +1581,7 @@ zelTracerKernelCreateRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Kernel.pfnCreateCb = pfnCreateCb;
+        cbs.core.Kernel.pfnCreateCb = pfnCreateCb;
 
     return result;
 }
@@ -1597,7 +1597,7 @@ zelTracerKernelDestroyRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Kernel.pfnDestroyCb = pfnDestroyCb;
+        cbs.core.Kernel.pfnDestroyCb = pfnDestroyCb;
 
     return result;
 }
@@ -1613,7 +1613,7 @@ zelTracerModuleGetFunctionPointerRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Module.pfnGetFunctionPointerCb = pfnGetFunctionPointerCb;
+        cbs.core.Module.pfnGetFunctionPointerCb = pfnGetFunctionPointerCb;
 
     return result;
 }
@@ -1629,7 +1629,7 @@ zelTracerKernelSetGroupSizeRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Kernel.pfnSetGroupSizeCb = pfnSetGroupSizeCb;
+        cbs.core.Kernel.pfnSetGroupSizeCb = pfnSetGroupSizeCb;
 
     return result;
 }
@@ -1645,7 +1645,7 @@ zelTracerKernelSuggestGroupSizeRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Kernel.pfnSuggestGroupSizeCb = pfnSuggestGroupSizeCb;
+        cbs.core.Kernel.pfnSuggestGroupSizeCb = pfnSuggestGroupSizeCb;
 
     return result;
 }
@@ -1661,7 +1661,7 @@ zelTracerKernelSuggestMaxCooperativeGroupCountRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Kernel.pfnSuggestMaxCooperativeGroupCountCb = pfnSuggestMaxCooperativeGroupCountCb;
+        cbs.core.Kernel.pfnSuggestMaxCooperativeGroupCountCb = pfnSuggestMaxCooperativeGroupCountCb;
 
     return result;
 }
@@ -1677,7 +1677,7 @@ zelTracerKernelSetArgumentValueRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Kernel.pfnSetArgumentValueCb = pfnSetArgumentValueCb;
+        cbs.core.Kernel.pfnSetArgumentValueCb = pfnSetArgumentValueCb;
 
     return result;
 }
@@ -1693,7 +1693,7 @@ zelTracerKernelSetIndirectAccessRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Kernel.pfnSetIndirectAccessCb = pfnSetIndirectAccessCb;
+        cbs.core.Kernel.pfnSetIndirectAccessCb = pfnSetIndirectAccessCb;
 
     return result;
 }
@@ -1709,7 +1709,7 @@ zelTracerKernelGetIndirectAccessRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Kernel.pfnGetIndirectAccessCb = pfnGetIndirectAccessCb;
+        cbs.core.Kernel.pfnGetIndirectAccessCb = pfnGetIndirectAccessCb;
 
     return result;
 }
@@ -1725,7 +1725,7 @@ zelTracerKernelGetSourceAttributesRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Kernel.pfnGetSourceAttributesCb = pfnGetSourceAttributesCb;
+        cbs.core.Kernel.pfnGetSourceAttributesCb = pfnGetSourceAttributesCb;
 
     return result;
 }
@@ -1741,7 +1741,7 @@ zelTracerKernelSetCacheConfigRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Kernel.pfnSetCacheConfigCb = pfnSetCacheConfigCb;
+        cbs.core.Kernel.pfnSetCacheConfigCb = pfnSetCacheConfigCb;
 
     return result;
 }
@@ -1757,7 +1757,7 @@ zelTracerKernelGetPropertiesRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Kernel.pfnGetPropertiesCb = pfnGetPropertiesCb;
+        cbs.core.Kernel.pfnGetPropertiesCb = pfnGetPropertiesCb;
 
     return result;
 }
@@ -1773,7 +1773,7 @@ zelTracerKernelGetNameRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Kernel.pfnGetNameCb = pfnGetNameCb;
+        cbs.core.Kernel.pfnGetNameCb = pfnGetNameCb;
 
     return result;
 }
@@ -1789,7 +1789,7 @@ zelTracerCommandListAppendLaunchKernelRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.CommandList.pfnAppendLaunchKernelCb = pfnAppendLaunchKernelCb;
+        cbs.core.CommandList.pfnAppendLaunchKernelCb = pfnAppendLaunchKernelCb;
 
     return result;
 }
@@ -1805,7 +1805,7 @@ zelTracerCommandListAppendLaunchCooperativeKernelRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.CommandList.pfnAppendLaunchCooperativeKernelCb = pfnAppendLaunchCooperativeKernelCb;
+        cbs.core.CommandList.pfnAppendLaunchCooperativeKernelCb = pfnAppendLaunchCooperativeKernelCb;
 
     return result;
 }
@@ -1821,7 +1821,7 @@ zelTracerCommandListAppendLaunchKernelIndirectRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.CommandList.pfnAppendLaunchKernelIndirectCb = pfnAppendLaunchKernelIndirectCb;
+        cbs.core.CommandList.pfnAppendLaunchKernelIndirectCb = pfnAppendLaunchKernelIndirectCb;
 
     return result;
 }
@@ -1837,7 +1837,7 @@ zelTracerCommandListAppendLaunchMultipleKernelsIndirectRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.CommandList.pfnAppendLaunchMultipleKernelsIndirectCb = pfnAppendLaunchMultipleKernelsIndirectCb;
+        cbs.core.CommandList.pfnAppendLaunchMultipleKernelsIndirectCb = pfnAppendLaunchMultipleKernelsIndirectCb;
 
     return result;
 }
@@ -1853,7 +1853,7 @@ zelTracerContextMakeMemoryResidentRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Context.pfnMakeMemoryResidentCb = pfnMakeMemoryResidentCb;
+        cbs.core.Context.pfnMakeMemoryResidentCb = pfnMakeMemoryResidentCb;
 
     return result;
 }
@@ -1869,7 +1869,7 @@ zelTracerContextEvictMemoryRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Context.pfnEvictMemoryCb = pfnEvictMemoryCb;
+        cbs.core.Context.pfnEvictMemoryCb = pfnEvictMemoryCb;
 
     return result;
 }
@@ -1885,7 +1885,7 @@ zelTracerContextMakeImageResidentRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Context.pfnMakeImageResidentCb = pfnMakeImageResidentCb;
+        cbs.core.Context.pfnMakeImageResidentCb = pfnMakeImageResidentCb;
 
     return result;
 }
@@ -1901,7 +1901,7 @@ zelTracerContextEvictImageRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Context.pfnEvictImageCb = pfnEvictImageCb;
+        cbs.core.Context.pfnEvictImageCb = pfnEvictImageCb;
 
     return result;
 }
@@ -1917,7 +1917,7 @@ zelTracerSamplerCreateRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Sampler.pfnCreateCb = pfnCreateCb;
+        cbs.core.Sampler.pfnCreateCb = pfnCreateCb;
 
     return result;
 }
@@ -1933,7 +1933,7 @@ zelTracerSamplerDestroyRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Sampler.pfnDestroyCb = pfnDestroyCb;
+        cbs.core.Sampler.pfnDestroyCb = pfnDestroyCb;
 
     return result;
 }
@@ -1949,7 +1949,7 @@ zelTracerVirtualMemReserveRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.VirtualMem.pfnReserveCb = pfnReserveCb;
+        cbs.core.VirtualMem.pfnReserveCb = pfnReserveCb;
 
     return result;
 }
@@ -1965,7 +1965,7 @@ zelTracerVirtualMemFreeRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.VirtualMem.pfnFreeCb = pfnFreeCb;
+        cbs.core.VirtualMem.pfnFreeCb = pfnFreeCb;
 
     return result;
 }
@@ -1981,7 +1981,7 @@ zelTracerVirtualMemQueryPageSizeRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.VirtualMem.pfnQueryPageSizeCb = pfnQueryPageSizeCb;
+        cbs.core.VirtualMem.pfnQueryPageSizeCb = pfnQueryPageSizeCb;
 
     return result;
 }
@@ -1997,7 +1997,7 @@ zelTracerPhysicalMemCreateRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.PhysicalMem.pfnCreateCb = pfnCreateCb;
+        cbs.core.PhysicalMem.pfnCreateCb = pfnCreateCb;
 
     return result;
 }
@@ -2013,7 +2013,7 @@ zelTracerPhysicalMemDestroyRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.PhysicalMem.pfnDestroyCb = pfnDestroyCb;
+        cbs.core.PhysicalMem.pfnDestroyCb = pfnDestroyCb;
 
     return result;
 }
@@ -2029,7 +2029,7 @@ zelTracerVirtualMemMapRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.VirtualMem.pfnMapCb = pfnMapCb;
+        cbs.core.VirtualMem.pfnMapCb = pfnMapCb;
 
     return result;
 }
@@ -2045,7 +2045,7 @@ zelTracerVirtualMemUnmapRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.VirtualMem.pfnUnmapCb = pfnUnmapCb;
+        cbs.core.VirtualMem.pfnUnmapCb = pfnUnmapCb;
 
     return result;
 }
@@ -2061,7 +2061,7 @@ zelTracerVirtualMemSetAccessAttributeRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.VirtualMem.pfnSetAccessAttributeCb = pfnSetAccessAttributeCb;
+        cbs.core.VirtualMem.pfnSetAccessAttributeCb = pfnSetAccessAttributeCb;
 
     return result;
 }
@@ -2077,7 +2077,7 @@ zelTracerVirtualMemGetAccessAttributeRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.VirtualMem.pfnGetAccessAttributeCb = pfnGetAccessAttributeCb;
+        cbs.core.VirtualMem.pfnGetAccessAttributeCb = pfnGetAccessAttributeCb;
 
     return result;
 }
@@ -2093,7 +2093,7 @@ zelTracerKernelSetGlobalOffsetExpRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Kernel.pfnSetGlobalOffsetExpCb = pfnSetGlobalOffsetExpCb;
+        cbs.core.Kernel.pfnSetGlobalOffsetExpCb = pfnSetGlobalOffsetExpCb;
 
     return result;
 }
@@ -2109,7 +2109,7 @@ zelTracerDeviceReserveCacheExtRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Device.pfnReserveCacheExtCb = pfnReserveCacheExtCb;
+        cbs.core.Device.pfnReserveCacheExtCb = pfnReserveCacheExtCb;
 
     return result;
 }
@@ -2125,7 +2125,7 @@ zelTracerDeviceSetCacheAdviceExtRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Device.pfnSetCacheAdviceExtCb = pfnSetCacheAdviceExtCb;
+        cbs.core.Device.pfnSetCacheAdviceExtCb = pfnSetCacheAdviceExtCb;
 
     return result;
 }
@@ -2141,7 +2141,7 @@ zelTracerEventQueryTimestampsExpRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Event.pfnQueryTimestampsExpCb = pfnQueryTimestampsExpCb;
+        cbs.core.Event.pfnQueryTimestampsExpCb = pfnQueryTimestampsExpCb;
 
     return result;
 }
@@ -2157,7 +2157,7 @@ zelTracerImageGetMemoryPropertiesExpRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Image.pfnGetMemoryPropertiesExpCb = pfnGetMemoryPropertiesExpCb;
+        cbs.core.Image.pfnGetMemoryPropertiesExpCb = pfnGetMemoryPropertiesExpCb;
 
     return result;
 }
@@ -2173,7 +2173,7 @@ zelTracerImageViewCreateExtRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Image.pfnViewCreateExtCb = pfnViewCreateExtCb;
+        cbs.core.Image.pfnViewCreateExtCb = pfnViewCreateExtCb;
 
     return result;
 }
@@ -2189,7 +2189,7 @@ zelTracerImageViewCreateExpRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Image.pfnViewCreateExpCb = pfnViewCreateExpCb;
+        cbs.core.Image.pfnViewCreateExpCb = pfnViewCreateExpCb;
 
     return result;
 }
@@ -2205,7 +2205,7 @@ zelTracerKernelSchedulingHintExpRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Kernel.pfnSchedulingHintExpCb = pfnSchedulingHintExpCb;
+        cbs.core.Kernel.pfnSchedulingHintExpCb = pfnSchedulingHintExpCb;
 
     return result;
 }
@@ -2221,7 +2221,7 @@ zelTracerDevicePciGetPropertiesExtRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Device.pfnPciGetPropertiesExtCb = pfnPciGetPropertiesExtCb;
+        cbs.core.Device.pfnPciGetPropertiesExtCb = pfnPciGetPropertiesExtCb;
 
     return result;
 }
@@ -2237,7 +2237,7 @@ zelTracerCommandListAppendImageCopyToMemoryExtRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.CommandList.pfnAppendImageCopyToMemoryExtCb = pfnAppendImageCopyToMemoryExtCb;
+        cbs.core.CommandList.pfnAppendImageCopyToMemoryExtCb = pfnAppendImageCopyToMemoryExtCb;
 
     return result;
 }
@@ -2253,7 +2253,7 @@ zelTracerCommandListAppendImageCopyFromMemoryExtRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.CommandList.pfnAppendImageCopyFromMemoryExtCb = pfnAppendImageCopyFromMemoryExtCb;
+        cbs.core.CommandList.pfnAppendImageCopyFromMemoryExtCb = pfnAppendImageCopyFromMemoryExtCb;
 
     return result;
 }
@@ -2269,7 +2269,7 @@ zelTracerImageGetAllocPropertiesExtRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Image.pfnGetAllocPropertiesExtCb = pfnGetAllocPropertiesExtCb;
+        cbs.core.Image.pfnGetAllocPropertiesExtCb = pfnGetAllocPropertiesExtCb;
 
     return result;
 }
@@ -2285,7 +2285,7 @@ zelTracerModuleInspectLinkageExtRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Module.pfnInspectLinkageExtCb = pfnInspectLinkageExtCb;
+        cbs.core.Module.pfnInspectLinkageExtCb = pfnInspectLinkageExtCb;
 
     return result;
 }
@@ -2301,7 +2301,7 @@ zelTracerMemFreeExtRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Mem.pfnFreeExtCb = pfnFreeExtCb;
+        cbs.core.Mem.pfnFreeExtCb = pfnFreeExtCb;
 
     return result;
 }
@@ -2317,7 +2317,7 @@ zelTracerFabricVertexGetExpRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.FabricVertex.pfnGetExpCb = pfnGetExpCb;
+        cbs.core.FabricVertex.pfnGetExpCb = pfnGetExpCb;
 
     return result;
 }
@@ -2333,7 +2333,7 @@ zelTracerFabricVertexGetSubVerticesExpRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.FabricVertex.pfnGetSubVerticesExpCb = pfnGetSubVerticesExpCb;
+        cbs.core.FabricVertex.pfnGetSubVerticesExpCb = pfnGetSubVerticesExpCb;
 
     return result;
 }
@@ -2349,7 +2349,7 @@ zelTracerFabricVertexGetPropertiesExpRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.FabricVertex.pfnGetPropertiesExpCb = pfnGetPropertiesExpCb;
+        cbs.core.FabricVertex.pfnGetPropertiesExpCb = pfnGetPropertiesExpCb;
 
     return result;
 }
@@ -2365,7 +2365,7 @@ zelTracerFabricVertexGetDeviceExpRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.FabricVertex.pfnGetDeviceExpCb = pfnGetDeviceExpCb;
+        cbs.core.FabricVertex.pfnGetDeviceExpCb = pfnGetDeviceExpCb;
 
     return result;
 }
@@ -2381,7 +2381,7 @@ zelTracerDeviceGetFabricVertexExpRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Device.pfnGetFabricVertexExpCb = pfnGetFabricVertexExpCb;
+        cbs.core.Device.pfnGetFabricVertexExpCb = pfnGetFabricVertexExpCb;
 
     return result;
 }
@@ -2397,7 +2397,7 @@ zelTracerFabricEdgeGetExpRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.FabricEdge.pfnGetExpCb = pfnGetExpCb;
+        cbs.core.FabricEdge.pfnGetExpCb = pfnGetExpCb;
 
     return result;
 }
@@ -2413,7 +2413,7 @@ zelTracerFabricEdgeGetVerticesExpRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.FabricEdge.pfnGetVerticesExpCb = pfnGetVerticesExpCb;
+        cbs.core.FabricEdge.pfnGetVerticesExpCb = pfnGetVerticesExpCb;
 
     return result;
 }
@@ -2429,7 +2429,7 @@ zelTracerFabricEdgeGetPropertiesExpRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.FabricEdge.pfnGetPropertiesExpCb = pfnGetPropertiesExpCb;
+        cbs.core.FabricEdge.pfnGetPropertiesExpCb = pfnGetPropertiesExpCb;
 
     return result;
 }
@@ -2445,7 +2445,7 @@ zelTracerEventQueryKernelTimestampsExtRegisterCallback(
     ze_result_t result;
     auto& cbs = tracing_layer::APITracer::fromHandle(hTracer)->getProEpilogues(callback_type, result);
     if (result == ZE_RESULT_SUCCESS)
-        cbs.Event.pfnQueryKernelTimestampsExtCb = pfnQueryKernelTimestampsExtCb;
+        cbs.core.Event.pfnQueryKernelTimestampsExtCb = pfnQueryKernelTimestampsExtCb;
 
     return result;
 }
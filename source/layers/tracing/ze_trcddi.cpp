@@ -26,7 +26,13 @@ namespace tracing_layer
         if( nullptr == pfnInit)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Global.pfnInit, flags);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Global, pfnInitCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Global.pfnInit, flags);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Global.pfnInit, flags);
 
         // capture parameters
         ze_init_params_t tracerParams = {
@@ -35,15 +41,13 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnInitCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnInitCb_t, Global, pfnInitCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnInitCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Global.pfnInit,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.Global.pfnInit,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
-                                                  *tracerParams.pflags);
+                                                  apiCallbackData,
+                                                  *tracerParams.pflags));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -65,7 +69,13 @@ namespace tracing_layer
         if( nullptr == pfnGet)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Driver.pfnGet, pCount, phDrivers);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Driver, pfnGetCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Driver.pfnGet, pCount, phDrivers);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Driver.pfnGet, pCount, phDrivers);
 
         // capture parameters
         ze_driver_get_params_t tracerParams = {
@@ -75,16 +85,14 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnDriverGetCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDriverGetCb_t, Driver, pfnGetCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDriverGetCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Driver.pfnGet,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Driver.pfnGet,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.ppCount,
-                                                  *tracerParams.pphDrivers);
+                                                  *tracerParams.pphDrivers));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -100,7 +108,13 @@ namespace tracing_layer
         if( nullptr == pfnGetApiVersion)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Driver.pfnGetApiVersion, hDriver, version);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Driver, pfnGetApiVersionCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hDriver);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Driver.pfnGetApiVersion, hDriver, version);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Driver.pfnGetApiVersion, hDriver, version);
 
         // capture parameters
         ze_driver_get_api_version_params_t tracerParams = {
@@ -110,16 +124,14 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnDriverGetApiVersionCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDriverGetApiVersionCb_t, Driver, pfnGetApiVersionCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDriverGetApiVersionCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Driver.pfnGetApiVersion,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Driver.pfnGetApiVersion,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDriver,
-                                                  *tracerParams.pversion);
+                                                  *tracerParams.pversion));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -135,7 +147,13 @@ namespace tracing_layer
         if( nullptr == pfnGetProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Driver.pfnGetProperties, hDriver, pDriverProperties);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Driver, pfnGetPropertiesCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hDriver);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Driver.pfnGetProperties, hDriver, pDriverProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Driver.pfnGetProperties, hDriver, pDriverProperties);
 
         // capture parameters
         ze_driver_get_properties_params_t tracerParams = {
@@ -145,16 +163,14 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnDriverGetPropertiesCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDriverGetPropertiesCb_t, Driver, pfnGetPropertiesCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDriverGetPropertiesCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Driver.pfnGetProperties,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Driver.pfnGetProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDriver,
-                                                  *tracerParams.ppDriverProperties);
+                                                  *tracerParams.ppDriverProperties));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -170,7 +186,13 @@ namespace tracing_layer
         if( nullptr == pfnGetIpcProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Driver.pfnGetIpcProperties, hDriver, pIpcProperties);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Driver, pfnGetIpcPropertiesCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hDriver);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Driver.pfnGetIpcProperties, hDriver, pIpcProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Driver.pfnGetIpcProperties, hDriver, pIpcProperties);
 
         // capture parameters
         ze_driver_get_ipc_properties_params_t tracerParams = {
@@ -180,16 +202,14 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnDriverGetIpcPropertiesCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDriverGetIpcPropertiesCb_t, Driver, pfnGetIpcPropertiesCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDriverGetIpcPropertiesCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Driver.pfnGetIpcProperties,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Driver.pfnGetIpcProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDriver,
-                                                  *tracerParams.ppIpcProperties);
+                                                  *tracerParams.ppIpcProperties));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -214,7 +234,13 @@ namespace tracing_layer
         if( nullptr == pfnGetExtensionProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Driver.pfnGetExtensionProperties, hDriver, pCount, pExtensionProperties);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Driver, pfnGetExtensionPropertiesCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hDriver);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Driver.pfnGetExtensionProperties, hDriver, pCount, pExtensionProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Driver.pfnGetExtensionProperties, hDriver, pCount, pExtensionProperties);
 
         // capture parameters
         ze_driver_get_extension_properties_params_t tracerParams = {
@@ -225,17 +251,15 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnDriverGetExtensionPropertiesCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDriverGetExtensionPropertiesCb_t, Driver, pfnGetExtensionPropertiesCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDriverGetExtensionPropertiesCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Driver.pfnGetExtensionProperties,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Driver.pfnGetExtensionProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDriver,
                                                   *tracerParams.ppCount,
-                                                  *tracerParams.ppExtensionProperties);
+                                                  *tracerParams.ppExtensionProperties));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -252,7 +276,13 @@ namespace tracing_layer
         if( nullptr == pfnGetExtensionFunctionAddress)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Driver.pfnGetExtensionFunctionAddress, hDriver, name, ppFunctionAddress);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Driver, pfnGetExtensionFunctionAddressCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hDriver);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Driver.pfnGetExtensionFunctionAddress, hDriver, name, ppFunctionAddress);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Driver.pfnGetExtensionFunctionAddress, hDriver, name, ppFunctionAddress);
 
         // capture parameters
         ze_driver_get_extension_function_address_params_t tracerParams = {
@@ -263,17 +293,15 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnDriverGetExtensionFunctionAddressCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDriverGetExtensionFunctionAddressCb_t, Driver, pfnGetExtensionFunctionAddressCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDriverGetExtensionFunctionAddressCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Driver.pfnGetExtensionFunctionAddress,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Driver.pfnGetExtensionFunctionAddress,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDriver,
                                                   *tracerParams.pname,
-                                                  *tracerParams.pppFunctionAddress);
+                                                  *tracerParams.pppFunctionAddress));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -290,7 +318,13 @@ namespace tracing_layer
         if( nullptr == pfnGetLastErrorDescription)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Driver.pfnGetLastErrorDescription, hDriver, ppString);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Driver, pfnGetLastErrorDescriptionCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hDriver);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Driver.pfnGetLastErrorDescription, hDriver, ppString);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Driver.pfnGetLastErrorDescription, hDriver, ppString);
 
         // capture parameters
         ze_driver_get_last_error_description_params_t tracerParams = {
@@ -300,16 +334,14 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnDriverGetLastErrorDescriptionCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDriverGetLastErrorDescriptionCb_t, Driver, pfnGetLastErrorDescriptionCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDriverGetLastErrorDescriptionCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Driver.pfnGetLastErrorDescription,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Driver.pfnGetLastErrorDescription,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDriver,
-                                                  *tracerParams.pppString);
+                                                  *tracerParams.pppString));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -332,7 +364,13 @@ namespace tracing_layer
         if( nullptr == pfnGet)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGet, hDriver, pCount, phDevices);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Device, pfnGetCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hDriver);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Device.pfnGet, hDriver, pCount, phDevices);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Device.pfnGet, hDriver, pCount, phDevices);
 
         // capture parameters
         ze_device_get_params_t tracerParams = {
@@ -343,17 +381,15 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnDeviceGetCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDeviceGetCb_t, Device, pfnGetCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDeviceGetCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGet,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Device.pfnGet,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDriver,
                                                   *tracerParams.ppCount,
-                                                  *tracerParams.pphDevices);
+                                                  *tracerParams.pphDevices));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -376,7 +412,13 @@ namespace tracing_layer
         if( nullptr == pfnGetSubDevices)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetSubDevices, hDevice, pCount, phSubdevices);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Device, pfnGetSubDevicesCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hDevice);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Device.pfnGetSubDevices, hDevice, pCount, phSubdevices);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Device.pfnGetSubDevices, hDevice, pCount, phSubdevices);
 
         // capture parameters
         ze_device_get_sub_devices_params_t tracerParams = {
@@ -387,17 +429,15 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnDeviceGetSubDevicesCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDeviceGetSubDevicesCb_t, Device, pfnGetSubDevicesCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDeviceGetSubDevicesCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGetSubDevices,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Device.pfnGetSubDevices,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.ppCount,
-                                                  *tracerParams.pphSubdevices);
+                                                  *tracerParams.pphSubdevices));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -413,7 +453,13 @@ namespace tracing_layer
         if( nullptr == pfnGetProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetProperties, hDevice, pDeviceProperties);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Device, pfnGetPropertiesCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hDevice);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Device.pfnGetProperties, hDevice, pDeviceProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Device.pfnGetProperties, hDevice, pDeviceProperties);
 
         // capture parameters
         ze_device_get_properties_params_t tracerParams = {
@@ -423,16 +469,14 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnDeviceGetPropertiesCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDeviceGetPropertiesCb_t, Device, pfnGetPropertiesCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDeviceGetPropertiesCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGetProperties,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Device.pfnGetProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
-                                                  *tracerParams.ppDeviceProperties);
+                                                  *tracerParams.ppDeviceProperties));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -448,7 +492,13 @@ namespace tracing_layer
         if( nullptr == pfnGetComputeProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetComputeProperties, hDevice, pComputeProperties);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Device, pfnGetComputePropertiesCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hDevice);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Device.pfnGetComputeProperties, hDevice, pComputeProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Device.pfnGetComputeProperties, hDevice, pComputeProperties);
 
         // capture parameters
         ze_device_get_compute_properties_params_t tracerParams = {
@@ -458,16 +508,14 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnDeviceGetComputePropertiesCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDeviceGetComputePropertiesCb_t, Device, pfnGetComputePropertiesCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDeviceGetComputePropertiesCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGetComputeProperties,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Device.pfnGetComputeProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
-                                                  *tracerParams.ppComputeProperties);
+                                                  *tracerParams.ppComputeProperties));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -483,7 +531,13 @@ namespace tracing_layer
         if( nullptr == pfnGetModuleProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetModuleProperties, hDevice, pModuleProperties);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Device, pfnGetModulePropertiesCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hDevice);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Device.pfnGetModuleProperties, hDevice, pModuleProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Device.pfnGetModuleProperties, hDevice, pModuleProperties);
 
         // capture parameters
         ze_device_get_module_properties_params_t tracerParams = {
@@ -493,16 +547,14 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnDeviceGetModulePropertiesCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDeviceGetModulePropertiesCb_t, Device, pfnGetModulePropertiesCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDeviceGetModulePropertiesCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGetModuleProperties,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Device.pfnGetModuleProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
-                                                  *tracerParams.ppModuleProperties);
+                                                  *tracerParams.ppModuleProperties));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -528,7 +580,13 @@ namespace tracing_layer
         if( nullptr == pfnGetCommandQueueGroupProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetCommandQueueGroupProperties, hDevice, pCount, pCommandQueueGroupProperties);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Device, pfnGetCommandQueueGroupPropertiesCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hDevice);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Device.pfnGetCommandQueueGroupProperties, hDevice, pCount, pCommandQueueGroupProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Device.pfnGetCommandQueueGroupProperties, hDevice, pCount, pCommandQueueGroupProperties);
 
         // capture parameters
         ze_device_get_command_queue_group_properties_params_t tracerParams = {
@@ -539,17 +597,15 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnDeviceGetCommandQueueGroupPropertiesCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDeviceGetCommandQueueGroupPropertiesCb_t, Device, pfnGetCommandQueueGroupPropertiesCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDeviceGetCommandQueueGroupPropertiesCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGetCommandQueueGroupProperties,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Device.pfnGetCommandQueueGroupProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.ppCount,
-                                                  *tracerParams.ppCommandQueueGroupProperties);
+                                                  *tracerParams.ppCommandQueueGroupProperties));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -574,7 +630,13 @@ namespace tracing_layer
         if( nullptr == pfnGetMemoryProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetMemoryProperties, hDevice, pCount, pMemProperties);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Device, pfnGetMemoryPropertiesCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hDevice);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Device.pfnGetMemoryProperties, hDevice, pCount, pMemProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Device.pfnGetMemoryProperties, hDevice, pCount, pMemProperties);
 
         // capture parameters
         ze_device_get_memory_properties_params_t tracerParams = {
@@ -585,17 +647,15 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnDeviceGetMemoryPropertiesCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDeviceGetMemoryPropertiesCb_t, Device, pfnGetMemoryPropertiesCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDeviceGetMemoryPropertiesCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGetMemoryProperties,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Device.pfnGetMemoryProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.ppCount,
-                                                  *tracerParams.ppMemProperties);
+                                                  *tracerParams.ppMemProperties));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -611,7 +671,13 @@ namespace tracing_layer
         if( nullptr == pfnGetMemoryAccessProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetMemoryAccessProperties, hDevice, pMemAccessProperties);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Device, pfnGetMemoryAccessPropertiesCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hDevice);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Device.pfnGetMemoryAccessProperties, hDevice, pMemAccessProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Device.pfnGetMemoryAccessProperties, hDevice, pMemAccessProperties);
 
         // capture parameters
         ze_device_get_memory_access_properties_params_t tracerParams = {
@@ -621,16 +687,14 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnDeviceGetMemoryAccessPropertiesCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDeviceGetMemoryAccessPropertiesCb_t, Device, pfnGetMemoryAccessPropertiesCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDeviceGetMemoryAccessPropertiesCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGetMemoryAccessProperties,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Device.pfnGetMemoryAccessProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
-                                                  *tracerParams.ppMemAccessProperties);
+                                                  *tracerParams.ppMemAccessProperties));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -654,7 +718,13 @@ namespace tracing_layer
         if( nullptr == pfnGetCacheProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetCacheProperties, hDevice, pCount, pCacheProperties);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Device, pfnGetCachePropertiesCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hDevice);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Device.pfnGetCacheProperties, hDevice, pCount, pCacheProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Device.pfnGetCacheProperties, hDevice, pCount, pCacheProperties);
 
         // capture parameters
         ze_device_get_cache_properties_params_t tracerParams = {
@@ -665,17 +735,15 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnDeviceGetCachePropertiesCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDeviceGetCachePropertiesCb_t, Device, pfnGetCachePropertiesCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDeviceGetCachePropertiesCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGetCacheProperties,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Device.pfnGetCacheProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.ppCount,
-                                                  *tracerParams.ppCacheProperties);
+                                                  *tracerParams.ppCacheProperties));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -691,7 +759,13 @@ namespace tracing_layer
         if( nullptr == pfnGetImageProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetImageProperties, hDevice, pImageProperties);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Device, pfnGetImagePropertiesCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hDevice);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Device.pfnGetImageProperties, hDevice, pImageProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Device.pfnGetImageProperties, hDevice, pImageProperties);
 
         // capture parameters
         ze_device_get_image_properties_params_t tracerParams = {
@@ -701,16 +775,14 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnDeviceGetImagePropertiesCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDeviceGetImagePropertiesCb_t, Device, pfnGetImagePropertiesCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDeviceGetImagePropertiesCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGetImageProperties,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Device.pfnGetImageProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
-                                                  *tracerParams.ppImageProperties);
+                                                  *tracerParams.ppImageProperties));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -726,7 +798,13 @@ namespace tracing_layer
         if( nullptr == pfnGetExternalMemoryProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetExternalMemoryProperties, hDevice, pExternalMemoryProperties);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Device, pfnGetExternalMemoryPropertiesCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hDevice);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Device.pfnGetExternalMemoryProperties, hDevice, pExternalMemoryProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Device.pfnGetExternalMemoryProperties, hDevice, pExternalMemoryProperties);
 
         // capture parameters
         ze_device_get_external_memory_properties_params_t tracerParams = {
@@ -736,16 +814,14 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnDeviceGetExternalMemoryPropertiesCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDeviceGetExternalMemoryPropertiesCb_t, Device, pfnGetExternalMemoryPropertiesCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDeviceGetExternalMemoryPropertiesCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGetExternalMemoryProperties,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Device.pfnGetExternalMemoryProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
-                                                  *tracerParams.ppExternalMemoryProperties);
+                                                  *tracerParams.ppExternalMemoryProperties));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -762,7 +838,13 @@ namespace tracing_layer
         if( nullptr == pfnGetP2PProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetP2PProperties, hDevice, hPeerDevice, pP2PProperties);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Device, pfnGetP2PPropertiesCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hDevice, hPeerDevice);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Device.pfnGetP2PProperties, hDevice, hPeerDevice, pP2PProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Device.pfnGetP2PProperties, hDevice, hPeerDevice, pP2PProperties);
 
         // capture parameters
         ze_device_get_p2_p_properties_params_t tracerParams = {
@@ -773,17 +855,15 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnDeviceGetP2PPropertiesCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDeviceGetP2PPropertiesCb_t, Device, pfnGetP2PPropertiesCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDeviceGetP2PPropertiesCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGetP2PProperties,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Device.pfnGetP2PProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.phPeerDevice,
-                                                  *tracerParams.ppP2PProperties);
+                                                  *tracerParams.ppP2PProperties));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -800,7 +880,13 @@ namespace tracing_layer
         if( nullptr == pfnCanAccessPeer)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnCanAccessPeer, hDevice, hPeerDevice, value);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Device, pfnCanAccessPeerCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hDevice, hPeerDevice);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Device.pfnCanAccessPeer, hDevice, hPeerDevice, value);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Device.pfnCanAccessPeer, hDevice, hPeerDevice, value);
 
         // capture parameters
         ze_device_can_access_peer_params_t tracerParams = {
@@ -811,17 +897,15 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnDeviceCanAccessPeerCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDeviceCanAccessPeerCb_t, Device, pfnCanAccessPeerCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDeviceCanAccessPeerCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnCanAccessPeer,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Device.pfnCanAccessPeer,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.phPeerDevice,
-                                                  *tracerParams.pvalue);
+                                                  *tracerParams.pvalue));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -836,7 +920,13 @@ namespace tracing_layer
         if( nullptr == pfnGetStatus)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetStatus, hDevice);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Device, pfnGetStatusCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hDevice);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Device.pfnGetStatus, hDevice);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Device.pfnGetStatus, hDevice);
 
         // capture parameters
         ze_device_get_status_params_t tracerParams = {
@@ -845,15 +935,13 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnDeviceGetStatusCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDeviceGetStatusCb_t, Device, pfnGetStatusCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDeviceGetStatusCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGetStatus,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.Device.pfnGetStatus,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
-                                                  *tracerParams.phDevice);
+                                                  apiCallbackData,
+                                                  *tracerParams.phDevice));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -872,7 +960,13 @@ namespace tracing_layer
         if( nullptr == pfnGetGlobalTimestamps)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetGlobalTimestamps, hDevice, hostTimestamp, deviceTimestamp);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Device, pfnGetGlobalTimestampsCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hDevice);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Device.pfnGetGlobalTimestamps, hDevice, hostTimestamp, deviceTimestamp);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Device.pfnGetGlobalTimestamps, hDevice, hostTimestamp, deviceTimestamp);
 
         // capture parameters
         ze_device_get_global_timestamps_params_t tracerParams = {
@@ -883,17 +977,15 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnDeviceGetGlobalTimestampsCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDeviceGetGlobalTimestampsCb_t, Device, pfnGetGlobalTimestampsCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDeviceGetGlobalTimestampsCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGetGlobalTimestamps,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Device.pfnGetGlobalTimestamps,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.phostTimestamp,
-                                                  *tracerParams.pdeviceTimestamp);
+                                                  *tracerParams.pdeviceTimestamp));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -910,7 +1002,13 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Context.pfnCreate, hDriver, desc, phContext);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Context, pfnCreateCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hDriver);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Context.pfnCreate, hDriver, desc, phContext);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Context.pfnCreate, hDriver, desc, phContext);
 
         // capture parameters
         ze_context_create_params_t tracerParams = {
@@ -921,17 +1019,15 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnContextCreateCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnContextCreateCb_t, Context, pfnCreateCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnContextCreateCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Context.pfnCreate,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<1>, tracing_layer::epilogue_arg_indices<2>>>(context.zeDdiTable.Context.pfnCreate,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDriver,
                                                   *tracerParams.pdesc,
-                                                  *tracerParams.pphContext);
+                                                  *tracerParams.pphContext));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -958,7 +1054,13 @@ namespace tracing_layer
         if( nullptr == pfnCreateEx)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Context.pfnCreateEx, hDriver, desc, numDevices, phDevices, phContext);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Context, pfnCreateExCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hDriver);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Context.pfnCreateEx, hDriver, desc, numDevices, phDevices, phContext);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Context.pfnCreateEx, hDriver, desc, numDevices, phDevices, phContext);
 
         // capture parameters
         ze_context_create_ex_params_t tracerParams = {
@@ -971,19 +1073,17 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnContextCreateExCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnContextCreateExCb_t, Context, pfnCreateExCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnContextCreateExCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Context.pfnCreateEx,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<1, 3>, tracing_layer::epilogue_arg_indices<4>>>(context.zeDdiTable.Context.pfnCreateEx,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDriver,
                                                   *tracerParams.pdesc,
                                                   *tracerParams.pnumDevices,
                                                   *tracerParams.pphDevices,
-                                                  *tracerParams.pphContext);
+                                                  *tracerParams.pphContext));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -998,7 +1098,13 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Context.pfnDestroy, hContext);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Context, pfnDestroyCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hContext);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Context.pfnDestroy, hContext);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Context.pfnDestroy, hContext);
 
         // capture parameters
         ze_context_destroy_params_t tracerParams = {
@@ -1007,15 +1113,13 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnContextDestroyCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnContextDestroyCb_t, Context, pfnDestroyCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnContextDestroyCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Context.pfnDestroy,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.Context.pfnDestroy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
-                                                  *tracerParams.phContext);
+                                                  apiCallbackData,
+                                                  *tracerParams.phContext));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -1030,7 +1134,13 @@ namespace tracing_layer
         if( nullptr == pfnGetStatus)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Context.pfnGetStatus, hContext);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Context, pfnGetStatusCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hContext);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Context.pfnGetStatus, hContext);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Context.pfnGetStatus, hContext);
 
         // capture parameters
         ze_context_get_status_params_t tracerParams = {
@@ -1039,15 +1149,13 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnContextGetStatusCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnContextGetStatusCb_t, Context, pfnGetStatusCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnContextGetStatusCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Context.pfnGetStatus,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.Context.pfnGetStatus,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
-                                                  *tracerParams.phContext);
+                                                  apiCallbackData,
+                                                  *tracerParams.phContext));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -1065,7 +1173,13 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandQueue.pfnCreate, hContext, hDevice, desc, phCommandQueue);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(CommandQueue, pfnCreateCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hContext, hDevice);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.CommandQueue.pfnCreate, hContext, hDevice, desc, phCommandQueue);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.CommandQueue.pfnCreate, hContext, hDevice, desc, phCommandQueue);
 
         // capture parameters
         ze_command_queue_create_params_t tracerParams = {
@@ -1077,18 +1191,16 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnCommandQueueCreateCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandQueueCreateCb_t, CommandQueue, pfnCreateCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandQueueCreateCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandQueue.pfnCreate,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<2>, tracing_layer::epilogue_arg_indices<3>>>(context.zeDdiTable.CommandQueue.pfnCreate,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pdesc,
-                                                  *tracerParams.pphCommandQueue);
+                                                  *tracerParams.pphCommandQueue));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -1103,7 +1215,13 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandQueue.pfnDestroy, hCommandQueue);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(CommandQueue, pfnDestroyCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hCommandQueue);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.CommandQueue.pfnDestroy, hCommandQueue);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.CommandQueue.pfnDestroy, hCommandQueue);
 
         // capture parameters
         ze_command_queue_destroy_params_t tracerParams = {
@@ -1112,15 +1230,13 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnCommandQueueDestroyCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandQueueDestroyCb_t, CommandQueue, pfnDestroyCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandQueueDestroyCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandQueue.pfnDestroy,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.CommandQueue.pfnDestroy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
-                                                  *tracerParams.phCommandQueue);
+                                                  apiCallbackData,
+                                                  *tracerParams.phCommandQueue));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -1139,7 +1255,13 @@ namespace tracing_layer
         if( nullptr == pfnExecuteCommandLists)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandQueue.pfnExecuteCommandLists, hCommandQueue, numCommandLists, phCommandLists, hFence);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(CommandQueue, pfnExecuteCommandListsCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hCommandQueue, hFence);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.CommandQueue.pfnExecuteCommandLists, hCommandQueue, numCommandLists, phCommandLists, hFence);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.CommandQueue.pfnExecuteCommandLists, hCommandQueue, numCommandLists, phCommandLists, hFence);
 
         // capture parameters
         ze_command_queue_execute_command_lists_params_t tracerParams = {
@@ -1151,18 +1273,16 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnCommandQueueExecuteCommandListsCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandQueueExecuteCommandListsCb_t, CommandQueue, pfnExecuteCommandListsCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandQueueExecuteCommandListsCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandQueue.pfnExecuteCommandLists,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<2>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.CommandQueue.pfnExecuteCommandLists,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandQueue,
                                                   *tracerParams.pnumCommandLists,
                                                   *tracerParams.pphCommandLists,
-                                                  *tracerParams.phFence);
+                                                  *tracerParams.phFence));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -1184,7 +1304,13 @@ namespace tracing_layer
         if( nullptr == pfnSynchronize)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandQueue.pfnSynchronize, hCommandQueue, timeout);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(CommandQueue, pfnSynchronizeCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hCommandQueue);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.CommandQueue.pfnSynchronize, hCommandQueue, timeout);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.CommandQueue.pfnSynchronize, hCommandQueue, timeout);
 
         // capture parameters
         ze_command_queue_synchronize_params_t tracerParams = {
@@ -1194,16 +1320,14 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnCommandQueueSynchronizeCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandQueueSynchronizeCb_t, CommandQueue, pfnSynchronizeCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandQueueSynchronizeCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandQueue.pfnSynchronize,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.CommandQueue.pfnSynchronize,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandQueue,
-                                                  *tracerParams.ptimeout);
+                                                  *tracerParams.ptimeout));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -1221,7 +1345,13 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnCreate, hContext, hDevice, desc, phCommandList);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(CommandList, pfnCreateCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hContext, hDevice);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.CommandList.pfnCreate, hContext, hDevice, desc, phCommandList);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.CommandList.pfnCreate, hContext, hDevice, desc, phCommandList);
 
         // capture parameters
         ze_command_list_create_params_t tracerParams = {
@@ -1233,18 +1363,16 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnCommandListCreateCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListCreateCb_t, CommandList, pfnCreateCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListCreateCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnCreate,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<2>, tracing_layer::epilogue_arg_indices<3>>>(context.zeDdiTable.CommandList.pfnCreate,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pdesc,
-                                                  *tracerParams.pphCommandList);
+                                                  *tracerParams.pphCommandList));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -1262,7 +1390,13 @@ namespace tracing_layer
         if( nullptr == pfnCreateImmediate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnCreateImmediate, hContext, hDevice, altdesc, phCommandList);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(CommandList, pfnCreateImmediateCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hContext, hDevice);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.CommandList.pfnCreateImmediate, hContext, hDevice, altdesc, phCommandList);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.CommandList.pfnCreateImmediate, hContext, hDevice, altdesc, phCommandList);
 
         // capture parameters
         ze_command_list_create_immediate_params_t tracerParams = {
@@ -1274,18 +1408,16 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnCommandListCreateImmediateCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListCreateImmediateCb_t, CommandList, pfnCreateImmediateCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListCreateImmediateCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnCreateImmediate,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<2>, tracing_layer::epilogue_arg_indices<3>>>(context.zeDdiTable.CommandList.pfnCreateImmediate,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.paltdesc,
-                                                  *tracerParams.pphCommandList);
+                                                  *tracerParams.pphCommandList));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -1300,7 +1432,13 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnDestroy, hCommandList);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(CommandList, pfnDestroyCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hCommandList);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.CommandList.pfnDestroy, hCommandList);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.CommandList.pfnDestroy, hCommandList);
 
         // capture parameters
         ze_command_list_destroy_params_t tracerParams = {
@@ -1309,15 +1447,13 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnCommandListDestroyCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListDestroyCb_t, CommandList, pfnDestroyCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListDestroyCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnDestroy,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.CommandList.pfnDestroy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
-                                                  *tracerParams.phCommandList);
+                                                  apiCallbackData,
+                                                  *tracerParams.phCommandList));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -1332,7 +1468,13 @@ namespace tracing_layer
         if( nullptr == pfnClose)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnClose, hCommandList);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(CommandList, pfnCloseCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hCommandList);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.CommandList.pfnClose, hCommandList);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.CommandList.pfnClose, hCommandList);
 
         // capture parameters
         ze_command_list_close_params_t tracerParams = {
@@ -1341,15 +1483,13 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnCommandListCloseCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListCloseCb_t, CommandList, pfnCloseCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListCloseCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnClose,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.CommandList.pfnClose,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
-                                                  *tracerParams.phCommandList);
+                                                  apiCallbackData,
+                                                  *tracerParams.phCommandList));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -1364,7 +1504,13 @@ namespace tracing_layer
         if( nullptr == pfnReset)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnReset, hCommandList);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(CommandList, pfnResetCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hCommandList);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.CommandList.pfnReset, hCommandList);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.CommandList.pfnReset, hCommandList);
 
         // capture parameters
         ze_command_list_reset_params_t tracerParams = {
@@ -1373,15 +1519,13 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnCommandListResetCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListResetCb_t, CommandList, pfnResetCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListResetCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnReset,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.CommandList.pfnReset,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
-                                                  *tracerParams.phCommandList);
+                                                  apiCallbackData,
+                                                  *tracerParams.phCommandList));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -1403,7 +1547,13 @@ namespace tracing_layer
         if( nullptr == pfnAppendWriteGlobalTimestamp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendWriteGlobalTimestamp, hCommandList, dstptr, hSignalEvent, numWaitEvents, phWaitEvents);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(CommandList, pfnAppendWriteGlobalTimestampCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hCommandList, hSignalEvent);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.CommandList.pfnAppendWriteGlobalTimestamp, hCommandList, dstptr, hSignalEvent, numWaitEvents, phWaitEvents);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.CommandList.pfnAppendWriteGlobalTimestamp, hCommandList, dstptr, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
         ze_command_list_append_write_global_timestamp_params_t tracerParams = {
@@ -1416,19 +1566,17 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnCommandListAppendWriteGlobalTimestampCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendWriteGlobalTimestampCb_t, CommandList, pfnAppendWriteGlobalTimestampCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendWriteGlobalTimestampCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendWriteGlobalTimestamp,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.CommandList.pfnAppendWriteGlobalTimestamp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pdstptr,
                                                   *tracerParams.phSignalEvent,
                                                   *tracerParams.pnumWaitEvents,
-                                                  *tracerParams.pphWaitEvents);
+                                                  *tracerParams.pphWaitEvents));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -1450,7 +1598,13 @@ namespace tracing_layer
         if( nullptr == pfnHostSynchronize)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnHostSynchronize, hCommandList, timeout);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(CommandList, pfnHostSynchronizeCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hCommandList);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.CommandList.pfnHostSynchronize, hCommandList, timeout);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.CommandList.pfnHostSynchronize, hCommandList, timeout);
 
         // capture parameters
         ze_command_list_host_synchronize_params_t tracerParams = {
@@ -1460,16 +1614,14 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnCommandListHostSynchronizeCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListHostSynchronizeCb_t, CommandList, pfnHostSynchronizeCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListHostSynchronizeCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnHostSynchronize,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.CommandList.pfnHostSynchronize,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
-                                                  *tracerParams.ptimeout);
+                                                  *tracerParams.ptimeout));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -1489,7 +1641,13 @@ namespace tracing_layer
         if( nullptr == pfnAppendBarrier)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendBarrier, hCommandList, hSignalEvent, numWaitEvents, phWaitEvents);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(CommandList, pfnAppendBarrierCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hCommandList, hSignalEvent);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.CommandList.pfnAppendBarrier, hCommandList, hSignalEvent, numWaitEvents, phWaitEvents);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.CommandList.pfnAppendBarrier, hCommandList, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
         ze_command_list_append_barrier_params_t tracerParams = {
@@ -1501,18 +1659,16 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnCommandListAppendBarrierCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendBarrierCb_t, CommandList, pfnAppendBarrierCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendBarrierCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendBarrier,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<3>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.CommandList.pfnAppendBarrier,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.phSignalEvent,
                                                   *tracerParams.pnumWaitEvents,
-                                                  *tracerParams.pphWaitEvents);
+                                                  *tracerParams.pphWaitEvents));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -1535,7 +1691,13 @@ namespace tracing_layer
         if( nullptr == pfnAppendMemoryRangesBarrier)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendMemoryRangesBarrier, hCommandList, numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEvents);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(CommandList, pfnAppendMemoryRangesBarrierCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hCommandList, hSignalEvent);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.CommandList.pfnAppendMemoryRangesBarrier, hCommandList, numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEvents);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.CommandList.pfnAppendMemoryRangesBarrier, hCommandList, numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
         ze_command_list_append_memory_ranges_barrier_params_t tracerParams = {
@@ -1550,21 +1712,19 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnCommandListAppendMemoryRangesBarrierCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendMemoryRangesBarrierCb_t, CommandList, pfnAppendMemoryRangesBarrierCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendMemoryRangesBarrierCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendMemoryRangesBarrier,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<2, 3, 6>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.CommandList.pfnAppendMemoryRangesBarrier,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pnumRanges,
                                                   *tracerParams.ppRangeSizes,
                                                   *tracerParams.ppRanges,
                                                   *tracerParams.phSignalEvent,
                                                   *tracerParams.pnumWaitEvents,
-                                                  *tracerParams.pphWaitEvents);
+                                                  *tracerParams.pphWaitEvents));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -1580,7 +1740,13 @@ namespace tracing_layer
         if( nullptr == pfnSystemBarrier)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Context.pfnSystemBarrier, hContext, hDevice);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Context, pfnSystemBarrierCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hContext, hDevice);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Context.pfnSystemBarrier, hContext, hDevice);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Context.pfnSystemBarrier, hContext, hDevice);
 
         // capture parameters
         ze_context_system_barrier_params_t tracerParams = {
@@ -1590,16 +1756,14 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnContextSystemBarrierCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnContextSystemBarrierCb_t, Context, pfnSystemBarrierCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnContextSystemBarrierCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Context.pfnSystemBarrier,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.Context.pfnSystemBarrier,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
-                                                  *tracerParams.phDevice);
+                                                  *tracerParams.phDevice));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -1622,7 +1786,13 @@ namespace tracing_layer
         if( nullptr == pfnAppendMemoryCopy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendMemoryCopy, hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(CommandList, pfnAppendMemoryCopyCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hCommandList, hSignalEvent);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.CommandList.pfnAppendMemoryCopy, hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.CommandList.pfnAppendMemoryCopy, hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
         ze_command_list_append_memory_copy_params_t tracerParams = {
@@ -1637,21 +1807,19 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnCommandListAppendMemoryCopyCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendMemoryCopyCb_t, CommandList, pfnAppendMemoryCopyCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendMemoryCopyCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendMemoryCopy,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<6>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.CommandList.pfnAppendMemoryCopy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pdstptr,
                                                   *tracerParams.psrcptr,
                                                   *tracerParams.psize,
                                                   *tracerParams.phSignalEvent,
                                                   *tracerParams.pnumWaitEvents,
-                                                  *tracerParams.pphWaitEvents);
+                                                  *tracerParams.pphWaitEvents));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -1675,7 +1843,13 @@ namespace tracing_layer
         if( nullptr == pfnAppendMemoryFill)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendMemoryFill, hCommandList, ptr, pattern, pattern_size, size, hSignalEvent, numWaitEvents, phWaitEvents);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(CommandList, pfnAppendMemoryFillCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hCommandList, hSignalEvent);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.CommandList.pfnAppendMemoryFill, hCommandList, ptr, pattern, pattern_size, size, hSignalEvent, numWaitEvents, phWaitEvents);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.CommandList.pfnAppendMemoryFill, hCommandList, ptr, pattern, pattern_size, size, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
         ze_command_list_append_memory_fill_params_t tracerParams = {
@@ -1691,14 +1865,12 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnCommandListAppendMemoryFillCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendMemoryFillCb_t, CommandList, pfnAppendMemoryFillCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendMemoryFillCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendMemoryFill,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<7>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.CommandList.pfnAppendMemoryFill,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pptr,
                                                   *tracerParams.ppattern,
@@ -1706,7 +1878,7 @@ namespace tracing_layer
                                                   *tracerParams.psize,
                                                   *tracerParams.phSignalEvent,
                                                   *tracerParams.pnumWaitEvents,
-                                                  *tracerParams.pphWaitEvents);
+                                                  *tracerParams.pphWaitEvents));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -1738,7 +1910,13 @@ namespace tracing_layer
         if( nullptr == pfnAppendMemoryCopyRegion)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendMemoryCopyRegion, hCommandList, dstptr, dstRegion, dstPitch, dstSlicePitch, srcptr, srcRegion, srcPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(CommandList, pfnAppendMemoryCopyRegionCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hCommandList, hSignalEvent);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.CommandList.pfnAppendMemoryCopyRegion, hCommandList, dstptr, dstRegion, dstPitch, dstSlicePitch, srcptr, srcRegion, srcPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.CommandList.pfnAppendMemoryCopyRegion, hCommandList, dstptr, dstRegion, dstPitch, dstSlicePitch, srcptr, srcRegion, srcPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
         ze_command_list_append_memory_copy_region_params_t tracerParams = {
@@ -1758,14 +1936,12 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnCommandListAppendMemoryCopyRegionCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendMemoryCopyRegionCb_t, CommandList, pfnAppendMemoryCopyRegionCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendMemoryCopyRegionCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendMemoryCopyRegion,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<2, 6, 11>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.CommandList.pfnAppendMemoryCopyRegion,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pdstptr,
                                                   *tracerParams.pdstRegion,
@@ -1777,7 +1953,7 @@ namespace tracing_layer
                                                   *tracerParams.psrcSlicePitch,
                                                   *tracerParams.phSignalEvent,
                                                   *tracerParams.pnumWaitEvents,
-                                                  *tracerParams.pphWaitEvents);
+                                                  *tracerParams.pphWaitEvents));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -1801,7 +1977,13 @@ namespace tracing_layer
         if( nullptr == pfnAppendMemoryCopyFromContext)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendMemoryCopyFromContext, hCommandList, dstptr, hContextSrc, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(CommandList, pfnAppendMemoryCopyFromContextCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hCommandList, hContextSrc, hSignalEvent);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.CommandList.pfnAppendMemoryCopyFromContext, hCommandList, dstptr, hContextSrc, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.CommandList.pfnAppendMemoryCopyFromContext, hCommandList, dstptr, hContextSrc, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
         ze_command_list_append_memory_copy_from_context_params_t tracerParams = {
@@ -1817,14 +1999,12 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnCommandListAppendMemoryCopyFromContextCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendMemoryCopyFromContextCb_t, CommandList, pfnAppendMemoryCopyFromContextCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendMemoryCopyFromContextCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendMemoryCopyFromContext,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<7>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.CommandList.pfnAppendMemoryCopyFromContext,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pdstptr,
                                                   *tracerParams.phContextSrc,
@@ -1832,7 +2012,7 @@ namespace tracing_layer
                                                   *tracerParams.psize,
                                                   *tracerParams.phSignalEvent,
                                                   *tracerParams.pnumWaitEvents,
-                                                  *tracerParams.pphWaitEvents);
+                                                  *tracerParams.pphWaitEvents));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -1854,7 +2034,13 @@ namespace tracing_layer
         if( nullptr == pfnAppendImageCopy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendImageCopy, hCommandList, hDstImage, hSrcImage, hSignalEvent, numWaitEvents, phWaitEvents);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(CommandList, pfnAppendImageCopyCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hCommandList, hDstImage, hSrcImage, hSignalEvent);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.CommandList.pfnAppendImageCopy, hCommandList, hDstImage, hSrcImage, hSignalEvent, numWaitEvents, phWaitEvents);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.CommandList.pfnAppendImageCopy, hCommandList, hDstImage, hSrcImage, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
         ze_command_list_append_image_copy_params_t tracerParams = {
@@ -1868,20 +2054,18 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnCommandListAppendImageCopyCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendImageCopyCb_t, CommandList, pfnAppendImageCopyCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendImageCopyCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendImageCopy,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<5>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.CommandList.pfnAppendImageCopy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.phDstImage,
                                                   *tracerParams.phSrcImage,
                                                   *tracerParams.phSignalEvent,
                                                   *tracerParams.pnumWaitEvents,
-                                                  *tracerParams.pphWaitEvents);
+                                                  *tracerParams.pphWaitEvents));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -1905,7 +2089,13 @@ namespace tracing_layer
         if( nullptr == pfnAppendImageCopyRegion)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendImageCopyRegion, hCommandList, hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(CommandList, pfnAppendImageCopyRegionCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hCommandList, hDstImage, hSrcImage, hSignalEvent);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.CommandList.pfnAppendImageCopyRegion, hCommandList, hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.CommandList.pfnAppendImageCopyRegion, hCommandList, hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
         ze_command_list_append_image_copy_region_params_t tracerParams = {
@@ -1921,14 +2111,12 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnCommandListAppendImageCopyRegionCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendImageCopyRegionCb_t, CommandList, pfnAppendImageCopyRegionCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendImageCopyRegionCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendImageCopyRegion,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<3, 4, 7>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.CommandList.pfnAppendImageCopyRegion,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.phDstImage,
                                                   *tracerParams.phSrcImage,
@@ -1936,7 +2124,7 @@ namespace tracing_layer
                                                   *tracerParams.ppSrcRegion,
                                                   *tracerParams.phSignalEvent,
                                                   *tracerParams.pnumWaitEvents,
-                                                  *tracerParams.pphWaitEvents);
+                                                  *tracerParams.pphWaitEvents));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -1959,7 +2147,13 @@ namespace tracing_layer
         if( nullptr == pfnAppendImageCopyToMemory)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendImageCopyToMemory, hCommandList, dstptr, hSrcImage, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(CommandList, pfnAppendImageCopyToMemoryCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hCommandList, hSrcImage, hSignalEvent);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.CommandList.pfnAppendImageCopyToMemory, hCommandList, dstptr, hSrcImage, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.CommandList.pfnAppendImageCopyToMemory, hCommandList, dstptr, hSrcImage, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
         ze_command_list_append_image_copy_to_memory_params_t tracerParams = {
@@ -1974,21 +2168,19 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnCommandListAppendImageCopyToMemoryCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendImageCopyToMemoryCb_t, CommandList, pfnAppendImageCopyToMemoryCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendImageCopyToMemoryCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendImageCopyToMemory,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<3, 6>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.CommandList.pfnAppendImageCopyToMemory,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pdstptr,
                                                   *tracerParams.phSrcImage,
                                                   *tracerParams.ppSrcRegion,
                                                   *tracerParams.phSignalEvent,
                                                   *tracerParams.pnumWaitEvents,
-                                                  *tracerParams.pphWaitEvents);
+                                                  *tracerParams.pphWaitEvents));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -2011,7 +2203,13 @@ namespace tracing_layer
         if( nullptr == pfnAppendImageCopyFromMemory)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendImageCopyFromMemory, hCommandList, hDstImage, srcptr, pDstRegion, hSignalEvent, numWaitEvents, phWaitEvents);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(CommandList, pfnAppendImageCopyFromMemoryCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hCommandList, hDstImage, hSignalEvent);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.CommandList.pfnAppendImageCopyFromMemory, hCommandList, hDstImage, srcptr, pDstRegion, hSignalEvent, numWaitEvents, phWaitEvents);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.CommandList.pfnAppendImageCopyFromMemory, hCommandList, hDstImage, srcptr, pDstRegion, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
         ze_command_list_append_image_copy_from_memory_params_t tracerParams = {
@@ -2026,21 +2224,19 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnCommandListAppendImageCopyFromMemoryCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendImageCopyFromMemoryCb_t, CommandList, pfnAppendImageCopyFromMemoryCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendImageCopyFromMemoryCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendImageCopyFromMemory,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<3, 6>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.CommandList.pfnAppendImageCopyFromMemory,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.phDstImage,
                                                   *tracerParams.psrcptr,
                                                   *tracerParams.ppDstRegion,
                                                   *tracerParams.phSignalEvent,
                                                   *tracerParams.pnumWaitEvents,
-                                                  *tracerParams.pphWaitEvents);
+                                                  *tracerParams.pphWaitEvents));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -2057,7 +2253,13 @@ namespace tracing_layer
         if( nullptr == pfnAppendMemoryPrefetch)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendMemoryPrefetch, hCommandList, ptr, size);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(CommandList, pfnAppendMemoryPrefetchCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hCommandList);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.CommandList.pfnAppendMemoryPrefetch, hCommandList, ptr, size);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.CommandList.pfnAppendMemoryPrefetch, hCommandList, ptr, size);
 
         // capture parameters
         ze_command_list_append_memory_prefetch_params_t tracerParams = {
@@ -2068,17 +2270,15 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnCommandListAppendMemoryPrefetchCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendMemoryPrefetchCb_t, CommandList, pfnAppendMemoryPrefetchCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendMemoryPrefetchCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendMemoryPrefetch,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.CommandList.pfnAppendMemoryPrefetch,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pptr,
-                                                  *tracerParams.psize);
+                                                  *tracerParams.psize));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -2097,7 +2297,13 @@ namespace tracing_layer
         if( nullptr == pfnAppendMemAdvise)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendMemAdvise, hCommandList, hDevice, ptr, size, advice);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(CommandList, pfnAppendMemAdviseCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hCommandList, hDevice);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.CommandList.pfnAppendMemAdvise, hCommandList, hDevice, ptr, size, advice);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.CommandList.pfnAppendMemAdvise, hCommandList, hDevice, ptr, size, advice);
 
         // capture parameters
         ze_command_list_append_mem_advise_params_t tracerParams = {
@@ -2110,19 +2316,17 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnCommandListAppendMemAdviseCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendMemAdviseCb_t, CommandList, pfnAppendMemAdviseCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendMemAdviseCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendMemAdvise,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.CommandList.pfnAppendMemAdvise,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pptr,
                                                   *tracerParams.psize,
-                                                  *tracerParams.padvice);
+                                                  *tracerParams.padvice));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -2145,7 +2349,13 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.EventPool.pfnCreate, hContext, desc, numDevices, phDevices, phEventPool);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(EventPool, pfnCreateCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hContext);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.EventPool.pfnCreate, hContext, desc, numDevices, phDevices, phEventPool);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.EventPool.pfnCreate, hContext, desc, numDevices, phDevices, phEventPool);
 
         // capture parameters
         ze_event_pool_create_params_t tracerParams = {
@@ -2158,19 +2368,17 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnEventPoolCreateCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnEventPoolCreateCb_t, EventPool, pfnCreateCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnEventPoolCreateCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.EventPool.pfnCreate,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<1, 3>, tracing_layer::epilogue_arg_indices<4>>>(context.zeDdiTable.EventPool.pfnCreate,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.pdesc,
                                                   *tracerParams.pnumDevices,
                                                   *tracerParams.pphDevices,
-                                                  *tracerParams.pphEventPool);
+                                                  *tracerParams.pphEventPool));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -2185,7 +2393,13 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.EventPool.pfnDestroy, hEventPool);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(EventPool, pfnDestroyCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hEventPool);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.EventPool.pfnDestroy, hEventPool);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.EventPool.pfnDestroy, hEventPool);
 
         // capture parameters
         ze_event_pool_destroy_params_t tracerParams = {
@@ -2194,15 +2408,13 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnEventPoolDestroyCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnEventPoolDestroyCb_t, EventPool, pfnDestroyCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnEventPoolDestroyCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.EventPool.pfnDestroy,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.EventPool.pfnDestroy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
-                                                  *tracerParams.phEventPool);
+                                                  apiCallbackData,
+                                                  *tracerParams.phEventPool));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -2219,7 +2431,13 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnCreate, hEventPool, desc, phEvent);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Event, pfnCreateCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hEventPool);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Event.pfnCreate, hEventPool, desc, phEvent);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Event.pfnCreate, hEventPool, desc, phEvent);
 
         // capture parameters
         ze_event_create_params_t tracerParams = {
@@ -2230,17 +2448,15 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnEventCreateCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnEventCreateCb_t, Event, pfnCreateCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnEventCreateCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Event.pfnCreate,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<1>, tracing_layer::epilogue_arg_indices<2>>>(context.zeDdiTable.Event.pfnCreate,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEventPool,
                                                   *tracerParams.pdesc,
-                                                  *tracerParams.pphEvent);
+                                                  *tracerParams.pphEvent));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -2255,7 +2471,13 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnDestroy, hEvent);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Event, pfnDestroyCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hEvent);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Event.pfnDestroy, hEvent);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Event.pfnDestroy, hEvent);
 
         // capture parameters
         ze_event_destroy_params_t tracerParams = {
@@ -2264,15 +2486,13 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnEventDestroyCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnEventDestroyCb_t, Event, pfnDestroyCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnEventDestroyCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Event.pfnDestroy,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.Event.pfnDestroy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
-                                                  *tracerParams.phEvent);
+                                                  apiCallbackData,
+                                                  *tracerParams.phEvent));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -2288,7 +2508,13 @@ namespace tracing_layer
         if( nullptr == pfnGetIpcHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.EventPool.pfnGetIpcHandle, hEventPool, phIpc);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(EventPool, pfnGetIpcHandleCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hEventPool);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.EventPool.pfnGetIpcHandle, hEventPool, phIpc);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.EventPool.pfnGetIpcHandle, hEventPool, phIpc);
 
         // capture parameters
         ze_event_pool_get_ipc_handle_params_t tracerParams = {
@@ -2298,16 +2524,14 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnEventPoolGetIpcHandleCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnEventPoolGetIpcHandleCb_t, EventPool, pfnGetIpcHandleCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnEventPoolGetIpcHandleCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.EventPool.pfnGetIpcHandle,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.EventPool.pfnGetIpcHandle,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEventPool,
-                                                  *tracerParams.pphIpc);
+                                                  *tracerParams.pphIpc));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -2324,7 +2548,13 @@ namespace tracing_layer
         if( nullptr == pfnPutIpcHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.EventPool.pfnPutIpcHandle, hContext, hIpc);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(EventPool, pfnPutIpcHandleCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hContext);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.EventPool.pfnPutIpcHandle, hContext, hIpc);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.EventPool.pfnPutIpcHandle, hContext, hIpc);
 
         // capture parameters
         ze_event_pool_put_ipc_handle_params_t tracerParams = {
@@ -2334,16 +2564,14 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnEventPoolPutIpcHandleCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnEventPoolPutIpcHandleCb_t, EventPool, pfnPutIpcHandleCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnEventPoolPutIpcHandleCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.EventPool.pfnPutIpcHandle,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.EventPool.pfnPutIpcHandle,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
-                                                  *tracerParams.phIpc);
+                                                  *tracerParams.phIpc));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -2361,7 +2589,13 @@ namespace tracing_layer
         if( nullptr == pfnOpenIpcHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.EventPool.pfnOpenIpcHandle, hContext, hIpc, phEventPool);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(EventPool, pfnOpenIpcHandleCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hContext);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.EventPool.pfnOpenIpcHandle, hContext, hIpc, phEventPool);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.EventPool.pfnOpenIpcHandle, hContext, hIpc, phEventPool);
 
         // capture parameters
         ze_event_pool_open_ipc_handle_params_t tracerParams = {
@@ -2372,17 +2606,15 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnEventPoolOpenIpcHandleCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnEventPoolOpenIpcHandleCb_t, EventPool, pfnOpenIpcHandleCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnEventPoolOpenIpcHandleCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.EventPool.pfnOpenIpcHandle,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<2>>>(context.zeDdiTable.EventPool.pfnOpenIpcHandle,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phIpc,
-                                                  *tracerParams.pphEventPool);
+                                                  *tracerParams.pphEventPool));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -2397,7 +2629,13 @@ namespace tracing_layer
         if( nullptr == pfnCloseIpcHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.EventPool.pfnCloseIpcHandle, hEventPool);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(EventPool, pfnCloseIpcHandleCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hEventPool);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.EventPool.pfnCloseIpcHandle, hEventPool);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.EventPool.pfnCloseIpcHandle, hEventPool);
 
         // capture parameters
         ze_event_pool_close_ipc_handle_params_t tracerParams = {
@@ -2406,15 +2644,13 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnEventPoolCloseIpcHandleCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnEventPoolCloseIpcHandleCb_t, EventPool, pfnCloseIpcHandleCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnEventPoolCloseIpcHandleCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.EventPool.pfnCloseIpcHandle,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.EventPool.pfnCloseIpcHandle,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
-                                                  *tracerParams.phEventPool);
+                                                  apiCallbackData,
+                                                  *tracerParams.phEventPool));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -2430,7 +2666,13 @@ namespace tracing_layer
         if( nullptr == pfnAppendSignalEvent)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendSignalEvent, hCommandList, hEvent);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(CommandList, pfnAppendSignalEventCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hCommandList, hEvent);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.CommandList.pfnAppendSignalEvent, hCommandList, hEvent);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.CommandList.pfnAppendSignalEvent, hCommandList, hEvent);
 
         // capture parameters
         ze_command_list_append_signal_event_params_t tracerParams = {
@@ -2440,16 +2682,14 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnCommandListAppendSignalEventCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendSignalEventCb_t, CommandList, pfnAppendSignalEventCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendSignalEventCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendSignalEvent,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.CommandList.pfnAppendSignalEvent,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
-                                                  *tracerParams.phEvent);
+                                                  *tracerParams.phEvent));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -2467,7 +2707,13 @@ namespace tracing_layer
         if( nullptr == pfnAppendWaitOnEvents)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendWaitOnEvents, hCommandList, numEvents, phEvents);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(CommandList, pfnAppendWaitOnEventsCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hCommandList);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.CommandList.pfnAppendWaitOnEvents, hCommandList, numEvents, phEvents);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.CommandList.pfnAppendWaitOnEvents, hCommandList, numEvents, phEvents);
 
         // capture parameters
         ze_command_list_append_wait_on_events_params_t tracerParams = {
@@ -2478,17 +2724,15 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnCommandListAppendWaitOnEventsCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendWaitOnEventsCb_t, CommandList, pfnAppendWaitOnEventsCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendWaitOnEventsCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendWaitOnEvents,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<2>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.CommandList.pfnAppendWaitOnEvents,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pnumEvents,
-                                                  *tracerParams.pphEvents);
+                                                  *tracerParams.pphEvents));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -2503,7 +2747,13 @@ namespace tracing_layer
         if( nullptr == pfnHostSignal)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnHostSignal, hEvent);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Event, pfnHostSignalCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hEvent);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Event.pfnHostSignal, hEvent);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Event.pfnHostSignal, hEvent);
 
         // capture parameters
         ze_event_host_signal_params_t tracerParams = {
@@ -2512,15 +2762,13 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnEventHostSignalCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnEventHostSignalCb_t, Event, pfnHostSignalCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnEventHostSignalCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Event.pfnHostSignal,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.Event.pfnHostSignal,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
-                                                  *tracerParams.phEvent);
+                                                  apiCallbackData,
+                                                  *tracerParams.phEvent));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -2542,7 +2790,13 @@ namespace tracing_layer
         if( nullptr == pfnHostSynchronize)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnHostSynchronize, hEvent, timeout);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Event, pfnHostSynchronizeCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hEvent);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Event.pfnHostSynchronize, hEvent, timeout);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Event.pfnHostSynchronize, hEvent, timeout);
 
         // capture parameters
         ze_event_host_synchronize_params_t tracerParams = {
@@ -2552,16 +2806,14 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnEventHostSynchronizeCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnEventHostSynchronizeCb_t, Event, pfnHostSynchronizeCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnEventHostSynchronizeCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Event.pfnHostSynchronize,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.Event.pfnHostSynchronize,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEvent,
-                                                  *tracerParams.ptimeout);
+                                                  *tracerParams.ptimeout));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -2576,7 +2828,13 @@ namespace tracing_layer
         if( nullptr == pfnQueryStatus)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnQueryStatus, hEvent);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Event, pfnQueryStatusCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hEvent);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Event.pfnQueryStatus, hEvent);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Event.pfnQueryStatus, hEvent);
 
         // capture parameters
         ze_event_query_status_params_t tracerParams = {
@@ -2585,15 +2843,13 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnEventQueryStatusCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnEventQueryStatusCb_t, Event, pfnQueryStatusCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnEventQueryStatusCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Event.pfnQueryStatus,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.Event.pfnQueryStatus,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
-                                                  *tracerParams.phEvent);
+                                                  apiCallbackData,
+                                                  *tracerParams.phEvent));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -2609,7 +2865,13 @@ namespace tracing_layer
         if( nullptr == pfnAppendEventReset)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendEventReset, hCommandList, hEvent);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(CommandList, pfnAppendEventResetCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hCommandList, hEvent);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.CommandList.pfnAppendEventReset, hCommandList, hEvent);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.CommandList.pfnAppendEventReset, hCommandList, hEvent);
 
         // capture parameters
         ze_command_list_append_event_reset_params_t tracerParams = {
@@ -2619,16 +2881,14 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnCommandListAppendEventResetCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendEventResetCb_t, CommandList, pfnAppendEventResetCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendEventResetCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendEventReset,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.CommandList.pfnAppendEventReset,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
-                                                  *tracerParams.phEvent);
+                                                  *tracerParams.phEvent));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -2643,7 +2903,13 @@ namespace tracing_layer
         if( nullptr == pfnHostReset)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnHostReset, hEvent);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Event, pfnHostResetCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hEvent);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Event.pfnHostReset, hEvent);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Event.pfnHostReset, hEvent);
 
         // capture parameters
         ze_event_host_reset_params_t tracerParams = {
@@ -2652,15 +2918,13 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnEventHostResetCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnEventHostResetCb_t, Event, pfnHostResetCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnEventHostResetCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Event.pfnHostReset,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.Event.pfnHostReset,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
-                                                  *tracerParams.phEvent);
+                                                  apiCallbackData,
+                                                  *tracerParams.phEvent));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -2676,7 +2940,13 @@ namespace tracing_layer
         if( nullptr == pfnQueryKernelTimestamp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnQueryKernelTimestamp, hEvent, dstptr);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Event, pfnQueryKernelTimestampCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hEvent);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Event.pfnQueryKernelTimestamp, hEvent, dstptr);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Event.pfnQueryKernelTimestamp, hEvent, dstptr);
 
         // capture parameters
         ze_event_query_kernel_timestamp_params_t tracerParams = {
@@ -2686,16 +2956,14 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnEventQueryKernelTimestampCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnEventQueryKernelTimestampCb_t, Event, pfnQueryKernelTimestampCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnEventQueryKernelTimestampCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Event.pfnQueryKernelTimestamp,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Event.pfnQueryKernelTimestamp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEvent,
-                                                  *tracerParams.pdstptr);
+                                                  *tracerParams.pdstptr));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -2722,7 +2990,13 @@ namespace tracing_layer
         if( nullptr == pfnAppendQueryKernelTimestamps)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendQueryKernelTimestamps, hCommandList, numEvents, phEvents, dstptr, pOffsets, hSignalEvent, numWaitEvents, phWaitEvents);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(CommandList, pfnAppendQueryKernelTimestampsCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hCommandList, hSignalEvent);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.CommandList.pfnAppendQueryKernelTimestamps, hCommandList, numEvents, phEvents, dstptr, pOffsets, hSignalEvent, numWaitEvents, phWaitEvents);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.CommandList.pfnAppendQueryKernelTimestamps, hCommandList, numEvents, phEvents, dstptr, pOffsets, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
         ze_command_list_append_query_kernel_timestamps_params_t tracerParams = {
@@ -2738,14 +3012,12 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnCommandListAppendQueryKernelTimestampsCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendQueryKernelTimestampsCb_t, CommandList, pfnAppendQueryKernelTimestampsCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendQueryKernelTimestampsCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendQueryKernelTimestamps,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.CommandList.pfnAppendQueryKernelTimestamps,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pnumEvents,
                                                   *tracerParams.pphEvents,
@@ -2753,7 +3025,7 @@ namespace tracing_layer
                                                   *tracerParams.ppOffsets,
                                                   *tracerParams.phSignalEvent,
                                                   *tracerParams.pnumWaitEvents,
-                                                  *tracerParams.pphWaitEvents);
+                                                  *tracerParams.pphWaitEvents));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -2770,7 +3042,13 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Fence.pfnCreate, hCommandQueue, desc, phFence);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Fence, pfnCreateCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hCommandQueue);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Fence.pfnCreate, hCommandQueue, desc, phFence);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Fence.pfnCreate, hCommandQueue, desc, phFence);
 
         // capture parameters
         ze_fence_create_params_t tracerParams = {
@@ -2781,17 +3059,15 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnFenceCreateCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnFenceCreateCb_t, Fence, pfnCreateCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnFenceCreateCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Fence.pfnCreate,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<1>, tracing_layer::epilogue_arg_indices<2>>>(context.zeDdiTable.Fence.pfnCreate,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandQueue,
                                                   *tracerParams.pdesc,
-                                                  *tracerParams.pphFence);
+                                                  *tracerParams.pphFence));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -2806,7 +3082,13 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Fence.pfnDestroy, hFence);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Fence, pfnDestroyCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hFence);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Fence.pfnDestroy, hFence);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Fence.pfnDestroy, hFence);
 
         // capture parameters
         ze_fence_destroy_params_t tracerParams = {
@@ -2815,15 +3097,13 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnFenceDestroyCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnFenceDestroyCb_t, Fence, pfnDestroyCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnFenceDestroyCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Fence.pfnDestroy,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.Fence.pfnDestroy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
-                                                  *tracerParams.phFence);
+                                                  apiCallbackData,
+                                                  *tracerParams.phFence));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -2845,7 +3125,13 @@ namespace tracing_layer
         if( nullptr == pfnHostSynchronize)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Fence.pfnHostSynchronize, hFence, timeout);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Fence, pfnHostSynchronizeCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hFence);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Fence.pfnHostSynchronize, hFence, timeout);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Fence.pfnHostSynchronize, hFence, timeout);
 
         // capture parameters
         ze_fence_host_synchronize_params_t tracerParams = {
@@ -2855,16 +3141,14 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnFenceHostSynchronizeCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnFenceHostSynchronizeCb_t, Fence, pfnHostSynchronizeCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnFenceHostSynchronizeCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Fence.pfnHostSynchronize,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.Fence.pfnHostSynchronize,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phFence,
-                                                  *tracerParams.ptimeout);
+                                                  *tracerParams.ptimeout));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -2879,7 +3163,13 @@ namespace tracing_layer
         if( nullptr == pfnQueryStatus)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Fence.pfnQueryStatus, hFence);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Fence, pfnQueryStatusCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hFence);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Fence.pfnQueryStatus, hFence);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Fence.pfnQueryStatus, hFence);
 
         // capture parameters
         ze_fence_query_status_params_t tracerParams = {
@@ -2888,15 +3178,13 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnFenceQueryStatusCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnFenceQueryStatusCb_t, Fence, pfnQueryStatusCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnFenceQueryStatusCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Fence.pfnQueryStatus,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.Fence.pfnQueryStatus,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
-                                                  *tracerParams.phFence);
+                                                  apiCallbackData,
+                                                  *tracerParams.phFence));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -2911,7 +3199,13 @@ namespace tracing_layer
         if( nullptr == pfnReset)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Fence.pfnReset, hFence);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Fence, pfnResetCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hFence);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Fence.pfnReset, hFence);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Fence.pfnReset, hFence);
 
         // capture parameters
         ze_fence_reset_params_t tracerParams = {
@@ -2920,15 +3214,13 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnFenceResetCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnFenceResetCb_t, Fence, pfnResetCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnFenceResetCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Fence.pfnReset,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.Fence.pfnReset,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
-                                                  *tracerParams.phFence);
+                                                  apiCallbackData,
+                                                  *tracerParams.phFence));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -2945,7 +3237,13 @@ namespace tracing_layer
         if( nullptr == pfnGetProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Image.pfnGetProperties, hDevice, desc, pImageProperties);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Image, pfnGetPropertiesCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hDevice);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Image.pfnGetProperties, hDevice, desc, pImageProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Image.pfnGetProperties, hDevice, desc, pImageProperties);
 
         // capture parameters
         ze_image_get_properties_params_t tracerParams = {
@@ -2956,17 +3254,15 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnImageGetPropertiesCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnImageGetPropertiesCb_t, Image, pfnGetPropertiesCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnImageGetPropertiesCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Image.pfnGetProperties,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Image.pfnGetProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pdesc,
-                                                  *tracerParams.ppImageProperties);
+                                                  *tracerParams.ppImageProperties));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -2984,7 +3280,13 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Image.pfnCreate, hContext, hDevice, desc, phImage);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Image, pfnCreateCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hContext, hDevice);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Image.pfnCreate, hContext, hDevice, desc, phImage);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Image.pfnCreate, hContext, hDevice, desc, phImage);
 
         // capture parameters
         ze_image_create_params_t tracerParams = {
@@ -2996,18 +3298,16 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnImageCreateCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnImageCreateCb_t, Image, pfnCreateCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnImageCreateCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Image.pfnCreate,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<2>, tracing_layer::epilogue_arg_indices<3>>>(context.zeDdiTable.Image.pfnCreate,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pdesc,
-                                                  *tracerParams.pphImage);
+                                                  *tracerParams.pphImage));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -3022,7 +3322,13 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Image.pfnDestroy, hImage);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Image, pfnDestroyCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hImage);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Image.pfnDestroy, hImage);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Image.pfnDestroy, hImage);
 
         // capture parameters
         ze_image_destroy_params_t tracerParams = {
@@ -3031,15 +3337,13 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnImageDestroyCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnImageDestroyCb_t, Image, pfnDestroyCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnImageDestroyCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Image.pfnDestroy,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.Image.pfnDestroy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
-                                                  *tracerParams.phImage);
+                                                  apiCallbackData,
+                                                  *tracerParams.phImage));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -3062,7 +3366,13 @@ namespace tracing_layer
         if( nullptr == pfnAllocShared)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnAllocShared, hContext, device_desc, host_desc, size, alignment, hDevice, pptr);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Mem, pfnAllocSharedCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hContext, hDevice);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Mem.pfnAllocShared, hContext, device_desc, host_desc, size, alignment, hDevice, pptr);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Mem.pfnAllocShared, hContext, device_desc, host_desc, size, alignment, hDevice, pptr);
 
         // capture parameters
         ze_mem_alloc_shared_params_t tracerParams = {
@@ -3077,21 +3387,19 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnMemAllocSharedCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnMemAllocSharedCb_t, Mem, pfnAllocSharedCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnMemAllocSharedCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Mem.pfnAllocShared,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Mem.pfnAllocShared,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.pdevice_desc,
                                                   *tracerParams.phost_desc,
                                                   *tracerParams.psize,
                                                   *tracerParams.palignment,
                                                   *tracerParams.phDevice,
-                                                  *tracerParams.ppptr);
+                                                  *tracerParams.ppptr));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -3113,7 +3421,13 @@ namespace tracing_layer
         if( nullptr == pfnAllocDevice)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnAllocDevice, hContext, device_desc, size, alignment, hDevice, pptr);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Mem, pfnAllocDeviceCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hContext, hDevice);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Mem.pfnAllocDevice, hContext, device_desc, size, alignment, hDevice, pptr);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Mem.pfnAllocDevice, hContext, device_desc, size, alignment, hDevice, pptr);
 
         // capture parameters
         ze_mem_alloc_device_params_t tracerParams = {
@@ -3127,20 +3441,18 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnMemAllocDeviceCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnMemAllocDeviceCb_t, Mem, pfnAllocDeviceCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnMemAllocDeviceCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Mem.pfnAllocDevice,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Mem.pfnAllocDevice,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.pdevice_desc,
                                                   *tracerParams.psize,
                                                   *tracerParams.palignment,
                                                   *tracerParams.phDevice,
-                                                  *tracerParams.ppptr);
+                                                  *tracerParams.ppptr));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -3161,7 +3473,13 @@ namespace tracing_layer
         if( nullptr == pfnAllocHost)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnAllocHost, hContext, host_desc, size, alignment, pptr);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Mem, pfnAllocHostCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hContext);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Mem.pfnAllocHost, hContext, host_desc, size, alignment, pptr);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Mem.pfnAllocHost, hContext, host_desc, size, alignment, pptr);
 
         // capture parameters
         ze_mem_alloc_host_params_t tracerParams = {
@@ -3174,19 +3492,17 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnMemAllocHostCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnMemAllocHostCb_t, Mem, pfnAllocHostCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnMemAllocHostCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Mem.pfnAllocHost,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Mem.pfnAllocHost,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phost_desc,
                                                   *tracerParams.psize,
                                                   *tracerParams.palignment,
-                                                  *tracerParams.ppptr);
+                                                  *tracerParams.ppptr));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -3202,7 +3518,13 @@ namespace tracing_layer
         if( nullptr == pfnFree)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnFree, hContext, ptr);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Mem, pfnFreeCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hContext);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Mem.pfnFree, hContext, ptr);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Mem.pfnFree, hContext, ptr);
 
         // capture parameters
         ze_mem_free_params_t tracerParams = {
@@ -3212,16 +3534,14 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnMemFreeCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnMemFreeCb_t, Mem, pfnFreeCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnMemFreeCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Mem.pfnFree,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.Mem.pfnFree,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
-                                                  *tracerParams.pptr);
+                                                  *tracerParams.pptr));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -3239,7 +3559,13 @@ namespace tracing_layer
         if( nullptr == pfnGetAllocProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnGetAllocProperties, hContext, ptr, pMemAllocProperties, phDevice);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Mem, pfnGetAllocPropertiesCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hContext);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Mem.pfnGetAllocProperties, hContext, ptr, pMemAllocProperties, phDevice);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Mem.pfnGetAllocProperties, hContext, ptr, pMemAllocProperties, phDevice);
 
         // capture parameters
         ze_mem_get_alloc_properties_params_t tracerParams = {
@@ -3251,18 +3577,16 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnMemGetAllocPropertiesCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnMemGetAllocPropertiesCb_t, Mem, pfnGetAllocPropertiesCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnMemGetAllocPropertiesCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Mem.pfnGetAllocProperties,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Mem.pfnGetAllocProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.pptr,
                                                   *tracerParams.ppMemAllocProperties,
-                                                  *tracerParams.pphDevice);
+                                                  *tracerParams.pphDevice));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -3280,7 +3604,13 @@ namespace tracing_layer
         if( nullptr == pfnGetAddressRange)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnGetAddressRange, hContext, ptr, pBase, pSize);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Mem, pfnGetAddressRangeCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hContext);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Mem.pfnGetAddressRange, hContext, ptr, pBase, pSize);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Mem.pfnGetAddressRange, hContext, ptr, pBase, pSize);
 
         // capture parameters
         ze_mem_get_address_range_params_t tracerParams = {
@@ -3292,18 +3622,16 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnMemGetAddressRangeCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnMemGetAddressRangeCb_t, Mem, pfnGetAddressRangeCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnMemGetAddressRangeCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Mem.pfnGetAddressRange,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Mem.pfnGetAddressRange,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.pptr,
                                                   *tracerParams.ppBase,
-                                                  *tracerParams.ppSize);
+                                                  *tracerParams.ppSize));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -3320,7 +3648,13 @@ namespace tracing_layer
         if( nullptr == pfnGetIpcHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnGetIpcHandle, hContext, ptr, pIpcHandle);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Mem, pfnGetIpcHandleCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hContext);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Mem.pfnGetIpcHandle, hContext, ptr, pIpcHandle);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Mem.pfnGetIpcHandle, hContext, ptr, pIpcHandle);
 
         // capture parameters
         ze_mem_get_ipc_handle_params_t tracerParams = {
@@ -3331,17 +3665,15 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnMemGetIpcHandleCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnMemGetIpcHandleCb_t, Mem, pfnGetIpcHandleCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnMemGetIpcHandleCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Mem.pfnGetIpcHandle,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Mem.pfnGetIpcHandle,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.pptr,
-                                                  *tracerParams.ppIpcHandle);
+                                                  *tracerParams.ppIpcHandle));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -3358,7 +3690,13 @@ namespace tracing_layer
         if( nullptr == pfnGetIpcHandleFromFileDescriptorExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.MemExp.pfnGetIpcHandleFromFileDescriptorExp, hContext, handle, pIpcHandle);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Mem, pfnGetIpcHandleFromFileDescriptorExpCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hContext);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.MemExp.pfnGetIpcHandleFromFileDescriptorExp, hContext, handle, pIpcHandle);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.MemExp.pfnGetIpcHandleFromFileDescriptorExp, hContext, handle, pIpcHandle);
 
         // capture parameters
         ze_mem_get_ipc_handle_from_file_descriptor_exp_params_t tracerParams = {
@@ -3369,17 +3707,15 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnMemGetIpcHandleFromFileDescriptorExpCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnMemGetIpcHandleFromFileDescriptorExpCb_t, Mem, pfnGetIpcHandleFromFileDescriptorExpCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnMemGetIpcHandleFromFileDescriptorExpCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.MemExp.pfnGetIpcHandleFromFileDescriptorExp,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.MemExp.pfnGetIpcHandleFromFileDescriptorExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phandle,
-                                                  *tracerParams.ppIpcHandle);
+                                                  *tracerParams.ppIpcHandle));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -3396,7 +3732,13 @@ namespace tracing_layer
         if( nullptr == pfnGetFileDescriptorFromIpcHandleExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.MemExp.pfnGetFileDescriptorFromIpcHandleExp, hContext, ipcHandle, pHandle);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Mem, pfnGetFileDescriptorFromIpcHandleExpCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hContext);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.MemExp.pfnGetFileDescriptorFromIpcHandleExp, hContext, ipcHandle, pHandle);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.MemExp.pfnGetFileDescriptorFromIpcHandleExp, hContext, ipcHandle, pHandle);
 
         // capture parameters
         ze_mem_get_file_descriptor_from_ipc_handle_exp_params_t tracerParams = {
@@ -3407,17 +3749,15 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnMemGetFileDescriptorFromIpcHandleExpCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnMemGetFileDescriptorFromIpcHandleExpCb_t, Mem, pfnGetFileDescriptorFromIpcHandleExpCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnMemGetFileDescriptorFromIpcHandleExpCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.MemExp.pfnGetFileDescriptorFromIpcHandleExp,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.MemExp.pfnGetFileDescriptorFromIpcHandleExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.pipcHandle,
-                                                  *tracerParams.ppHandle);
+                                                  *tracerParams.ppHandle));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -3433,7 +3773,13 @@ namespace tracing_layer
         if( nullptr == pfnPutIpcHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnPutIpcHandle, hContext, handle);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Mem, pfnPutIpcHandleCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hContext);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Mem.pfnPutIpcHandle, hContext, handle);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Mem.pfnPutIpcHandle, hContext, handle);
 
         // capture parameters
         ze_mem_put_ipc_handle_params_t tracerParams = {
@@ -3443,16 +3789,14 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnMemPutIpcHandleCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnMemPutIpcHandleCb_t, Mem, pfnPutIpcHandleCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnMemPutIpcHandleCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Mem.pfnPutIpcHandle,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.Mem.pfnPutIpcHandle,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
-                                                  *tracerParams.phandle);
+                                                  *tracerParams.phandle));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -3472,7 +3816,13 @@ namespace tracing_layer
         if( nullptr == pfnOpenIpcHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnOpenIpcHandle, hContext, hDevice, handle, flags, pptr);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Mem, pfnOpenIpcHandleCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hContext, hDevice);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Mem.pfnOpenIpcHandle, hContext, hDevice, handle, flags, pptr);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Mem.pfnOpenIpcHandle, hContext, hDevice, handle, flags, pptr);
 
         // capture parameters
         ze_mem_open_ipc_handle_params_t tracerParams = {
@@ -3485,19 +3835,17 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnMemOpenIpcHandleCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnMemOpenIpcHandleCb_t, Mem, pfnOpenIpcHandleCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnMemOpenIpcHandleCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Mem.pfnOpenIpcHandle,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Mem.pfnOpenIpcHandle,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.phandle,
                                                   *tracerParams.pflags,
-                                                  *tracerParams.ppptr);
+                                                  *tracerParams.ppptr));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -3513,7 +3861,13 @@ namespace tracing_layer
         if( nullptr == pfnCloseIpcHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnCloseIpcHandle, hContext, ptr);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Mem, pfnCloseIpcHandleCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hContext);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Mem.pfnCloseIpcHandle, hContext, ptr);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Mem.pfnCloseIpcHandle, hContext, ptr);
 
         // capture parameters
         ze_mem_close_ipc_handle_params_t tracerParams = {
@@ -3523,16 +3877,14 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnMemCloseIpcHandleCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnMemCloseIpcHandleCb_t, Mem, pfnCloseIpcHandleCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnMemCloseIpcHandleCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Mem.pfnCloseIpcHandle,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.Mem.pfnCloseIpcHandle,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
-                                                  *tracerParams.pptr);
+                                                  *tracerParams.pptr));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -3551,7 +3903,13 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Module.pfnCreate, hContext, hDevice, desc, phModule, phBuildLog);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Module, pfnCreateCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hContext, hDevice);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Module.pfnCreate, hContext, hDevice, desc, phModule, phBuildLog);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Module.pfnCreate, hContext, hDevice, desc, phModule, phBuildLog);
 
         // capture parameters
         ze_module_create_params_t tracerParams = {
@@ -3564,19 +3922,17 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnModuleCreateCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnModuleCreateCb_t, Module, pfnCreateCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnModuleCreateCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Module.pfnCreate,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<2>, tracing_layer::epilogue_arg_indices<3, 4>>>(context.zeDdiTable.Module.pfnCreate,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pdesc,
                                                   *tracerParams.pphModule,
-                                                  *tracerParams.pphBuildLog);
+                                                  *tracerParams.pphBuildLog));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -3591,7 +3947,13 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Module.pfnDestroy, hModule);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Module, pfnDestroyCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hModule);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Module.pfnDestroy, hModule);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Module.pfnDestroy, hModule);
 
         // capture parameters
         ze_module_destroy_params_t tracerParams = {
@@ -3600,15 +3962,13 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnModuleDestroyCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnModuleDestroyCb_t, Module, pfnDestroyCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnModuleDestroyCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Module.pfnDestroy,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.Module.pfnDestroy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
-                                                  *tracerParams.phModule);
+                                                  apiCallbackData,
+                                                  *tracerParams.phModule));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -3626,7 +3986,13 @@ namespace tracing_layer
         if( nullptr == pfnDynamicLink)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Module.pfnDynamicLink, numModules, phModules, phLinkLog);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Module, pfnDynamicLinkCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Module.pfnDynamicLink, numModules, phModules, phLinkLog);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Module.pfnDynamicLink, numModules, phModules, phLinkLog);
 
         // capture parameters
         ze_module_dynamic_link_params_t tracerParams = {
@@ -3637,17 +4003,15 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnModuleDynamicLinkCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnModuleDynamicLinkCb_t, Module, pfnDynamicLinkCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnModuleDynamicLinkCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Module.pfnDynamicLink,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<1>, tracing_layer::epilogue_arg_indices<2>>>(context.zeDdiTable.Module.pfnDynamicLink,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.pnumModules,
                                                   *tracerParams.pphModules,
-                                                  *tracerParams.pphLinkLog);
+                                                  *tracerParams.pphLinkLog));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -3662,7 +4026,13 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.ModuleBuildLog.pfnDestroy, hModuleBuildLog);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(ModuleBuildLog, pfnDestroyCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hModuleBuildLog);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.ModuleBuildLog.pfnDestroy, hModuleBuildLog);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.ModuleBuildLog.pfnDestroy, hModuleBuildLog);
 
         // capture parameters
         ze_module_build_log_destroy_params_t tracerParams = {
@@ -3671,15 +4041,13 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnModuleBuildLogDestroyCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnModuleBuildLogDestroyCb_t, ModuleBuildLog, pfnDestroyCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnModuleBuildLogDestroyCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.ModuleBuildLog.pfnDestroy,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.ModuleBuildLog.pfnDestroy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
-                                                  *tracerParams.phModuleBuildLog);
+                                                  apiCallbackData,
+                                                  *tracerParams.phModuleBuildLog));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -3696,7 +4064,13 @@ namespace tracing_layer
         if( nullptr == pfnGetString)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.ModuleBuildLog.pfnGetString, hModuleBuildLog, pSize, pBuildLog);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(ModuleBuildLog, pfnGetStringCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hModuleBuildLog);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.ModuleBuildLog.pfnGetString, hModuleBuildLog, pSize, pBuildLog);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.ModuleBuildLog.pfnGetString, hModuleBuildLog, pSize, pBuildLog);
 
         // capture parameters
         ze_module_build_log_get_string_params_t tracerParams = {
@@ -3707,17 +4081,15 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnModuleBuildLogGetStringCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnModuleBuildLogGetStringCb_t, ModuleBuildLog, pfnGetStringCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnModuleBuildLogGetStringCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.ModuleBuildLog.pfnGetString,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.ModuleBuildLog.pfnGetString,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phModuleBuildLog,
                                                   *tracerParams.ppSize,
-                                                  *tracerParams.ppBuildLog);
+                                                  *tracerParams.ppBuildLog));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -3734,7 +4106,13 @@ namespace tracing_layer
         if( nullptr == pfnGetNativeBinary)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Module.pfnGetNativeBinary, hModule, pSize, pModuleNativeBinary);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Module, pfnGetNativeBinaryCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hModule);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Module.pfnGetNativeBinary, hModule, pSize, pModuleNativeBinary);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Module.pfnGetNativeBinary, hModule, pSize, pModuleNativeBinary);
 
         // capture parameters
         ze_module_get_native_binary_params_t tracerParams = {
@@ -3745,17 +4123,15 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnModuleGetNativeBinaryCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnModuleGetNativeBinaryCb_t, Module, pfnGetNativeBinaryCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnModuleGetNativeBinaryCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Module.pfnGetNativeBinary,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Module.pfnGetNativeBinary,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phModule,
                                                   *tracerParams.ppSize,
-                                                  *tracerParams.ppModuleNativeBinary);
+                                                  *tracerParams.ppModuleNativeBinary));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -3773,7 +4149,13 @@ namespace tracing_layer
         if( nullptr == pfnGetGlobalPointer)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Module.pfnGetGlobalPointer, hModule, pGlobalName, pSize, pptr);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Module, pfnGetGlobalPointerCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hModule);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Module.pfnGetGlobalPointer, hModule, pGlobalName, pSize, pptr);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Module.pfnGetGlobalPointer, hModule, pGlobalName, pSize, pptr);
 
         // capture parameters
         ze_module_get_global_pointer_params_t tracerParams = {
@@ -3785,18 +4167,16 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnModuleGetGlobalPointerCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnModuleGetGlobalPointerCb_t, Module, pfnGetGlobalPointerCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnModuleGetGlobalPointerCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Module.pfnGetGlobalPointer,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Module.pfnGetGlobalPointer,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phModule,
                                                   *tracerParams.ppGlobalName,
                                                   *tracerParams.ppSize,
-                                                  *tracerParams.ppptr);
+                                                  *tracerParams.ppptr));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -3819,7 +4199,13 @@ namespace tracing_layer
         if( nullptr == pfnGetKernelNames)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Module.pfnGetKernelNames, hModule, pCount, pNames);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Module, pfnGetKernelNamesCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hModule);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Module.pfnGetKernelNames, hModule, pCount, pNames);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Module.pfnGetKernelNames, hModule, pCount, pNames);
 
         // capture parameters
         ze_module_get_kernel_names_params_t tracerParams = {
@@ -3830,17 +4216,15 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnModuleGetKernelNamesCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnModuleGetKernelNamesCb_t, Module, pfnGetKernelNamesCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnModuleGetKernelNamesCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Module.pfnGetKernelNames,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Module.pfnGetKernelNames,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phModule,
                                                   *tracerParams.ppCount,
-                                                  *tracerParams.ppNames);
+                                                  *tracerParams.ppNames));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -3856,7 +4240,13 @@ namespace tracing_layer
         if( nullptr == pfnGetProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Module.pfnGetProperties, hModule, pModuleProperties);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Module, pfnGetPropertiesCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hModule);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Module.pfnGetProperties, hModule, pModuleProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Module.pfnGetProperties, hModule, pModuleProperties);
 
         // capture parameters
         ze_module_get_properties_params_t tracerParams = {
@@ -3866,16 +4256,14 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnModuleGetPropertiesCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnModuleGetPropertiesCb_t, Module, pfnGetPropertiesCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnModuleGetPropertiesCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Module.pfnGetProperties,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Module.pfnGetProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phModule,
-                                                  *tracerParams.ppModuleProperties);
+                                                  *tracerParams.ppModuleProperties));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -3892,7 +4280,13 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnCreate, hModule, desc, phKernel);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Kernel, pfnCreateCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hModule);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Kernel.pfnCreate, hModule, desc, phKernel);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Kernel.pfnCreate, hModule, desc, phKernel);
 
         // capture parameters
         ze_kernel_create_params_t tracerParams = {
@@ -3903,17 +4297,15 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnKernelCreateCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnKernelCreateCb_t, Kernel, pfnCreateCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnKernelCreateCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Kernel.pfnCreate,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<1>, tracing_layer::epilogue_arg_indices<2>>>(context.zeDdiTable.Kernel.pfnCreate,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phModule,
                                                   *tracerParams.pdesc,
-                                                  *tracerParams.pphKernel);
+                                                  *tracerParams.pphKernel));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -3928,7 +4320,13 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnDestroy, hKernel);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Kernel, pfnDestroyCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hKernel);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Kernel.pfnDestroy, hKernel);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Kernel.pfnDestroy, hKernel);
 
         // capture parameters
         ze_kernel_destroy_params_t tracerParams = {
@@ -3937,15 +4335,13 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnKernelDestroyCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnKernelDestroyCb_t, Kernel, pfnDestroyCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnKernelDestroyCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Kernel.pfnDestroy,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.Kernel.pfnDestroy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
-                                                  *tracerParams.phKernel);
+                                                  apiCallbackData,
+                                                  *tracerParams.phKernel));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -3962,7 +4358,13 @@ namespace tracing_layer
         if( nullptr == pfnGetFunctionPointer)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Module.pfnGetFunctionPointer, hModule, pFunctionName, pfnFunction);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Module, pfnGetFunctionPointerCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hModule);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Module.pfnGetFunctionPointer, hModule, pFunctionName, pfnFunction);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Module.pfnGetFunctionPointer, hModule, pFunctionName, pfnFunction);
 
         // capture parameters
         ze_module_get_function_pointer_params_t tracerParams = {
@@ -3973,17 +4375,15 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnModuleGetFunctionPointerCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnModuleGetFunctionPointerCb_t, Module, pfnGetFunctionPointerCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnModuleGetFunctionPointerCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Module.pfnGetFunctionPointer,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Module.pfnGetFunctionPointer,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phModule,
                                                   *tracerParams.ppFunctionName,
-                                                  *tracerParams.ppfnFunction);
+                                                  *tracerParams.ppfnFunction));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -4001,7 +4401,13 @@ namespace tracing_layer
         if( nullptr == pfnSetGroupSize)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnSetGroupSize, hKernel, groupSizeX, groupSizeY, groupSizeZ);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Kernel, pfnSetGroupSizeCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hKernel);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Kernel.pfnSetGroupSize, hKernel, groupSizeX, groupSizeY, groupSizeZ);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Kernel.pfnSetGroupSize, hKernel, groupSizeX, groupSizeY, groupSizeZ);
 
         // capture parameters
         ze_kernel_set_group_size_params_t tracerParams = {
@@ -4013,18 +4419,16 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnKernelSetGroupSizeCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnKernelSetGroupSizeCb_t, Kernel, pfnSetGroupSizeCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnKernelSetGroupSizeCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Kernel.pfnSetGroupSize,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.Kernel.pfnSetGroupSize,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.pgroupSizeX,
                                                   *tracerParams.pgroupSizeY,
-                                                  *tracerParams.pgroupSizeZ);
+                                                  *tracerParams.pgroupSizeZ));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -4045,7 +4449,13 @@ namespace tracing_layer
         if( nullptr == pfnSuggestGroupSize)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnSuggestGroupSize, hKernel, globalSizeX, globalSizeY, globalSizeZ, groupSizeX, groupSizeY, groupSizeZ);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Kernel, pfnSuggestGroupSizeCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hKernel);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Kernel.pfnSuggestGroupSize, hKernel, globalSizeX, globalSizeY, globalSizeZ, groupSizeX, groupSizeY, groupSizeZ);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Kernel.pfnSuggestGroupSize, hKernel, globalSizeX, globalSizeY, globalSizeZ, groupSizeX, groupSizeY, groupSizeZ);
 
         // capture parameters
         ze_kernel_suggest_group_size_params_t tracerParams = {
@@ -4060,21 +4470,19 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnKernelSuggestGroupSizeCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnKernelSuggestGroupSizeCb_t, Kernel, pfnSuggestGroupSizeCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnKernelSuggestGroupSizeCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Kernel.pfnSuggestGroupSize,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Kernel.pfnSuggestGroupSize,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.pglobalSizeX,
                                                   *tracerParams.pglobalSizeY,
                                                   *tracerParams.pglobalSizeZ,
                                                   *tracerParams.pgroupSizeX,
                                                   *tracerParams.pgroupSizeY,
-                                                  *tracerParams.pgroupSizeZ);
+                                                  *tracerParams.pgroupSizeZ));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -4090,7 +4498,13 @@ namespace tracing_layer
         if( nullptr == pfnSuggestMaxCooperativeGroupCount)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnSuggestMaxCooperativeGroupCount, hKernel, totalGroupCount);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Kernel, pfnSuggestMaxCooperativeGroupCountCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hKernel);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Kernel.pfnSuggestMaxCooperativeGroupCount, hKernel, totalGroupCount);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Kernel.pfnSuggestMaxCooperativeGroupCount, hKernel, totalGroupCount);
 
         // capture parameters
         ze_kernel_suggest_max_cooperative_group_count_params_t tracerParams = {
@@ -4100,16 +4514,14 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnKernelSuggestMaxCooperativeGroupCountCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnKernelSuggestMaxCooperativeGroupCountCb_t, Kernel, pfnSuggestMaxCooperativeGroupCountCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnKernelSuggestMaxCooperativeGroupCountCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Kernel.pfnSuggestMaxCooperativeGroupCount,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Kernel.pfnSuggestMaxCooperativeGroupCount,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phKernel,
-                                                  *tracerParams.ptotalGroupCount);
+                                                  *tracerParams.ptotalGroupCount));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -4128,7 +4540,13 @@ namespace tracing_layer
         if( nullptr == pfnSetArgumentValue)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnSetArgumentValue, hKernel, argIndex, argSize, pArgValue);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Kernel, pfnSetArgumentValueCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hKernel);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Kernel.pfnSetArgumentValue, hKernel, argIndex, argSize, pArgValue);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Kernel.pfnSetArgumentValue, hKernel, argIndex, argSize, pArgValue);
 
         // capture parameters
         ze_kernel_set_argument_value_params_t tracerParams = {
@@ -4140,18 +4558,16 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnKernelSetArgumentValueCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnKernelSetArgumentValueCb_t, Kernel, pfnSetArgumentValueCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnKernelSetArgumentValueCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Kernel.pfnSetArgumentValue,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.Kernel.pfnSetArgumentValue,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.pargIndex,
                                                   *tracerParams.pargSize,
-                                                  *tracerParams.ppArgValue);
+                                                  *tracerParams.ppArgValue));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -4167,7 +4583,13 @@ namespace tracing_layer
         if( nullptr == pfnSetIndirectAccess)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnSetIndirectAccess, hKernel, flags);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Kernel, pfnSetIndirectAccessCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hKernel);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Kernel.pfnSetIndirectAccess, hKernel, flags);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Kernel.pfnSetIndirectAccess, hKernel, flags);
 
         // capture parameters
         ze_kernel_set_indirect_access_params_t tracerParams = {
@@ -4177,16 +4599,14 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnKernelSetIndirectAccessCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnKernelSetIndirectAccessCb_t, Kernel, pfnSetIndirectAccessCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnKernelSetIndirectAccessCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Kernel.pfnSetIndirectAccess,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.Kernel.pfnSetIndirectAccess,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phKernel,
-                                                  *tracerParams.pflags);
+                                                  *tracerParams.pflags));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -4202,7 +4622,13 @@ namespace tracing_layer
         if( nullptr == pfnGetIndirectAccess)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnGetIndirectAccess, hKernel, pFlags);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Kernel, pfnGetIndirectAccessCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hKernel);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Kernel.pfnGetIndirectAccess, hKernel, pFlags);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Kernel.pfnGetIndirectAccess, hKernel, pFlags);
 
         // capture parameters
         ze_kernel_get_indirect_access_params_t tracerParams = {
@@ -4212,16 +4638,14 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnKernelGetIndirectAccessCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnKernelGetIndirectAccessCb_t, Kernel, pfnGetIndirectAccessCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnKernelGetIndirectAccessCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Kernel.pfnGetIndirectAccess,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Kernel.pfnGetIndirectAccess,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phKernel,
-                                                  *tracerParams.ppFlags);
+                                                  *tracerParams.ppFlags));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -4245,7 +4669,13 @@ namespace tracing_layer
         if( nullptr == pfnGetSourceAttributes)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnGetSourceAttributes, hKernel, pSize, pString);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Kernel, pfnGetSourceAttributesCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hKernel);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Kernel.pfnGetSourceAttributes, hKernel, pSize, pString);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Kernel.pfnGetSourceAttributes, hKernel, pSize, pString);
 
         // capture parameters
         ze_kernel_get_source_attributes_params_t tracerParams = {
@@ -4256,17 +4686,15 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnKernelGetSourceAttributesCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnKernelGetSourceAttributesCb_t, Kernel, pfnGetSourceAttributesCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnKernelGetSourceAttributesCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Kernel.pfnGetSourceAttributes,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Kernel.pfnGetSourceAttributes,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.ppSize,
-                                                  *tracerParams.ppString);
+                                                  *tracerParams.ppString));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -4283,7 +4711,13 @@ namespace tracing_layer
         if( nullptr == pfnSetCacheConfig)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnSetCacheConfig, hKernel, flags);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Kernel, pfnSetCacheConfigCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hKernel);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Kernel.pfnSetCacheConfig, hKernel, flags);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Kernel.pfnSetCacheConfig, hKernel, flags);
 
         // capture parameters
         ze_kernel_set_cache_config_params_t tracerParams = {
@@ -4293,16 +4727,14 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnKernelSetCacheConfigCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnKernelSetCacheConfigCb_t, Kernel, pfnSetCacheConfigCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnKernelSetCacheConfigCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Kernel.pfnSetCacheConfig,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.Kernel.pfnSetCacheConfig,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phKernel,
-                                                  *tracerParams.pflags);
+                                                  *tracerParams.pflags));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -4318,7 +4750,13 @@ namespace tracing_layer
         if( nullptr == pfnGetProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnGetProperties, hKernel, pKernelProperties);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Kernel, pfnGetPropertiesCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hKernel);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Kernel.pfnGetProperties, hKernel, pKernelProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Kernel.pfnGetProperties, hKernel, pKernelProperties);
 
         // capture parameters
         ze_kernel_get_properties_params_t tracerParams = {
@@ -4328,16 +4766,14 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnKernelGetPropertiesCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnKernelGetPropertiesCb_t, Kernel, pfnGetPropertiesCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnKernelGetPropertiesCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Kernel.pfnGetProperties,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Kernel.pfnGetProperties,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phKernel,
-                                                  *tracerParams.ppKernelProperties);
+                                                  *tracerParams.ppKernelProperties));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -4355,7 +4791,13 @@ namespace tracing_layer
         if( nullptr == pfnGetName)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnGetName, hKernel, pSize, pName);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Kernel, pfnGetNameCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hKernel);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Kernel.pfnGetName, hKernel, pSize, pName);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Kernel.pfnGetName, hKernel, pSize, pName);
 
         // capture parameters
         ze_kernel_get_name_params_t tracerParams = {
@@ -4366,17 +4808,15 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnKernelGetNameCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnKernelGetNameCb_t, Kernel, pfnGetNameCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnKernelGetNameCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Kernel.pfnGetName,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Kernel.pfnGetName,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.ppSize,
-                                                  *tracerParams.ppName);
+                                                  *tracerParams.ppName));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -4398,7 +4838,13 @@ namespace tracing_layer
         if( nullptr == pfnAppendLaunchKernel)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendLaunchKernel, hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(CommandList, pfnAppendLaunchKernelCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hCommandList, hKernel, hSignalEvent);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.CommandList.pfnAppendLaunchKernel, hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.CommandList.pfnAppendLaunchKernel, hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
         ze_command_list_append_launch_kernel_params_t tracerParams = {
@@ -4412,20 +4858,18 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnCommandListAppendLaunchKernelCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendLaunchKernelCb_t, CommandList, pfnAppendLaunchKernelCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendLaunchKernelCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendLaunchKernel,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<2, 5>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.CommandList.pfnAppendLaunchKernel,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.ppLaunchFuncArgs,
                                                   *tracerParams.phSignalEvent,
                                                   *tracerParams.pnumWaitEvents,
-                                                  *tracerParams.pphWaitEvents);
+                                                  *tracerParams.pphWaitEvents));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -4447,7 +4891,13 @@ namespace tracing_layer
         if( nullptr == pfnAppendLaunchCooperativeKernel)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendLaunchCooperativeKernel, hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(CommandList, pfnAppendLaunchCooperativeKernelCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hCommandList, hKernel, hSignalEvent);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.CommandList.pfnAppendLaunchCooperativeKernel, hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.CommandList.pfnAppendLaunchCooperativeKernel, hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
         ze_command_list_append_launch_cooperative_kernel_params_t tracerParams = {
@@ -4461,20 +4911,18 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnCommandListAppendLaunchCooperativeKernelCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendLaunchCooperativeKernelCb_t, CommandList, pfnAppendLaunchCooperativeKernelCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendLaunchCooperativeKernelCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendLaunchCooperativeKernel,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<2, 5>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.CommandList.pfnAppendLaunchCooperativeKernel,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.ppLaunchFuncArgs,
                                                   *tracerParams.phSignalEvent,
                                                   *tracerParams.pnumWaitEvents,
-                                                  *tracerParams.pphWaitEvents);
+                                                  *tracerParams.pphWaitEvents));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -4497,7 +4945,13 @@ namespace tracing_layer
         if( nullptr == pfnAppendLaunchKernelIndirect)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendLaunchKernelIndirect, hCommandList, hKernel, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(CommandList, pfnAppendLaunchKernelIndirectCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hCommandList, hKernel, hSignalEvent);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.CommandList.pfnAppendLaunchKernelIndirect, hCommandList, hKernel, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.CommandList.pfnAppendLaunchKernelIndirect, hCommandList, hKernel, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
         ze_command_list_append_launch_kernel_indirect_params_t tracerParams = {
@@ -4511,20 +4965,18 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnCommandListAppendLaunchKernelIndirectCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendLaunchKernelIndirectCb_t, CommandList, pfnAppendLaunchKernelIndirectCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendLaunchKernelIndirectCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendLaunchKernelIndirect,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<2, 5>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.CommandList.pfnAppendLaunchKernelIndirect,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.ppLaunchArgumentsBuffer,
                                                   *tracerParams.phSignalEvent,
                                                   *tracerParams.pnumWaitEvents,
-                                                  *tracerParams.pphWaitEvents);
+                                                  *tracerParams.pphWaitEvents));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -4551,7 +5003,13 @@ namespace tracing_layer
         if( nullptr == pfnAppendLaunchMultipleKernelsIndirect)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendLaunchMultipleKernelsIndirect, hCommandList, numKernels, phKernels, pCountBuffer, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(CommandList, pfnAppendLaunchMultipleKernelsIndirectCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hCommandList, hSignalEvent);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.CommandList.pfnAppendLaunchMultipleKernelsIndirect, hCommandList, numKernels, phKernels, pCountBuffer, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.CommandList.pfnAppendLaunchMultipleKernelsIndirect, hCommandList, numKernels, phKernels, pCountBuffer, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
         ze_command_list_append_launch_multiple_kernels_indirect_params_t tracerParams = {
@@ -4567,14 +5025,12 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnCommandListAppendLaunchMultipleKernelsIndirectCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendLaunchMultipleKernelsIndirectCb_t, CommandList, pfnAppendLaunchMultipleKernelsIndirectCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendLaunchMultipleKernelsIndirectCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendLaunchMultipleKernelsIndirect,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<2, 3, 4, 7>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.CommandList.pfnAppendLaunchMultipleKernelsIndirect,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pnumKernels,
                                                   *tracerParams.pphKernels,
@@ -4582,7 +5038,7 @@ namespace tracing_layer
                                                   *tracerParams.ppLaunchArgumentsBuffer,
                                                   *tracerParams.phSignalEvent,
                                                   *tracerParams.pnumWaitEvents,
-                                                  *tracerParams.pphWaitEvents);
+                                                  *tracerParams.pphWaitEvents));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -4600,7 +5056,13 @@ namespace tracing_layer
         if( nullptr == pfnMakeMemoryResident)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Context.pfnMakeMemoryResident, hContext, hDevice, ptr, size);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Context, pfnMakeMemoryResidentCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hContext, hDevice);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Context.pfnMakeMemoryResident, hContext, hDevice, ptr, size);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Context.pfnMakeMemoryResident, hContext, hDevice, ptr, size);
 
         // capture parameters
         ze_context_make_memory_resident_params_t tracerParams = {
@@ -4612,18 +5074,16 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnContextMakeMemoryResidentCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnContextMakeMemoryResidentCb_t, Context, pfnMakeMemoryResidentCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnContextMakeMemoryResidentCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Context.pfnMakeMemoryResident,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.Context.pfnMakeMemoryResident,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pptr,
-                                                  *tracerParams.psize);
+                                                  *tracerParams.psize));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -4641,7 +5101,13 @@ namespace tracing_layer
         if( nullptr == pfnEvictMemory)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Context.pfnEvictMemory, hContext, hDevice, ptr, size);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Context, pfnEvictMemoryCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hContext, hDevice);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Context.pfnEvictMemory, hContext, hDevice, ptr, size);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Context.pfnEvictMemory, hContext, hDevice, ptr, size);
 
         // capture parameters
         ze_context_evict_memory_params_t tracerParams = {
@@ -4653,18 +5119,16 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnContextEvictMemoryCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnContextEvictMemoryCb_t, Context, pfnEvictMemoryCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnContextEvictMemoryCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Context.pfnEvictMemory,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.Context.pfnEvictMemory,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pptr,
-                                                  *tracerParams.psize);
+                                                  *tracerParams.psize));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -4681,7 +5145,13 @@ namespace tracing_layer
         if( nullptr == pfnMakeImageResident)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Context.pfnMakeImageResident, hContext, hDevice, hImage);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Context, pfnMakeImageResidentCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hContext, hDevice, hImage);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Context.pfnMakeImageResident, hContext, hDevice, hImage);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Context.pfnMakeImageResident, hContext, hDevice, hImage);
 
         // capture parameters
         ze_context_make_image_resident_params_t tracerParams = {
@@ -4692,17 +5162,15 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnContextMakeImageResidentCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnContextMakeImageResidentCb_t, Context, pfnMakeImageResidentCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnContextMakeImageResidentCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Context.pfnMakeImageResident,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.Context.pfnMakeImageResident,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
-                                                  *tracerParams.phImage);
+                                                  *tracerParams.phImage));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -4719,7 +5187,13 @@ namespace tracing_layer
         if( nullptr == pfnEvictImage)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Context.pfnEvictImage, hContext, hDevice, hImage);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Context, pfnEvictImageCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hContext, hDevice, hImage);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Context.pfnEvictImage, hContext, hDevice, hImage);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Context.pfnEvictImage, hContext, hDevice, hImage);
 
         // capture parameters
         ze_context_evict_image_params_t tracerParams = {
@@ -4730,17 +5204,15 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnContextEvictImageCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnContextEvictImageCb_t, Context, pfnEvictImageCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnContextEvictImageCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Context.pfnEvictImage,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.Context.pfnEvictImage,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
-                                                  *tracerParams.phImage);
+                                                  *tracerParams.phImage));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -4758,7 +5230,13 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Sampler.pfnCreate, hContext, hDevice, desc, phSampler);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Sampler, pfnCreateCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hContext, hDevice);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Sampler.pfnCreate, hContext, hDevice, desc, phSampler);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Sampler.pfnCreate, hContext, hDevice, desc, phSampler);
 
         // capture parameters
         ze_sampler_create_params_t tracerParams = {
@@ -4770,18 +5248,16 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnSamplerCreateCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnSamplerCreateCb_t, Sampler, pfnCreateCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnSamplerCreateCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Sampler.pfnCreate,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<2>, tracing_layer::epilogue_arg_indices<3>>>(context.zeDdiTable.Sampler.pfnCreate,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pdesc,
-                                                  *tracerParams.pphSampler);
+                                                  *tracerParams.pphSampler));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -4796,7 +5272,13 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Sampler.pfnDestroy, hSampler);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Sampler, pfnDestroyCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hSampler);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Sampler.pfnDestroy, hSampler);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Sampler.pfnDestroy, hSampler);
 
         // capture parameters
         ze_sampler_destroy_params_t tracerParams = {
@@ -4805,15 +5287,13 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnSamplerDestroyCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnSamplerDestroyCb_t, Sampler, pfnDestroyCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnSamplerDestroyCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Sampler.pfnDestroy,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.Sampler.pfnDestroy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
-                                                  *tracerParams.phSampler);
+                                                  apiCallbackData,
+                                                  *tracerParams.phSampler));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -4832,7 +5312,13 @@ namespace tracing_layer
         if( nullptr == pfnReserve)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.VirtualMem.pfnReserve, hContext, pStart, size, pptr);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(VirtualMem, pfnReserveCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hContext);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.VirtualMem.pfnReserve, hContext, pStart, size, pptr);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.VirtualMem.pfnReserve, hContext, pStart, size, pptr);
 
         // capture parameters
         ze_virtual_mem_reserve_params_t tracerParams = {
@@ -4844,18 +5330,16 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnVirtualMemReserveCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnVirtualMemReserveCb_t, VirtualMem, pfnReserveCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnVirtualMemReserveCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.VirtualMem.pfnReserve,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.VirtualMem.pfnReserve,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.ppStart,
                                                   *tracerParams.psize,
-                                                  *tracerParams.ppptr);
+                                                  *tracerParams.ppptr));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -4872,7 +5356,13 @@ namespace tracing_layer
         if( nullptr == pfnFree)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.VirtualMem.pfnFree, hContext, ptr, size);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(VirtualMem, pfnFreeCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hContext);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.VirtualMem.pfnFree, hContext, ptr, size);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.VirtualMem.pfnFree, hContext, ptr, size);
 
         // capture parameters
         ze_virtual_mem_free_params_t tracerParams = {
@@ -4883,17 +5373,15 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnVirtualMemFreeCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnVirtualMemFreeCb_t, VirtualMem, pfnFreeCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnVirtualMemFreeCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.VirtualMem.pfnFree,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.VirtualMem.pfnFree,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.pptr,
-                                                  *tracerParams.psize);
+                                                  *tracerParams.psize));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -4912,7 +5400,13 @@ namespace tracing_layer
         if( nullptr == pfnQueryPageSize)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.VirtualMem.pfnQueryPageSize, hContext, hDevice, size, pagesize);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(VirtualMem, pfnQueryPageSizeCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hContext, hDevice);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.VirtualMem.pfnQueryPageSize, hContext, hDevice, size, pagesize);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.VirtualMem.pfnQueryPageSize, hContext, hDevice, size, pagesize);
 
         // capture parameters
         ze_virtual_mem_query_page_size_params_t tracerParams = {
@@ -4924,18 +5418,16 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnVirtualMemQueryPageSizeCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnVirtualMemQueryPageSizeCb_t, VirtualMem, pfnQueryPageSizeCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnVirtualMemQueryPageSizeCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.VirtualMem.pfnQueryPageSize,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.VirtualMem.pfnQueryPageSize,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.psize,
-                                                  *tracerParams.ppagesize);
+                                                  *tracerParams.ppagesize));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -4953,7 +5445,13 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.PhysicalMem.pfnCreate, hContext, hDevice, desc, phPhysicalMemory);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(PhysicalMem, pfnCreateCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hContext, hDevice);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.PhysicalMem.pfnCreate, hContext, hDevice, desc, phPhysicalMemory);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.PhysicalMem.pfnCreate, hContext, hDevice, desc, phPhysicalMemory);
 
         // capture parameters
         ze_physical_mem_create_params_t tracerParams = {
@@ -4965,18 +5463,16 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnPhysicalMemCreateCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnPhysicalMemCreateCb_t, PhysicalMem, pfnCreateCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnPhysicalMemCreateCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.PhysicalMem.pfnCreate,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<2>, tracing_layer::epilogue_arg_indices<3>>>(context.zeDdiTable.PhysicalMem.pfnCreate,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pdesc,
-                                                  *tracerParams.pphPhysicalMemory);
+                                                  *tracerParams.pphPhysicalMemory));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -4992,7 +5488,13 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.PhysicalMem.pfnDestroy, hContext, hPhysicalMemory);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(PhysicalMem, pfnDestroyCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hContext, hPhysicalMemory);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.PhysicalMem.pfnDestroy, hContext, hPhysicalMemory);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.PhysicalMem.pfnDestroy, hContext, hPhysicalMemory);
 
         // capture parameters
         ze_physical_mem_destroy_params_t tracerParams = {
@@ -5002,16 +5504,14 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnPhysicalMemDestroyCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnPhysicalMemDestroyCb_t, PhysicalMem, pfnDestroyCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnPhysicalMemDestroyCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.PhysicalMem.pfnDestroy,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.PhysicalMem.pfnDestroy,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
-                                                  *tracerParams.phPhysicalMemory);
+                                                  *tracerParams.phPhysicalMemory));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -5034,7 +5534,13 @@ namespace tracing_layer
         if( nullptr == pfnMap)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.VirtualMem.pfnMap, hContext, ptr, size, hPhysicalMemory, offset, access);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(VirtualMem, pfnMapCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hContext, hPhysicalMemory);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.VirtualMem.pfnMap, hContext, ptr, size, hPhysicalMemory, offset, access);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.VirtualMem.pfnMap, hContext, ptr, size, hPhysicalMemory, offset, access);
 
         // capture parameters
         ze_virtual_mem_map_params_t tracerParams = {
@@ -5048,20 +5554,18 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnVirtualMemMapCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnVirtualMemMapCb_t, VirtualMem, pfnMapCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnVirtualMemMapCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.VirtualMem.pfnMap,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.VirtualMem.pfnMap,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.pptr,
                                                   *tracerParams.psize,
                                                   *tracerParams.phPhysicalMemory,
                                                   *tracerParams.poffset,
-                                                  *tracerParams.paccess);
+                                                  *tracerParams.paccess));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -5078,7 +5582,13 @@ namespace tracing_layer
         if( nullptr == pfnUnmap)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.VirtualMem.pfnUnmap, hContext, ptr, size);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(VirtualMem, pfnUnmapCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hContext);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.VirtualMem.pfnUnmap, hContext, ptr, size);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.VirtualMem.pfnUnmap, hContext, ptr, size);
 
         // capture parameters
         ze_virtual_mem_unmap_params_t tracerParams = {
@@ -5089,17 +5599,15 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnVirtualMemUnmapCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnVirtualMemUnmapCb_t, VirtualMem, pfnUnmapCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnVirtualMemUnmapCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.VirtualMem.pfnUnmap,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.VirtualMem.pfnUnmap,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.pptr,
-                                                  *tracerParams.psize);
+                                                  *tracerParams.psize));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -5118,7 +5626,13 @@ namespace tracing_layer
         if( nullptr == pfnSetAccessAttribute)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.VirtualMem.pfnSetAccessAttribute, hContext, ptr, size, access);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(VirtualMem, pfnSetAccessAttributeCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hContext);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.VirtualMem.pfnSetAccessAttribute, hContext, ptr, size, access);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.VirtualMem.pfnSetAccessAttribute, hContext, ptr, size, access);
 
         // capture parameters
         ze_virtual_mem_set_access_attribute_params_t tracerParams = {
@@ -5130,18 +5644,16 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnVirtualMemSetAccessAttributeCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnVirtualMemSetAccessAttributeCb_t, VirtualMem, pfnSetAccessAttributeCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnVirtualMemSetAccessAttributeCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.VirtualMem.pfnSetAccessAttribute,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.VirtualMem.pfnSetAccessAttribute,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.pptr,
                                                   *tracerParams.psize,
-                                                  *tracerParams.paccess);
+                                                  *tracerParams.paccess));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -5161,7 +5673,13 @@ namespace tracing_layer
         if( nullptr == pfnGetAccessAttribute)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.VirtualMem.pfnGetAccessAttribute, hContext, ptr, size, access, outSize);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(VirtualMem, pfnGetAccessAttributeCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hContext);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.VirtualMem.pfnGetAccessAttribute, hContext, ptr, size, access, outSize);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.VirtualMem.pfnGetAccessAttribute, hContext, ptr, size, access, outSize);
 
         // capture parameters
         ze_virtual_mem_get_access_attribute_params_t tracerParams = {
@@ -5174,19 +5692,17 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnVirtualMemGetAccessAttributeCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnVirtualMemGetAccessAttributeCb_t, VirtualMem, pfnGetAccessAttributeCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnVirtualMemGetAccessAttributeCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.VirtualMem.pfnGetAccessAttribute,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.VirtualMem.pfnGetAccessAttribute,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.pptr,
                                                   *tracerParams.psize,
                                                   *tracerParams.paccess,
-                                                  *tracerParams.poutSize);
+                                                  *tracerParams.poutSize));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -5204,7 +5720,13 @@ namespace tracing_layer
         if( nullptr == pfnSetGlobalOffsetExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.KernelExp.pfnSetGlobalOffsetExp, hKernel, offsetX, offsetY, offsetZ);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Kernel, pfnSetGlobalOffsetExpCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hKernel);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.KernelExp.pfnSetGlobalOffsetExp, hKernel, offsetX, offsetY, offsetZ);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.KernelExp.pfnSetGlobalOffsetExp, hKernel, offsetX, offsetY, offsetZ);
 
         // capture parameters
         ze_kernel_set_global_offset_exp_params_t tracerParams = {
@@ -5216,18 +5738,16 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnKernelSetGlobalOffsetExpCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnKernelSetGlobalOffsetExpCb_t, Kernel, pfnSetGlobalOffsetExpCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnKernelSetGlobalOffsetExpCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.KernelExp.pfnSetGlobalOffsetExp,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.KernelExp.pfnSetGlobalOffsetExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phKernel,
                                                   *tracerParams.poffsetX,
                                                   *tracerParams.poffsetY,
-                                                  *tracerParams.poffsetZ);
+                                                  *tracerParams.poffsetZ));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -5247,7 +5767,13 @@ namespace tracing_layer
         if( nullptr == pfnReserveCacheExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnReserveCacheExt, hDevice, cacheLevel, cacheReservationSize);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Device, pfnReserveCacheExtCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hDevice);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Device.pfnReserveCacheExt, hDevice, cacheLevel, cacheReservationSize);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Device.pfnReserveCacheExt, hDevice, cacheLevel, cacheReservationSize);
 
         // capture parameters
         ze_device_reserve_cache_ext_params_t tracerParams = {
@@ -5258,17 +5784,15 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnDeviceReserveCacheExtCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDeviceReserveCacheExtCb_t, Device, pfnReserveCacheExtCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDeviceReserveCacheExtCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnReserveCacheExt,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.Device.pfnReserveCacheExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pcacheLevel,
-                                                  *tracerParams.pcacheReservationSize);
+                                                  *tracerParams.pcacheReservationSize));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -5286,7 +5810,13 @@ namespace tracing_layer
         if( nullptr == pfnSetCacheAdviceExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnSetCacheAdviceExt, hDevice, ptr, regionSize, cacheRegion);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Device, pfnSetCacheAdviceExtCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hDevice);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Device.pfnSetCacheAdviceExt, hDevice, ptr, regionSize, cacheRegion);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Device.pfnSetCacheAdviceExt, hDevice, ptr, regionSize, cacheRegion);
 
         // capture parameters
         ze_device_set_cache_advice_ext_params_t tracerParams = {
@@ -5298,18 +5828,16 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnDeviceSetCacheAdviceExtCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDeviceSetCacheAdviceExtCb_t, Device, pfnSetCacheAdviceExtCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDeviceSetCacheAdviceExtCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnSetCacheAdviceExt,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.Device.pfnSetCacheAdviceExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pptr,
                                                   *tracerParams.pregionSize,
-                                                  *tracerParams.pcacheRegion);
+                                                  *tracerParams.pcacheRegion));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -5333,7 +5861,13 @@ namespace tracing_layer
         if( nullptr == pfnQueryTimestampsExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.EventExp.pfnQueryTimestampsExp, hEvent, hDevice, pCount, pTimestamps);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Event, pfnQueryTimestampsExpCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hEvent, hDevice);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.EventExp.pfnQueryTimestampsExp, hEvent, hDevice, pCount, pTimestamps);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.EventExp.pfnQueryTimestampsExp, hEvent, hDevice, pCount, pTimestamps);
 
         // capture parameters
         ze_event_query_timestamps_exp_params_t tracerParams = {
@@ -5345,18 +5879,16 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnEventQueryTimestampsExpCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnEventQueryTimestampsExpCb_t, Event, pfnQueryTimestampsExpCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnEventQueryTimestampsExpCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.EventExp.pfnQueryTimestampsExp,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.EventExp.pfnQueryTimestampsExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEvent,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.ppCount,
-                                                  *tracerParams.ppTimestamps);
+                                                  *tracerParams.ppTimestamps));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -5372,7 +5904,13 @@ namespace tracing_layer
         if( nullptr == pfnGetMemoryPropertiesExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.ImageExp.pfnGetMemoryPropertiesExp, hImage, pMemoryProperties);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Image, pfnGetMemoryPropertiesExpCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hImage);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.ImageExp.pfnGetMemoryPropertiesExp, hImage, pMemoryProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.ImageExp.pfnGetMemoryPropertiesExp, hImage, pMemoryProperties);
 
         // capture parameters
         ze_image_get_memory_properties_exp_params_t tracerParams = {
@@ -5382,16 +5920,14 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnImageGetMemoryPropertiesExpCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnImageGetMemoryPropertiesExpCb_t, Image, pfnGetMemoryPropertiesExpCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnImageGetMemoryPropertiesExpCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.ImageExp.pfnGetMemoryPropertiesExp,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.ImageExp.pfnGetMemoryPropertiesExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phImage,
-                                                  *tracerParams.ppMemoryProperties);
+                                                  *tracerParams.ppMemoryProperties));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -5410,7 +5946,13 @@ namespace tracing_layer
         if( nullptr == pfnViewCreateExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Image.pfnViewCreateExt, hContext, hDevice, desc, hImage, phImageView);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Image, pfnViewCreateExtCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hContext, hDevice, hImage);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Image.pfnViewCreateExt, hContext, hDevice, desc, hImage, phImageView);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Image.pfnViewCreateExt, hContext, hDevice, desc, hImage, phImageView);
 
         // capture parameters
         ze_image_view_create_ext_params_t tracerParams = {
@@ -5423,19 +5965,17 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnImageViewCreateExtCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnImageViewCreateExtCb_t, Image, pfnViewCreateExtCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnImageViewCreateExtCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Image.pfnViewCreateExt,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<2>, tracing_layer::epilogue_arg_indices<4>>>(context.zeDdiTable.Image.pfnViewCreateExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pdesc,
                                                   *tracerParams.phImage,
-                                                  *tracerParams.pphImageView);
+                                                  *tracerParams.pphImageView));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -5454,7 +5994,13 @@ namespace tracing_layer
         if( nullptr == pfnViewCreateExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.ImageExp.pfnViewCreateExp, hContext, hDevice, desc, hImage, phImageView);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Image, pfnViewCreateExpCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hContext, hDevice, hImage);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.ImageExp.pfnViewCreateExp, hContext, hDevice, desc, hImage, phImageView);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.ImageExp.pfnViewCreateExp, hContext, hDevice, desc, hImage, phImageView);
 
         // capture parameters
         ze_image_view_create_exp_params_t tracerParams = {
@@ -5467,19 +6013,17 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnImageViewCreateExpCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnImageViewCreateExpCb_t, Image, pfnViewCreateExpCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnImageViewCreateExpCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.ImageExp.pfnViewCreateExp,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<2>, tracing_layer::epilogue_arg_indices<4>>>(context.zeDdiTable.ImageExp.pfnViewCreateExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.pdesc,
                                                   *tracerParams.phImage,
-                                                  *tracerParams.pphImageView);
+                                                  *tracerParams.pphImageView));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -5495,7 +6039,13 @@ namespace tracing_layer
         if( nullptr == pfnSchedulingHintExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.KernelExp.pfnSchedulingHintExp, hKernel, pHint);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Kernel, pfnSchedulingHintExpCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hKernel);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.KernelExp.pfnSchedulingHintExp, hKernel, pHint);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.KernelExp.pfnSchedulingHintExp, hKernel, pHint);
 
         // capture parameters
         ze_kernel_scheduling_hint_exp_params_t tracerParams = {
@@ -5505,16 +6055,14 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnKernelSchedulingHintExpCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnKernelSchedulingHintExpCb_t, Kernel, pfnSchedulingHintExpCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnKernelSchedulingHintExpCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.KernelExp.pfnSchedulingHintExp,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<1>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.KernelExp.pfnSchedulingHintExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phKernel,
-                                                  *tracerParams.ppHint);
+                                                  *tracerParams.ppHint));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -5530,7 +6078,13 @@ namespace tracing_layer
         if( nullptr == pfnPciGetPropertiesExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnPciGetPropertiesExt, hDevice, pPciProperties);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Device, pfnPciGetPropertiesExtCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hDevice);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Device.pfnPciGetPropertiesExt, hDevice, pPciProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Device.pfnPciGetPropertiesExt, hDevice, pPciProperties);
 
         // capture parameters
         ze_device_pci_get_properties_ext_params_t tracerParams = {
@@ -5540,16 +6094,14 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnDevicePciGetPropertiesExtCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDevicePciGetPropertiesExtCb_t, Device, pfnPciGetPropertiesExtCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDevicePciGetPropertiesExtCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnPciGetPropertiesExt,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Device.pfnPciGetPropertiesExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
-                                                  *tracerParams.ppPciProperties);
+                                                  *tracerParams.ppPciProperties));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -5576,7 +6128,13 @@ namespace tracing_layer
         if( nullptr == pfnAppendImageCopyToMemoryExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendImageCopyToMemoryExt, hCommandList, dstptr, hSrcImage, pSrcRegion, destRowPitch, destSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(CommandList, pfnAppendImageCopyToMemoryExtCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hCommandList, hSrcImage, hSignalEvent);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.CommandList.pfnAppendImageCopyToMemoryExt, hCommandList, dstptr, hSrcImage, pSrcRegion, destRowPitch, destSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.CommandList.pfnAppendImageCopyToMemoryExt, hCommandList, dstptr, hSrcImage, pSrcRegion, destRowPitch, destSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
         ze_command_list_append_image_copy_to_memory_ext_params_t tracerParams = {
@@ -5593,14 +6151,12 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnCommandListAppendImageCopyToMemoryExtCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendImageCopyToMemoryExtCb_t, CommandList, pfnAppendImageCopyToMemoryExtCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendImageCopyToMemoryExtCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendImageCopyToMemoryExt,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<3, 8>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.CommandList.pfnAppendImageCopyToMemoryExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.pdstptr,
                                                   *tracerParams.phSrcImage,
@@ -5609,7 +6165,7 @@ namespace tracing_layer
                                                   *tracerParams.pdestSlicePitch,
                                                   *tracerParams.phSignalEvent,
                                                   *tracerParams.pnumWaitEvents,
-                                                  *tracerParams.pphWaitEvents);
+                                                  *tracerParams.pphWaitEvents));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -5636,7 +6192,13 @@ namespace tracing_layer
         if( nullptr == pfnAppendImageCopyFromMemoryExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendImageCopyFromMemoryExt, hCommandList, hDstImage, srcptr, pDstRegion, srcRowPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(CommandList, pfnAppendImageCopyFromMemoryExtCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hCommandList, hDstImage, hSignalEvent);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.CommandList.pfnAppendImageCopyFromMemoryExt, hCommandList, hDstImage, srcptr, pDstRegion, srcRowPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.CommandList.pfnAppendImageCopyFromMemoryExt, hCommandList, hDstImage, srcptr, pDstRegion, srcRowPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
         ze_command_list_append_image_copy_from_memory_ext_params_t tracerParams = {
@@ -5653,14 +6215,12 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnCommandListAppendImageCopyFromMemoryExtCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendImageCopyFromMemoryExtCb_t, CommandList, pfnAppendImageCopyFromMemoryExtCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnCommandListAppendImageCopyFromMemoryExtCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendImageCopyFromMemoryExt,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<3, 8>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.CommandList.pfnAppendImageCopyFromMemoryExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phCommandList,
                                                   *tracerParams.phDstImage,
                                                   *tracerParams.psrcptr,
@@ -5669,7 +6229,7 @@ namespace tracing_layer
                                                   *tracerParams.psrcSlicePitch,
                                                   *tracerParams.phSignalEvent,
                                                   *tracerParams.pnumWaitEvents,
-                                                  *tracerParams.pphWaitEvents);
+                                                  *tracerParams.pphWaitEvents));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -5686,7 +6246,13 @@ namespace tracing_layer
         if( nullptr == pfnGetAllocPropertiesExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Image.pfnGetAllocPropertiesExt, hContext, hImage, pImageAllocProperties);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Image, pfnGetAllocPropertiesExtCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hContext, hImage);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Image.pfnGetAllocPropertiesExt, hContext, hImage, pImageAllocProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Image.pfnGetAllocPropertiesExt, hContext, hImage, pImageAllocProperties);
 
         // capture parameters
         ze_image_get_alloc_properties_ext_params_t tracerParams = {
@@ -5697,17 +6263,15 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnImageGetAllocPropertiesExtCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnImageGetAllocPropertiesExtCb_t, Image, pfnGetAllocPropertiesExtCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnImageGetAllocPropertiesExtCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Image.pfnGetAllocPropertiesExt,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Image.pfnGetAllocPropertiesExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.phImage,
-                                                  *tracerParams.ppImageAllocProperties);
+                                                  *tracerParams.ppImageAllocProperties));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -5727,7 +6291,13 @@ namespace tracing_layer
         if( nullptr == pfnInspectLinkageExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Module.pfnInspectLinkageExt, pInspectDesc, numModules, phModules, phLog);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Module, pfnInspectLinkageExtCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Module.pfnInspectLinkageExt, pInspectDesc, numModules, phModules, phLog);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Module.pfnInspectLinkageExt, pInspectDesc, numModules, phModules, phLog);
 
         // capture parameters
         ze_module_inspect_linkage_ext_params_t tracerParams = {
@@ -5739,18 +6309,16 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnModuleInspectLinkageExtCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnModuleInspectLinkageExtCb_t, Module, pfnInspectLinkageExtCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnModuleInspectLinkageExtCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Module.pfnInspectLinkageExt,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<0, 2>, tracing_layer::epilogue_arg_indices<3>>>(context.zeDdiTable.Module.pfnInspectLinkageExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.ppInspectDesc,
                                                   *tracerParams.pnumModules,
                                                   *tracerParams.pphModules,
-                                                  *tracerParams.pphLog);
+                                                  *tracerParams.pphLog));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -5767,7 +6335,13 @@ namespace tracing_layer
         if( nullptr == pfnFreeExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnFreeExt, hContext, pMemFreeDesc, ptr);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Mem, pfnFreeExtCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hContext);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Mem.pfnFreeExt, hContext, pMemFreeDesc, ptr);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Mem.pfnFreeExt, hContext, pMemFreeDesc, ptr);
 
         // capture parameters
         ze_mem_free_ext_params_t tracerParams = {
@@ -5778,17 +6352,15 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnMemFreeExtCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnMemFreeExtCb_t, Mem, pfnFreeExtCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnMemFreeExtCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Mem.pfnFreeExt,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<1>, tracing_layer::epilogue_arg_indices<>>>(context.zeDdiTable.Mem.pfnFreeExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phContext,
                                                   *tracerParams.ppMemFreeDesc,
-                                                  *tracerParams.pptr);
+                                                  *tracerParams.pptr));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -5812,7 +6384,13 @@ namespace tracing_layer
         if( nullptr == pfnGetExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.FabricVertexExp.pfnGetExp, hDriver, pCount, phVertices);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(FabricVertex, pfnGetExpCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hDriver);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.FabricVertexExp.pfnGetExp, hDriver, pCount, phVertices);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.FabricVertexExp.pfnGetExp, hDriver, pCount, phVertices);
 
         // capture parameters
         ze_fabric_vertex_get_exp_params_t tracerParams = {
@@ -5823,17 +6401,15 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnFabricVertexGetExpCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnFabricVertexGetExpCb_t, FabricVertex, pfnGetExpCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnFabricVertexGetExpCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.FabricVertexExp.pfnGetExp,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.FabricVertexExp.pfnGetExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDriver,
                                                   *tracerParams.ppCount,
-                                                  *tracerParams.pphVertices);
+                                                  *tracerParams.pphVertices));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -5857,7 +6433,13 @@ namespace tracing_layer
         if( nullptr == pfnGetSubVerticesExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.FabricVertexExp.pfnGetSubVerticesExp, hVertex, pCount, phSubvertices);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(FabricVertex, pfnGetSubVerticesExpCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hVertex);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.FabricVertexExp.pfnGetSubVerticesExp, hVertex, pCount, phSubvertices);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.FabricVertexExp.pfnGetSubVerticesExp, hVertex, pCount, phSubvertices);
 
         // capture parameters
         ze_fabric_vertex_get_sub_vertices_exp_params_t tracerParams = {
@@ -5868,17 +6450,15 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnFabricVertexGetSubVerticesExpCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnFabricVertexGetSubVerticesExpCb_t, FabricVertex, pfnGetSubVerticesExpCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnFabricVertexGetSubVerticesExpCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.FabricVertexExp.pfnGetSubVerticesExp,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.FabricVertexExp.pfnGetSubVerticesExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phVertex,
                                                   *tracerParams.ppCount,
-                                                  *tracerParams.pphSubvertices);
+                                                  *tracerParams.pphSubvertices));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -5894,7 +6474,13 @@ namespace tracing_layer
         if( nullptr == pfnGetPropertiesExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.FabricVertexExp.pfnGetPropertiesExp, hVertex, pVertexProperties);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(FabricVertex, pfnGetPropertiesExpCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hVertex);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.FabricVertexExp.pfnGetPropertiesExp, hVertex, pVertexProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.FabricVertexExp.pfnGetPropertiesExp, hVertex, pVertexProperties);
 
         // capture parameters
         ze_fabric_vertex_get_properties_exp_params_t tracerParams = {
@@ -5904,16 +6490,14 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnFabricVertexGetPropertiesExpCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnFabricVertexGetPropertiesExpCb_t, FabricVertex, pfnGetPropertiesExpCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnFabricVertexGetPropertiesExpCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.FabricVertexExp.pfnGetPropertiesExp,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.FabricVertexExp.pfnGetPropertiesExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phVertex,
-                                                  *tracerParams.ppVertexProperties);
+                                                  *tracerParams.ppVertexProperties));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -5929,7 +6513,13 @@ namespace tracing_layer
         if( nullptr == pfnGetDeviceExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.FabricVertexExp.pfnGetDeviceExp, hVertex, phDevice);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(FabricVertex, pfnGetDeviceExpCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hVertex);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.FabricVertexExp.pfnGetDeviceExp, hVertex, phDevice);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.FabricVertexExp.pfnGetDeviceExp, hVertex, phDevice);
 
         // capture parameters
         ze_fabric_vertex_get_device_exp_params_t tracerParams = {
@@ -5939,16 +6529,14 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnFabricVertexGetDeviceExpCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnFabricVertexGetDeviceExpCb_t, FabricVertex, pfnGetDeviceExpCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnFabricVertexGetDeviceExpCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.FabricVertexExp.pfnGetDeviceExp,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<1>>>(context.zeDdiTable.FabricVertexExp.pfnGetDeviceExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phVertex,
-                                                  *tracerParams.pphDevice);
+                                                  *tracerParams.pphDevice));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -5964,7 +6552,13 @@ namespace tracing_layer
         if( nullptr == pfnGetFabricVertexExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.DeviceExp.pfnGetFabricVertexExp, hDevice, phVertex);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Device, pfnGetFabricVertexExpCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hDevice);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.DeviceExp.pfnGetFabricVertexExp, hDevice, phVertex);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.DeviceExp.pfnGetFabricVertexExp, hDevice, phVertex);
 
         // capture parameters
         ze_device_get_fabric_vertex_exp_params_t tracerParams = {
@@ -5974,16 +6568,14 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnDeviceGetFabricVertexExpCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDeviceGetFabricVertexExpCb_t, Device, pfnGetFabricVertexExpCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnDeviceGetFabricVertexExpCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.DeviceExp.pfnGetFabricVertexExp,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<1>>>(context.zeDdiTable.DeviceExp.pfnGetFabricVertexExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phDevice,
-                                                  *tracerParams.pphVertex);
+                                                  *tracerParams.pphVertex));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -6008,7 +6600,13 @@ namespace tracing_layer
         if( nullptr == pfnGetExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.FabricEdgeExp.pfnGetExp, hVertexA, hVertexB, pCount, phEdges);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(FabricEdge, pfnGetExpCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hVertexA, hVertexB);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.FabricEdgeExp.pfnGetExp, hVertexA, hVertexB, pCount, phEdges);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.FabricEdgeExp.pfnGetExp, hVertexA, hVertexB, pCount, phEdges);
 
         // capture parameters
         ze_fabric_edge_get_exp_params_t tracerParams = {
@@ -6020,18 +6618,16 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnFabricEdgeGetExpCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnFabricEdgeGetExpCb_t, FabricEdge, pfnGetExpCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnFabricEdgeGetExpCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.FabricEdgeExp.pfnGetExp,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.FabricEdgeExp.pfnGetExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phVertexA,
                                                   *tracerParams.phVertexB,
                                                   *tracerParams.ppCount,
-                                                  *tracerParams.pphEdges);
+                                                  *tracerParams.pphEdges));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -6048,7 +6644,13 @@ namespace tracing_layer
         if( nullptr == pfnGetVerticesExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.FabricEdgeExp.pfnGetVerticesExp, hEdge, phVertexA, phVertexB);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(FabricEdge, pfnGetVerticesExpCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hEdge);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.FabricEdgeExp.pfnGetVerticesExp, hEdge, phVertexA, phVertexB);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.FabricEdgeExp.pfnGetVerticesExp, hEdge, phVertexA, phVertexB);
 
         // capture parameters
         ze_fabric_edge_get_vertices_exp_params_t tracerParams = {
@@ -6059,17 +6661,15 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnFabricEdgeGetVerticesExpCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnFabricEdgeGetVerticesExpCb_t, FabricEdge, pfnGetVerticesExpCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnFabricEdgeGetVerticesExpCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.FabricEdgeExp.pfnGetVerticesExp,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<true, tracing_layer::epilogue_arg_indices<>, tracing_layer::epilogue_arg_indices<1, 2>>>(context.zeDdiTable.FabricEdgeExp.pfnGetVerticesExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEdge,
                                                   *tracerParams.pphVertexA,
-                                                  *tracerParams.pphVertexB);
+                                                  *tracerParams.pphVertexB));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -6085,7 +6685,13 @@ namespace tracing_layer
         if( nullptr == pfnGetPropertiesExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.FabricEdgeExp.pfnGetPropertiesExp, hEdge, pEdgeProperties);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(FabricEdge, pfnGetPropertiesExpCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hEdge);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.FabricEdgeExp.pfnGetPropertiesExp, hEdge, pEdgeProperties);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.FabricEdgeExp.pfnGetPropertiesExp, hEdge, pEdgeProperties);
 
         // capture parameters
         ze_fabric_edge_get_properties_exp_params_t tracerParams = {
@@ -6095,16 +6701,14 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnFabricEdgeGetPropertiesExpCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnFabricEdgeGetPropertiesExpCb_t, FabricEdge, pfnGetPropertiesExpCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnFabricEdgeGetPropertiesExpCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.FabricEdgeExp.pfnGetPropertiesExp,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.FabricEdgeExp.pfnGetPropertiesExp,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEdge,
-                                                  *tracerParams.ppEdgeProperties);
+                                                  *tracerParams.ppEdgeProperties));
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -6134,7 +6738,13 @@ namespace tracing_layer
         if( nullptr == pfnQueryKernelTimestampsExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnQueryKernelTimestampsExt, hEvent, hDevice, pCount, pResults);
+        const size_t apiIndex = ZE_TRACER_API_INDEX(Event, pfnQueryKernelTimestampsExtCb);
+
+        tracing_layer::APIRecordScope apiRecord(apiIndex, hEvent, hDevice);
+
+        ZE_HANDLE_UNTRACED_API(apiRecord, apiIndex, context.zeDdiTable.Event.pfnQueryKernelTimestampsExt, hEvent, hDevice, pCount, pResults);
+
+        ZE_HANDLE_TRACER_RECURSION(apiRecord, context.zeDdiTable.Event.pfnQueryKernelTimestampsExt, hEvent, hDevice, pCount, pResults);
 
         // capture parameters
         ze_event_query_kernel_timestamps_ext_params_t tracerParams = {
@@ -6146,19 +6756,176 @@ namespace tracing_layer
 
         tracing_layer::APITracerCallbackDataImp<ze_pfnEventQueryKernelTimestampsExtCb_t> apiCallbackData;
 
-        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnEventQueryKernelTimestampsExtCb_t, Event, pfnQueryKernelTimestampsExtCb);
+        ZE_GEN_PER_API_CALLBACK_STATE(apiCallbackData, ze_pfnEventQueryKernelTimestampsExtCb_t, apiIndex);
 
 
-        return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Event.pfnQueryKernelTimestampsExt,
+        return apiRecord.exit(tracing_layer::APITracerWrapperImp<tracing_layer::epilogue_args<false>>(context.zeDdiTable.Event.pfnQueryKernelTimestampsExt,
                                                   &tracerParams,
-                                                  apiCallbackData.apiOrdinal,
-                                                  apiCallbackData.prologCallbacks,
-                                                  apiCallbackData.epilogCallbacks,
+                                                  apiCallbackData,
                                                   *tracerParams.phEvent,
                                                   *tracerParams.phDevice,
                                                   *tracerParams.ppCount,
-                                                  *tracerParams.ppResults);
-    }
+                                                  *tracerParams.ppResults));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief APIs described in the trace recorder's file header
+    const trace_api_desc_t zeTraceApiDescs[] = {
+        { ZE_TRACER_API_INDEX(Global, pfnInitCb), "zeInit", 0 },
+        { ZE_TRACER_API_INDEX(Driver, pfnGetCb), "zeDriverGet", 0 },
+        { ZE_TRACER_API_INDEX(Driver, pfnGetApiVersionCb), "zeDriverGetApiVersion", 1 },
+        { ZE_TRACER_API_INDEX(Driver, pfnGetPropertiesCb), "zeDriverGetProperties", 1 },
+        { ZE_TRACER_API_INDEX(Driver, pfnGetIpcPropertiesCb), "zeDriverGetIpcProperties", 1 },
+        { ZE_TRACER_API_INDEX(Driver, pfnGetExtensionPropertiesCb), "zeDriverGetExtensionProperties", 1 },
+        { ZE_TRACER_API_INDEX(Driver, pfnGetExtensionFunctionAddressCb), "zeDriverGetExtensionFunctionAddress", 1 },
+        { ZE_TRACER_API_INDEX(Driver, pfnGetLastErrorDescriptionCb), "zeDriverGetLastErrorDescription", 1 },
+        { ZE_TRACER_API_INDEX(Device, pfnGetCb), "zeDeviceGet", 1 },
+        { ZE_TRACER_API_INDEX(Device, pfnGetSubDevicesCb), "zeDeviceGetSubDevices", 1 },
+        { ZE_TRACER_API_INDEX(Device, pfnGetPropertiesCb), "zeDeviceGetProperties", 1 },
+        { ZE_TRACER_API_INDEX(Device, pfnGetComputePropertiesCb), "zeDeviceGetComputeProperties", 1 },
+        { ZE_TRACER_API_INDEX(Device, pfnGetModulePropertiesCb), "zeDeviceGetModuleProperties", 1 },
+        { ZE_TRACER_API_INDEX(Device, pfnGetCommandQueueGroupPropertiesCb), "zeDeviceGetCommandQueueGroupProperties", 1 },
+        { ZE_TRACER_API_INDEX(Device, pfnGetMemoryPropertiesCb), "zeDeviceGetMemoryProperties", 1 },
+        { ZE_TRACER_API_INDEX(Device, pfnGetMemoryAccessPropertiesCb), "zeDeviceGetMemoryAccessProperties", 1 },
+        { ZE_TRACER_API_INDEX(Device, pfnGetCachePropertiesCb), "zeDeviceGetCacheProperties", 1 },
+        { ZE_TRACER_API_INDEX(Device, pfnGetImagePropertiesCb), "zeDeviceGetImageProperties", 1 },
+        { ZE_TRACER_API_INDEX(Device, pfnGetExternalMemoryPropertiesCb), "zeDeviceGetExternalMemoryProperties", 1 },
+        { ZE_TRACER_API_INDEX(Device, pfnGetP2PPropertiesCb), "zeDeviceGetP2PProperties", 2 },
+        { ZE_TRACER_API_INDEX(Device, pfnCanAccessPeerCb), "zeDeviceCanAccessPeer", 2 },
+        { ZE_TRACER_API_INDEX(Device, pfnGetStatusCb), "zeDeviceGetStatus", 1 },
+        { ZE_TRACER_API_INDEX(Device, pfnGetGlobalTimestampsCb), "zeDeviceGetGlobalTimestamps", 1 },
+        { ZE_TRACER_API_INDEX(Context, pfnCreateCb), "zeContextCreate", 1 },
+        { ZE_TRACER_API_INDEX(Context, pfnCreateExCb), "zeContextCreateEx", 1 },
+        { ZE_TRACER_API_INDEX(Context, pfnDestroyCb), "zeContextDestroy", 1 },
+        { ZE_TRACER_API_INDEX(Context, pfnGetStatusCb), "zeContextGetStatus", 1 },
+        { ZE_TRACER_API_INDEX(CommandQueue, pfnCreateCb), "zeCommandQueueCreate", 2 },
+        { ZE_TRACER_API_INDEX(CommandQueue, pfnDestroyCb), "zeCommandQueueDestroy", 1 },
+        { ZE_TRACER_API_INDEX(CommandQueue, pfnExecuteCommandListsCb), "zeCommandQueueExecuteCommandLists", 2 },
+        { ZE_TRACER_API_INDEX(CommandQueue, pfnSynchronizeCb), "zeCommandQueueSynchronize", 1 },
+        { ZE_TRACER_API_INDEX(CommandList, pfnCreateCb), "zeCommandListCreate", 2 },
+        { ZE_TRACER_API_INDEX(CommandList, pfnCreateImmediateCb), "zeCommandListCreateImmediate", 2 },
+        { ZE_TRACER_API_INDEX(CommandList, pfnDestroyCb), "zeCommandListDestroy", 1 },
+        { ZE_TRACER_API_INDEX(CommandList, pfnCloseCb), "zeCommandListClose", 1 },
+        { ZE_TRACER_API_INDEX(CommandList, pfnResetCb), "zeCommandListReset", 1 },
+        { ZE_TRACER_API_INDEX(CommandList, pfnAppendWriteGlobalTimestampCb), "zeCommandListAppendWriteGlobalTimestamp", 2 },
+        { ZE_TRACER_API_INDEX(CommandList, pfnHostSynchronizeCb), "zeCommandListHostSynchronize", 1 },
+        { ZE_TRACER_API_INDEX(CommandList, pfnAppendBarrierCb), "zeCommandListAppendBarrier", 2 },
+        { ZE_TRACER_API_INDEX(CommandList, pfnAppendMemoryRangesBarrierCb), "zeCommandListAppendMemoryRangesBarrier", 2 },
+        { ZE_TRACER_API_INDEX(Context, pfnSystemBarrierCb), "zeContextSystemBarrier", 2 },
+        { ZE_TRACER_API_INDEX(CommandList, pfnAppendMemoryCopyCb), "zeCommandListAppendMemoryCopy", 2 },
+        { ZE_TRACER_API_INDEX(CommandList, pfnAppendMemoryFillCb), "zeCommandListAppendMemoryFill", 2 },
+        { ZE_TRACER_API_INDEX(CommandList, pfnAppendMemoryCopyRegionCb), "zeCommandListAppendMemoryCopyRegion", 2 },
+        { ZE_TRACER_API_INDEX(CommandList, pfnAppendMemoryCopyFromContextCb), "zeCommandListAppendMemoryCopyFromContext", 3 },
+        { ZE_TRACER_API_INDEX(CommandList, pfnAppendImageCopyCb), "zeCommandListAppendImageCopy", 4 },
+        { ZE_TRACER_API_INDEX(CommandList, pfnAppendImageCopyRegionCb), "zeCommandListAppendImageCopyRegion", 4 },
+        { ZE_TRACER_API_INDEX(CommandList, pfnAppendImageCopyToMemoryCb), "zeCommandListAppendImageCopyToMemory", 3 },
+        { ZE_TRACER_API_INDEX(CommandList, pfnAppendImageCopyFromMemoryCb), "zeCommandListAppendImageCopyFromMemory", 3 },
+        { ZE_TRACER_API_INDEX(CommandList, pfnAppendMemoryPrefetchCb), "zeCommandListAppendMemoryPrefetch", 1 },
+        { ZE_TRACER_API_INDEX(CommandList, pfnAppendMemAdviseCb), "zeCommandListAppendMemAdvise", 2 },
+        { ZE_TRACER_API_INDEX(EventPool, pfnCreateCb), "zeEventPoolCreate", 1 },
+        { ZE_TRACER_API_INDEX(EventPool, pfnDestroyCb), "zeEventPoolDestroy", 1 },
+        { ZE_TRACER_API_INDEX(Event, pfnCreateCb), "zeEventCreate", 1 },
+        { ZE_TRACER_API_INDEX(Event, pfnDestroyCb), "zeEventDestroy", 1 },
+        { ZE_TRACER_API_INDEX(EventPool, pfnGetIpcHandleCb), "zeEventPoolGetIpcHandle", 1 },
+        { ZE_TRACER_API_INDEX(EventPool, pfnPutIpcHandleCb), "zeEventPoolPutIpcHandle", 1 },
+        { ZE_TRACER_API_INDEX(EventPool, pfnOpenIpcHandleCb), "zeEventPoolOpenIpcHandle", 1 },
+        { ZE_TRACER_API_INDEX(EventPool, pfnCloseIpcHandleCb), "zeEventPoolCloseIpcHandle", 1 },
+        { ZE_TRACER_API_INDEX(CommandList, pfnAppendSignalEventCb), "zeCommandListAppendSignalEvent", 2 },
+        { ZE_TRACER_API_INDEX(CommandList, pfnAppendWaitOnEventsCb), "zeCommandListAppendWaitOnEvents", 1 },
+        { ZE_TRACER_API_INDEX(Event, pfnHostSignalCb), "zeEventHostSignal", 1 },
+        { ZE_TRACER_API_INDEX(Event, pfnHostSynchronizeCb), "zeEventHostSynchronize", 1 },
+        { ZE_TRACER_API_INDEX(Event, pfnQueryStatusCb), "zeEventQueryStatus", 1 },
+        { ZE_TRACER_API_INDEX(CommandList, pfnAppendEventResetCb), "zeCommandListAppendEventReset", 2 },
+        { ZE_TRACER_API_INDEX(Event, pfnHostResetCb), "zeEventHostReset", 1 },
+        { ZE_TRACER_API_INDEX(Event, pfnQueryKernelTimestampCb), "zeEventQueryKernelTimestamp", 1 },
+        { ZE_TRACER_API_INDEX(CommandList, pfnAppendQueryKernelTimestampsCb), "zeCommandListAppendQueryKernelTimestamps", 2 },
+        { ZE_TRACER_API_INDEX(Fence, pfnCreateCb), "zeFenceCreate", 1 },
+        { ZE_TRACER_API_INDEX(Fence, pfnDestroyCb), "zeFenceDestroy", 1 },
+        { ZE_TRACER_API_INDEX(Fence, pfnHostSynchronizeCb), "zeFenceHostSynchronize", 1 },
+        { ZE_TRACER_API_INDEX(Fence, pfnQueryStatusCb), "zeFenceQueryStatus", 1 },
+        { ZE_TRACER_API_INDEX(Fence, pfnResetCb), "zeFenceReset", 1 },
+        { ZE_TRACER_API_INDEX(Image, pfnGetPropertiesCb), "zeImageGetProperties", 1 },
+        { ZE_TRACER_API_INDEX(Image, pfnCreateCb), "zeImageCreate", 2 },
+        { ZE_TRACER_API_INDEX(Image, pfnDestroyCb), "zeImageDestroy", 1 },
+        { ZE_TRACER_API_INDEX(Mem, pfnAllocSharedCb), "zeMemAllocShared", 2 },
+        { ZE_TRACER_API_INDEX(Mem, pfnAllocDeviceCb), "zeMemAllocDevice", 2 },
+        { ZE_TRACER_API_INDEX(Mem, pfnAllocHostCb), "zeMemAllocHost", 1 },
+        { ZE_TRACER_API_INDEX(Mem, pfnFreeCb), "zeMemFree", 1 },
+        { ZE_TRACER_API_INDEX(Mem, pfnGetAllocPropertiesCb), "zeMemGetAllocProperties", 1 },
+        { ZE_TRACER_API_INDEX(Mem, pfnGetAddressRangeCb), "zeMemGetAddressRange", 1 },
+        { ZE_TRACER_API_INDEX(Mem, pfnGetIpcHandleCb), "zeMemGetIpcHandle", 1 },
+        { ZE_TRACER_API_INDEX(Mem, pfnGetIpcHandleFromFileDescriptorExpCb), "zeMemGetIpcHandleFromFileDescriptorExp", 1 },
+        { ZE_TRACER_API_INDEX(Mem, pfnGetFileDescriptorFromIpcHandleExpCb), "zeMemGetFileDescriptorFromIpcHandleExp", 1 },
+        { ZE_TRACER_API_INDEX(Mem, pfnPutIpcHandleCb), "zeMemPutIpcHandle", 1 },
+        { ZE_TRACER_API_INDEX(Mem, pfnOpenIpcHandleCb), "zeMemOpenIpcHandle", 2 },
+        { ZE_TRACER_API_INDEX(Mem, pfnCloseIpcHandleCb), "zeMemCloseIpcHandle", 1 },
+        { ZE_TRACER_API_INDEX(Module, pfnCreateCb), "zeModuleCreate", 2 },
+        { ZE_TRACER_API_INDEX(Module, pfnDestroyCb), "zeModuleDestroy", 1 },
+        { ZE_TRACER_API_INDEX(Module, pfnDynamicLinkCb), "zeModuleDynamicLink", 0 },
+        { ZE_TRACER_API_INDEX(ModuleBuildLog, pfnDestroyCb), "zeModuleBuildLogDestroy", 1 },
+        { ZE_TRACER_API_INDEX(ModuleBuildLog, pfnGetStringCb), "zeModuleBuildLogGetString", 1 },
+        { ZE_TRACER_API_INDEX(Module, pfnGetNativeBinaryCb), "zeModuleGetNativeBinary", 1 },
+        { ZE_TRACER_API_INDEX(Module, pfnGetGlobalPointerCb), "zeModuleGetGlobalPointer", 1 },
+        { ZE_TRACER_API_INDEX(Module, pfnGetKernelNamesCb), "zeModuleGetKernelNames", 1 },
+        { ZE_TRACER_API_INDEX(Module, pfnGetPropertiesCb), "zeModuleGetProperties", 1 },
+        { ZE_TRACER_API_INDEX(Kernel, pfnCreateCb), "zeKernelCreate", 1 },
+        { ZE_TRACER_API_INDEX(Kernel, pfnDestroyCb), "zeKernelDestroy", 1 },
+        { ZE_TRACER_API_INDEX(Module, pfnGetFunctionPointerCb), "zeModuleGetFunctionPointer", 1 },
+        { ZE_TRACER_API_INDEX(Kernel, pfnSetGroupSizeCb), "zeKernelSetGroupSize", 1 },
+        { ZE_TRACER_API_INDEX(Kernel, pfnSuggestGroupSizeCb), "zeKernelSuggestGroupSize", 1 },
+        { ZE_TRACER_API_INDEX(Kernel, pfnSuggestMaxCooperativeGroupCountCb), "zeKernelSuggestMaxCooperativeGroupCount", 1 },
+        { ZE_TRACER_API_INDEX(Kernel, pfnSetArgumentValueCb), "zeKernelSetArgumentValue", 1 },
+        { ZE_TRACER_API_INDEX(Kernel, pfnSetIndirectAccessCb), "zeKernelSetIndirectAccess", 1 },
+        { ZE_TRACER_API_INDEX(Kernel, pfnGetIndirectAccessCb), "zeKernelGetIndirectAccess", 1 },
+        { ZE_TRACER_API_INDEX(Kernel, pfnGetSourceAttributesCb), "zeKernelGetSourceAttributes", 1 },
+        { ZE_TRACER_API_INDEX(Kernel, pfnSetCacheConfigCb), "zeKernelSetCacheConfig", 1 },
+        { ZE_TRACER_API_INDEX(Kernel, pfnGetPropertiesCb), "zeKernelGetProperties", 1 },
+        { ZE_TRACER_API_INDEX(Kernel, pfnGetNameCb), "zeKernelGetName", 1 },
+        { ZE_TRACER_API_INDEX(CommandList, pfnAppendLaunchKernelCb), "zeCommandListAppendLaunchKernel", 3 },
+        { ZE_TRACER_API_INDEX(CommandList, pfnAppendLaunchCooperativeKernelCb), "zeCommandListAppendLaunchCooperativeKernel", 3 },
+        { ZE_TRACER_API_INDEX(CommandList, pfnAppendLaunchKernelIndirectCb), "zeCommandListAppendLaunchKernelIndirect", 3 },
+        { ZE_TRACER_API_INDEX(CommandList, pfnAppendLaunchMultipleKernelsIndirectCb), "zeCommandListAppendLaunchMultipleKernelsIndirect", 2 },
+        { ZE_TRACER_API_INDEX(Context, pfnMakeMemoryResidentCb), "zeContextMakeMemoryResident", 2 },
+        { ZE_TRACER_API_INDEX(Context, pfnEvictMemoryCb), "zeContextEvictMemory", 2 },
+        { ZE_TRACER_API_INDEX(Context, pfnMakeImageResidentCb), "zeContextMakeImageResident", 3 },
+        { ZE_TRACER_API_INDEX(Context, pfnEvictImageCb), "zeContextEvictImage", 3 },
+        { ZE_TRACER_API_INDEX(Sampler, pfnCreateCb), "zeSamplerCreate", 2 },
+        { ZE_TRACER_API_INDEX(Sampler, pfnDestroyCb), "zeSamplerDestroy", 1 },
+        { ZE_TRACER_API_INDEX(VirtualMem, pfnReserveCb), "zeVirtualMemReserve", 1 },
+        { ZE_TRACER_API_INDEX(VirtualMem, pfnFreeCb), "zeVirtualMemFree", 1 },
+        { ZE_TRACER_API_INDEX(VirtualMem, pfnQueryPageSizeCb), "zeVirtualMemQueryPageSize", 2 },
+        { ZE_TRACER_API_INDEX(PhysicalMem, pfnCreateCb), "zePhysicalMemCreate", 2 },
+        { ZE_TRACER_API_INDEX(PhysicalMem, pfnDestroyCb), "zePhysicalMemDestroy", 2 },
+        { ZE_TRACER_API_INDEX(VirtualMem, pfnMapCb), "zeVirtualMemMap", 2 },
+        { ZE_TRACER_API_INDEX(VirtualMem, pfnUnmapCb), "zeVirtualMemUnmap", 1 },
+        { ZE_TRACER_API_INDEX(VirtualMem, pfnSetAccessAttributeCb), "zeVirtualMemSetAccessAttribute", 1 },
+        { ZE_TRACER_API_INDEX(VirtualMem, pfnGetAccessAttributeCb), "zeVirtualMemGetAccessAttribute", 1 },
+        { ZE_TRACER_API_INDEX(Kernel, pfnSetGlobalOffsetExpCb), "zeKernelSetGlobalOffsetExp", 1 },
+        { ZE_TRACER_API_INDEX(Device, pfnReserveCacheExtCb), "zeDeviceReserveCacheExt", 1 },
+        { ZE_TRACER_API_INDEX(Device, pfnSetCacheAdviceExtCb), "zeDeviceSetCacheAdviceExt", 1 },
+        { ZE_TRACER_API_INDEX(Event, pfnQueryTimestampsExpCb), "zeEventQueryTimestampsExp", 2 },
+        { ZE_TRACER_API_INDEX(Image, pfnGetMemoryPropertiesExpCb), "zeImageGetMemoryPropertiesExp", 1 },
+        { ZE_TRACER_API_INDEX(Image, pfnViewCreateExtCb), "zeImageViewCreateExt", 3 },
+        { ZE_TRACER_API_INDEX(Image, pfnViewCreateExpCb), "zeImageViewCreateExp", 3 },
+        { ZE_TRACER_API_INDEX(Kernel, pfnSchedulingHintExpCb), "zeKernelSchedulingHintExp", 1 },
+        { ZE_TRACER_API_INDEX(Device, pfnPciGetPropertiesExtCb), "zeDevicePciGetPropertiesExt", 1 },
+        { ZE_TRACER_API_INDEX(CommandList, pfnAppendImageCopyToMemoryExtCb), "zeCommandListAppendImageCopyToMemoryExt", 3 },
+        { ZE_TRACER_API_INDEX(CommandList, pfnAppendImageCopyFromMemoryExtCb), "zeCommandListAppendImageCopyFromMemoryExt", 3 },
+        { ZE_TRACER_API_INDEX(Image, pfnGetAllocPropertiesExtCb), "zeImageGetAllocPropertiesExt", 2 },
+        { ZE_TRACER_API_INDEX(Module, pfnInspectLinkageExtCb), "zeModuleInspectLinkageExt", 0 },
+        { ZE_TRACER_API_INDEX(Mem, pfnFreeExtCb), "zeMemFreeExt", 1 },
+        { ZE_TRACER_API_INDEX(FabricVertex, pfnGetExpCb), "zeFabricVertexGetExp", 1 },
+        { ZE_TRACER_API_INDEX(FabricVertex, pfnGetSubVerticesExpCb), "zeFabricVertexGetSubVerticesExp", 1 },
+        { ZE_TRACER_API_INDEX(FabricVertex, pfnGetPropertiesExpCb), "zeFabricVertexGetPropertiesExp", 1 },
+        { ZE_TRACER_API_INDEX(FabricVertex, pfnGetDeviceExpCb), "zeFabricVertexGetDeviceExp", 1 },
+        { ZE_TRACER_API_INDEX(Device, pfnGetFabricVertexExpCb), "zeDeviceGetFabricVertexExp", 1 },
+        { ZE_TRACER_API_INDEX(FabricEdge, pfnGetExpCb), "zeFabricEdgeGetExp", 2 },
+        { ZE_TRACER_API_INDEX(FabricEdge, pfnGetVerticesExpCb), "zeFabricEdgeGetVerticesExp", 1 },
+        { ZE_TRACER_API_INDEX(FabricEdge, pfnGetPropertiesExpCb), "zeFabricEdgeGetPropertiesExp", 1 },
+        { ZE_TRACER_API_INDEX(Event, pfnQueryKernelTimestampsExtCb), "zeEventQueryKernelTimestampsExt", 2 },
+    };
+
+    const size_t zeTraceApiDescCount = sizeof(zeTraceApiDescs) / sizeof(zeTraceApiDescs[0]);
 
 } // namespace tracing_layer
 
@@ -0,0 +1,286 @@
+/*
+ *
+ * Copyright (C) 2021-2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file zes_tracing_cb_structs.h
+ *
+ */
+#ifndef zes_tracing_cb_structs_H
+#define zes_tracing_cb_structs_H
+#if defined(__cplusplus)
+#pragma once
+#endif
+
+#include "zes_api.h"
+#include "layers/zel_tracing_register_cb_zes.h"
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Table of Global callback functions pointers
+typedef struct _zel_zes_global_callbacks_t
+{
+    zes_pfnInitCb_t                                                 pfnInitCb;
+} zel_zes_global_callbacks_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Table of Device callback functions pointers
+typedef struct _zel_zes_device_callbacks_t
+{
+    zes_pfnDeviceGetPropertiesCb_t                                  pfnGetPropertiesCb;
+    zes_pfnDeviceGetStateCb_t                                       pfnGetStateCb;
+    zes_pfnDeviceResetCb_t                                          pfnResetCb;
+    zes_pfnDeviceProcessesGetStateCb_t                              pfnProcessesGetStateCb;
+    zes_pfnDevicePciGetPropertiesCb_t                               pfnPciGetPropertiesCb;
+    zes_pfnDevicePciGetStateCb_t                                    pfnPciGetStateCb;
+    zes_pfnDevicePciGetBarsCb_t                                     pfnPciGetBarsCb;
+    zes_pfnDevicePciGetStatsCb_t                                    pfnPciGetStatsCb;
+    zes_pfnDeviceEnumDiagnosticTestSuitesCb_t                       pfnEnumDiagnosticTestSuitesCb;
+    zes_pfnDeviceEnumEngineGroupsCb_t                               pfnEnumEngineGroupsCb;
+    zes_pfnDeviceEventRegisterCb_t                                  pfnEventRegisterCb;
+    zes_pfnDeviceEnumFabricPortsCb_t                                pfnEnumFabricPortsCb;
+    zes_pfnDeviceEnumFansCb_t                                       pfnEnumFansCb;
+    zes_pfnDeviceEnumFirmwaresCb_t                                  pfnEnumFirmwaresCb;
+    zes_pfnDeviceEnumFrequencyDomainsCb_t                           pfnEnumFrequencyDomainsCb;
+    zes_pfnDeviceEnumLedsCb_t                                       pfnEnumLedsCb;
+    zes_pfnDeviceEnumMemoryModulesCb_t                              pfnEnumMemoryModulesCb;
+    zes_pfnDeviceEnumPerformanceFactorDomainsCb_t                   pfnEnumPerformanceFactorDomainsCb;
+    zes_pfnDeviceEnumPowerDomainsCb_t                               pfnEnumPowerDomainsCb;
+    zes_pfnDeviceGetCardPowerDomainCb_t                             pfnGetCardPowerDomainCb;
+    zes_pfnDeviceEnumPsusCb_t                                       pfnEnumPsusCb;
+    zes_pfnDeviceEnumRasErrorSetsCb_t                               pfnEnumRasErrorSetsCb;
+    zes_pfnDeviceEnumSchedulersCb_t                                 pfnEnumSchedulersCb;
+    zes_pfnDeviceEnumStandbyDomainsCb_t                             pfnEnumStandbyDomainsCb;
+    zes_pfnDeviceEnumTemperatureSensorsCb_t                         pfnEnumTemperatureSensorsCb;
+    zes_pfnDeviceEccAvailableCb_t                                   pfnEccAvailableCb;
+    zes_pfnDeviceEccConfigurableCb_t                                pfnEccConfigurableCb;
+    zes_pfnDeviceGetEccStateCb_t                                    pfnGetEccStateCb;
+    zes_pfnDeviceSetEccStateCb_t                                    pfnSetEccStateCb;
+    zes_pfnDeviceGetCb_t                                            pfnGetCb;
+    zes_pfnDeviceSetOverclockWaiverCb_t                             pfnSetOverclockWaiverCb;
+    zes_pfnDeviceGetOverclockDomainsCb_t                            pfnGetOverclockDomainsCb;
+    zes_pfnDeviceGetOverclockControlsCb_t                           pfnGetOverclockControlsCb;
+    zes_pfnDeviceResetOverclockSettingsCb_t                         pfnResetOverclockSettingsCb;
+    zes_pfnDeviceReadOverclockStateCb_t                             pfnReadOverclockStateCb;
+    zes_pfnDeviceEnumOverclockDomainsCb_t                           pfnEnumOverclockDomainsCb;
+} zel_zes_device_callbacks_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Table of Driver callback functions pointers
+typedef struct _zel_zes_driver_callbacks_t
+{
+    zes_pfnDriverEventListenCb_t                                    pfnEventListenCb;
+    zes_pfnDriverEventListenExCb_t                                  pfnEventListenExCb;
+    zes_pfnDriverGetCb_t                                            pfnGetCb;
+} zel_zes_driver_callbacks_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Table of Diagnostics callback functions pointers
+typedef struct _zel_zes_diagnostics_callbacks_t
+{
+    zes_pfnDiagnosticsGetPropertiesCb_t                             pfnGetPropertiesCb;
+    zes_pfnDiagnosticsGetTestsCb_t                                  pfnGetTestsCb;
+    zes_pfnDiagnosticsRunTestsCb_t                                  pfnRunTestsCb;
+} zel_zes_diagnostics_callbacks_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Table of Engine callback functions pointers
+typedef struct _zel_zes_engine_callbacks_t
+{
+    zes_pfnEngineGetPropertiesCb_t                                  pfnGetPropertiesCb;
+    zes_pfnEngineGetActivityCb_t                                    pfnGetActivityCb;
+} zel_zes_engine_callbacks_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Table of FabricPort callback functions pointers
+typedef struct _zel_zes_fabric_port_callbacks_t
+{
+    zes_pfnFabricPortGetPropertiesCb_t                              pfnGetPropertiesCb;
+    zes_pfnFabricPortGetLinkTypeCb_t                                pfnGetLinkTypeCb;
+    zes_pfnFabricPortGetConfigCb_t                                  pfnGetConfigCb;
+    zes_pfnFabricPortSetConfigCb_t                                  pfnSetConfigCb;
+    zes_pfnFabricPortGetStateCb_t                                   pfnGetStateCb;
+    zes_pfnFabricPortGetThroughputCb_t                              pfnGetThroughputCb;
+} zel_zes_fabric_port_callbacks_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Table of Fan callback functions pointers
+typedef struct _zel_zes_fan_callbacks_t
+{
+    zes_pfnFanGetPropertiesCb_t                                     pfnGetPropertiesCb;
+    zes_pfnFanGetConfigCb_t                                         pfnGetConfigCb;
+    zes_pfnFanSetDefaultModeCb_t                                    pfnSetDefaultModeCb;
+    zes_pfnFanSetFixedSpeedModeCb_t                                 pfnSetFixedSpeedModeCb;
+    zes_pfnFanSetSpeedTableModeCb_t                                 pfnSetSpeedTableModeCb;
+    zes_pfnFanGetStateCb_t                                          pfnGetStateCb;
+} zel_zes_fan_callbacks_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Table of Firmware callback functions pointers
+typedef struct _zel_zes_firmware_callbacks_t
+{
+    zes_pfnFirmwareGetPropertiesCb_t                                pfnGetPropertiesCb;
+    zes_pfnFirmwareFlashCb_t                                        pfnFlashCb;
+} zel_zes_firmware_callbacks_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Table of Frequency callback functions pointers
+typedef struct _zel_zes_frequency_callbacks_t
+{
+    zes_pfnFrequencyGetPropertiesCb_t                               pfnGetPropertiesCb;
+    zes_pfnFrequencyGetAvailableClocksCb_t                          pfnGetAvailableClocksCb;
+    zes_pfnFrequencyGetRangeCb_t                                    pfnGetRangeCb;
+    zes_pfnFrequencySetRangeCb_t                                    pfnSetRangeCb;
+    zes_pfnFrequencyGetStateCb_t                                    pfnGetStateCb;
+    zes_pfnFrequencyGetThrottleTimeCb_t                             pfnGetThrottleTimeCb;
+    zes_pfnFrequencyOcGetCapabilitiesCb_t                           pfnOcGetCapabilitiesCb;
+    zes_pfnFrequencyOcGetFrequencyTargetCb_t                        pfnOcGetFrequencyTargetCb;
+    zes_pfnFrequencyOcSetFrequencyTargetCb_t                        pfnOcSetFrequencyTargetCb;
+    zes_pfnFrequencyOcGetVoltageTargetCb_t                          pfnOcGetVoltageTargetCb;
+    zes_pfnFrequencyOcSetVoltageTargetCb_t                          pfnOcSetVoltageTargetCb;
+    zes_pfnFrequencyOcSetModeCb_t                                   pfnOcSetModeCb;
+    zes_pfnFrequencyOcGetModeCb_t                                   pfnOcGetModeCb;
+    zes_pfnFrequencyOcGetIccMaxCb_t                                 pfnOcGetIccMaxCb;
+    zes_pfnFrequencyOcSetIccMaxCb_t                                 pfnOcSetIccMaxCb;
+    zes_pfnFrequencyOcGetTjMaxCb_t                                  pfnOcGetTjMaxCb;
+    zes_pfnFrequencyOcSetTjMaxCb_t                                  pfnOcSetTjMaxCb;
+} zel_zes_frequency_callbacks_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Table of Led callback functions pointers
+typedef struct _zel_zes_led_callbacks_t
+{
+    zes_pfnLedGetPropertiesCb_t                                     pfnGetPropertiesCb;
+    zes_pfnLedGetStateCb_t                                          pfnGetStateCb;
+    zes_pfnLedSetStateCb_t                                          pfnSetStateCb;
+    zes_pfnLedSetColorCb_t                                          pfnSetColorCb;
+} zel_zes_led_callbacks_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Table of Memory callback functions pointers
+typedef struct _zel_zes_memory_callbacks_t
+{
+    zes_pfnMemoryGetPropertiesCb_t                                  pfnGetPropertiesCb;
+    zes_pfnMemoryGetStateCb_t                                       pfnGetStateCb;
+    zes_pfnMemoryGetBandwidthCb_t                                   pfnGetBandwidthCb;
+} zel_zes_memory_callbacks_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Table of Overclock callback functions pointers
+typedef struct _zel_zes_overclock_callbacks_t
+{
+    zes_pfnOverclockGetDomainPropertiesCb_t                         pfnGetDomainPropertiesCb;
+    zes_pfnOverclockGetDomainVFPropertiesCb_t                       pfnGetDomainVFPropertiesCb;
+    zes_pfnOverclockGetDomainControlPropertiesCb_t                  pfnGetDomainControlPropertiesCb;
+    zes_pfnOverclockGetControlCurrentValueCb_t                      pfnGetControlCurrentValueCb;
+    zes_pfnOverclockGetControlPendingValueCb_t                      pfnGetControlPendingValueCb;
+    zes_pfnOverclockSetControlUserValueCb_t                         pfnSetControlUserValueCb;
+    zes_pfnOverclockGetControlStateCb_t                             pfnGetControlStateCb;
+    zes_pfnOverclockGetVFPointValuesCb_t                            pfnGetVFPointValuesCb;
+    zes_pfnOverclockSetVFPointValuesCb_t                            pfnSetVFPointValuesCb;
+} zel_zes_overclock_callbacks_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Table of PerformanceFactor callback functions pointers
+typedef struct _zel_zes_performance_factor_callbacks_t
+{
+    zes_pfnPerformanceFactorGetPropertiesCb_t                       pfnGetPropertiesCb;
+    zes_pfnPerformanceFactorGetConfigCb_t                           pfnGetConfigCb;
+    zes_pfnPerformanceFactorSetConfigCb_t                           pfnSetConfigCb;
+} zel_zes_performance_factor_callbacks_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Table of Power callback functions pointers
+typedef struct _zel_zes_power_callbacks_t
+{
+    zes_pfnPowerGetPropertiesCb_t                                   pfnGetPropertiesCb;
+    zes_pfnPowerGetEnergyCounterCb_t                                pfnGetEnergyCounterCb;
+    zes_pfnPowerGetLimitsCb_t                                       pfnGetLimitsCb;
+    zes_pfnPowerSetLimitsCb_t                                       pfnSetLimitsCb;
+    zes_pfnPowerGetEnergyThresholdCb_t                              pfnGetEnergyThresholdCb;
+    zes_pfnPowerSetEnergyThresholdCb_t                              pfnSetEnergyThresholdCb;
+    zes_pfnPowerGetLimitsExtCb_t                                    pfnGetLimitsExtCb;
+    zes_pfnPowerSetLimitsExtCb_t                                    pfnSetLimitsExtCb;
+} zel_zes_power_callbacks_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Table of Psu callback functions pointers
+typedef struct _zel_zes_psu_callbacks_t
+{
+    zes_pfnPsuGetPropertiesCb_t                                     pfnGetPropertiesCb;
+    zes_pfnPsuGetStateCb_t                                          pfnGetStateCb;
+} zel_zes_psu_callbacks_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Table of Ras callback functions pointers
+typedef struct _zel_zes_ras_callbacks_t
+{
+    zes_pfnRasGetPropertiesCb_t                                     pfnGetPropertiesCb;
+    zes_pfnRasGetConfigCb_t                                         pfnGetConfigCb;
+    zes_pfnRasSetConfigCb_t                                         pfnSetConfigCb;
+    zes_pfnRasGetStateCb_t                                          pfnGetStateCb;
+} zel_zes_ras_callbacks_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Table of Scheduler callback functions pointers
+typedef struct _zel_zes_scheduler_callbacks_t
+{
+    zes_pfnSchedulerGetPropertiesCb_t                               pfnGetPropertiesCb;
+    zes_pfnSchedulerGetCurrentModeCb_t                              pfnGetCurrentModeCb;
+    zes_pfnSchedulerGetTimeoutModePropertiesCb_t                    pfnGetTimeoutModePropertiesCb;
+    zes_pfnSchedulerGetTimesliceModePropertiesCb_t                  pfnGetTimesliceModePropertiesCb;
+    zes_pfnSchedulerSetTimeoutModeCb_t                              pfnSetTimeoutModeCb;
+    zes_pfnSchedulerSetTimesliceModeCb_t                            pfnSetTimesliceModeCb;
+    zes_pfnSchedulerSetExclusiveModeCb_t                            pfnSetExclusiveModeCb;
+    zes_pfnSchedulerSetComputeUnitDebugModeCb_t                     pfnSetComputeUnitDebugModeCb;
+} zel_zes_scheduler_callbacks_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Table of Standby callback functions pointers
+typedef struct _zel_zes_standby_callbacks_t
+{
+    zes_pfnStandbyGetPropertiesCb_t                                 pfnGetPropertiesCb;
+    zes_pfnStandbyGetModeCb_t                                       pfnGetModeCb;
+    zes_pfnStandbySetModeCb_t                                       pfnSetModeCb;
+} zel_zes_standby_callbacks_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Table of Temperature callback functions pointers
+typedef struct _zel_zes_temperature_callbacks_t
+{
+    zes_pfnTemperatureGetPropertiesCb_t                             pfnGetPropertiesCb;
+    zes_pfnTemperatureGetConfigCb_t                                 pfnGetConfigCb;
+    zes_pfnTemperatureSetConfigCb_t                                 pfnSetConfigCb;
+    zes_pfnTemperatureGetStateCb_t                                  pfnGetStateCb;
+} zel_zes_temperature_callbacks_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Container for all callbacks
+typedef struct _zel_all_sysman_callbacks_t
+{
+    zel_zes_global_callbacks_t          Global;
+    zel_zes_device_callbacks_t          Device;
+    zel_zes_driver_callbacks_t          Driver;
+    zel_zes_diagnostics_callbacks_t     Diagnostics;
+    zel_zes_engine_callbacks_t          Engine;
+    zel_zes_fabric_port_callbacks_t     FabricPort;
+    zel_zes_fan_callbacks_t             Fan;
+    zel_zes_firmware_callbacks_t        Firmware;
+    zel_zes_frequency_callbacks_t       Frequency;
+    zel_zes_led_callbacks_t             Led;
+    zel_zes_memory_callbacks_t          Memory;
+    zel_zes_overclock_callbacks_t       Overclock;
+    zel_zes_performance_factor_callbacks_t  PerformanceFactor;
+    zel_zes_power_callbacks_t           Power;
+    zel_zes_psu_callbacks_t             Psu;
+    zel_zes_ras_callbacks_t             Ras;
+    zel_zes_scheduler_callbacks_t       Scheduler;
+    zel_zes_standby_callbacks_t         Standby;
+    zel_zes_temperature_callbacks_t     Temperature;
+} zel_all_sysman_callbacks_t;
+
+
+
+#endif // zes_tracing_cb_structs_H
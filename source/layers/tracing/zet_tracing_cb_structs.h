@@ -0,0 +1,154 @@
+/*
+ *
+ * Copyright (C) 2021-2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file zet_tracing_cb_structs.h
+ *
+ */
+#ifndef zet_tracing_cb_structs_H
+#define zet_tracing_cb_structs_H
+#if defined(__cplusplus)
+#pragma once
+#endif
+
+#include "zet_api.h"
+#include "layers/zel_tracing_register_cb_zet.h"
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Table of Device callback functions pointers
+typedef struct _zel_zet_device_callbacks_t
+{
+    zet_pfnDeviceGetDebugPropertiesCb_t                             pfnGetDebugPropertiesCb;
+} zel_zet_device_callbacks_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Table of Context callback functions pointers
+typedef struct _zel_zet_context_callbacks_t
+{
+    zet_pfnContextActivateMetricGroupsCb_t                          pfnActivateMetricGroupsCb;
+} zel_zet_context_callbacks_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Table of CommandList callback functions pointers
+typedef struct _zel_zet_command_list_callbacks_t
+{
+    zet_pfnCommandListAppendMetricStreamerMarkerCb_t                pfnAppendMetricStreamerMarkerCb;
+    zet_pfnCommandListAppendMetricQueryBeginCb_t                    pfnAppendMetricQueryBeginCb;
+    zet_pfnCommandListAppendMetricQueryEndCb_t                      pfnAppendMetricQueryEndCb;
+    zet_pfnCommandListAppendMetricMemoryBarrierCb_t                 pfnAppendMetricMemoryBarrierCb;
+} zel_zet_command_list_callbacks_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Table of Kernel callback functions pointers
+typedef struct _zel_zet_kernel_callbacks_t
+{
+    zet_pfnKernelGetProfileInfoCb_t                                 pfnGetProfileInfoCb;
+} zel_zet_kernel_callbacks_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Table of Module callback functions pointers
+typedef struct _zel_zet_module_callbacks_t
+{
+    zet_pfnModuleGetDebugInfoCb_t                                   pfnGetDebugInfoCb;
+} zel_zet_module_callbacks_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Table of Debug callback functions pointers
+typedef struct _zel_zet_debug_callbacks_t
+{
+    zet_pfnDebugAttachCb_t                                          pfnAttachCb;
+    zet_pfnDebugDetachCb_t                                          pfnDetachCb;
+    zet_pfnDebugReadEventCb_t                                       pfnReadEventCb;
+    zet_pfnDebugAcknowledgeEventCb_t                                pfnAcknowledgeEventCb;
+    zet_pfnDebugInterruptCb_t                                       pfnInterruptCb;
+    zet_pfnDebugResumeCb_t                                          pfnResumeCb;
+    zet_pfnDebugReadMemoryCb_t                                      pfnReadMemoryCb;
+    zet_pfnDebugWriteMemoryCb_t                                     pfnWriteMemoryCb;
+    zet_pfnDebugGetRegisterSetPropertiesCb_t                        pfnGetRegisterSetPropertiesCb;
+    zet_pfnDebugReadRegistersCb_t                                   pfnReadRegistersCb;
+    zet_pfnDebugWriteRegistersCb_t                                  pfnWriteRegistersCb;
+    zet_pfnDebugGetThreadRegisterSetPropertiesCb_t                  pfnGetThreadRegisterSetPropertiesCb;
+} zel_zet_debug_callbacks_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Table of Metric callback functions pointers
+typedef struct _zel_zet_metric_callbacks_t
+{
+    zet_pfnMetricGetCb_t                                            pfnGetCb;
+    zet_pfnMetricGetPropertiesCb_t                                  pfnGetPropertiesCb;
+} zel_zet_metric_callbacks_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Table of MetricGroup callback functions pointers
+typedef struct _zel_zet_metric_group_callbacks_t
+{
+    zet_pfnMetricGroupGetCb_t                                       pfnGetCb;
+    zet_pfnMetricGroupGetPropertiesCb_t                             pfnGetPropertiesCb;
+    zet_pfnMetricGroupCalculateMetricValuesCb_t                     pfnCalculateMetricValuesCb;
+    zet_pfnMetricGroupCalculateMultipleMetricValuesExpCb_t          pfnCalculateMultipleMetricValuesExpCb;
+    zet_pfnMetricGroupGetGlobalTimestampsExpCb_t                    pfnGetGlobalTimestampsExpCb;
+} zel_zet_metric_group_callbacks_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Table of MetricQuery callback functions pointers
+typedef struct _zel_zet_metric_query_callbacks_t
+{
+    zet_pfnMetricQueryCreateCb_t                                    pfnCreateCb;
+    zet_pfnMetricQueryDestroyCb_t                                   pfnDestroyCb;
+    zet_pfnMetricQueryResetCb_t                                     pfnResetCb;
+    zet_pfnMetricQueryGetDataCb_t                                   pfnGetDataCb;
+} zel_zet_metric_query_callbacks_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Table of MetricQueryPool callback functions pointers
+typedef struct _zel_zet_metric_query_pool_callbacks_t
+{
+    zet_pfnMetricQueryPoolCreateCb_t                                pfnCreateCb;
+    zet_pfnMetricQueryPoolDestroyCb_t                               pfnDestroyCb;
+} zel_zet_metric_query_pool_callbacks_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Table of MetricStreamer callback functions pointers
+typedef struct _zel_zet_metric_streamer_callbacks_t
+{
+    zet_pfnMetricStreamerOpenCb_t                                   pfnOpenCb;
+    zet_pfnMetricStreamerCloseCb_t                                  pfnCloseCb;
+    zet_pfnMetricStreamerReadDataCb_t                               pfnReadDataCb;
+} zel_zet_metric_streamer_callbacks_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Table of TracerExp callback functions pointers
+typedef struct _zel_zet_tracer_exp_callbacks_t
+{
+    zet_pfnTracerExpCreateCb_t                                      pfnCreateCb;
+    zet_pfnTracerExpDestroyCb_t                                     pfnDestroyCb;
+    zet_pfnTracerExpSetProloguesCb_t                                pfnSetProloguesCb;
+    zet_pfnTracerExpSetEpiloguesCb_t                                pfnSetEpiloguesCb;
+    zet_pfnTracerExpSetEnabledCb_t                                  pfnSetEnabledCb;
+} zel_zet_tracer_exp_callbacks_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Container for all callbacks
+typedef struct _zel_all_tools_callbacks_t
+{
+    zel_zet_device_callbacks_t          Device;
+    zel_zet_context_callbacks_t         Context;
+    zel_zet_command_list_callbacks_t    CommandList;
+    zel_zet_kernel_callbacks_t          Kernel;
+    zel_zet_module_callbacks_t          Module;
+    zel_zet_debug_callbacks_t           Debug;
+    zel_zet_metric_callbacks_t          Metric;
+    zel_zet_metric_group_callbacks_t    MetricGroup;
+    zel_zet_metric_query_callbacks_t    MetricQuery;
+    zel_zet_metric_query_pool_callbacks_t   MetricQueryPool;
+    zel_zet_metric_streamer_callbacks_t MetricStreamer;
+    zel_zet_tracer_exp_callbacks_t      TracerExp;
+} zel_all_tools_callbacks_t;
+
+
+
+#endif // zet_tracing_cb_structs_H
@@ -10,8 +10,12 @@
 #include "ze_handle_lifetime.h"
 #include "zes_handle_lifetime.h"
 #include "zet_handle_lifetime.h"
+#include <atomic>
+#include <cstdint>
 #include <memory>
-#include <unordered_map>
+#include <mutex>
+#include <utility>
+#include <vector>
 
 namespace validation_layer {
 
@@ -19,6 +23,203 @@ typedef struct _zel_handle_state_t {
   bool is_open;
 } zel_handle_state_t;
 
+//
+// Handles of one type that are alive, with their state, in an
+// open-addressing table keyed by the handle value. Validation looks a handle
+// up on every call that takes it, so lookups take no lock: they probe the
+// slots, each holding a handle and its state, and are retried if a rehash
+// moved the slots meanwhile. Creating and destroying handles, which is far
+// rarer, is serialized by a lock. Destroyed handles leave a tombstone, so
+// the slots of live handles never move outside a rehash.
+//
+template <typename THandle> class HandleStateMap {
+public:
+  HandleStateMap() { table.store(createTable(minCapacity), std::memory_order_release); }
+
+  // the handle values used to mark slots are never inserted
+  void insert(THandle handle, zel_handle_state_t state = {}) {
+    uintptr_t key = reinterpret_cast<uintptr_t>(handle);
+    if (key == emptyKey || key == tombstoneKey)
+      return;
+
+    std::lock_guard<std::mutex> lock(writerMutex);
+    Slot *slot = findSlot(table.load(std::memory_order_relaxed), key);
+    if (slot != nullptr) {
+      slot->state.store(state, std::memory_order_relaxed);
+      return;
+    }
+    if (usedCount + 1 > table.load(std::memory_order_relaxed)->capacity / 2)
+      rehash();
+
+    Table *current = table.load(std::memory_order_relaxed);
+    for (size_t index = getIndex(current, key);; index = (index + 1) & (current->capacity - 1)) {
+      uintptr_t slotKey = current->slots[index].key.load(std::memory_order_relaxed);
+      if (slotKey != emptyKey && slotKey != tombstoneKey)
+        continue;
+      if (slotKey == emptyKey)
+        usedCount++;
+      current->slots[index].state.store(state, std::memory_order_relaxed);
+      current->slots[index].key.store(key, std::memory_order_release);
+      liveCount++;
+      return;
+    }
+  }
+  void erase(THandle handle) {
+    uintptr_t key = reinterpret_cast<uintptr_t>(handle);
+    if (key == emptyKey || key == tombstoneKey)
+      return;
+
+    std::lock_guard<std::mutex> lock(writerMutex);
+    Slot *slot = findSlot(table.load(std::memory_order_relaxed), key);
+    if (slot == nullptr)
+      return;
+    slot->key.store(tombstoneKey, std::memory_order_release);
+    liveCount--;
+  }
+  bool contains(THandle handle) {
+    zel_handle_state_t state;
+    return getState(handle, state);
+  }
+  bool getState(THandle handle, zel_handle_state_t &state) {
+    uintptr_t key = reinterpret_cast<uintptr_t>(handle);
+    if (key == emptyKey || key == tombstoneKey)
+      return false;
+    for (;;) {
+      uint64_t sequence = rehashSequence.load(std::memory_order_acquire);
+      Slot *slot = findSlot(table.load(std::memory_order_acquire), key);
+      zel_handle_state_t slotState = {};
+      if (slot != nullptr)
+        slotState = slot->state.load(std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if ((sequence & 1) == 0 &&
+          rehashSequence.load(std::memory_order_relaxed) == sequence) {
+        state = slotState;
+        return slot != nullptr;
+      }
+    }
+  }
+  // sets the state of a handle that is alive
+  void setState(THandle handle, zel_handle_state_t state) {
+    uintptr_t key = reinterpret_cast<uintptr_t>(handle);
+    if (key == emptyKey || key == tombstoneKey)
+      return;
+
+    std::lock_guard<std::mutex> lock(writerMutex);
+    Slot *slot = findSlot(table.load(std::memory_order_relaxed), key);
+    if (slot != nullptr)
+      slot->state.store(state, std::memory_order_relaxed);
+  }
+
+private:
+  // Slot markers. No object lives at address 1, so a handle with that value
+  // is never valid; it is never tracked and always reported invalid.
+  static const uintptr_t emptyKey = 0;
+  static const uintptr_t tombstoneKey = 1;
+  static const size_t minCapacity = 64;
+
+  struct Slot {
+    std::atomic<uintptr_t> key;
+    std::atomic<zel_handle_state_t> state;
+  };
+  struct Table {
+    size_t capacity;
+    unsigned shift;
+    std::unique_ptr<Slot[]> slots;
+  };
+
+  // handles are allocation addresses: the high bits of a multiplicative
+  // hash spread objects allocated together over the table
+  static size_t getIndex(const Table *current, uintptr_t key) {
+    return static_cast<size_t>((static_cast<uint64_t>(key) * 0x9E3779B97F4A7C15ull) >>
+                               current->shift);
+  }
+
+  // the probe stops at an empty slot, or after the whole table while a
+  // rehash is rewriting it under a reader
+  static Slot *findSlot(Table *current, uintptr_t key) {
+    size_t index = getIndex(current, key);
+    for (size_t probe = 0; probe < current->capacity; probe++) {
+      uintptr_t slotKey = current->slots[index].key.load(std::memory_order_acquire);
+      if (slotKey == key)
+        return &current->slots[index];
+      if (slotKey == emptyKey)
+        return nullptr;
+      index = (index + 1) & (current->capacity - 1);
+    }
+    return nullptr;
+  }
+
+  Table *createTable(size_t capacity) {
+    Table *created = new Table;
+    created->capacity = capacity;
+    created->shift = 64;
+    for (size_t c = capacity; c > 1; c >>= 1)
+      created->shift--;
+    created->slots.reset(new Slot[capacity]);
+    for (size_t i = 0; i < capacity; i++) {
+      created->slots[i].key.store(emptyKey, std::memory_order_relaxed);
+      created->slots[i].state.store({}, std::memory_order_relaxed);
+    }
+    tables.emplace_back(created);
+    return created;
+  }
+
+  //
+  // Drop the tombstones, growing the table when live handles fill more
+  // than a quarter of it. Readers may still probe an outgrown table, so
+  // tables are kept until the map is destroyed. The memory is bounded by
+  // the peak number of live handles, not by the number of handles ever
+  // tracked: a table only grows past 4 slots per live handle, so the current
+  // one has fewer than 8 slots per peak live handle, and since tables double
+  // the outgrown ones together are smaller than the current one. That is
+  // under 16 slots, or 256 bytes, per peak live handle.
+  //
+  void rehash() {
+    Table *current = table.load(std::memory_order_relaxed);
+    std::vector<std::pair<uintptr_t, zel_handle_state_t>> live;
+    live.reserve(liveCount);
+    for (size_t i = 0; i < current->capacity; i++) {
+      uintptr_t slotKey = current->slots[i].key.load(std::memory_order_relaxed);
+      if (slotKey != emptyKey && slotKey != tombstoneKey)
+        live.emplace_back(slotKey, current->slots[i].state.load(std::memory_order_relaxed));
+    }
+
+    rehashSequence.store(rehashSequence.load(std::memory_order_relaxed) + 1,
+                         std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    Table *rehashed = current;
+    if ((live.size() + 1) * 4 > current->capacity)
+      rehashed = createTable(current->capacity * 2);
+    else
+      for (size_t i = 0; i < current->capacity; i++)
+        current->slots[i].key.store(emptyKey, std::memory_order_relaxed);
+    for (auto &entry : live) {
+      size_t index = getIndex(rehashed, entry.first);
+      while (rehashed->slots[index].key.load(std::memory_order_relaxed) != emptyKey)
+        index = (index + 1) & (rehashed->capacity - 1);
+      rehashed->slots[index].state.store(entry.second, std::memory_order_relaxed);
+      rehashed->slots[index].key.store(entry.first, std::memory_order_relaxed);
+    }
+    usedCount = live.size();
+    table.store(rehashed, std::memory_order_release);
+
+    rehashSequence.store(rehashSequence.load(std::memory_order_relaxed) + 1,
+                         std::memory_order_release);
+  }
+
+  std::atomic<Table *> table;
+  // odd while a rehash is moving slots
+  std::atomic<uint64_t> rehashSequence{0};
+
+  std::mutex writerMutex;
+  std::vector<std::unique_ptr<Table>> tables;
+  size_t liveCount = 0;
+  size_t usedCount = 0; // live handles and tombstones
+};
+
+// IPC and external memory handles are structures passed by value, with no
+// address of their own to track, so they are not tracked.
 class HandleLifetimeValidation {
 public:
   ZEHandleLifetimeValidation zeHandleLifetime;
@@ -26,137 +227,123 @@ public:
   ZETHandleLifetimeValidation zetHandleLifetime;
 
   void addHandle(ze_context_handle_t handle) {
-    contextHandleStateMap.insert({handle, nullptr});
+    contextHandleStateMap.insert(handle);
   }
   void addHandle(ze_driver_handle_t handle) {
-    driverHandleStateMap.insert({handle, nullptr});
+    driverHandleStateMap.insert(handle);
   }
   void addHandle(ze_device_handle_t handle) {
-    deviceHandleStateMap.insert({handle, nullptr});
+    deviceHandleStateMap.insert(handle);
   }
   void addHandle(ze_command_queue_handle_t handle) {
-    commandQueueHandleStateMap.insert({handle, nullptr});
+    commandQueueHandleStateMap.insert(handle);
   }
   void addHandle(ze_command_list_handle_t handle, bool is_open = true) {
-    commandListHandleStateMap.insert(
-        {handle, std::make_unique<zel_handle_state_t>()});
-    commandListHandleStateMap[handle]->is_open = is_open;
+    commandListHandleStateMap.insert(handle, {is_open});
   }
   void addHandle(ze_fence_handle_t handle) {
-    fenceHandleStateMap.insert({handle, nullptr});
+    fenceHandleStateMap.insert(handle);
   }
   void addHandle(ze_event_pool_handle_t handle) {
-    eventPoolHandleStateMap.insert({handle, nullptr});
+    eventPoolHandleStateMap.insert(handle);
   }
   void addHandle(ze_event_handle_t handle) {
-    eventHandleStateMap.insert({handle, nullptr});
+    eventHandleStateMap.insert(handle);
   }
   void addHandle(ze_image_handle_t handle) {
-    imageHandleStateMap.insert({handle, nullptr});
+    imageHandleStateMap.insert(handle);
   }
   void addHandle(ze_module_handle_t handle) {
-    moduleHandleStateMap.insert({handle, nullptr});
+    moduleHandleStateMap.insert(handle);
   }
   void addHandle(ze_module_build_log_handle_t handle) {
-    moduleBuildLogHandleStateMap.insert({handle, nullptr});
+    moduleBuildLogHandleStateMap.insert(handle);
   }
   void addHandle(ze_kernel_handle_t handle) {
-    kernelHandleStateMap.insert({handle, nullptr});
+    kernelHandleStateMap.insert(handle);
   }
   void addHandle(ze_sampler_handle_t handle) {
-    samplerHandleStateMap.insert({handle, nullptr});
+    samplerHandleStateMap.insert(handle);
   }
   void addHandle(ze_fabric_vertex_handle_t handle) {
-    fabricVertexHandleStateMap.insert({handle, nullptr});
+    fabricVertexHandleStateMap.insert(handle);
   }
   void addHandle(ze_fabric_edge_handle_t handle) {
-    fabricEdgeHandleStateMap.insert({handle, nullptr});
+    fabricEdgeHandleStateMap.insert(handle);
   }
   void addHandle(ze_physical_mem_handle_t handle) {
-    physicalMemHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(ze_ipc_event_pool_handle_t handle) {
-    ipcEventPoolHandleStateMap.insert({&handle, nullptr});
-  }
-  void addHandle(ze_ipc_mem_handle_t handle) {
-    ipcMemHandleStateMap.insert({&handle, nullptr});
-  }
-  void addHandle(ze_external_memory_import_win32_handle_t &handle) {
-    externalMemoryImportWin32HandleStateMap.insert({&handle, nullptr});
-  }
-  void addHandle(ze_external_memory_export_win32_handle_t &handle) {
-    externalMemoryExportWin32HandleStateMap.insert({&handle, nullptr});
+    physicalMemHandleStateMap.insert(handle);
   }
 
   void addHandle(zet_metric_group_handle_t handle) {
-    metricGroupHandleStateMap.insert({handle, nullptr});
+    metricGroupHandleStateMap.insert(handle);
   }
   void addHandle(zet_metric_handle_t handle) {
-    metricHandleStateMap.insert({handle, nullptr});
+    metricHandleStateMap.insert(handle);
   }
   void addHandle(zet_metric_streamer_handle_t handle) {
-    metricStreamerHandleStateMap.insert({handle, nullptr});
+    metricStreamerHandleStateMap.insert(handle);
   }
   void addHandle(zet_metric_query_pool_handle_t handle) {
-    metricQueryPoolHandleStateMap.insert({handle, nullptr});
+    metricQueryPoolHandleStateMap.insert(handle);
   }
   void addHandle(zet_metric_query_handle_t handle) {
-    metricQueryHandleStateMap.insert({handle, nullptr});
+    metricQueryHandleStateMap.insert(handle);
   }
   void addHandle(zet_tracer_exp_handle_t handle) {
-    tracerExpHandleStateMap.insert({handle, nullptr});
+    tracerExpHandleStateMap.insert(handle);
   }
   void addHandle(zet_debug_session_handle_t handle) {
-    debugSessionHandleStateMap.insert({handle, nullptr});
+    debugSessionHandleStateMap.insert(handle);
   }
 
   void addHandle(zes_sched_handle_t handle) {
-    schedHandleStateMap.insert({handle, nullptr});
+    schedHandleStateMap.insert(handle);
   }
   void addHandle(zes_perf_handle_t handle) {
-    perfHandleStateMap.insert({handle, nullptr});
+    perfHandleStateMap.insert(handle);
   }
   void addHandle(zes_pwr_handle_t handle) {
-    pwrHandleStateMap.insert({handle, nullptr});
+    pwrHandleStateMap.insert(handle);
   }
   void addHandle(zes_freq_handle_t handle) {
-    freqHandleStateMap.insert({handle, nullptr});
+    freqHandleStateMap.insert(handle);
   }
   void addHandle(zes_engine_handle_t handle) {
-    engineHandleStateMap.insert({handle, nullptr});
+    engineHandleStateMap.insert(handle);
   }
   void addHandle(zes_standby_handle_t handle) {
-    standbyHandleStateMap.insert({handle, nullptr});
+    standbyHandleStateMap.insert(handle);
   }
   void addHandle(zes_firmware_handle_t handle) {
-    firmwareHandleStateMap.insert({handle, nullptr});
+    firmwareHandleStateMap.insert(handle);
   }
   void addHandle(zes_mem_handle_t handle) {
-    memHandleStateMap.insert({handle, nullptr});
+    memHandleStateMap.insert(handle);
   }
   void addHandle(zes_fabric_port_handle_t handle) {
-    fabricPortHandleStateMap.insert({handle, nullptr});
+    fabricPortHandleStateMap.insert(handle);
   }
   void addHandle(zes_temp_handle_t handle) {
-    tempHandleStateMap.insert({handle, nullptr});
+    tempHandleStateMap.insert(handle);
   }
   void addHandle(zes_psu_handle_t handle) {
-    psuHandleStateMap.insert({handle, nullptr});
+    psuHandleStateMap.insert(handle);
   }
   void addHandle(zes_fan_handle_t handle) {
-    fanHandleStateMap.insert({handle, nullptr});
+    fanHandleStateMap.insert(handle);
   }
   void addHandle(zes_led_handle_t handle) {
-    ledHandleStateMap.insert({handle, nullptr});
+    ledHandleStateMap.insert(handle);
   }
   void addHandle(zes_ras_handle_t handle) {
-    rasHandleStateMap.insert({handle, nullptr});
+    rasHandleStateMap.insert(handle);
   }
   void addHandle(zes_diag_handle_t handle) {
-    diagHandleStateMap.insert({handle, nullptr});
+    diagHandleStateMap.insert(handle);
   }
   void addHandle(zes_overclock_handle_t handle) {
-    overclockHandleStateMap.insert({handle, nullptr});
+    overclockHandleStateMap.insert(handle);
   }
 
   void removeHandle(ze_context_handle_t handle) {
@@ -207,18 +394,6 @@ public:
   void removeHandle(ze_fabric_edge_handle_t handle) {
     fabricEdgeHandleStateMap.erase(handle);
   }
-  void removeHandle(ze_ipc_mem_handle_t &handle) {
-    ipcMemHandleStateMap.erase(&handle);
-  }
-  void removeHandle(ze_ipc_event_pool_handle_t &handle) {
-    ipcEventPoolHandleStateMap.erase(&handle);
-  }
-  void removeHandle(ze_external_memory_export_win32_handle_t &handle) {
-    externalMemoryExportWin32HandleStateMap.erase(&handle);
-  }
-  void removeHandle(ze_external_memory_import_win32_handle_t &handle) {
-    externalMemoryImportWin32HandleStateMap.erase(&handle);
-  }
 
   void removeHandle(zet_metric_group_handle_t handle) {
     metricGroupHandleStateMap.erase(handle);
@@ -292,294 +467,195 @@ public:
   }
 
   bool isHandleValid(ze_context_handle_t handle) {
-    return contextHandleStateMap.find(handle) != contextHandleStateMap.end();
+    return contextHandleStateMap.contains(handle);
   }
   bool isHandleValid(ze_driver_handle_t handle) {
-    return driverHandleStateMap.find(handle) != driverHandleStateMap.end();
+    return driverHandleStateMap.contains(handle);
   }
   bool isHandleValid(ze_device_handle_t handle) {
-    return deviceHandleStateMap.find(handle) != deviceHandleStateMap.end();
+    return deviceHandleStateMap.contains(handle);
   }
   bool isHandleValid(ze_command_queue_handle_t handle) {
-    return commandQueueHandleStateMap.find(handle) !=
-           commandQueueHandleStateMap.end();
+    return commandQueueHandleStateMap.contains(handle);
   }
   bool isHandleValid(ze_command_list_handle_t handle) {
-    return commandListHandleStateMap.find(handle) !=
-           commandListHandleStateMap.end();
+    return commandListHandleStateMap.contains(handle);
   }
   bool isHandleValid(ze_fence_handle_t handle) {
-    return fenceHandleStateMap.find(handle) != fenceHandleStateMap.end();
+    return fenceHandleStateMap.contains(handle);
   }
   bool isHandleValid(ze_event_pool_handle_t handle) {
-    return eventPoolHandleStateMap.find(handle) !=
-           eventPoolHandleStateMap.end();
+    return eventPoolHandleStateMap.contains(handle);
   }
   bool isHandleValid(ze_event_handle_t handle) {
-    return eventHandleStateMap.find(handle) != eventHandleStateMap.end();
+    return eventHandleStateMap.contains(handle);
   }
   bool isHandleValid(ze_image_handle_t handle) {
-    return imageHandleStateMap.find(handle) != imageHandleStateMap.end();
+    return imageHandleStateMap.contains(handle);
   }
   bool isHandleValid(ze_module_handle_t handle) {
-    return moduleHandleStateMap.find(handle) != moduleHandleStateMap.end();
+    return moduleHandleStateMap.contains(handle);
   }
   bool isHandleValid(ze_module_build_log_handle_t handle) {
-    return moduleBuildLogHandleStateMap.find(handle) !=
-           moduleBuildLogHandleStateMap.end();
+    return moduleBuildLogHandleStateMap.contains(handle);
   }
   bool isHandleValid(ze_kernel_handle_t handle) {
-    return kernelHandleStateMap.find(handle) != kernelHandleStateMap.end();
+    return kernelHandleStateMap.contains(handle);
   }
   bool isHandleValid(ze_sampler_handle_t handle) {
-    return samplerHandleStateMap.find(handle) != samplerHandleStateMap.end();
+    return samplerHandleStateMap.contains(handle);
   }
   bool isHandleValid(ze_physical_mem_handle_t handle) {
-    return physicalMemHandleStateMap.find(handle) !=
-           physicalMemHandleStateMap.end();
+    return physicalMemHandleStateMap.contains(handle);
   }
   bool isHandleValid(ze_fabric_vertex_handle_t handle) {
-    return fabricVertexHandleStateMap.find(handle) !=
-           fabricVertexHandleStateMap.end();
+    return fabricVertexHandleStateMap.contains(handle);
   }
   bool isHandleValid(ze_fabric_edge_handle_t handle) {
-    return fabricEdgeHandleStateMap.find(handle) !=
-           fabricEdgeHandleStateMap.end();
-  }
-  bool isHandleValid(ze_ipc_mem_handle_t &handle) {
-    return ipcMemHandleStateMap.find(&handle) != ipcMemHandleStateMap.end();
-  }
-  bool isHandleValid(ze_ipc_event_pool_handle_t &handle) {
-    return ipcEventPoolHandleStateMap.find(&handle) !=
-           ipcEventPoolHandleStateMap.end();
-  }
-  bool isHandleValid(ze_external_memory_import_win32_handle_t &handle) {
-    return externalMemoryImportWin32HandleStateMap.find(&handle) !=
-           externalMemoryImportWin32HandleStateMap.end();
-  }
-  bool isHandleValid(ze_external_memory_export_win32_handle_t &handle) {
-    return externalMemoryExportWin32HandleStateMap.find(&handle) !=
-           externalMemoryExportWin32HandleStateMap.end();
+    return fabricEdgeHandleStateMap.contains(handle);
   }
 
   bool isHandleValid(zet_metric_group_handle_t handle) {
-    return metricGroupHandleStateMap.find(handle) !=
-           metricGroupHandleStateMap.end();
+    return metricGroupHandleStateMap.contains(handle);
   }
   bool isHandleValid(zet_metric_handle_t handle) {
-    return metricHandleStateMap.find(handle) != metricHandleStateMap.end();
+    return metricHandleStateMap.contains(handle);
   }
   bool isHandleValid(zet_metric_streamer_handle_t handle) {
-    return metricStreamerHandleStateMap.find(handle) !=
-           metricStreamerHandleStateMap.end();
+    return metricStreamerHandleStateMap.contains(handle);
   }
   bool isHandleValid(zet_metric_query_pool_handle_t handle) {
-    return metricQueryPoolHandleStateMap.find(handle) !=
-           metricQueryPoolHandleStateMap.end();
+    return metricQueryPoolHandleStateMap.contains(handle);
   }
   bool isHandleValid(zet_metric_query_handle_t handle) {
-    return metricQueryHandleStateMap.find(handle) !=
-           metricQueryHandleStateMap.end();
+    return metricQueryHandleStateMap.contains(handle);
   }
   bool isHandleValid(zet_tracer_exp_handle_t handle) {
-    return tracerExpHandleStateMap.find(handle) !=
-           tracerExpHandleStateMap.end();
+    return tracerExpHandleStateMap.contains(handle);
   }
   bool isHandleValid(zet_debug_session_handle_t handle) {
-    return debugSessionHandleStateMap.find(handle) !=
-           debugSessionHandleStateMap.end();
+    return debugSessionHandleStateMap.contains(handle);
   }
 
   bool isHandleValid(zes_sched_handle_t handle) {
-    return schedHandleStateMap.find(handle) != schedHandleStateMap.end();
+    return schedHandleStateMap.contains(handle);
   }
   bool isHandleValid(zes_perf_handle_t handle) {
-    return perfHandleStateMap.find(handle) != perfHandleStateMap.end();
+    return perfHandleStateMap.contains(handle);
   }
   bool isHandleValid(zes_pwr_handle_t handle) {
-    return pwrHandleStateMap.find(handle) != pwrHandleStateMap.end();
+    return pwrHandleStateMap.contains(handle);
   }
   bool isHandleValid(zes_freq_handle_t handle) {
-    return freqHandleStateMap.find(handle) != freqHandleStateMap.end();
+    return freqHandleStateMap.contains(handle);
   }
   bool isHandleValid(zes_engine_handle_t handle) {
-    return engineHandleStateMap.find(handle) != engineHandleStateMap.end();
+    return engineHandleStateMap.contains(handle);
   }
   bool isHandleValid(zes_standby_handle_t handle) {
-    return standbyHandleStateMap.find(handle) != standbyHandleStateMap.end();
+    return standbyHandleStateMap.contains(handle);
   }
   bool isHandleValid(zes_firmware_handle_t handle) {
-    return firmwareHandleStateMap.find(handle) != firmwareHandleStateMap.end();
+    return firmwareHandleStateMap.contains(handle);
   }
   bool isHandleValid(zes_mem_handle_t handle) {
-    return memHandleStateMap.find(handle) != memHandleStateMap.end();
+    return memHandleStateMap.contains(handle);
   }
   bool isHandleValid(zes_fabric_port_handle_t handle) {
-    return fabricPortHandleStateMap.find(handle) !=
-           fabricPortHandleStateMap.end();
+    return fabricPortHandleStateMap.contains(handle);
   }
   bool isHandleValid(zes_temp_handle_t handle) {
-    return tempHandleStateMap.find(handle) != tempHandleStateMap.end();
+    return tempHandleStateMap.contains(handle);
   }
   bool isHandleValid(zes_psu_handle_t handle) {
-    return psuHandleStateMap.find(handle) != psuHandleStateMap.end();
+    return psuHandleStateMap.contains(handle);
   }
   bool isHandleValid(zes_fan_handle_t handle) {
-    return fanHandleStateMap.find(handle) != fanHandleStateMap.end();
+    return fanHandleStateMap.contains(handle);
   }
   bool isHandleValid(zes_led_handle_t handle) {
-    return ledHandleStateMap.find(handle) != ledHandleStateMap.end();
+    return ledHandleStateMap.contains(handle);
   }
   bool isHandleValid(zes_ras_handle_t handle) {
-    return rasHandleStateMap.find(handle) != rasHandleStateMap.end();
+    return rasHandleStateMap.contains(handle);
   }
   bool isHandleValid(zes_diag_handle_t handle) {
-    return diagHandleStateMap.find(handle) != diagHandleStateMap.end();
+    return diagHandleStateMap.contains(handle);
   }
   bool isHandleValid(zes_overclock_handle_t handle) {
-    return overclockHandleStateMap.find(handle) !=
-           overclockHandleStateMap.end();
+    return overclockHandleStateMap.contains(handle);
   }
 
   bool isOpen(ze_command_list_handle_t handle) {
-    return commandListHandleStateMap[handle]->is_open;
+    zel_handle_state_t state = {};
+    return commandListHandleStateMap.getState(handle, state) && state.is_open;
+  }
+  // validity and state of a command list in one lookup
+  bool getState(ze_command_list_handle_t handle, zel_handle_state_t &state) {
+    return commandListHandleStateMap.getState(handle, state);
   }
   void close(ze_command_list_handle_t handle) {
-    commandListHandleStateMap[handle]->is_open = false;
+    commandListHandleStateMap.setState(handle, {false});
   }
   void reset(ze_command_list_handle_t handle) {
-    commandListHandleStateMap[handle]->is_open = true;
+    commandListHandleStateMap.setState(handle, {true});
   }
 
 private:
-  std::unordered_map<ze_context_handle_t, std::unique_ptr<zel_handle_state_t>>
-      contextHandleStateMap;
-  std::unordered_map<ze_driver_handle_t, std::unique_ptr<zel_handle_state_t>>
-      driverHandleStateMap;
-  std::unordered_map<ze_device_handle_t, std::unique_ptr<zel_handle_state_t>>
-      deviceHandleStateMap;
-  std::unordered_map<ze_command_queue_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      commandQueueHandleStateMap;
-  std::unordered_map<ze_command_list_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      commandListHandleStateMap;
-  std::unordered_map<ze_fence_handle_t, std::unique_ptr<zel_handle_state_t>>
-      fenceHandleStateMap;
-  std::unordered_map<ze_event_pool_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      eventPoolHandleStateMap;
-  std::unordered_map<ze_event_handle_t, std::unique_ptr<zel_handle_state_t>>
-      eventHandleStateMap;
-  std::unordered_map<ze_image_handle_t, std::unique_ptr<zel_handle_state_t>>
-      imageHandleStateMap;
-  std::unordered_map<ze_module_handle_t, std::unique_ptr<zel_handle_state_t>>
-      moduleHandleStateMap;
-  std::unordered_map<ze_module_build_log_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      moduleBuildLogHandleStateMap;
-  std::unordered_map<ze_kernel_handle_t, std::unique_ptr<zel_handle_state_t>>
-      kernelHandleStateMap;
-  std::unordered_map<ze_sampler_handle_t, std::unique_ptr<zel_handle_state_t>>
-      samplerHandleStateMap;
-  std::unordered_map<ze_physical_mem_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      physicalMemHandleStateMap;
-
-  std::unordered_map<ze_fabric_vertex_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      fabricVertexHandleStateMap;
-  std::unordered_map<ze_fabric_edge_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      fabricEdgeHandleStateMap;
-
-  std::unordered_map<ze_ipc_event_pool_handle_t *,
-                     std::unique_ptr<zel_handle_state_t>>
-      ipcEventPoolHandleStateMap;
-  std::unordered_map<ze_ipc_mem_handle_t *, std::unique_ptr<zel_handle_state_t>>
-      ipcMemHandleStateMap;
-
-  std::unordered_map<ze_external_memory_import_win32_handle_t *,
-                     std::unique_ptr<zel_handle_state_t>>
-      externalMemoryImportWin32HandleStateMap;
-  std::unordered_map<ze_external_memory_export_win32_handle_t *,
-                     std::unique_ptr<zel_handle_state_t>>
-      externalMemoryExportWin32HandleStateMap;
+  HandleStateMap<ze_context_handle_t> contextHandleStateMap;
+  HandleStateMap<ze_driver_handle_t> driverHandleStateMap;
+  HandleStateMap<ze_device_handle_t> deviceHandleStateMap;
+  HandleStateMap<ze_command_queue_handle_t> commandQueueHandleStateMap;
+  HandleStateMap<ze_command_list_handle_t> commandListHandleStateMap;
+  HandleStateMap<ze_fence_handle_t> fenceHandleStateMap;
+  HandleStateMap<ze_event_pool_handle_t> eventPoolHandleStateMap;
+  HandleStateMap<ze_event_handle_t> eventHandleStateMap;
+  HandleStateMap<ze_image_handle_t> imageHandleStateMap;
+  HandleStateMap<ze_module_handle_t> moduleHandleStateMap;
+  HandleStateMap<ze_module_build_log_handle_t> moduleBuildLogHandleStateMap;
+  HandleStateMap<ze_kernel_handle_t> kernelHandleStateMap;
+  HandleStateMap<ze_sampler_handle_t> samplerHandleStateMap;
+  HandleStateMap<ze_physical_mem_handle_t> physicalMemHandleStateMap;
+
+  HandleStateMap<ze_fabric_vertex_handle_t> fabricVertexHandleStateMap;
+  HandleStateMap<ze_fabric_edge_handle_t> fabricEdgeHandleStateMap;
+
+
 
   // tools
-  std::unordered_map<zet_driver_handle_t, std::unique_ptr<zel_handle_state_t>>
-      zetDriverHandleStateMap;
-  std::unordered_map<zet_device_handle_t, std::unique_ptr<zel_handle_state_t>>
-      zetDeviceHandleStateMap;
-  std::unordered_map<zet_context_handle_t, std::unique_ptr<zel_handle_state_t>>
-      zetContextHandleStateMap;
-  std::unordered_map<zet_command_list_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      zetCommandListHandleStateMap;
-  std::unordered_map<zet_module_handle_t, std::unique_ptr<zel_handle_state_t>>
-      zetModuleHandleStateMap;
-  std::unordered_map<zet_kernel_handle_t, std::unique_ptr<zel_handle_state_t>>
-      zetKernelHandleStateMap;
-  std::unordered_map<zet_metric_group_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      metricGroupHandleStateMap;
-  std::unordered_map<zet_metric_handle_t, std::unique_ptr<zel_handle_state_t>>
-      metricHandleStateMap;
-  std::unordered_map<zet_metric_streamer_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      metricStreamerHandleStateMap;
-  std::unordered_map<zet_metric_query_pool_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      metricQueryPoolHandleStateMap;
-  std::unordered_map<zet_metric_query_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      metricQueryHandleStateMap;
-  std::unordered_map<zet_tracer_exp_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      tracerExpHandleStateMap;
-  std::unordered_map<zet_debug_session_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      debugSessionHandleStateMap;
+  HandleStateMap<zet_driver_handle_t> zetDriverHandleStateMap;
+  HandleStateMap<zet_device_handle_t> zetDeviceHandleStateMap;
+  HandleStateMap<zet_context_handle_t> zetContextHandleStateMap;
+  HandleStateMap<zet_command_list_handle_t> zetCommandListHandleStateMap;
+  HandleStateMap<zet_module_handle_t> zetModuleHandleStateMap;
+  HandleStateMap<zet_kernel_handle_t> zetKernelHandleStateMap;
+  HandleStateMap<zet_metric_group_handle_t> metricGroupHandleStateMap;
+  HandleStateMap<zet_metric_handle_t> metricHandleStateMap;
+  HandleStateMap<zet_metric_streamer_handle_t> metricStreamerHandleStateMap;
+  HandleStateMap<zet_metric_query_pool_handle_t> metricQueryPoolHandleStateMap;
+  HandleStateMap<zet_metric_query_handle_t> metricQueryHandleStateMap;
+  HandleStateMap<zet_tracer_exp_handle_t> tracerExpHandleStateMap;
+  HandleStateMap<zet_debug_session_handle_t> debugSessionHandleStateMap;
 
   // sysman
-  std::unordered_map<zes_driver_handle_t, std::unique_ptr<zel_handle_state_t>>
-      zesDriverHandleStateMap;
-  std::unordered_map<zes_device_handle_t, std::unique_ptr<zel_handle_state_t>>
-      zesDeviceHandleStateMap;
-  std::unordered_map<zes_sched_handle_t, std::unique_ptr<zel_handle_state_t>>
-      schedHandleStateMap;
-  std::unordered_map<zes_perf_handle_t, std::unique_ptr<zel_handle_state_t>>
-      perfHandleStateMap;
-  std::unordered_map<zes_pwr_handle_t, std::unique_ptr<zel_handle_state_t>>
-      pwrHandleStateMap;
-  std::unordered_map<zes_freq_handle_t, std::unique_ptr<zel_handle_state_t>>
-      freqHandleStateMap;
-  std::unordered_map<zes_engine_handle_t, std::unique_ptr<zel_handle_state_t>>
-      engineHandleStateMap;
-  std::unordered_map<zes_standby_handle_t, std::unique_ptr<zel_handle_state_t>>
-      standbyHandleStateMap;
-  std::unordered_map<zes_firmware_handle_t, std::unique_ptr<zel_handle_state_t>>
-      firmwareHandleStateMap;
-  std::unordered_map<zes_mem_handle_t, std::unique_ptr<zel_handle_state_t>>
-      memHandleStateMap;
-  std::unordered_map<zes_fabric_port_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      fabricPortHandleStateMap;
-  std::unordered_map<zes_temp_handle_t, std::unique_ptr<zel_handle_state_t>>
-      tempHandleStateMap;
-  std::unordered_map<zes_psu_handle_t, std::unique_ptr<zel_handle_state_t>>
-      psuHandleStateMap;
-  std::unordered_map<zes_fan_handle_t, std::unique_ptr<zel_handle_state_t>>
-      fanHandleStateMap;
-  std::unordered_map<zes_led_handle_t, std::unique_ptr<zel_handle_state_t>>
-      ledHandleStateMap;
-  std::unordered_map<zes_ras_handle_t, std::unique_ptr<zel_handle_state_t>>
-      rasHandleStateMap;
-  std::unordered_map<zes_diag_handle_t, std::unique_ptr<zel_handle_state_t>>
-      diagHandleStateMap;
-  std::unordered_map<zes_overclock_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      overclockHandleStateMap;
+  HandleStateMap<zes_driver_handle_t> zesDriverHandleStateMap;
+  HandleStateMap<zes_device_handle_t> zesDeviceHandleStateMap;
+  HandleStateMap<zes_sched_handle_t> schedHandleStateMap;
+  HandleStateMap<zes_perf_handle_t> perfHandleStateMap;
+  HandleStateMap<zes_pwr_handle_t> pwrHandleStateMap;
+  HandleStateMap<zes_freq_handle_t> freqHandleStateMap;
+  HandleStateMap<zes_engine_handle_t> engineHandleStateMap;
+  HandleStateMap<zes_standby_handle_t> standbyHandleStateMap;
+  HandleStateMap<zes_firmware_handle_t> firmwareHandleStateMap;
+  HandleStateMap<zes_mem_handle_t> memHandleStateMap;
+  HandleStateMap<zes_fabric_port_handle_t> fabricPortHandleStateMap;
+  HandleStateMap<zes_temp_handle_t> tempHandleStateMap;
+  HandleStateMap<zes_psu_handle_t> psuHandleStateMap;
+  HandleStateMap<zes_fan_handle_t> fanHandleStateMap;
+  HandleStateMap<zes_led_handle_t> ledHandleStateMap;
+  HandleStateMap<zes_ras_handle_t> rasHandleStateMap;
+  HandleStateMap<zes_diag_handle_t> diagHandleStateMap;
+  HandleStateMap<zes_overclock_handle_t> overclockHandleStateMap;
 };
 
 } // namespace validation_layer
@@ -553,10 +553,11 @@ namespace validation_layer
         )
     { 
         
-        if ( !context.handleLifetime->isHandleValid( hCommandList )){
+        zel_handle_state_t hCommandListState;
+        if ( !context.handleLifetime->getState( hCommandList, hCommandListState )){
                 return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
-        if (!context.handleLifetime->isOpen( hCommandList )){
+        if (!hCommandListState.is_open){
             return ZE_RESULT_ERROR_INVALID_ARGUMENT;
         }
         if (hSignalEvent && !context.handleLifetime->isHandleValid( hSignalEvent )){
@@ -598,10 +599,11 @@ namespace validation_layer
         )
     { 
         
-        if ( !context.handleLifetime->isHandleValid( hCommandList )){
+        zel_handle_state_t hCommandListState;
+        if ( !context.handleLifetime->getState( hCommandList, hCommandListState )){
                 return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
-        if (!context.handleLifetime->isOpen( hCommandList )){
+        if (!hCommandListState.is_open){
             return ZE_RESULT_ERROR_INVALID_ARGUMENT;
         }
         if (hSignalEvent && !context.handleLifetime->isHandleValid( hSignalEvent )){
@@ -628,10 +630,11 @@ namespace validation_layer
         )
     { 
         
-        if ( !context.handleLifetime->isHandleValid( hCommandList )){
+        zel_handle_state_t hCommandListState;
+        if ( !context.handleLifetime->getState( hCommandList, hCommandListState )){
                 return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
-        if (!context.handleLifetime->isOpen( hCommandList )){
+        if (!hCommandListState.is_open){
             return ZE_RESULT_ERROR_INVALID_ARGUMENT;
         }
         if (hSignalEvent && !context.handleLifetime->isHandleValid( hSignalEvent )){
@@ -673,10 +676,11 @@ namespace validation_layer
         )
     { 
         
-        if ( !context.handleLifetime->isHandleValid( hCommandList )){
+        zel_handle_state_t hCommandListState;
+        if ( !context.handleLifetime->getState( hCommandList, hCommandListState )){
                 return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
-        if (!context.handleLifetime->isOpen( hCommandList )){
+        if (!hCommandListState.is_open){
             return ZE_RESULT_ERROR_INVALID_ARGUMENT;
         }
         if (hSignalEvent && !context.handleLifetime->isHandleValid( hSignalEvent )){
@@ -704,10 +708,11 @@ namespace validation_layer
         )
     { 
         
-        if ( !context.handleLifetime->isHandleValid( hCommandList )){
+        zel_handle_state_t hCommandListState;
+        if ( !context.handleLifetime->getState( hCommandList, hCommandListState )){
                 return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
-        if (!context.handleLifetime->isOpen( hCommandList )){
+        if (!hCommandListState.is_open){
             return ZE_RESULT_ERROR_INVALID_ARGUMENT;
         }
         if (hSignalEvent && !context.handleLifetime->isHandleValid( hSignalEvent )){
@@ -743,10 +748,11 @@ namespace validation_layer
         )
     { 
         
-        if ( !context.handleLifetime->isHandleValid( hCommandList )){
+        zel_handle_state_t hCommandListState;
+        if ( !context.handleLifetime->getState( hCommandList, hCommandListState )){
                 return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
-        if (!context.handleLifetime->isOpen( hCommandList )){
+        if (!hCommandListState.is_open){
             return ZE_RESULT_ERROR_INVALID_ARGUMENT;
         }
         if (hSignalEvent && !context.handleLifetime->isHandleValid( hSignalEvent )){
@@ -774,10 +780,11 @@ namespace validation_layer
         )
     { 
         
-        if ( !context.handleLifetime->isHandleValid( hCommandList )){
+        zel_handle_state_t hCommandListState;
+        if ( !context.handleLifetime->getState( hCommandList, hCommandListState )){
                 return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
-        if (!context.handleLifetime->isOpen( hCommandList )){
+        if (!hCommandListState.is_open){
             return ZE_RESULT_ERROR_INVALID_ARGUMENT;
         }
         if ( !context.handleLifetime->isHandleValid( hContextSrc )){
@@ -806,10 +813,11 @@ namespace validation_layer
         )
     { 
         
-        if ( !context.handleLifetime->isHandleValid( hCommandList )){
+        zel_handle_state_t hCommandListState;
+        if ( !context.handleLifetime->getState( hCommandList, hCommandListState )){
                 return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
-        if (!context.handleLifetime->isOpen( hCommandList )){
+        if (!hCommandListState.is_open){
             return ZE_RESULT_ERROR_INVALID_ARGUMENT;
         }
         if ( !context.handleLifetime->isHandleValid( hDstImage )){
@@ -843,10 +851,11 @@ namespace validation_layer
         )
     { 
         
-        if ( !context.handleLifetime->isHandleValid( hCommandList )){
+        zel_handle_state_t hCommandListState;
+        if ( !context.handleLifetime->getState( hCommandList, hCommandListState )){
                 return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
-        if (!context.handleLifetime->isOpen( hCommandList )){
+        if (!hCommandListState.is_open){
             return ZE_RESULT_ERROR_INVALID_ARGUMENT;
         }
         if ( !context.handleLifetime->isHandleValid( hDstImage )){
@@ -879,10 +888,11 @@ namespace validation_layer
         )
     { 
         
-        if ( !context.handleLifetime->isHandleValid( hCommandList )){
+        zel_handle_state_t hCommandListState;
+        if ( !context.handleLifetime->getState( hCommandList, hCommandListState )){
                 return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
-        if (!context.handleLifetime->isOpen( hCommandList )){
+        if (!hCommandListState.is_open){
             return ZE_RESULT_ERROR_INVALID_ARGUMENT;
         }
         if ( !context.handleLifetime->isHandleValid( hSrcImage )){
@@ -912,10 +922,11 @@ namespace validation_layer
         )
     { 
         
-        if ( !context.handleLifetime->isHandleValid( hCommandList )){
+        zel_handle_state_t hCommandListState;
+        if ( !context.handleLifetime->getState( hCommandList, hCommandListState )){
                 return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
-        if (!context.handleLifetime->isOpen( hCommandList )){
+        if (!hCommandListState.is_open){
             return ZE_RESULT_ERROR_INVALID_ARGUMENT;
         }
         if ( !context.handleLifetime->isHandleValid( hDstImage )){
@@ -939,10 +950,11 @@ namespace validation_layer
         )
     { 
         
-        if ( !context.handleLifetime->isHandleValid( hCommandList )){
+        zel_handle_state_t hCommandListState;
+        if ( !context.handleLifetime->getState( hCommandList, hCommandListState )){
                 return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
-        if (!context.handleLifetime->isOpen( hCommandList )){
+        if (!hCommandListState.is_open){
             return ZE_RESULT_ERROR_INVALID_ARGUMENT;
         }
         return ZE_RESULT_SUCCESS;
@@ -957,10 +969,11 @@ namespace validation_layer
         )
     { 
         
-        if ( !context.handleLifetime->isHandleValid( hCommandList )){
+        zel_handle_state_t hCommandListState;
+        if ( !context.handleLifetime->getState( hCommandList, hCommandListState )){
                 return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
-        if (!context.handleLifetime->isOpen( hCommandList )){
+        if (!hCommandListState.is_open){
             return ZE_RESULT_ERROR_INVALID_ARGUMENT;
         }
         if ( !context.handleLifetime->isHandleValid( hDevice )){
@@ -1088,10 +1101,11 @@ namespace validation_layer
         )
     { 
         
-        if ( !context.handleLifetime->isHandleValid( hCommandList )){
+        zel_handle_state_t hCommandListState;
+        if ( !context.handleLifetime->getState( hCommandList, hCommandListState )){
                 return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
-        if (!context.handleLifetime->isOpen( hCommandList )){
+        if (!hCommandListState.is_open){
             return ZE_RESULT_ERROR_INVALID_ARGUMENT;
         }
         if ( !context.handleLifetime->isHandleValid( hEvent )){
@@ -1108,10 +1122,11 @@ namespace validation_layer
         )
     { 
         
-        if ( !context.handleLifetime->isHandleValid( hCommandList )){
+        zel_handle_state_t hCommandListState;
+        if ( !context.handleLifetime->getState( hCommandList, hCommandListState )){
                 return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
-        if (!context.handleLifetime->isOpen( hCommandList )){
+        if (!hCommandListState.is_open){
             return ZE_RESULT_ERROR_INVALID_ARGUMENT;
         }
         for (size_t i = 0; ( nullptr != phEvents) && (i < numEvents); ++i){
@@ -1168,10 +1183,11 @@ namespace validation_layer
         )
     { 
         
-        if ( !context.handleLifetime->isHandleValid( hCommandList )){
+        zel_handle_state_t hCommandListState;
+        if ( !context.handleLifetime->getState( hCommandList, hCommandListState )){
                 return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
-        if (!context.handleLifetime->isOpen( hCommandList )){
+        if (!hCommandListState.is_open){
             return ZE_RESULT_ERROR_INVALID_ARGUMENT;
         }
         if ( !context.handleLifetime->isHandleValid( hEvent )){
@@ -1220,10 +1236,11 @@ namespace validation_layer
         )
     { 
         
-        if ( !context.handleLifetime->isHandleValid( hCommandList )){
+        zel_handle_state_t hCommandListState;
+        if ( !context.handleLifetime->getState( hCommandList, hCommandListState )){
                 return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
-        if (!context.handleLifetime->isOpen( hCommandList )){
+        if (!hCommandListState.is_open){
             return ZE_RESULT_ERROR_INVALID_ARGUMENT;
         }
         for (size_t i = 0; ( nullptr != phEvents) && (i < numEvents); ++i){
@@ -1856,10 +1873,11 @@ namespace validation_layer
         )
     { 
         
-        if ( !context.handleLifetime->isHandleValid( hCommandList )){
+        zel_handle_state_t hCommandListState;
+        if ( !context.handleLifetime->getState( hCommandList, hCommandListState )){
                 return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
-        if (!context.handleLifetime->isOpen( hCommandList )){
+        if (!hCommandListState.is_open){
             return ZE_RESULT_ERROR_INVALID_ARGUMENT;
         }
         if ( !context.handleLifetime->isHandleValid( hKernel )){
@@ -1888,10 +1906,11 @@ namespace validation_layer
         )
     { 
         
-        if ( !context.handleLifetime->isHandleValid( hCommandList )){
+        zel_handle_state_t hCommandListState;
+        if ( !context.handleLifetime->getState( hCommandList, hCommandListState )){
                 return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
-        if (!context.handleLifetime->isOpen( hCommandList )){
+        if (!hCommandListState.is_open){
             return ZE_RESULT_ERROR_INVALID_ARGUMENT;
         }
         if ( !context.handleLifetime->isHandleValid( hKernel )){
@@ -1921,10 +1940,11 @@ namespace validation_layer
         )
     { 
         
-        if ( !context.handleLifetime->isHandleValid( hCommandList )){
+        zel_handle_state_t hCommandListState;
+        if ( !context.handleLifetime->getState( hCommandList, hCommandListState )){
                 return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
-        if (!context.handleLifetime->isOpen( hCommandList )){
+        if (!hCommandListState.is_open){
             return ZE_RESULT_ERROR_INVALID_ARGUMENT;
         }
         if ( !context.handleLifetime->isHandleValid( hKernel )){
@@ -1958,10 +1978,11 @@ namespace validation_layer
         )
     { 
         
-        if ( !context.handleLifetime->isHandleValid( hCommandList )){
+        zel_handle_state_t hCommandListState;
+        if ( !context.handleLifetime->getState( hCommandList, hCommandListState )){
                 return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
-        if (!context.handleLifetime->isOpen( hCommandList )){
+        if (!hCommandListState.is_open){
             return ZE_RESULT_ERROR_INVALID_ARGUMENT;
         }
         for (size_t i = 0; ( nullptr != phKernels) && (i < numKernels); ++i){
@@ -2392,10 +2413,11 @@ namespace validation_layer
         )
     { 
         
-        if ( !context.handleLifetime->isHandleValid( hCommandList )){
+        zel_handle_state_t hCommandListState;
+        if ( !context.handleLifetime->getState( hCommandList, hCommandListState )){
                 return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
-        if (!context.handleLifetime->isOpen( hCommandList )){
+        if (!hCommandListState.is_open){
             return ZE_RESULT_ERROR_INVALID_ARGUMENT;
         }
         if ( !context.handleLifetime->isHandleValid( hSrcImage )){
@@ -2429,10 +2451,11 @@ namespace validation_layer
         )
     { 
         
-        if ( !context.handleLifetime->isHandleValid( hCommandList )){
+        zel_handle_state_t hCommandListState;
+        if ( !context.handleLifetime->getState( hCommandList, hCommandListState )){
                 return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
-        if (!context.handleLifetime->isOpen( hCommandList )){
+        if (!hCommandListState.is_open){
             return ZE_RESULT_ERROR_INVALID_ARGUMENT;
         }
         if ( !context.handleLifetime->isHandleValid( hDstImage )){
@@ -373,10 +373,11 @@ namespace validation_layer
         )
     { 
         
-        if ( !context.handleLifetime->isHandleValid( hCommandList )){
+        zel_handle_state_t hCommandListState;
+        if ( !context.handleLifetime->getState( hCommandList, hCommandListState )){
                 return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
-        if (!context.handleLifetime->isOpen( hCommandList )){
+        if (!hCommandListState.is_open){
             return ZE_RESULT_ERROR_INVALID_ARGUMENT;
         }
         if ( !context.handleLifetime->isHandleValid( hMetricStreamer )){
@@ -495,10 +496,11 @@ namespace validation_layer
         )
     { 
         
-        if ( !context.handleLifetime->isHandleValid( hCommandList )){
+        zel_handle_state_t hCommandListState;
+        if ( !context.handleLifetime->getState( hCommandList, hCommandListState )){
                 return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
-        if (!context.handleLifetime->isOpen( hCommandList )){
+        if (!hCommandListState.is_open){
             return ZE_RESULT_ERROR_INVALID_ARGUMENT;
         }
         if ( !context.handleLifetime->isHandleValid( hMetricQuery )){
@@ -516,10 +518,11 @@ namespace validation_layer
         )
     { 
         
-        if ( !context.handleLifetime->isHandleValid( hCommandList )){
+        zel_handle_state_t hCommandListState;
+        if ( !context.handleLifetime->getState( hCommandList, hCommandListState )){
                 return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
-        if (!context.handleLifetime->isOpen( hCommandList )){
+        if (!hCommandListState.is_open){
             return ZE_RESULT_ERROR_INVALID_ARGUMENT;
         }
         if ( !context.handleLifetime->isHandleValid( hMetricQuery )){
@@ -536,10 +539,11 @@ namespace validation_layer
         )
     { 
         
-        if ( !context.handleLifetime->isHandleValid( hCommandList )){
+        zel_handle_state_t hCommandListState;
+        if ( !context.handleLifetime->getState( hCommandList, hCommandListState )){
                 return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
-        if (!context.handleLifetime->isOpen( hCommandList )){
+        if (!hCommandListState.is_open){
             return ZE_RESULT_ERROR_INVALID_ARGUMENT;
         }
         return ZE_RESULT_SUCCESS;
@@ -1,6 +1,6 @@
 /*
  *
- * Copyright (C) 2019-2021 Intel Corporation
+ * Copyright (C) 2019-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,7 @@
  *
  */
 #include "ze_lib.h"
+#include <algorithm>
 #ifndef DYNAMIC_LOAD_LOADER
 #include "../loader/ze_loader_api.h"
 #endif
@@ -15,7 +16,13 @@
 namespace ze_lib
 {
     ///////////////////////////////////////////////////////////////////////////////
+#ifdef L0_STATIC_LOADER_BUILD
+    // a static archive runs no library constructor, see lib_init.cpp
+    static context_t staticContext;
+    context_t *context = &staticContext;
+#else
     context_t *context;
+#endif
     bool destruction = false;
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -65,41 +72,96 @@ namespace ze_lib
 
 #endif
 
-        if( ZE_RESULT_SUCCESS == result )
-        {
-            result = zeInit();
-        }
+        // the tracing layer's recorder and profiler see only the calls made
+        // through it
+        if( nullptr != tracing_lib )
+            tracingBuiltinsEnabled = getenv_tobool( "ZE_ENABLE_TRACING_RECORDER" ) ||
+                getenv_tobool( "ZE_ENABLE_TRACING_PROFILER" );
 
+        //Done before filling the DDI tables so that they dispatch
+        //directly to the driver if only one remains usable
         if( ZE_RESULT_SUCCESS == result )
-        {
-            result = zetInit();
-        }
+            result = CheckDrivers(flags, sysmanOnly);
 
-        if( ZE_RESULT_SUCCESS == result )
-        {
-            result = zesInit();
-        }
+        //The DDI tables are filled on first use, see loadTables
 
         if( ZE_RESULT_SUCCESS == result )
         {
-            result = zelTracingInit();
+            isInitialized = true;
         }
 
-        if( ZE_RESULT_SUCCESS == result && !sysmanOnly)
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// has the loader load the drivers admitted by flags; called by every
+    /// zeInit and zesInit, so that a later call with other flags adds the
+    /// drivers the earlier ones excluded
+    __zedlllocal ze_result_t context_t::CheckDrivers(ze_init_flags_t flags, bool sysmanOnly)
+    {
+        if( !sysmanOnly )
         {
             //Check which drivers support the ze_driver_flag_t specified
-            //No need to check if only initializing sysman  
-            result = zelLoaderDriverCheck(flags);
+            //No need to check if only initializing sysman
+            return zelLoaderDriverCheck(flags);
         }
 
-        if( ZE_RESULT_SUCCESS == result )
-        {
-            isInitialized = true;
-        }
+        //Drivers are loaded lazily; sysman needs all of them
+        return zelLoaderDriverLoad(0);
+    }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// fills a group of tables through the loader, once; a process using only
+    /// zes* never resolves the core and tools entry points
+    __zedlllocal ze_result_t context_t::loadTables( lazy_tables_t& tables, ze_result_t ( context_t::*init )() )
+    {
+        std::call_once( tables.once, [&]() {
+            tables.result = ( this->*init )();
+            if( ZE_RESULT_SUCCESS == tables.result )
+                tables.filled.store( true, std::memory_order_release );
+        });
+        return tables.result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// enables or disables a tracer in the tracing layer; the exported functions
+    /// only call through the tracing layer while some tracer is enabled
+    __zedlllocal ze_result_t context_t::tracerSetEnabled( zel_pfnTracerSetEnabled_t pfnSetEnabled,
+        zel_tracer_handle_t hTracer, ze_bool_t enable )
+    {
+        std::lock_guard<std::mutex> lock( tracingMutex );
+
+        auto result = pfnSetEnabled( hTracer, enable );
+        if( ZE_RESULT_SUCCESS != result )
+            return result;
+
+        auto it = std::find( enabledTracers.begin(), enabledTracers.end(), hTracer );
+        if( enable && it == enabledTracers.end() )
+            enabledTracers.push_back( hTracer );
+        else if( !enable && it != enabledTracers.end() )
+            enabledTracers.erase( it );
+
+        updateActiveTables();
         return result;
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// switches the exported functions between the DDI tables and the tracing
+    /// tables of each namespace whose tracing tables are loaded; both stay
+    /// allocated, so calls still running on the other table finish normally.
+    /// The tracing tables stay active while the trace recorder or the profiler
+    /// runs. Called with tracingMutex held.
+    __zedlllocal void context_t::updateActiveTables()
+    {
+        bool traced = tracingBuiltinsEnabled || !enabledTracers.empty();
+        zeActiveDdiTable.store( ( traced && zeTracingTablesLoaded ) ? &zeTracingDdiTable : &zeDdiTable,
+            std::memory_order_release );
+        zetActiveDdiTable.store( ( traced && zetTracingTablesLoaded ) ? &zetTracingDdiTable : &zetDdiTable,
+            std::memory_order_release );
+        zesActiveDdiTable.store( ( traced && zesTracingTablesLoaded ) ? &zesTracingDdiTable : &zesDdiTable,
+            std::memory_order_release );
+    }
+
 } // namespace ze_lib
 
 extern "C" {
@@ -1,6 +1,6 @@
 /*
  *
- * Copyright (C) 2019-2021 Intel Corporation
+ * Copyright (C) 2019-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -17,11 +17,21 @@
 #include "layers/zel_tracing_api.h"
 #include "layers/zel_tracing_ddi.h"
 #include "ze_util.h"
+#include <atomic>
 #include <vector>
 #include <mutex>
 
 namespace ze_lib
 {
+    ///////////////////////////////////////////////////////////////////////////////
+    /// group of DDI tables filled once, by the first call that needs it
+    struct lazy_tables_t
+    {
+        std::once_flag once;
+        ze_result_t result = ZE_RESULT_ERROR_UNINITIALIZED;
+        std::atomic<bool> filled { false };     ///< entries still empty are not supported
+    };
+
     ///////////////////////////////////////////////////////////////////////////////
     class context_t
     {
@@ -36,22 +46,61 @@ namespace ze_lib
         std::once_flag initOnce;
 
         ze_result_t Init(ze_init_flags_t flags, bool sysmanOnly);
+        ze_result_t CheckDrivers(ze_init_flags_t flags, bool sysmanOnly);
 
         ze_result_t zeInit();
+        ze_result_t zeLoadTables() { return loadTables( zeTables, &context_t::zeInit ); }
+        bool zeTablesFilled() const { return zeTables.filled.load( std::memory_order_acquire ); }
         ze_dditable_t   zeDdiTable = {};
+        std::atomic<ze_dditable_t *>    zeActiveDdiTable { &zeDdiTable };  ///< table the exported functions call through
 
         ze_result_t zetInit();
+        ze_result_t zetLoadTables() { return loadTables( zetTables, &context_t::zetInit ); }
+        bool zetTablesFilled() const { return zetTables.filled.load( std::memory_order_acquire ); }
         zet_dditable_t  zetDdiTable = {};
+        std::atomic<zet_dditable_t *>   zetActiveDdiTable { &zetDdiTable };
 
         ze_result_t zesInit();
+        ze_result_t zesLoadTables() { return loadTables( zesTables, &context_t::zesInit ); }
+        bool zesTablesFilled() const { return zesTables.filled.load( std::memory_order_acquire ); }
         zes_dditable_t  zesDdiTable = {};
+        std::atomic<zes_dditable_t *>   zesActiveDdiTable { &zesDdiTable };
 
         ze_result_t zelTracingInit();
+        ze_result_t zelTracingLoadTables() { return loadTables( zelTracingTables, &context_t::zelTracingInit ); }
         zel_tracing_dditable_t  zelTracingDdiTable = {};
 
+        ze_result_t zeTracingInit();
+        ze_dditable_t   zeTracingDdiTable = {};     ///< zeDdiTable intercepted by the tracing layer
+
+        ze_result_t zetTracingInit();
+        zet_dditable_t  zetTracingDdiTable = {};
+
+        ze_result_t zesTracingInit();
+        zes_dditable_t  zesTracingDdiTable = {};
+
+        ze_result_t tracerSetEnabled( zel_pfnTracerSetEnabled_t pfnSetEnabled, zel_tracer_handle_t hTracer, ze_bool_t enable );
+
+
         HMODULE tracing_lib = nullptr;
         bool isInitialized = false;
         bool inTeardown = false;
+
+    protected:
+        lazy_tables_t zeTables;
+        lazy_tables_t zetTables;
+        lazy_tables_t zesTables;
+        lazy_tables_t zelTracingTables;
+
+        ze_result_t loadTables( lazy_tables_t& tables, ze_result_t ( context_t::*init )() );
+
+        std::mutex tracingMutex;
+        bool zeTracingTablesLoaded = false;
+        bool zetTracingTablesLoaded = false;
+        bool zesTracingTablesLoaded = false;
+        bool tracingBuiltinsEnabled = false;
+        std::vector<zel_tracer_handle_t> enabledTracers;
+        void updateActiveTables();
     };
 
     extern context_t *context;
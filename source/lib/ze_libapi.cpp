@@ -44,24 +44,44 @@ zeInit(
                                                     ///< must be 0 (default) or a combination of ::ze_init_flag_t.
     )
 {
+    bool sysmanOnly = false;
     static ze_result_t result = ZE_RESULT_SUCCESS;
-    std::call_once(ze_lib::context->initOnce, [flags]() {
-        result = ze_lib::context->Init(flags, false);
-
+    bool initialized = false;
+    std::call_once(ze_lib::context->initOnce, [flags, sysmanOnly, &initialized]() {
+        result = ze_lib::context->Init(flags, sysmanOnly);
+        initialized = true;
     });
 
     if( ZE_RESULT_SUCCESS != result )
         return result;
 
+    // a later call may admit drivers the flags of the first one excluded
+    if( !initialized ) {
+        auto checkResult = ze_lib::context->CheckDrivers(flags, sysmanOnly);
+        if( ZE_RESULT_SUCCESS != checkResult )
+            return checkResult;
+    }
+
     if(ze_lib::context->inTeardown) {
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnInit = ze_lib::context->zeDdiTable.Global.pfnInit;
+    auto pfnInit = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Global.pfnInit;
     if( nullptr == pfnInit ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnInit = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Global.pfnInit;
+        if( nullptr == pfnInit )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -108,11 +128,22 @@ zeDriverGet(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGet = ze_lib::context->zeDdiTable.Driver.pfnGet;
+    auto pfnGet = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Driver.pfnGet;
     if( nullptr == pfnGet ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGet = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Driver.pfnGet;
+        if( nullptr == pfnGet )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -146,11 +177,22 @@ zeDriverGetApiVersion(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetApiVersion = ze_lib::context->zeDdiTable.Driver.pfnGetApiVersion;
+    auto pfnGetApiVersion = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Driver.pfnGetApiVersion;
     if( nullptr == pfnGetApiVersion ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetApiVersion = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Driver.pfnGetApiVersion;
+        if( nullptr == pfnGetApiVersion )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -188,11 +230,22 @@ zeDriverGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zeDdiTable.Driver.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Driver.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetProperties = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Driver.pfnGetProperties;
+        if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -226,11 +279,22 @@ zeDriverGetIpcProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetIpcProperties = ze_lib::context->zeDdiTable.Driver.pfnGetIpcProperties;
+    auto pfnGetIpcProperties = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Driver.pfnGetIpcProperties;
     if( nullptr == pfnGetIpcProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetIpcProperties = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Driver.pfnGetIpcProperties;
+        if( nullptr == pfnGetIpcProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -277,11 +341,22 @@ zeDriverGetExtensionProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetExtensionProperties = ze_lib::context->zeDdiTable.Driver.pfnGetExtensionProperties;
+    auto pfnGetExtensionProperties = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Driver.pfnGetExtensionProperties;
     if( nullptr == pfnGetExtensionProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetExtensionProperties = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Driver.pfnGetExtensionProperties;
+        if( nullptr == pfnGetExtensionProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -318,11 +393,22 @@ zeDriverGetExtensionFunctionAddress(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetExtensionFunctionAddress = ze_lib::context->zeDdiTable.Driver.pfnGetExtensionFunctionAddress;
+    auto pfnGetExtensionFunctionAddress = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Driver.pfnGetExtensionFunctionAddress;
     if( nullptr == pfnGetExtensionFunctionAddress ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetExtensionFunctionAddress = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Driver.pfnGetExtensionFunctionAddress;
+        if( nullptr == pfnGetExtensionFunctionAddress )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -363,11 +449,22 @@ zeDriverGetLastErrorDescription(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetLastErrorDescription = ze_lib::context->zeDdiTable.Driver.pfnGetLastErrorDescription;
+    auto pfnGetLastErrorDescription = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Driver.pfnGetLastErrorDescription;
     if( nullptr == pfnGetLastErrorDescription ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetLastErrorDescription = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Driver.pfnGetLastErrorDescription;
+        if( nullptr == pfnGetLastErrorDescription )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -413,11 +510,22 @@ zeDeviceGet(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGet = ze_lib::context->zeDdiTable.Device.pfnGet;
+    auto pfnGet = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGet;
     if( nullptr == pfnGet ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGet = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGet;
+        if( nullptr == pfnGet )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -466,11 +574,22 @@ zeDeviceGetSubDevices(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetSubDevices = ze_lib::context->zeDdiTable.Device.pfnGetSubDevices;
+    auto pfnGetSubDevices = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGetSubDevices;
     if( nullptr == pfnGetSubDevices ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetSubDevices = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGetSubDevices;
+        if( nullptr == pfnGetSubDevices )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -508,11 +627,22 @@ zeDeviceGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zeDdiTable.Device.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetProperties = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGetProperties;
+        if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -550,11 +680,22 @@ zeDeviceGetComputeProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetComputeProperties = ze_lib::context->zeDdiTable.Device.pfnGetComputeProperties;
+    auto pfnGetComputeProperties = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGetComputeProperties;
     if( nullptr == pfnGetComputeProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetComputeProperties = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGetComputeProperties;
+        if( nullptr == pfnGetComputeProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -588,11 +729,22 @@ zeDeviceGetModuleProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetModuleProperties = ze_lib::context->zeDdiTable.Device.pfnGetModuleProperties;
+    auto pfnGetModuleProperties = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGetModuleProperties;
     if( nullptr == pfnGetModuleProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetModuleProperties = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGetModuleProperties;
+        if( nullptr == pfnGetModuleProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -646,11 +798,22 @@ zeDeviceGetCommandQueueGroupProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetCommandQueueGroupProperties = ze_lib::context->zeDdiTable.Device.pfnGetCommandQueueGroupProperties;
+    auto pfnGetCommandQueueGroupProperties = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGetCommandQueueGroupProperties;
     if( nullptr == pfnGetCommandQueueGroupProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetCommandQueueGroupProperties = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGetCommandQueueGroupProperties;
+        if( nullptr == pfnGetCommandQueueGroupProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -703,11 +866,22 @@ zeDeviceGetMemoryProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetMemoryProperties = ze_lib::context->zeDdiTable.Device.pfnGetMemoryProperties;
+    auto pfnGetMemoryProperties = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGetMemoryProperties;
     if( nullptr == pfnGetMemoryProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetMemoryProperties = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGetMemoryProperties;
+        if( nullptr == pfnGetMemoryProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -745,11 +919,22 @@ zeDeviceGetMemoryAccessProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetMemoryAccessProperties = ze_lib::context->zeDdiTable.Device.pfnGetMemoryAccessProperties;
+    auto pfnGetMemoryAccessProperties = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGetMemoryAccessProperties;
     if( nullptr == pfnGetMemoryAccessProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetMemoryAccessProperties = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGetMemoryAccessProperties;
+        if( nullptr == pfnGetMemoryAccessProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -795,11 +980,22 @@ zeDeviceGetCacheProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetCacheProperties = ze_lib::context->zeDdiTable.Device.pfnGetCacheProperties;
+    auto pfnGetCacheProperties = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGetCacheProperties;
     if( nullptr == pfnGetCacheProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetCacheProperties = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGetCacheProperties;
+        if( nullptr == pfnGetCacheProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -834,11 +1030,22 @@ zeDeviceGetImageProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetImageProperties = ze_lib::context->zeDdiTable.Device.pfnGetImageProperties;
+    auto pfnGetImageProperties = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGetImageProperties;
     if( nullptr == pfnGetImageProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetImageProperties = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGetImageProperties;
+        if( nullptr == pfnGetImageProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -872,11 +1079,22 @@ zeDeviceGetExternalMemoryProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetExternalMemoryProperties = ze_lib::context->zeDdiTable.Device.pfnGetExternalMemoryProperties;
+    auto pfnGetExternalMemoryProperties = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGetExternalMemoryProperties;
     if( nullptr == pfnGetExternalMemoryProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetExternalMemoryProperties = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGetExternalMemoryProperties;
+        if( nullptr == pfnGetExternalMemoryProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -913,11 +1131,22 @@ zeDeviceGetP2PProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetP2PProperties = ze_lib::context->zeDdiTable.Device.pfnGetP2PProperties;
+    auto pfnGetP2PProperties = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGetP2PProperties;
     if( nullptr == pfnGetP2PProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetP2PProperties = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGetP2PProperties;
+        if( nullptr == pfnGetP2PProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -967,11 +1196,22 @@ zeDeviceCanAccessPeer(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCanAccessPeer = ze_lib::context->zeDdiTable.Device.pfnCanAccessPeer;
+    auto pfnCanAccessPeer = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Device.pfnCanAccessPeer;
     if( nullptr == pfnCanAccessPeer ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnCanAccessPeer = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Device.pfnCanAccessPeer;
+        if( nullptr == pfnCanAccessPeer )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1009,11 +1249,22 @@ zeDeviceGetStatus(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetStatus = ze_lib::context->zeDdiTable.Device.pfnGetStatus;
+    auto pfnGetStatus = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGetStatus;
     if( nullptr == pfnGetStatus ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetStatus = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGetStatus;
+        if( nullptr == pfnGetStatus )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1052,11 +1303,22 @@ zeDeviceGetGlobalTimestamps(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetGlobalTimestamps = ze_lib::context->zeDdiTable.Device.pfnGetGlobalTimestamps;
+    auto pfnGetGlobalTimestamps = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGetGlobalTimestamps;
     if( nullptr == pfnGetGlobalTimestamps ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetGlobalTimestamps = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGetGlobalTimestamps;
+        if( nullptr == pfnGetGlobalTimestamps )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1096,11 +1358,22 @@ zeContextCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zeDdiTable.Context.pfnCreate;
+    auto pfnCreate = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Context.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnCreate = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Context.pfnCreate;
+        if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1152,11 +1425,22 @@ zeContextCreateEx(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreateEx = ze_lib::context->zeDdiTable.Context.pfnCreateEx;
+    auto pfnCreateEx = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Context.pfnCreateEx;
     if( nullptr == pfnCreateEx ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnCreateEx = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Context.pfnCreateEx;
+        if( nullptr == pfnCreateEx )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1193,11 +1477,22 @@ zeContextDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zeDdiTable.Context.pfnDestroy;
+    auto pfnDestroy = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Context.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnDestroy = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Context.pfnDestroy;
+        if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1233,11 +1528,22 @@ zeContextGetStatus(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetStatus = ze_lib::context->zeDdiTable.Context.pfnGetStatus;
+    auto pfnGetStatus = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Context.pfnGetStatus;
     if( nullptr == pfnGetStatus ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetStatus = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Context.pfnGetStatus;
+        if( nullptr == pfnGetStatus )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1287,11 +1593,22 @@ zeCommandQueueCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zeDdiTable.CommandQueue.pfnCreate;
+    auto pfnCreate = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandQueue.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnCreate = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandQueue.pfnCreate;
+        if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1334,11 +1651,22 @@ zeCommandQueueDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zeDdiTable.CommandQueue.pfnDestroy;
+    auto pfnDestroy = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandQueue.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnDestroy = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandQueue.pfnDestroy;
+        if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1396,11 +1724,22 @@ zeCommandQueueExecuteCommandLists(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnExecuteCommandLists = ze_lib::context->zeDdiTable.CommandQueue.pfnExecuteCommandLists;
+    auto pfnExecuteCommandLists = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandQueue.pfnExecuteCommandLists;
     if( nullptr == pfnExecuteCommandLists ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnExecuteCommandLists = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandQueue.pfnExecuteCommandLists;
+        if( nullptr == pfnExecuteCommandLists )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1440,11 +1779,22 @@ zeCommandQueueSynchronize(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSynchronize = ze_lib::context->zeDdiTable.CommandQueue.pfnSynchronize;
+    auto pfnSynchronize = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandQueue.pfnSynchronize;
     if( nullptr == pfnSynchronize ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnSynchronize = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandQueue.pfnSynchronize;
+        if( nullptr == pfnSynchronize )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1489,11 +1839,22 @@ zeCommandListCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zeDdiTable.CommandList.pfnCreate;
+    auto pfnCreate = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnCreate = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnCreate;
+        if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1544,11 +1905,22 @@ zeCommandListCreateImmediate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreateImmediate = ze_lib::context->zeDdiTable.CommandList.pfnCreateImmediate;
+    auto pfnCreateImmediate = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnCreateImmediate;
     if( nullptr == pfnCreateImmediate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnCreateImmediate = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnCreateImmediate;
+        if( nullptr == pfnCreateImmediate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1585,11 +1957,22 @@ zeCommandListDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zeDdiTable.CommandList.pfnDestroy;
+    auto pfnDestroy = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnDestroy = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnDestroy;
+        if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1621,11 +2004,22 @@ zeCommandListClose(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnClose = ze_lib::context->zeDdiTable.CommandList.pfnClose;
+    auto pfnClose = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnClose;
     if( nullptr == pfnClose ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnClose = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnClose;
+        if( nullptr == pfnClose )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1660,11 +2054,22 @@ zeCommandListReset(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnReset = ze_lib::context->zeDdiTable.CommandList.pfnReset;
+    auto pfnReset = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnReset;
     if( nullptr == pfnReset ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnReset = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnReset;
+        if( nullptr == pfnReset )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1719,11 +2124,22 @@ zeCommandListAppendWriteGlobalTimestamp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendWriteGlobalTimestamp = ze_lib::context->zeDdiTable.CommandList.pfnAppendWriteGlobalTimestamp;
+    auto pfnAppendWriteGlobalTimestamp = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendWriteGlobalTimestamp;
     if( nullptr == pfnAppendWriteGlobalTimestamp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnAppendWriteGlobalTimestamp = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendWriteGlobalTimestamp;
+        if( nullptr == pfnAppendWriteGlobalTimestamp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1772,11 +2188,22 @@ zeCommandListHostSynchronize(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnHostSynchronize = ze_lib::context->zeDdiTable.CommandList.pfnHostSynchronize;
+    auto pfnHostSynchronize = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnHostSynchronize;
     if( nullptr == pfnHostSynchronize ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnHostSynchronize = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnHostSynchronize;
+        if( nullptr == pfnHostSynchronize )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1830,11 +2257,22 @@ zeCommandListAppendBarrier(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendBarrier = ze_lib::context->zeDdiTable.CommandList.pfnAppendBarrier;
+    auto pfnAppendBarrier = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendBarrier;
     if( nullptr == pfnAppendBarrier ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnAppendBarrier = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendBarrier;
+        if( nullptr == pfnAppendBarrier )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1888,11 +2326,22 @@ zeCommandListAppendMemoryRangesBarrier(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendMemoryRangesBarrier = ze_lib::context->zeDdiTable.CommandList.pfnAppendMemoryRangesBarrier;
+    auto pfnAppendMemoryRangesBarrier = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendMemoryRangesBarrier;
     if( nullptr == pfnAppendMemoryRangesBarrier ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnAppendMemoryRangesBarrier = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendMemoryRangesBarrier;
+        if( nullptr == pfnAppendMemoryRangesBarrier )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1931,11 +2380,22 @@ zeContextSystemBarrier(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSystemBarrier = ze_lib::context->zeDdiTable.Context.pfnSystemBarrier;
+    auto pfnSystemBarrier = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Context.pfnSystemBarrier;
     if( nullptr == pfnSystemBarrier ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnSystemBarrier = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Context.pfnSystemBarrier;
+        if( nullptr == pfnSystemBarrier )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1997,11 +2457,22 @@ zeCommandListAppendMemoryCopy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendMemoryCopy = ze_lib::context->zeDdiTable.CommandList.pfnAppendMemoryCopy;
+    auto pfnAppendMemoryCopy = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendMemoryCopy;
     if( nullptr == pfnAppendMemoryCopy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnAppendMemoryCopy = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendMemoryCopy;
+        if( nullptr == pfnAppendMemoryCopy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -2066,11 +2537,22 @@ zeCommandListAppendMemoryFill(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendMemoryFill = ze_lib::context->zeDdiTable.CommandList.pfnAppendMemoryFill;
+    auto pfnAppendMemoryFill = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendMemoryFill;
     if( nullptr == pfnAppendMemoryFill ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnAppendMemoryFill = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendMemoryFill;
+        if( nullptr == pfnAppendMemoryFill )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -2141,11 +2623,22 @@ zeCommandListAppendMemoryCopyRegion(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendMemoryCopyRegion = ze_lib::context->zeDdiTable.CommandList.pfnAppendMemoryCopyRegion;
+    auto pfnAppendMemoryCopyRegion = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendMemoryCopyRegion;
     if( nullptr == pfnAppendMemoryCopyRegion ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnAppendMemoryCopyRegion = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendMemoryCopyRegion;
+        if( nullptr == pfnAppendMemoryCopyRegion )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -2203,11 +2696,22 @@ zeCommandListAppendMemoryCopyFromContext(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendMemoryCopyFromContext = ze_lib::context->zeDdiTable.CommandList.pfnAppendMemoryCopyFromContext;
+    auto pfnAppendMemoryCopyFromContext = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendMemoryCopyFromContext;
     if( nullptr == pfnAppendMemoryCopyFromContext ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnAppendMemoryCopyFromContext = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendMemoryCopyFromContext;
+        if( nullptr == pfnAppendMemoryCopyFromContext )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -2261,11 +2765,22 @@ zeCommandListAppendImageCopy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendImageCopy = ze_lib::context->zeDdiTable.CommandList.pfnAppendImageCopy;
+    auto pfnAppendImageCopy = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendImageCopy;
     if( nullptr == pfnAppendImageCopy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnAppendImageCopy = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendImageCopy;
+        if( nullptr == pfnAppendImageCopy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -2321,11 +2836,22 @@ zeCommandListAppendImageCopyRegion(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendImageCopyRegion = ze_lib::context->zeDdiTable.CommandList.pfnAppendImageCopyRegion;
+    auto pfnAppendImageCopyRegion = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendImageCopyRegion;
     if( nullptr == pfnAppendImageCopyRegion ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnAppendImageCopyRegion = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendImageCopyRegion;
+        if( nullptr == pfnAppendImageCopyRegion )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -2386,11 +2912,22 @@ zeCommandListAppendImageCopyToMemory(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendImageCopyToMemory = ze_lib::context->zeDdiTable.CommandList.pfnAppendImageCopyToMemory;
+    auto pfnAppendImageCopyToMemory = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendImageCopyToMemory;
     if( nullptr == pfnAppendImageCopyToMemory ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnAppendImageCopyToMemory = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendImageCopyToMemory;
+        if( nullptr == pfnAppendImageCopyToMemory )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -2451,11 +2988,22 @@ zeCommandListAppendImageCopyFromMemory(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendImageCopyFromMemory = ze_lib::context->zeDdiTable.CommandList.pfnAppendImageCopyFromMemory;
+    auto pfnAppendImageCopyFromMemory = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendImageCopyFromMemory;
     if( nullptr == pfnAppendImageCopyFromMemory ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnAppendImageCopyFromMemory = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendImageCopyFromMemory;
+        if( nullptr == pfnAppendImageCopyFromMemory )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -2512,11 +3060,22 @@ zeCommandListAppendMemoryPrefetch(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendMemoryPrefetch = ze_lib::context->zeDdiTable.CommandList.pfnAppendMemoryPrefetch;
+    auto pfnAppendMemoryPrefetch = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendMemoryPrefetch;
     if( nullptr == pfnAppendMemoryPrefetch ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnAppendMemoryPrefetch = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendMemoryPrefetch;
+        if( nullptr == pfnAppendMemoryPrefetch )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -2573,11 +3132,22 @@ zeCommandListAppendMemAdvise(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendMemAdvise = ze_lib::context->zeDdiTable.CommandList.pfnAppendMemAdvise;
+    auto pfnAppendMemAdvise = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendMemAdvise;
     if( nullptr == pfnAppendMemAdvise ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnAppendMemAdvise = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendMemAdvise;
+        if( nullptr == pfnAppendMemAdvise )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -2626,11 +3196,22 @@ zeEventPoolCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zeDdiTable.EventPool.pfnCreate;
+    auto pfnCreate = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->EventPool.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnCreate = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->EventPool.pfnCreate;
+        if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -2669,11 +3250,22 @@ zeEventPoolDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zeDdiTable.EventPool.pfnDestroy;
+    auto pfnDestroy = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->EventPool.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnDestroy = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->EventPool.pfnDestroy;
+        if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -2722,11 +3314,22 @@ zeEventCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zeDdiTable.Event.pfnCreate;
+    auto pfnCreate = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Event.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnCreate = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Event.pfnCreate;
+        if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -2768,11 +3371,22 @@ zeEventDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zeDdiTable.Event.pfnDestroy;
+    auto pfnDestroy = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Event.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnDestroy = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Event.pfnDestroy;
+        if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -2808,11 +3422,22 @@ zeEventPoolGetIpcHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetIpcHandle = ze_lib::context->zeDdiTable.EventPool.pfnGetIpcHandle;
+    auto pfnGetIpcHandle = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->EventPool.pfnGetIpcHandle;
     if( nullptr == pfnGetIpcHandle ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetIpcHandle = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->EventPool.pfnGetIpcHandle;
+        if( nullptr == pfnGetIpcHandle )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -2854,11 +3479,22 @@ zeEventPoolPutIpcHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnPutIpcHandle = ze_lib::context->zeDdiTable.EventPool.pfnPutIpcHandle;
+    auto pfnPutIpcHandle = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->EventPool.pfnPutIpcHandle;
     if( nullptr == pfnPutIpcHandle ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnPutIpcHandle = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->EventPool.pfnPutIpcHandle;
+        if( nullptr == pfnPutIpcHandle )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -2898,11 +3534,22 @@ zeEventPoolOpenIpcHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOpenIpcHandle = ze_lib::context->zeDdiTable.EventPool.pfnOpenIpcHandle;
+    auto pfnOpenIpcHandle = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->EventPool.pfnOpenIpcHandle;
     if( nullptr == pfnOpenIpcHandle ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnOpenIpcHandle = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->EventPool.pfnOpenIpcHandle;
+        if( nullptr == pfnOpenIpcHandle )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -2935,11 +3582,22 @@ zeEventPoolCloseIpcHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCloseIpcHandle = ze_lib::context->zeDdiTable.EventPool.pfnCloseIpcHandle;
+    auto pfnCloseIpcHandle = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->EventPool.pfnCloseIpcHandle;
     if( nullptr == pfnCloseIpcHandle ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnCloseIpcHandle = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->EventPool.pfnCloseIpcHandle;
+        if( nullptr == pfnCloseIpcHandle )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -2988,11 +3646,22 @@ zeCommandListAppendSignalEvent(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendSignalEvent = ze_lib::context->zeDdiTable.CommandList.pfnAppendSignalEvent;
+    auto pfnAppendSignalEvent = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendSignalEvent;
     if( nullptr == pfnAppendSignalEvent ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnAppendSignalEvent = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendSignalEvent;
+        if( nullptr == pfnAppendSignalEvent )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3034,11 +3703,22 @@ zeCommandListAppendWaitOnEvents(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendWaitOnEvents = ze_lib::context->zeDdiTable.CommandList.pfnAppendWaitOnEvents;
+    auto pfnAppendWaitOnEvents = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendWaitOnEvents;
     if( nullptr == pfnAppendWaitOnEvents ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnAppendWaitOnEvents = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendWaitOnEvents;
+        if( nullptr == pfnAppendWaitOnEvents )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3079,11 +3759,22 @@ zeEventHostSignal(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnHostSignal = ze_lib::context->zeDdiTable.Event.pfnHostSignal;
+    auto pfnHostSignal = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Event.pfnHostSignal;
     if( nullptr == pfnHostSignal ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnHostSignal = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Event.pfnHostSignal;
+        if( nullptr == pfnHostSignal )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3128,11 +3819,22 @@ zeEventHostSynchronize(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnHostSynchronize = ze_lib::context->zeDdiTable.Event.pfnHostSynchronize;
+    auto pfnHostSynchronize = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Event.pfnHostSynchronize;
     if( nullptr == pfnHostSynchronize ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnHostSynchronize = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Event.pfnHostSynchronize;
+        if( nullptr == pfnHostSynchronize )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3171,11 +3873,22 @@ zeEventQueryStatus(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnQueryStatus = ze_lib::context->zeDdiTable.Event.pfnQueryStatus;
+    auto pfnQueryStatus = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Event.pfnQueryStatus;
     if( nullptr == pfnQueryStatus ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnQueryStatus = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Event.pfnQueryStatus;
+        if( nullptr == pfnQueryStatus )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3219,11 +3932,22 @@ zeCommandListAppendEventReset(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendEventReset = ze_lib::context->zeDdiTable.CommandList.pfnAppendEventReset;
+    auto pfnAppendEventReset = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendEventReset;
     if( nullptr == pfnAppendEventReset ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnAppendEventReset = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendEventReset;
+        if( nullptr == pfnAppendEventReset )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3259,11 +3983,22 @@ zeEventHostReset(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnHostReset = ze_lib::context->zeDdiTable.Event.pfnHostReset;
+    auto pfnHostReset = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Event.pfnHostReset;
     if( nullptr == pfnHostReset ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnHostReset = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Event.pfnHostReset;
+        if( nullptr == pfnHostReset )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3305,11 +4040,22 @@ zeEventQueryKernelTimestamp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnQueryKernelTimestamp = ze_lib::context->zeDdiTable.Event.pfnQueryKernelTimestamp;
+    auto pfnQueryKernelTimestamp = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Event.pfnQueryKernelTimestamp;
     if( nullptr == pfnQueryKernelTimestamp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnQueryKernelTimestamp = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Event.pfnQueryKernelTimestamp;
+        if( nullptr == pfnQueryKernelTimestamp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3372,11 +4118,22 @@ zeCommandListAppendQueryKernelTimestamps(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendQueryKernelTimestamps = ze_lib::context->zeDdiTable.CommandList.pfnAppendQueryKernelTimestamps;
+    auto pfnAppendQueryKernelTimestamps = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendQueryKernelTimestamps;
     if( nullptr == pfnAppendQueryKernelTimestamps ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnAppendQueryKernelTimestamps = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendQueryKernelTimestamps;
+        if( nullptr == pfnAppendQueryKernelTimestamps )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3422,11 +4179,22 @@ zeFenceCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zeDdiTable.Fence.pfnCreate;
+    auto pfnCreate = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Fence.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnCreate = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Fence.pfnCreate;
+        if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3467,11 +4235,22 @@ zeFenceDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zeDdiTable.Fence.pfnDestroy;
+    auto pfnDestroy = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Fence.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnDestroy = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Fence.pfnDestroy;
+        if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3516,11 +4295,22 @@ zeFenceHostSynchronize(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnHostSynchronize = ze_lib::context->zeDdiTable.Fence.pfnHostSynchronize;
+    auto pfnHostSynchronize = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Fence.pfnHostSynchronize;
     if( nullptr == pfnHostSynchronize ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnHostSynchronize = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Fence.pfnHostSynchronize;
+        if( nullptr == pfnHostSynchronize )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3558,11 +4348,22 @@ zeFenceQueryStatus(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnQueryStatus = ze_lib::context->zeDdiTable.Fence.pfnQueryStatus;
+    auto pfnQueryStatus = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Fence.pfnQueryStatus;
     if( nullptr == pfnQueryStatus ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnQueryStatus = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Fence.pfnQueryStatus;
+        if( nullptr == pfnQueryStatus )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3597,11 +4398,22 @@ zeFenceReset(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnReset = ze_lib::context->zeDdiTable.Fence.pfnReset;
+    auto pfnReset = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Fence.pfnReset;
     if( nullptr == pfnReset ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnReset = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Fence.pfnReset;
+        if( nullptr == pfnReset )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3640,11 +4452,22 @@ zeImageGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zeDdiTable.Image.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Image.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetProperties = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Image.pfnGetProperties;
+        if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3692,11 +4515,22 @@ zeImageCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zeDdiTable.Image.pfnCreate;
+    auto pfnCreate = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Image.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnCreate = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Image.pfnCreate;
+        if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3733,11 +4567,22 @@ zeImageDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zeDdiTable.Image.pfnDestroy;
+    auto pfnDestroy = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Image.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnDestroy = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Image.pfnDestroy;
+        if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3803,11 +4648,22 @@ zeMemAllocShared(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAllocShared = ze_lib::context->zeDdiTable.Mem.pfnAllocShared;
+    auto pfnAllocShared = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Mem.pfnAllocShared;
     if( nullptr == pfnAllocShared ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnAllocShared = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Mem.pfnAllocShared;
+        if( nullptr == pfnAllocShared )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3861,11 +4717,22 @@ zeMemAllocDevice(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAllocDevice = ze_lib::context->zeDdiTable.Mem.pfnAllocDevice;
+    auto pfnAllocDevice = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Mem.pfnAllocDevice;
     if( nullptr == pfnAllocDevice ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnAllocDevice = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Mem.pfnAllocDevice;
+        if( nullptr == pfnAllocDevice )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3919,11 +4786,22 @@ zeMemAllocHost(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAllocHost = ze_lib::context->zeDdiTable.Mem.pfnAllocHost;
+    auto pfnAllocHost = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Mem.pfnAllocHost;
     if( nullptr == pfnAllocHost ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnAllocHost = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Mem.pfnAllocHost;
+        if( nullptr == pfnAllocHost )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3963,11 +4841,22 @@ zeMemFree(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnFree = ze_lib::context->zeDdiTable.Mem.pfnFree;
+    auto pfnFree = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Mem.pfnFree;
     if( nullptr == pfnFree ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnFree = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Mem.pfnFree;
+        if( nullptr == pfnFree )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4008,11 +4897,22 @@ zeMemGetAllocProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetAllocProperties = ze_lib::context->zeDdiTable.Mem.pfnGetAllocProperties;
+    auto pfnGetAllocProperties = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Mem.pfnGetAllocProperties;
     if( nullptr == pfnGetAllocProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetAllocProperties = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Mem.pfnGetAllocProperties;
+        if( nullptr == pfnGetAllocProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4047,11 +4947,22 @@ zeMemGetAddressRange(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetAddressRange = ze_lib::context->zeDdiTable.Mem.pfnGetAddressRange;
+    auto pfnGetAddressRange = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Mem.pfnGetAddressRange;
     if( nullptr == pfnGetAddressRange ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetAddressRange = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Mem.pfnGetAddressRange;
+        if( nullptr == pfnGetAddressRange )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4092,11 +5003,22 @@ zeMemGetIpcHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetIpcHandle = ze_lib::context->zeDdiTable.Mem.pfnGetIpcHandle;
+    auto pfnGetIpcHandle = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Mem.pfnGetIpcHandle;
     if( nullptr == pfnGetIpcHandle ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetIpcHandle = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Mem.pfnGetIpcHandle;
+        if( nullptr == pfnGetIpcHandle )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4135,11 +5057,22 @@ zeMemGetIpcHandleFromFileDescriptorExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetIpcHandleFromFileDescriptorExp = ze_lib::context->zeDdiTable.MemExp.pfnGetIpcHandleFromFileDescriptorExp;
+    auto pfnGetIpcHandleFromFileDescriptorExp = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->MemExp.pfnGetIpcHandleFromFileDescriptorExp;
     if( nullptr == pfnGetIpcHandleFromFileDescriptorExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetIpcHandleFromFileDescriptorExp = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->MemExp.pfnGetIpcHandleFromFileDescriptorExp;
+        if( nullptr == pfnGetIpcHandleFromFileDescriptorExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4176,11 +5109,22 @@ zeMemGetFileDescriptorFromIpcHandleExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetFileDescriptorFromIpcHandleExp = ze_lib::context->zeDdiTable.MemExp.pfnGetFileDescriptorFromIpcHandleExp;
+    auto pfnGetFileDescriptorFromIpcHandleExp = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->MemExp.pfnGetFileDescriptorFromIpcHandleExp;
     if( nullptr == pfnGetFileDescriptorFromIpcHandleExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetFileDescriptorFromIpcHandleExp = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->MemExp.pfnGetFileDescriptorFromIpcHandleExp;
+        if( nullptr == pfnGetFileDescriptorFromIpcHandleExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4221,11 +5165,22 @@ zeMemPutIpcHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnPutIpcHandle = ze_lib::context->zeDdiTable.Mem.pfnPutIpcHandle;
+    auto pfnPutIpcHandle = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Mem.pfnPutIpcHandle;
     if( nullptr == pfnPutIpcHandle ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnPutIpcHandle = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Mem.pfnPutIpcHandle;
+        if( nullptr == pfnPutIpcHandle )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4273,11 +5228,22 @@ zeMemOpenIpcHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOpenIpcHandle = ze_lib::context->zeDdiTable.Mem.pfnOpenIpcHandle;
+    auto pfnOpenIpcHandle = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Mem.pfnOpenIpcHandle;
     if( nullptr == pfnOpenIpcHandle ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnOpenIpcHandle = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Mem.pfnOpenIpcHandle;
+        if( nullptr == pfnOpenIpcHandle )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4314,11 +5280,22 @@ zeMemCloseIpcHandle(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCloseIpcHandle = ze_lib::context->zeDdiTable.Mem.pfnCloseIpcHandle;
+    auto pfnCloseIpcHandle = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Mem.pfnCloseIpcHandle;
     if( nullptr == pfnCloseIpcHandle ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnCloseIpcHandle = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Mem.pfnCloseIpcHandle;
+        if( nullptr == pfnCloseIpcHandle )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4373,11 +5350,22 @@ zeModuleCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zeDdiTable.Module.pfnCreate;
+    auto pfnCreate = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Module.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnCreate = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Module.pfnCreate;
+        if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4416,11 +5404,22 @@ zeModuleDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zeDdiTable.Module.pfnDestroy;
+    auto pfnDestroy = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Module.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnDestroy = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Module.pfnDestroy;
+        if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4481,11 +5480,22 @@ zeModuleDynamicLink(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDynamicLink = ze_lib::context->zeDdiTable.Module.pfnDynamicLink;
+    auto pfnDynamicLink = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Module.pfnDynamicLink;
     if( nullptr == pfnDynamicLink ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnDynamicLink = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Module.pfnDynamicLink;
+        if( nullptr == pfnDynamicLink )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4522,11 +5532,22 @@ zeModuleBuildLogDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zeDdiTable.ModuleBuildLog.pfnDestroy;
+    auto pfnDestroy = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->ModuleBuildLog.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnDestroy = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->ModuleBuildLog.pfnDestroy;
+        if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4563,11 +5584,22 @@ zeModuleBuildLogGetString(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetString = ze_lib::context->zeDdiTable.ModuleBuildLog.pfnGetString;
+    auto pfnGetString = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->ModuleBuildLog.pfnGetString;
     if( nullptr == pfnGetString ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetString = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->ModuleBuildLog.pfnGetString;
+        if( nullptr == pfnGetString )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4610,11 +5642,22 @@ zeModuleGetNativeBinary(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetNativeBinary = ze_lib::context->zeDdiTable.Module.pfnGetNativeBinary;
+    auto pfnGetNativeBinary = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Module.pfnGetNativeBinary;
     if( nullptr == pfnGetNativeBinary ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetNativeBinary = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Module.pfnGetNativeBinary;
+        if( nullptr == pfnGetNativeBinary )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4655,11 +5698,22 @@ zeModuleGetGlobalPointer(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetGlobalPointer = ze_lib::context->zeDdiTable.Module.pfnGetGlobalPointer;
+    auto pfnGetGlobalPointer = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Module.pfnGetGlobalPointer;
     if( nullptr == pfnGetGlobalPointer ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetGlobalPointer = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Module.pfnGetGlobalPointer;
+        if( nullptr == pfnGetGlobalPointer )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4700,11 +5754,22 @@ zeModuleGetKernelNames(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetKernelNames = ze_lib::context->zeDdiTable.Module.pfnGetKernelNames;
+    auto pfnGetKernelNames = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Module.pfnGetKernelNames;
     if( nullptr == pfnGetKernelNames ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetKernelNames = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Module.pfnGetKernelNames;
+        if( nullptr == pfnGetKernelNames )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4738,11 +5803,22 @@ zeModuleGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zeDdiTable.Module.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Module.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetProperties = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Module.pfnGetProperties;
+        if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4785,11 +5861,22 @@ zeKernelCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zeDdiTable.Kernel.pfnCreate;
+    auto pfnCreate = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Kernel.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnCreate = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Kernel.pfnCreate;
+        if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4826,11 +5913,22 @@ zeKernelDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zeDdiTable.Kernel.pfnDestroy;
+    auto pfnDestroy = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Kernel.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnDestroy = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Kernel.pfnDestroy;
+        if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4872,11 +5970,22 @@ zeModuleGetFunctionPointer(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetFunctionPointer = ze_lib::context->zeDdiTable.Module.pfnGetFunctionPointer;
+    auto pfnGetFunctionPointer = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Module.pfnGetFunctionPointer;
     if( nullptr == pfnGetFunctionPointer ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetFunctionPointer = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Module.pfnGetFunctionPointer;
+        if( nullptr == pfnGetFunctionPointer )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4914,11 +6023,22 @@ zeKernelSetGroupSize(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetGroupSize = ze_lib::context->zeDdiTable.Kernel.pfnSetGroupSize;
+    auto pfnSetGroupSize = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Kernel.pfnSetGroupSize;
     if( nullptr == pfnSetGroupSize ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnSetGroupSize = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Kernel.pfnSetGroupSize;
+        if( nullptr == pfnSetGroupSize )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4963,11 +6083,22 @@ zeKernelSuggestGroupSize(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSuggestGroupSize = ze_lib::context->zeDdiTable.Kernel.pfnSuggestGroupSize;
+    auto pfnSuggestGroupSize = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Kernel.pfnSuggestGroupSize;
     if( nullptr == pfnSuggestGroupSize ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnSuggestGroupSize = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Kernel.pfnSuggestGroupSize;
+        if( nullptr == pfnSuggestGroupSize )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -5001,11 +6132,22 @@ zeKernelSuggestMaxCooperativeGroupCount(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSuggestMaxCooperativeGroupCount = ze_lib::context->zeDdiTable.Kernel.pfnSuggestMaxCooperativeGroupCount;
+    auto pfnSuggestMaxCooperativeGroupCount = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Kernel.pfnSuggestMaxCooperativeGroupCount;
     if( nullptr == pfnSuggestMaxCooperativeGroupCount ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnSuggestMaxCooperativeGroupCount = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Kernel.pfnSuggestMaxCooperativeGroupCount;
+        if( nullptr == pfnSuggestMaxCooperativeGroupCount )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -5045,11 +6187,22 @@ zeKernelSetArgumentValue(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetArgumentValue = ze_lib::context->zeDdiTable.Kernel.pfnSetArgumentValue;
+    auto pfnSetArgumentValue = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Kernel.pfnSetArgumentValue;
     if( nullptr == pfnSetArgumentValue ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnSetArgumentValue = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Kernel.pfnSetArgumentValue;
+        if( nullptr == pfnSetArgumentValue )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -5087,11 +6240,22 @@ zeKernelSetIndirectAccess(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetIndirectAccess = ze_lib::context->zeDdiTable.Kernel.pfnSetIndirectAccess;
+    auto pfnSetIndirectAccess = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Kernel.pfnSetIndirectAccess;
     if( nullptr == pfnSetIndirectAccess ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnSetIndirectAccess = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Kernel.pfnSetIndirectAccess;
+        if( nullptr == pfnSetIndirectAccess )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -5126,11 +6290,22 @@ zeKernelGetIndirectAccess(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetIndirectAccess = ze_lib::context->zeDdiTable.Kernel.pfnGetIndirectAccess;
+    auto pfnGetIndirectAccess = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Kernel.pfnGetIndirectAccess;
     if( nullptr == pfnGetIndirectAccess ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetIndirectAccess = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Kernel.pfnGetIndirectAccess;
+        if( nullptr == pfnGetIndirectAccess )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -5174,11 +6349,22 @@ zeKernelGetSourceAttributes(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetSourceAttributes = ze_lib::context->zeDdiTable.Kernel.pfnGetSourceAttributes;
+    auto pfnGetSourceAttributes = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Kernel.pfnGetSourceAttributes;
     if( nullptr == pfnGetSourceAttributes ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetSourceAttributes = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Kernel.pfnGetSourceAttributes;
+        if( nullptr == pfnGetSourceAttributes )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -5217,11 +6403,22 @@ zeKernelSetCacheConfig(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetCacheConfig = ze_lib::context->zeDdiTable.Kernel.pfnSetCacheConfig;
+    auto pfnSetCacheConfig = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Kernel.pfnSetCacheConfig;
     if( nullptr == pfnSetCacheConfig ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnSetCacheConfig = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Kernel.pfnSetCacheConfig;
+        if( nullptr == pfnSetCacheConfig )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -5255,11 +6452,22 @@ zeKernelGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zeDdiTable.Kernel.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Kernel.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetProperties = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Kernel.pfnGetProperties;
+        if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -5298,11 +6506,22 @@ zeKernelGetName(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetName = ze_lib::context->zeDdiTable.Kernel.pfnGetName;
+    auto pfnGetName = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Kernel.pfnGetName;
     if( nullptr == pfnGetName ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetName = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Kernel.pfnGetName;
+        if( nullptr == pfnGetName )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -5353,11 +6572,22 @@ zeCommandListAppendLaunchKernel(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendLaunchKernel = ze_lib::context->zeDdiTable.CommandList.pfnAppendLaunchKernel;
+    auto pfnAppendLaunchKernel = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendLaunchKernel;
     if( nullptr == pfnAppendLaunchKernel ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnAppendLaunchKernel = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendLaunchKernel;
+        if( nullptr == pfnAppendLaunchKernel )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -5412,11 +6642,22 @@ zeCommandListAppendLaunchCooperativeKernel(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendLaunchCooperativeKernel = ze_lib::context->zeDdiTable.CommandList.pfnAppendLaunchCooperativeKernel;
+    auto pfnAppendLaunchCooperativeKernel = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendLaunchCooperativeKernel;
     if( nullptr == pfnAppendLaunchCooperativeKernel ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnAppendLaunchCooperativeKernel = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendLaunchCooperativeKernel;
+        if( nullptr == pfnAppendLaunchCooperativeKernel )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -5473,11 +6714,22 @@ zeCommandListAppendLaunchKernelIndirect(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendLaunchKernelIndirect = ze_lib::context->zeDdiTable.CommandList.pfnAppendLaunchKernelIndirect;
+    auto pfnAppendLaunchKernelIndirect = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendLaunchKernelIndirect;
     if( nullptr == pfnAppendLaunchKernelIndirect ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnAppendLaunchKernelIndirect = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendLaunchKernelIndirect;
+        if( nullptr == pfnAppendLaunchKernelIndirect )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -5541,11 +6793,22 @@ zeCommandListAppendLaunchMultipleKernelsIndirect(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendLaunchMultipleKernelsIndirect = ze_lib::context->zeDdiTable.CommandList.pfnAppendLaunchMultipleKernelsIndirect;
+    auto pfnAppendLaunchMultipleKernelsIndirect = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendLaunchMultipleKernelsIndirect;
     if( nullptr == pfnAppendLaunchMultipleKernelsIndirect ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnAppendLaunchMultipleKernelsIndirect = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendLaunchMultipleKernelsIndirect;
+        if( nullptr == pfnAppendLaunchMultipleKernelsIndirect )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -5584,11 +6847,22 @@ zeContextMakeMemoryResident(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnMakeMemoryResident = ze_lib::context->zeDdiTable.Context.pfnMakeMemoryResident;
+    auto pfnMakeMemoryResident = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Context.pfnMakeMemoryResident;
     if( nullptr == pfnMakeMemoryResident ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnMakeMemoryResident = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Context.pfnMakeMemoryResident;
+        if( nullptr == pfnMakeMemoryResident )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -5629,11 +6903,22 @@ zeContextEvictMemory(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEvictMemory = ze_lib::context->zeDdiTable.Context.pfnEvictMemory;
+    auto pfnEvictMemory = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Context.pfnEvictMemory;
     if( nullptr == pfnEvictMemory ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnEvictMemory = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Context.pfnEvictMemory;
+        if( nullptr == pfnEvictMemory )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -5670,11 +6955,22 @@ zeContextMakeImageResident(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnMakeImageResident = ze_lib::context->zeDdiTable.Context.pfnMakeImageResident;
+    auto pfnMakeImageResident = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Context.pfnMakeImageResident;
     if( nullptr == pfnMakeImageResident ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnMakeImageResident = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Context.pfnMakeImageResident;
+        if( nullptr == pfnMakeImageResident )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -5713,11 +7009,22 @@ zeContextEvictImage(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEvictImage = ze_lib::context->zeDdiTable.Context.pfnEvictImage;
+    auto pfnEvictImage = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Context.pfnEvictImage;
     if( nullptr == pfnEvictImage ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnEvictImage = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Context.pfnEvictImage;
+        if( nullptr == pfnEvictImage )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -5760,11 +7067,22 @@ zeSamplerCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zeDdiTable.Sampler.pfnCreate;
+    auto pfnCreate = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Sampler.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnCreate = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Sampler.pfnCreate;
+        if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -5801,11 +7119,22 @@ zeSamplerDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zeDdiTable.Sampler.pfnDestroy;
+    auto pfnDestroy = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Sampler.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnDestroy = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Sampler.pfnDestroy;
+        if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -5853,11 +7182,22 @@ zeVirtualMemReserve(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnReserve = ze_lib::context->zeDdiTable.VirtualMem.pfnReserve;
+    auto pfnReserve = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->VirtualMem.pfnReserve;
     if( nullptr == pfnReserve ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnReserve = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->VirtualMem.pfnReserve;
+        if( nullptr == pfnReserve )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -5898,11 +7238,22 @@ zeVirtualMemFree(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnFree = ze_lib::context->zeDdiTable.VirtualMem.pfnFree;
+    auto pfnFree = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->VirtualMem.pfnFree;
     if( nullptr == pfnFree ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnFree = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->VirtualMem.pfnFree;
+        if( nullptr == pfnFree )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -5943,11 +7294,22 @@ zeVirtualMemQueryPageSize(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnQueryPageSize = ze_lib::context->zeDdiTable.VirtualMem.pfnQueryPageSize;
+    auto pfnQueryPageSize = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->VirtualMem.pfnQueryPageSize;
     if( nullptr == pfnQueryPageSize ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnQueryPageSize = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->VirtualMem.pfnQueryPageSize;
+        if( nullptr == pfnQueryPageSize )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -5993,11 +7355,22 @@ zePhysicalMemCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zeDdiTable.PhysicalMem.pfnCreate;
+    auto pfnCreate = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->PhysicalMem.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnCreate = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->PhysicalMem.pfnCreate;
+        if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -6034,11 +7407,22 @@ zePhysicalMemDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zeDdiTable.PhysicalMem.pfnDestroy;
+    auto pfnDestroy = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->PhysicalMem.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnDestroy = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->PhysicalMem.pfnDestroy;
+        if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -6094,11 +7478,22 @@ zeVirtualMemMap(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnMap = ze_lib::context->zeDdiTable.VirtualMem.pfnMap;
+    auto pfnMap = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->VirtualMem.pfnMap;
     if( nullptr == pfnMap ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnMap = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->VirtualMem.pfnMap;
+        if( nullptr == pfnMap )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -6140,11 +7535,22 @@ zeVirtualMemUnmap(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnUnmap = ze_lib::context->zeDdiTable.VirtualMem.pfnUnmap;
+    auto pfnUnmap = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->VirtualMem.pfnUnmap;
     if( nullptr == pfnUnmap ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnUnmap = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->VirtualMem.pfnUnmap;
+        if( nullptr == pfnUnmap )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -6188,11 +7594,22 @@ zeVirtualMemSetAccessAttribute(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetAccessAttribute = ze_lib::context->zeDdiTable.VirtualMem.pfnSetAccessAttribute;
+    auto pfnSetAccessAttribute = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->VirtualMem.pfnSetAccessAttribute;
     if( nullptr == pfnSetAccessAttribute ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnSetAccessAttribute = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->VirtualMem.pfnSetAccessAttribute;
+        if( nullptr == pfnSetAccessAttribute )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -6239,11 +7656,22 @@ zeVirtualMemGetAccessAttribute(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetAccessAttribute = ze_lib::context->zeDdiTable.VirtualMem.pfnGetAccessAttribute;
+    auto pfnGetAccessAttribute = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->VirtualMem.pfnGetAccessAttribute;
     if( nullptr == pfnGetAccessAttribute ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetAccessAttribute = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->VirtualMem.pfnGetAccessAttribute;
+        if( nullptr == pfnGetAccessAttribute )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -6280,11 +7708,22 @@ zeKernelSetGlobalOffsetExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetGlobalOffsetExp = ze_lib::context->zeDdiTable.KernelExp.pfnSetGlobalOffsetExp;
+    auto pfnSetGlobalOffsetExp = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->KernelExp.pfnSetGlobalOffsetExp;
     if( nullptr == pfnSetGlobalOffsetExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnSetGlobalOffsetExp = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->KernelExp.pfnSetGlobalOffsetExp;
+        if( nullptr == pfnSetGlobalOffsetExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -6324,11 +7763,22 @@ zeDeviceReserveCacheExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnReserveCacheExt = ze_lib::context->zeDdiTable.Device.pfnReserveCacheExt;
+    auto pfnReserveCacheExt = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Device.pfnReserveCacheExt;
     if( nullptr == pfnReserveCacheExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnReserveCacheExt = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Device.pfnReserveCacheExt;
+        if( nullptr == pfnReserveCacheExt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -6366,11 +7816,22 @@ zeDeviceSetCacheAdviceExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetCacheAdviceExt = ze_lib::context->zeDdiTable.Device.pfnSetCacheAdviceExt;
+    auto pfnSetCacheAdviceExt = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Device.pfnSetCacheAdviceExt;
     if( nullptr == pfnSetCacheAdviceExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnSetCacheAdviceExt = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Device.pfnSetCacheAdviceExt;
+        if( nullptr == pfnSetCacheAdviceExt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -6425,11 +7886,22 @@ zeEventQueryTimestampsExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnQueryTimestampsExp = ze_lib::context->zeDdiTable.EventExp.pfnQueryTimestampsExp;
+    auto pfnQueryTimestampsExp = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->EventExp.pfnQueryTimestampsExp;
     if( nullptr == pfnQueryTimestampsExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnQueryTimestampsExp = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->EventExp.pfnQueryTimestampsExp;
+        if( nullptr == pfnQueryTimestampsExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -6469,11 +7941,22 @@ zeImageGetMemoryPropertiesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetMemoryPropertiesExp = ze_lib::context->zeDdiTable.ImageExp.pfnGetMemoryPropertiesExp;
+    auto pfnGetMemoryPropertiesExp = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->ImageExp.pfnGetMemoryPropertiesExp;
     if( nullptr == pfnGetMemoryPropertiesExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetMemoryPropertiesExp = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->ImageExp.pfnGetMemoryPropertiesExp;
+        if( nullptr == pfnGetMemoryPropertiesExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -6530,11 +8013,22 @@ zeImageViewCreateExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnViewCreateExt = ze_lib::context->zeDdiTable.Image.pfnViewCreateExt;
+    auto pfnViewCreateExt = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Image.pfnViewCreateExt;
     if( nullptr == pfnViewCreateExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnViewCreateExt = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Image.pfnViewCreateExt;
+        if( nullptr == pfnViewCreateExt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -6594,11 +8088,22 @@ zeImageViewCreateExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnViewCreateExp = ze_lib::context->zeDdiTable.ImageExp.pfnViewCreateExp;
+    auto pfnViewCreateExp = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->ImageExp.pfnViewCreateExp;
     if( nullptr == pfnViewCreateExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnViewCreateExp = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->ImageExp.pfnViewCreateExp;
+        if( nullptr == pfnViewCreateExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -6641,11 +8146,22 @@ zeKernelSchedulingHintExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSchedulingHintExp = ze_lib::context->zeDdiTable.KernelExp.pfnSchedulingHintExp;
+    auto pfnSchedulingHintExp = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->KernelExp.pfnSchedulingHintExp;
     if( nullptr == pfnSchedulingHintExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnSchedulingHintExp = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->KernelExp.pfnSchedulingHintExp;
+        if( nullptr == pfnSchedulingHintExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -6683,11 +8199,22 @@ zeDevicePciGetPropertiesExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnPciGetPropertiesExt = ze_lib::context->zeDdiTable.Device.pfnPciGetPropertiesExt;
+    auto pfnPciGetPropertiesExt = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Device.pfnPciGetPropertiesExt;
     if( nullptr == pfnPciGetPropertiesExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnPciGetPropertiesExt = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Device.pfnPciGetPropertiesExt;
+        if( nullptr == pfnPciGetPropertiesExt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -6762,11 +8289,22 @@ zeCommandListAppendImageCopyToMemoryExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendImageCopyToMemoryExt = ze_lib::context->zeDdiTable.CommandList.pfnAppendImageCopyToMemoryExt;
+    auto pfnAppendImageCopyToMemoryExt = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendImageCopyToMemoryExt;
     if( nullptr == pfnAppendImageCopyToMemoryExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnAppendImageCopyToMemoryExt = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendImageCopyToMemoryExt;
+        if( nullptr == pfnAppendImageCopyToMemoryExt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -6841,11 +8379,22 @@ zeCommandListAppendImageCopyFromMemoryExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendImageCopyFromMemoryExt = ze_lib::context->zeDdiTable.CommandList.pfnAppendImageCopyFromMemoryExt;
+    auto pfnAppendImageCopyFromMemoryExt = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendImageCopyFromMemoryExt;
     if( nullptr == pfnAppendImageCopyFromMemoryExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnAppendImageCopyFromMemoryExt = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendImageCopyFromMemoryExt;
+        if( nullptr == pfnAppendImageCopyFromMemoryExt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -6880,11 +8429,22 @@ zeImageGetAllocPropertiesExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetAllocPropertiesExt = ze_lib::context->zeDdiTable.Image.pfnGetAllocPropertiesExt;
+    auto pfnGetAllocPropertiesExt = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Image.pfnGetAllocPropertiesExt;
     if( nullptr == pfnGetAllocPropertiesExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetAllocPropertiesExt = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Image.pfnGetAllocPropertiesExt;
+        if( nullptr == pfnGetAllocPropertiesExt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -6928,11 +8488,22 @@ zeModuleInspectLinkageExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnInspectLinkageExt = ze_lib::context->zeDdiTable.Module.pfnInspectLinkageExt;
+    auto pfnInspectLinkageExt = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Module.pfnInspectLinkageExt;
     if( nullptr == pfnInspectLinkageExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnInspectLinkageExt = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Module.pfnInspectLinkageExt;
+        if( nullptr == pfnInspectLinkageExt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -6973,11 +8544,22 @@ zeMemFreeExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnFreeExt = ze_lib::context->zeDdiTable.Mem.pfnFreeExt;
+    auto pfnFreeExt = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Mem.pfnFreeExt;
     if( nullptr == pfnFreeExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnFreeExt = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Mem.pfnFreeExt;
+        if( nullptr == pfnFreeExt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -7021,11 +8603,22 @@ zeFabricVertexGetExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetExp = ze_lib::context->zeDdiTable.FabricVertexExp.pfnGetExp;
+    auto pfnGetExp = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->FabricVertexExp.pfnGetExp;
     if( nullptr == pfnGetExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetExp = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->FabricVertexExp.pfnGetExp;
+        if( nullptr == pfnGetExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -7071,11 +8664,22 @@ zeFabricVertexGetSubVerticesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetSubVerticesExp = ze_lib::context->zeDdiTable.FabricVertexExp.pfnGetSubVerticesExp;
+    auto pfnGetSubVerticesExp = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->FabricVertexExp.pfnGetSubVerticesExp;
     if( nullptr == pfnGetSubVerticesExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetSubVerticesExp = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->FabricVertexExp.pfnGetSubVerticesExp;
+        if( nullptr == pfnGetSubVerticesExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -7109,11 +8713,22 @@ zeFabricVertexGetPropertiesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetPropertiesExp = ze_lib::context->zeDdiTable.FabricVertexExp.pfnGetPropertiesExp;
+    auto pfnGetPropertiesExp = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->FabricVertexExp.pfnGetPropertiesExp;
     if( nullptr == pfnGetPropertiesExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetPropertiesExp = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->FabricVertexExp.pfnGetPropertiesExp;
+        if( nullptr == pfnGetPropertiesExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -7151,11 +8766,22 @@ zeFabricVertexGetDeviceExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetDeviceExp = ze_lib::context->zeDdiTable.FabricVertexExp.pfnGetDeviceExp;
+    auto pfnGetDeviceExp = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->FabricVertexExp.pfnGetDeviceExp;
     if( nullptr == pfnGetDeviceExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetDeviceExp = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->FabricVertexExp.pfnGetDeviceExp;
+        if( nullptr == pfnGetDeviceExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -7191,11 +8817,22 @@ zeDeviceGetFabricVertexExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetFabricVertexExp = ze_lib::context->zeDdiTable.DeviceExp.pfnGetFabricVertexExp;
+    auto pfnGetFabricVertexExp = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->DeviceExp.pfnGetFabricVertexExp;
     if( nullptr == pfnGetFabricVertexExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetFabricVertexExp = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->DeviceExp.pfnGetFabricVertexExp;
+        if( nullptr == pfnGetFabricVertexExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -7241,11 +8878,22 @@ zeFabricEdgeGetExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetExp = ze_lib::context->zeDdiTable.FabricEdgeExp.pfnGetExp;
+    auto pfnGetExp = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->FabricEdgeExp.pfnGetExp;
     if( nullptr == pfnGetExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetExp = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->FabricEdgeExp.pfnGetExp;
+        if( nullptr == pfnGetExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -7283,11 +8931,22 @@ zeFabricEdgeGetVerticesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetVerticesExp = ze_lib::context->zeDdiTable.FabricEdgeExp.pfnGetVerticesExp;
+    auto pfnGetVerticesExp = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->FabricEdgeExp.pfnGetVerticesExp;
     if( nullptr == pfnGetVerticesExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetVerticesExp = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->FabricEdgeExp.pfnGetVerticesExp;
+        if( nullptr == pfnGetVerticesExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -7321,11 +8980,22 @@ zeFabricEdgeGetPropertiesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetPropertiesExp = ze_lib::context->zeDdiTable.FabricEdgeExp.pfnGetPropertiesExp;
+    auto pfnGetPropertiesExp = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->FabricEdgeExp.pfnGetPropertiesExp;
     if( nullptr == pfnGetPropertiesExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetPropertiesExp = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->FabricEdgeExp.pfnGetPropertiesExp;
+        if( nullptr == pfnGetPropertiesExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -7392,11 +9062,22 @@ zeEventQueryKernelTimestampsExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnQueryKernelTimestampsExt = ze_lib::context->zeDdiTable.Event.pfnQueryKernelTimestampsExt;
+    auto pfnQueryKernelTimestampsExt = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Event.pfnQueryKernelTimestampsExt;
     if( nullptr == pfnQueryKernelTimestampsExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zeTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zeLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnQueryKernelTimestampsExt = ze_lib::context->zeActiveDdiTable.load( std::memory_order_acquire )->Event.pfnQueryKernelTimestampsExt;
+        if( nullptr == pfnQueryKernelTimestampsExt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -10,6 +10,7 @@
 #include "ze_lib.h"
 #ifndef DYNAMIC_LOAD_LOADER
 #include "ze_ddi.h"
+#include "../loader/ze_loader_api.h"
 #endif
 
 namespace ze_lib
@@ -21,6 +22,12 @@ namespace ze_lib
     {
         ze_result_t result = ZE_RESULT_SUCCESS;
 
+        // the loader's exports leave the tracing layer to zeTracingInit
+        typedef void (ZE_APICALL *setPassThroughTables_t)(ze_bool_t);
+        auto setPassThroughTables = reinterpret_cast<setPassThroughTables_t>(
+            GET_FUNCTION_PTR(loader, "zeLoaderSetPassThroughTables") );
+        setPassThroughTables( true );
+
         if( ZE_RESULT_SUCCESS == result )
         {
             auto getTable = reinterpret_cast<ze_pfnGetGlobalProcAddrTable_t>(
@@ -189,6 +196,11 @@ namespace ze_lib
             result = getTable( ZE_API_VERSION_CURRENT, &zeDdiTable.FabricVertexExp );
         }
 
+        setPassThroughTables( false );
+
+        if( ( ZE_RESULT_SUCCESS == result ) && ( nullptr != tracing_lib ) )
+            result = zeTracingInit();
+
         return result;
     }
 #else
@@ -196,6 +208,9 @@ namespace ze_lib
     {
         ze_result_t result = ZE_RESULT_SUCCESS;
 
+        // the loader's exports leave the tracing layer to zeTracingInit
+        zeLoaderSetPassThroughTables( true );
+
         if( ZE_RESULT_SUCCESS == result )
         {
             result = zeGetGlobalProcAddrTable( ZE_API_VERSION_CURRENT, &zeDdiTable.Global );
@@ -316,8 +331,247 @@ namespace ze_lib
             result = zeGetFabricVertexExpProcAddrTable( ZE_API_VERSION_CURRENT, &zeDdiTable.FabricVertexExp );
         }
 
+        zeLoaderSetPassThroughTables( false );
+
+        if( ( ZE_RESULT_SUCCESS == result ) && ( nullptr != tracing_lib ) )
+            result = zeTracingInit();
+
         return result;
     }
 #endif
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// fills zeTracingDdiTable with the tracing layer's intercepts of a copy of
+    /// zeDdiTable; the exported functions switch to it while a tracer is enabled
+    __zedlllocal ze_result_t context_t::zeTracingInit()
+    {
+        ze_result_t result = ZE_RESULT_SUCCESS;
+        zeTracingDdiTable = zeDdiTable;
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetGlobalProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zeGetGlobalProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zeTracingDdiTable.Global );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetDriverProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zeGetDriverProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zeTracingDdiTable.Driver );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetDeviceProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zeGetDeviceProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zeTracingDdiTable.Device );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetDeviceExpProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zeGetDeviceExpProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zeTracingDdiTable.DeviceExp );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetContextProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zeGetContextProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zeTracingDdiTable.Context );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetCommandQueueProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zeGetCommandQueueProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zeTracingDdiTable.CommandQueue );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetCommandListProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zeGetCommandListProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zeTracingDdiTable.CommandList );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetEventProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zeGetEventProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zeTracingDdiTable.Event );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetEventExpProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zeGetEventExpProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zeTracingDdiTable.EventExp );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetEventPoolProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zeGetEventPoolProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zeTracingDdiTable.EventPool );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetFenceProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zeGetFenceProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zeTracingDdiTable.Fence );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetImageProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zeGetImageProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zeTracingDdiTable.Image );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetImageExpProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zeGetImageExpProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zeTracingDdiTable.ImageExp );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetKernelProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zeGetKernelProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zeTracingDdiTable.Kernel );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetKernelExpProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zeGetKernelExpProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zeTracingDdiTable.KernelExp );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetMemProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zeGetMemProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zeTracingDdiTable.Mem );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetMemExpProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zeGetMemExpProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zeTracingDdiTable.MemExp );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetModuleProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zeGetModuleProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zeTracingDdiTable.Module );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetModuleBuildLogProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zeGetModuleBuildLogProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zeTracingDdiTable.ModuleBuildLog );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetPhysicalMemProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zeGetPhysicalMemProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zeTracingDdiTable.PhysicalMem );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetSamplerProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zeGetSamplerProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zeTracingDdiTable.Sampler );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetVirtualMemProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zeGetVirtualMemProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zeTracingDdiTable.VirtualMem );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetFabricEdgeExpProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zeGetFabricEdgeExpProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zeTracingDdiTable.FabricEdgeExp );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<ze_pfnGetFabricVertexExpProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zeGetFabricVertexExpProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zeTracingDdiTable.FabricVertexExp );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            std::lock_guard<std::mutex> lock( tracingMutex );
+            zeTracingTablesLoaded = true;
+            updateActiveTables();
+        }
+
+        return result;
+    }
+
 } // namespace ze_lib
@@ -11,6 +11,17 @@
  */
 #include "ze_lib.h"
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Fills the tracing tables on the first call using them.
+static ze_result_t
+ensureTracingTablesLoaded()
+{
+    if( ze_lib::context->inTeardown || !ze_lib::context->isInitialized )
+        return ZE_RESULT_ERROR_UNINITIALIZED;
+
+    return ze_lib::context->zelTracingLoadTables();
+}
+
 extern "C" {
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -36,8 +47,10 @@ zelTracerCreate(
     zel_tracer_handle_t* phTracer               ///< [out] pointer to handle of tracer object created
     )
 {
-    if(ze_lib::context->inTeardown)
-        return ZE_RESULT_ERROR_UNINITIALIZED;
+    auto loadResult = ensureTracingTablesLoaded();
+    if( ZE_RESULT_SUCCESS != loadResult )
+        return loadResult;
+
     auto pfnCreate = ze_lib::context->zelTracingDdiTable.Tracer.pfnCreate;
     if( nullptr == pfnCreate )
         return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -68,8 +81,10 @@ zelTracerDestroy(
     zel_tracer_handle_t hTracer                 ///< [in][release] handle of tracer object to destroy
     )
 {
-    if(ze_lib::context->inTeardown)
-        return ZE_RESULT_ERROR_UNINITIALIZED;
+    auto loadResult = ensureTracingTablesLoaded();
+    if( ZE_RESULT_SUCCESS != loadResult )
+        return loadResult;
+
     auto pfnDestroy = ze_lib::context->zelTracingDdiTable.Tracer.pfnDestroy;
     if( nullptr == pfnDestroy )
         return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -103,8 +118,10 @@ zelTracerSetPrologues(
     zel_core_callbacks_t* pCoreCbs              ///< [in] pointer to table of 'core' callback function pointers
     )
 {
-    if(ze_lib::context->inTeardown)
-        return ZE_RESULT_ERROR_UNINITIALIZED;
+    auto loadResult = ensureTracingTablesLoaded();
+    if( ZE_RESULT_SUCCESS != loadResult )
+        return loadResult;
+
     auto pfnSetPrologues = ze_lib::context->zelTracingDdiTable.Tracer.pfnSetPrologues;
     if( nullptr == pfnSetPrologues )
         return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -138,8 +155,10 @@ zelTracerSetEpilogues(
     zel_core_callbacks_t* pCoreCbs              ///< [in] pointer to table of 'core' callback function pointers
     )
 {
-    if(ze_lib::context->inTeardown)
-        return ZE_RESULT_ERROR_UNINITIALIZED;
+    auto loadResult = ensureTracingTablesLoaded();
+    if( ZE_RESULT_SUCCESS != loadResult )
+        return loadResult;
+
     auto pfnSetEpilogues = ze_lib::context->zelTracingDdiTable.Tracer.pfnSetEpilogues;
     if( nullptr == pfnSetEpilogues )
         return ZE_RESULT_ERROR_UNINITIALIZED;
@@ -166,13 +185,15 @@ zelTracerSetEnabled(
     ze_bool_t enable                            ///< [in] enable the tracer if true; disable if false
     )
 {
-    if(ze_lib::context->inTeardown)
-        return ZE_RESULT_ERROR_UNINITIALIZED;
+    auto loadResult = ensureTracingTablesLoaded();
+    if( ZE_RESULT_SUCCESS != loadResult )
+        return loadResult;
+
     auto pfnSetEnabled = ze_lib::context->zelTracingDdiTable.Tracer.pfnSetEnabled;
     if( nullptr == pfnSetEnabled )
         return ZE_RESULT_ERROR_UNINITIALIZED;
 
-    return pfnSetEnabled( hTracer, enable );
+    return ze_lib::context->tracerSetEnabled( pfnSetEnabled, hTracer, enable );
 }
 
 } // extern "C"
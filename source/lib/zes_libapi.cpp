@@ -48,24 +48,44 @@ zesInit(
                                                     ///< currently unused, must be 0 (default).
     )
 {
+    bool sysmanOnly = true;
     static ze_result_t result = ZE_RESULT_SUCCESS;
-    std::call_once(ze_lib::context->initOnce, [flags]() {
-        result = ze_lib::context->Init(flags, true);
-
+    bool initialized = false;
+    std::call_once(ze_lib::context->initOnce, [flags, sysmanOnly, &initialized]() {
+        result = ze_lib::context->Init(flags, sysmanOnly);
+        initialized = true;
     });
 
     if( ZE_RESULT_SUCCESS != result )
         return result;
 
+    // a later call may admit drivers the flags of the first one excluded
+    if( !initialized ) {
+        auto checkResult = ze_lib::context->CheckDrivers(flags, sysmanOnly);
+        if( ZE_RESULT_SUCCESS != checkResult )
+            return checkResult;
+    }
+
     if(ze_lib::context->inTeardown) {
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnInit = ze_lib::context->zesDdiTable.Global.pfnInit;
+    auto pfnInit = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Global.pfnInit;
     if( nullptr == pfnInit ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnInit = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Global.pfnInit;
+        if( nullptr == pfnInit )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -109,11 +129,22 @@ zesDriverGet(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGet = ze_lib::context->zesDdiTable.Driver.pfnGet;
+    auto pfnGet = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Driver.pfnGet;
     if( nullptr == pfnGet ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGet = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Driver.pfnGet;
+        if( nullptr == pfnGet )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -160,11 +191,22 @@ zesDeviceGet(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGet = ze_lib::context->zesDdiTable.Device.pfnGet;
+    auto pfnGet = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGet;
     if( nullptr == pfnGet ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGet = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGet;
+        if( nullptr == pfnGet )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -198,11 +240,22 @@ zesDeviceGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.Device.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGetProperties;
+        if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -237,11 +290,22 @@ zesDeviceGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetState = ze_lib::context->zesDdiTable.Device.pfnGetState;
+    auto pfnGetState = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGetState;
     if( nullptr == pfnGetState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetState = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGetState;
+        if( nullptr == pfnGetState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -284,11 +348,22 @@ zesDeviceReset(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnReset = ze_lib::context->zesDdiTable.Device.pfnReset;
+    auto pfnReset = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnReset;
     if( nullptr == pfnReset ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnReset = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnReset;
+        if( nullptr == pfnReset )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -340,11 +415,22 @@ zesDeviceProcessesGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnProcessesGetState = ze_lib::context->zesDdiTable.Device.pfnProcessesGetState;
+    auto pfnProcessesGetState = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnProcessesGetState;
     if( nullptr == pfnProcessesGetState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnProcessesGetState = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnProcessesGetState;
+        if( nullptr == pfnProcessesGetState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -378,11 +464,22 @@ zesDevicePciGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnPciGetProperties = ze_lib::context->zesDdiTable.Device.pfnPciGetProperties;
+    auto pfnPciGetProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnPciGetProperties;
     if( nullptr == pfnPciGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnPciGetProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnPciGetProperties;
+        if( nullptr == pfnPciGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -416,11 +513,22 @@ zesDevicePciGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnPciGetState = ze_lib::context->zesDdiTable.Device.pfnPciGetState;
+    auto pfnPciGetState = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnPciGetState;
     if( nullptr == pfnPciGetState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnPciGetState = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnPciGetState;
+        if( nullptr == pfnPciGetState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -462,11 +570,22 @@ zesDevicePciGetBars(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnPciGetBars = ze_lib::context->zesDdiTable.Device.pfnPciGetBars;
+    auto pfnPciGetBars = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnPciGetBars;
     if( nullptr == pfnPciGetBars ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnPciGetBars = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnPciGetBars;
+        if( nullptr == pfnPciGetBars )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -502,11 +621,22 @@ zesDevicePciGetStats(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnPciGetStats = ze_lib::context->zesDdiTable.Device.pfnPciGetStats;
+    auto pfnPciGetStats = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnPciGetStats;
     if( nullptr == pfnPciGetStats ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnPciGetStats = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnPciGetStats;
+        if( nullptr == pfnPciGetStats )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -540,11 +670,22 @@ zesDeviceSetOverclockWaiver(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetOverclockWaiver = ze_lib::context->zesDdiTable.Device.pfnSetOverclockWaiver;
+    auto pfnSetOverclockWaiver = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnSetOverclockWaiver;
     if( nullptr == pfnSetOverclockWaiver ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnSetOverclockWaiver = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnSetOverclockWaiver;
+        if( nullptr == pfnSetOverclockWaiver )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -582,11 +723,22 @@ zesDeviceGetOverclockDomains(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetOverclockDomains = ze_lib::context->zesDdiTable.Device.pfnGetOverclockDomains;
+    auto pfnGetOverclockDomains = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGetOverclockDomains;
     if( nullptr == pfnGetOverclockDomains ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetOverclockDomains = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGetOverclockDomains;
+        if( nullptr == pfnGetOverclockDomains )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -628,11 +780,22 @@ zesDeviceGetOverclockControls(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetOverclockControls = ze_lib::context->zesDdiTable.Device.pfnGetOverclockControls;
+    auto pfnGetOverclockControls = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGetOverclockControls;
     if( nullptr == pfnGetOverclockControls ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetOverclockControls = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGetOverclockControls;
+        if( nullptr == pfnGetOverclockControls )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -668,11 +831,22 @@ zesDeviceResetOverclockSettings(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnResetOverclockSettings = ze_lib::context->zesDdiTable.Device.pfnResetOverclockSettings;
+    auto pfnResetOverclockSettings = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnResetOverclockSettings;
     if( nullptr == pfnResetOverclockSettings ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnResetOverclockSettings = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnResetOverclockSettings;
+        if( nullptr == pfnResetOverclockSettings )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -717,11 +891,22 @@ zesDeviceReadOverclockState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnReadOverclockState = ze_lib::context->zesDdiTable.Device.pfnReadOverclockState;
+    auto pfnReadOverclockState = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnReadOverclockState;
     if( nullptr == pfnReadOverclockState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnReadOverclockState = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnReadOverclockState;
+        if( nullptr == pfnReadOverclockState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -765,11 +950,22 @@ zesDeviceEnumOverclockDomains(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumOverclockDomains = ze_lib::context->zesDdiTable.Device.pfnEnumOverclockDomains;
+    auto pfnEnumOverclockDomains = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnEnumOverclockDomains;
     if( nullptr == pfnEnumOverclockDomains ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnEnumOverclockDomains = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnEnumOverclockDomains;
+        if( nullptr == pfnEnumOverclockDomains )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -805,11 +1001,22 @@ zesOverclockGetDomainProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetDomainProperties = ze_lib::context->zesDdiTable.Overclock.pfnGetDomainProperties;
+    auto pfnGetDomainProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Overclock.pfnGetDomainProperties;
     if( nullptr == pfnGetDomainProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetDomainProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Overclock.pfnGetDomainProperties;
+        if( nullptr == pfnGetDomainProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -845,11 +1052,22 @@ zesOverclockGetDomainVFProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetDomainVFProperties = ze_lib::context->zesDdiTable.Overclock.pfnGetDomainVFProperties;
+    auto pfnGetDomainVFProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Overclock.pfnGetDomainVFProperties;
     if( nullptr == pfnGetDomainVFProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetDomainVFProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Overclock.pfnGetDomainVFProperties;
+        if( nullptr == pfnGetDomainVFProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -888,11 +1106,22 @@ zesOverclockGetDomainControlProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetDomainControlProperties = ze_lib::context->zesDdiTable.Overclock.pfnGetDomainControlProperties;
+    auto pfnGetDomainControlProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Overclock.pfnGetDomainControlProperties;
     if( nullptr == pfnGetDomainControlProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetDomainControlProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Overclock.pfnGetDomainControlProperties;
+        if( nullptr == pfnGetDomainControlProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -931,11 +1160,22 @@ zesOverclockGetControlCurrentValue(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetControlCurrentValue = ze_lib::context->zesDdiTable.Overclock.pfnGetControlCurrentValue;
+    auto pfnGetControlCurrentValue = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Overclock.pfnGetControlCurrentValue;
     if( nullptr == pfnGetControlCurrentValue ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetControlCurrentValue = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Overclock.pfnGetControlCurrentValue;
+        if( nullptr == pfnGetControlCurrentValue )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -975,11 +1215,22 @@ zesOverclockGetControlPendingValue(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetControlPendingValue = ze_lib::context->zesDdiTable.Overclock.pfnGetControlPendingValue;
+    auto pfnGetControlPendingValue = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Overclock.pfnGetControlPendingValue;
     if( nullptr == pfnGetControlPendingValue ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetControlPendingValue = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Overclock.pfnGetControlPendingValue;
+        if( nullptr == pfnGetControlPendingValue )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1020,11 +1271,22 @@ zesOverclockSetControlUserValue(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetControlUserValue = ze_lib::context->zesDdiTable.Overclock.pfnSetControlUserValue;
+    auto pfnSetControlUserValue = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Overclock.pfnSetControlUserValue;
     if( nullptr == pfnSetControlUserValue ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnSetControlUserValue = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Overclock.pfnSetControlUserValue;
+        if( nullptr == pfnSetControlUserValue )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1065,11 +1327,22 @@ zesOverclockGetControlState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetControlState = ze_lib::context->zesDdiTable.Overclock.pfnGetControlState;
+    auto pfnGetControlState = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Overclock.pfnGetControlState;
     if( nullptr == pfnGetControlState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetControlState = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Overclock.pfnGetControlState;
+        if( nullptr == pfnGetControlState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1113,11 +1386,22 @@ zesOverclockGetVFPointValues(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetVFPointValues = ze_lib::context->zesDdiTable.Overclock.pfnGetVFPointValues;
+    auto pfnGetVFPointValues = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Overclock.pfnGetVFPointValues;
     if( nullptr == pfnGetVFPointValues ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetVFPointValues = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Overclock.pfnGetVFPointValues;
+        if( nullptr == pfnGetVFPointValues )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1156,11 +1440,22 @@ zesOverclockSetVFPointValues(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetVFPointValues = ze_lib::context->zesDdiTable.Overclock.pfnSetVFPointValues;
+    auto pfnSetVFPointValues = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Overclock.pfnSetVFPointValues;
     if( nullptr == pfnSetVFPointValues ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnSetVFPointValues = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Overclock.pfnSetVFPointValues;
+        if( nullptr == pfnSetVFPointValues )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1204,11 +1499,22 @@ zesDeviceEnumDiagnosticTestSuites(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumDiagnosticTestSuites = ze_lib::context->zesDdiTable.Device.pfnEnumDiagnosticTestSuites;
+    auto pfnEnumDiagnosticTestSuites = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnEnumDiagnosticTestSuites;
     if( nullptr == pfnEnumDiagnosticTestSuites ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnEnumDiagnosticTestSuites = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnEnumDiagnosticTestSuites;
+        if( nullptr == pfnEnumDiagnosticTestSuites )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1243,11 +1549,22 @@ zesDiagnosticsGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.Diagnostics.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Diagnostics.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Diagnostics.pfnGetProperties;
+        if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1293,11 +1610,22 @@ zesDiagnosticsGetTests(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetTests = ze_lib::context->zesDdiTable.Diagnostics.pfnGetTests;
+    auto pfnGetTests = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Diagnostics.pfnGetTests;
     if( nullptr == pfnGetTests ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetTests = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Diagnostics.pfnGetTests;
+        if( nullptr == pfnGetTests )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1346,11 +1674,22 @@ zesDiagnosticsRunTests(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnRunTests = ze_lib::context->zesDdiTable.Diagnostics.pfnRunTests;
+    auto pfnRunTests = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Diagnostics.pfnRunTests;
     if( nullptr == pfnRunTests ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnRunTests = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Diagnostics.pfnRunTests;
+        if( nullptr == pfnRunTests )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1384,11 +1723,22 @@ zesDeviceEccAvailable(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEccAvailable = ze_lib::context->zesDdiTable.Device.pfnEccAvailable;
+    auto pfnEccAvailable = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnEccAvailable;
     if( nullptr == pfnEccAvailable ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnEccAvailable = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnEccAvailable;
+        if( nullptr == pfnEccAvailable )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1422,11 +1772,22 @@ zesDeviceEccConfigurable(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEccConfigurable = ze_lib::context->zesDdiTable.Device.pfnEccConfigurable;
+    auto pfnEccConfigurable = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnEccConfigurable;
     if( nullptr == pfnEccConfigurable ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnEccConfigurable = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnEccConfigurable;
+        if( nullptr == pfnEccConfigurable )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1460,11 +1821,22 @@ zesDeviceGetEccState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetEccState = ze_lib::context->zesDdiTable.Device.pfnGetEccState;
+    auto pfnGetEccState = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGetEccState;
     if( nullptr == pfnGetEccState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetEccState = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGetEccState;
+        if( nullptr == pfnGetEccState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1506,11 +1878,22 @@ zesDeviceSetEccState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetEccState = ze_lib::context->zesDdiTable.Device.pfnSetEccState;
+    auto pfnSetEccState = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnSetEccState;
     if( nullptr == pfnSetEccState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnSetEccState = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnSetEccState;
+        if( nullptr == pfnSetEccState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1554,11 +1937,22 @@ zesDeviceEnumEngineGroups(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumEngineGroups = ze_lib::context->zesDdiTable.Device.pfnEnumEngineGroups;
+    auto pfnEnumEngineGroups = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnEnumEngineGroups;
     if( nullptr == pfnEnumEngineGroups ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnEnumEngineGroups = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnEnumEngineGroups;
+        if( nullptr == pfnEnumEngineGroups )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1592,11 +1986,22 @@ zesEngineGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.Engine.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Engine.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Engine.pfnGetProperties;
+        if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1631,11 +2036,22 @@ zesEngineGetActivity(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetActivity = ze_lib::context->zesDdiTable.Engine.pfnGetActivity;
+    auto pfnGetActivity = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Engine.pfnGetActivity;
     if( nullptr == pfnGetActivity ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetActivity = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Engine.pfnGetActivity;
+        if( nullptr == pfnGetActivity )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1669,11 +2085,22 @@ zesDeviceEventRegister(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEventRegister = ze_lib::context->zesDdiTable.Device.pfnEventRegister;
+    auto pfnEventRegister = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnEventRegister;
     if( nullptr == pfnEventRegister ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnEventRegister = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnEventRegister;
+        if( nullptr == pfnEventRegister )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1729,11 +2156,22 @@ zesDriverEventListen(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEventListen = ze_lib::context->zesDdiTable.Driver.pfnEventListen;
+    auto pfnEventListen = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Driver.pfnEventListen;
     if( nullptr == pfnEventListen ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnEventListen = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Driver.pfnEventListen;
+        if( nullptr == pfnEventListen )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1789,11 +2227,22 @@ zesDriverEventListenEx(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEventListenEx = ze_lib::context->zesDdiTable.Driver.pfnEventListenEx;
+    auto pfnEventListenEx = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Driver.pfnEventListenEx;
     if( nullptr == pfnEventListenEx ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnEventListenEx = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Driver.pfnEventListenEx;
+        if( nullptr == pfnEventListenEx )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1837,11 +2286,22 @@ zesDeviceEnumFabricPorts(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumFabricPorts = ze_lib::context->zesDdiTable.Device.pfnEnumFabricPorts;
+    auto pfnEnumFabricPorts = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnEnumFabricPorts;
     if( nullptr == pfnEnumFabricPorts ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnEnumFabricPorts = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnEnumFabricPorts;
+        if( nullptr == pfnEnumFabricPorts )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1875,11 +2335,22 @@ zesFabricPortGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.FabricPort.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->FabricPort.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->FabricPort.pfnGetProperties;
+        if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1914,11 +2385,22 @@ zesFabricPortGetLinkType(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetLinkType = ze_lib::context->zesDdiTable.FabricPort.pfnGetLinkType;
+    auto pfnGetLinkType = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->FabricPort.pfnGetLinkType;
     if( nullptr == pfnGetLinkType ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetLinkType = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->FabricPort.pfnGetLinkType;
+        if( nullptr == pfnGetLinkType )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1952,11 +2434,22 @@ zesFabricPortGetConfig(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetConfig = ze_lib::context->zesDdiTable.FabricPort.pfnGetConfig;
+    auto pfnGetConfig = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->FabricPort.pfnGetConfig;
     if( nullptr == pfnGetConfig ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetConfig = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->FabricPort.pfnGetConfig;
+        if( nullptr == pfnGetConfig )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1992,11 +2485,22 @@ zesFabricPortSetConfig(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetConfig = ze_lib::context->zesDdiTable.FabricPort.pfnSetConfig;
+    auto pfnSetConfig = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->FabricPort.pfnSetConfig;
     if( nullptr == pfnSetConfig ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnSetConfig = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->FabricPort.pfnSetConfig;
+        if( nullptr == pfnSetConfig )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -2031,11 +2535,22 @@ zesFabricPortGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetState = ze_lib::context->zesDdiTable.FabricPort.pfnGetState;
+    auto pfnGetState = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->FabricPort.pfnGetState;
     if( nullptr == pfnGetState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetState = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->FabricPort.pfnGetState;
+        if( nullptr == pfnGetState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -2071,11 +2586,22 @@ zesFabricPortGetThroughput(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetThroughput = ze_lib::context->zesDdiTable.FabricPort.pfnGetThroughput;
+    auto pfnGetThroughput = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->FabricPort.pfnGetThroughput;
     if( nullptr == pfnGetThroughput ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetThroughput = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->FabricPort.pfnGetThroughput;
+        if( nullptr == pfnGetThroughput )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -2119,11 +2645,22 @@ zesDeviceEnumFans(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumFans = ze_lib::context->zesDdiTable.Device.pfnEnumFans;
+    auto pfnEnumFans = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnEnumFans;
     if( nullptr == pfnEnumFans ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnEnumFans = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnEnumFans;
+        if( nullptr == pfnEnumFans )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -2157,11 +2694,22 @@ zesFanGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.Fan.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Fan.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Fan.pfnGetProperties;
+        if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -2196,11 +2744,22 @@ zesFanGetConfig(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetConfig = ze_lib::context->zesDdiTable.Fan.pfnGetConfig;
+    auto pfnGetConfig = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Fan.pfnGetConfig;
     if( nullptr == pfnGetConfig ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetConfig = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Fan.pfnGetConfig;
+        if( nullptr == pfnGetConfig )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -2234,11 +2793,22 @@ zesFanSetDefaultMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetDefaultMode = ze_lib::context->zesDdiTable.Fan.pfnSetDefaultMode;
+    auto pfnSetDefaultMode = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Fan.pfnSetDefaultMode;
     if( nullptr == pfnSetDefaultMode ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnSetDefaultMode = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Fan.pfnSetDefaultMode;
+        if( nullptr == pfnSetDefaultMode )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -2277,11 +2847,22 @@ zesFanSetFixedSpeedMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetFixedSpeedMode = ze_lib::context->zesDdiTable.Fan.pfnSetFixedSpeedMode;
+    auto pfnSetFixedSpeedMode = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Fan.pfnSetFixedSpeedMode;
     if( nullptr == pfnSetFixedSpeedMode ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnSetFixedSpeedMode = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Fan.pfnSetFixedSpeedMode;
+        if( nullptr == pfnSetFixedSpeedMode )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -2322,11 +2903,22 @@ zesFanSetSpeedTableMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetSpeedTableMode = ze_lib::context->zesDdiTable.Fan.pfnSetSpeedTableMode;
+    auto pfnSetSpeedTableMode = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Fan.pfnSetSpeedTableMode;
     if( nullptr == pfnSetSpeedTableMode ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnSetSpeedTableMode = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Fan.pfnSetSpeedTableMode;
+        if( nullptr == pfnSetSpeedTableMode )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -2367,11 +2959,22 @@ zesFanGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetState = ze_lib::context->zesDdiTable.Fan.pfnGetState;
+    auto pfnGetState = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Fan.pfnGetState;
     if( nullptr == pfnGetState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetState = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Fan.pfnGetState;
+        if( nullptr == pfnGetState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -2415,11 +3018,22 @@ zesDeviceEnumFirmwares(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumFirmwares = ze_lib::context->zesDdiTable.Device.pfnEnumFirmwares;
+    auto pfnEnumFirmwares = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnEnumFirmwares;
     if( nullptr == pfnEnumFirmwares ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnEnumFirmwares = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnEnumFirmwares;
+        if( nullptr == pfnEnumFirmwares )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -2454,11 +3068,22 @@ zesFirmwareGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.Firmware.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Firmware.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Firmware.pfnGetProperties;
+        if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -2495,11 +3120,22 @@ zesFirmwareFlash(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnFlash = ze_lib::context->zesDdiTable.Firmware.pfnFlash;
+    auto pfnFlash = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Firmware.pfnFlash;
     if( nullptr == pfnFlash ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnFlash = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Firmware.pfnFlash;
+        if( nullptr == pfnFlash )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -2543,11 +3179,22 @@ zesDeviceEnumFrequencyDomains(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumFrequencyDomains = ze_lib::context->zesDdiTable.Device.pfnEnumFrequencyDomains;
+    auto pfnEnumFrequencyDomains = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnEnumFrequencyDomains;
     if( nullptr == pfnEnumFrequencyDomains ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnEnumFrequencyDomains = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnEnumFrequencyDomains;
+        if( nullptr == pfnEnumFrequencyDomains )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -2581,11 +3228,22 @@ zesFrequencyGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.Frequency.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Frequency.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Frequency.pfnGetProperties;
+        if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -2630,11 +3288,22 @@ zesFrequencyGetAvailableClocks(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetAvailableClocks = ze_lib::context->zesDdiTable.Frequency.pfnGetAvailableClocks;
+    auto pfnGetAvailableClocks = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Frequency.pfnGetAvailableClocks;
     if( nullptr == pfnGetAvailableClocks ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetAvailableClocks = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Frequency.pfnGetAvailableClocks;
+        if( nullptr == pfnGetAvailableClocks )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -2669,11 +3338,22 @@ zesFrequencyGetRange(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetRange = ze_lib::context->zesDdiTable.Frequency.pfnGetRange;
+    auto pfnGetRange = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Frequency.pfnGetRange;
     if( nullptr == pfnGetRange ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetRange = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Frequency.pfnGetRange;
+        if( nullptr == pfnGetRange )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -2710,11 +3390,22 @@ zesFrequencySetRange(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetRange = ze_lib::context->zesDdiTable.Frequency.pfnSetRange;
+    auto pfnSetRange = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Frequency.pfnSetRange;
     if( nullptr == pfnSetRange ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnSetRange = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Frequency.pfnSetRange;
+        if( nullptr == pfnSetRange )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -2749,11 +3440,22 @@ zesFrequencyGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetState = ze_lib::context->zesDdiTable.Frequency.pfnGetState;
+    auto pfnGetState = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Frequency.pfnGetState;
     if( nullptr == pfnGetState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetState = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Frequency.pfnGetState;
+        if( nullptr == pfnGetState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -2788,11 +3490,22 @@ zesFrequencyGetThrottleTime(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetThrottleTime = ze_lib::context->zesDdiTable.Frequency.pfnGetThrottleTime;
+    auto pfnGetThrottleTime = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Frequency.pfnGetThrottleTime;
     if( nullptr == pfnGetThrottleTime ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetThrottleTime = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Frequency.pfnGetThrottleTime;
+        if( nullptr == pfnGetThrottleTime )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -2827,11 +3540,22 @@ zesFrequencyOcGetCapabilities(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOcGetCapabilities = ze_lib::context->zesDdiTable.Frequency.pfnOcGetCapabilities;
+    auto pfnOcGetCapabilities = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Frequency.pfnOcGetCapabilities;
     if( nullptr == pfnOcGetCapabilities ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnOcGetCapabilities = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Frequency.pfnOcGetCapabilities;
+        if( nullptr == pfnOcGetCapabilities )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -2876,11 +3600,22 @@ zesFrequencyOcGetFrequencyTarget(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOcGetFrequencyTarget = ze_lib::context->zesDdiTable.Frequency.pfnOcGetFrequencyTarget;
+    auto pfnOcGetFrequencyTarget = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Frequency.pfnOcGetFrequencyTarget;
     if( nullptr == pfnOcGetFrequencyTarget ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnOcGetFrequencyTarget = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Frequency.pfnOcGetFrequencyTarget;
+        if( nullptr == pfnOcGetFrequencyTarget )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -2923,11 +3658,22 @@ zesFrequencyOcSetFrequencyTarget(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOcSetFrequencyTarget = ze_lib::context->zesDdiTable.Frequency.pfnOcSetFrequencyTarget;
+    auto pfnOcSetFrequencyTarget = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Frequency.pfnOcSetFrequencyTarget;
     if( nullptr == pfnOcSetFrequencyTarget ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnOcSetFrequencyTarget = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Frequency.pfnOcSetFrequencyTarget;
+        if( nullptr == pfnOcSetFrequencyTarget )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -2975,11 +3721,22 @@ zesFrequencyOcGetVoltageTarget(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOcGetVoltageTarget = ze_lib::context->zesDdiTable.Frequency.pfnOcGetVoltageTarget;
+    auto pfnOcGetVoltageTarget = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Frequency.pfnOcGetVoltageTarget;
     if( nullptr == pfnOcGetVoltageTarget ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnOcGetVoltageTarget = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Frequency.pfnOcGetVoltageTarget;
+        if( nullptr == pfnOcGetVoltageTarget )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3024,11 +3781,22 @@ zesFrequencyOcSetVoltageTarget(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOcSetVoltageTarget = ze_lib::context->zesDdiTable.Frequency.pfnOcSetVoltageTarget;
+    auto pfnOcSetVoltageTarget = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Frequency.pfnOcSetVoltageTarget;
     if( nullptr == pfnOcSetVoltageTarget ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnOcSetVoltageTarget = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Frequency.pfnOcSetVoltageTarget;
+        if( nullptr == pfnOcSetVoltageTarget )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3070,11 +3838,22 @@ zesFrequencyOcSetMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOcSetMode = ze_lib::context->zesDdiTable.Frequency.pfnOcSetMode;
+    auto pfnOcSetMode = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Frequency.pfnOcSetMode;
     if( nullptr == pfnOcSetMode ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnOcSetMode = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Frequency.pfnOcSetMode;
+        if( nullptr == pfnOcSetMode )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3116,11 +3895,22 @@ zesFrequencyOcGetMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOcGetMode = ze_lib::context->zesDdiTable.Frequency.pfnOcGetMode;
+    auto pfnOcGetMode = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Frequency.pfnOcGetMode;
     if( nullptr == pfnOcGetMode ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnOcGetMode = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Frequency.pfnOcGetMode;
+        if( nullptr == pfnOcGetMode )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3158,11 +3948,22 @@ zesFrequencyOcGetIccMax(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOcGetIccMax = ze_lib::context->zesDdiTable.Frequency.pfnOcGetIccMax;
+    auto pfnOcGetIccMax = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Frequency.pfnOcGetIccMax;
     if( nullptr == pfnOcGetIccMax ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnOcGetIccMax = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Frequency.pfnOcGetIccMax;
+        if( nullptr == pfnOcGetIccMax )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3204,11 +4005,22 @@ zesFrequencyOcSetIccMax(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOcSetIccMax = ze_lib::context->zesDdiTable.Frequency.pfnOcSetIccMax;
+    auto pfnOcSetIccMax = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Frequency.pfnOcSetIccMax;
     if( nullptr == pfnOcSetIccMax ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnOcSetIccMax = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Frequency.pfnOcSetIccMax;
+        if( nullptr == pfnOcSetIccMax )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3245,11 +4057,22 @@ zesFrequencyOcGetTjMax(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOcGetTjMax = ze_lib::context->zesDdiTable.Frequency.pfnOcGetTjMax;
+    auto pfnOcGetTjMax = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Frequency.pfnOcGetTjMax;
     if( nullptr == pfnOcGetTjMax ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnOcGetTjMax = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Frequency.pfnOcGetTjMax;
+        if( nullptr == pfnOcGetTjMax )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3291,11 +4114,22 @@ zesFrequencyOcSetTjMax(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOcSetTjMax = ze_lib::context->zesDdiTable.Frequency.pfnOcSetTjMax;
+    auto pfnOcSetTjMax = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Frequency.pfnOcSetTjMax;
     if( nullptr == pfnOcSetTjMax ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnOcSetTjMax = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Frequency.pfnOcSetTjMax;
+        if( nullptr == pfnOcSetTjMax )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3339,11 +4173,22 @@ zesDeviceEnumLeds(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumLeds = ze_lib::context->zesDdiTable.Device.pfnEnumLeds;
+    auto pfnEnumLeds = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnEnumLeds;
     if( nullptr == pfnEnumLeds ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnEnumLeds = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnEnumLeds;
+        if( nullptr == pfnEnumLeds )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3377,11 +4222,22 @@ zesLedGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.Led.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Led.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Led.pfnGetProperties;
+        if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3415,11 +4271,22 @@ zesLedGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetState = ze_lib::context->zesDdiTable.Led.pfnGetState;
+    auto pfnGetState = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Led.pfnGetState;
     if( nullptr == pfnGetState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetState = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Led.pfnGetState;
+        if( nullptr == pfnGetState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3453,11 +4320,22 @@ zesLedSetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetState = ze_lib::context->zesDdiTable.Led.pfnSetState;
+    auto pfnSetState = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Led.pfnSetState;
     if( nullptr == pfnSetState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnSetState = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Led.pfnSetState;
+        if( nullptr == pfnSetState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3495,11 +4373,22 @@ zesLedSetColor(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetColor = ze_lib::context->zesDdiTable.Led.pfnSetColor;
+    auto pfnSetColor = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Led.pfnSetColor;
     if( nullptr == pfnSetColor ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnSetColor = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Led.pfnSetColor;
+        if( nullptr == pfnSetColor )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3543,11 +4432,22 @@ zesDeviceEnumMemoryModules(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumMemoryModules = ze_lib::context->zesDdiTable.Device.pfnEnumMemoryModules;
+    auto pfnEnumMemoryModules = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnEnumMemoryModules;
     if( nullptr == pfnEnumMemoryModules ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnEnumMemoryModules = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnEnumMemoryModules;
+        if( nullptr == pfnEnumMemoryModules )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3581,11 +4481,22 @@ zesMemoryGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.Memory.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Memory.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Memory.pfnGetProperties;
+        if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3619,11 +4530,22 @@ zesMemoryGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetState = ze_lib::context->zesDdiTable.Memory.pfnGetState;
+    auto pfnGetState = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Memory.pfnGetState;
     if( nullptr == pfnGetState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetState = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Memory.pfnGetState;
+        if( nullptr == pfnGetState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3660,11 +4582,22 @@ zesMemoryGetBandwidth(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetBandwidth = ze_lib::context->zesDdiTable.Memory.pfnGetBandwidth;
+    auto pfnGetBandwidth = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Memory.pfnGetBandwidth;
     if( nullptr == pfnGetBandwidth ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetBandwidth = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Memory.pfnGetBandwidth;
+        if( nullptr == pfnGetBandwidth )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3710,11 +4643,22 @@ zesDeviceEnumPerformanceFactorDomains(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumPerformanceFactorDomains = ze_lib::context->zesDdiTable.Device.pfnEnumPerformanceFactorDomains;
+    auto pfnEnumPerformanceFactorDomains = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnEnumPerformanceFactorDomains;
     if( nullptr == pfnEnumPerformanceFactorDomains ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnEnumPerformanceFactorDomains = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnEnumPerformanceFactorDomains;
+        if( nullptr == pfnEnumPerformanceFactorDomains )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3749,11 +4693,22 @@ zesPerformanceFactorGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.PerformanceFactor.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->PerformanceFactor.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->PerformanceFactor.pfnGetProperties;
+        if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3788,11 +4743,22 @@ zesPerformanceFactorGetConfig(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetConfig = ze_lib::context->zesDdiTable.PerformanceFactor.pfnGetConfig;
+    auto pfnGetConfig = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->PerformanceFactor.pfnGetConfig;
     if( nullptr == pfnGetConfig ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetConfig = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->PerformanceFactor.pfnGetConfig;
+        if( nullptr == pfnGetConfig )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3829,11 +4795,22 @@ zesPerformanceFactorSetConfig(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetConfig = ze_lib::context->zesDdiTable.PerformanceFactor.pfnSetConfig;
+    auto pfnSetConfig = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->PerformanceFactor.pfnSetConfig;
     if( nullptr == pfnSetConfig ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnSetConfig = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->PerformanceFactor.pfnSetConfig;
+        if( nullptr == pfnSetConfig )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3877,11 +4854,22 @@ zesDeviceEnumPowerDomains(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumPowerDomains = ze_lib::context->zesDdiTable.Device.pfnEnumPowerDomains;
+    auto pfnEnumPowerDomains = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnEnumPowerDomains;
     if( nullptr == pfnEnumPowerDomains ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnEnumPowerDomains = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnEnumPowerDomains;
+        if( nullptr == pfnEnumPowerDomains )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3917,11 +4905,22 @@ zesDeviceGetCardPowerDomain(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetCardPowerDomain = ze_lib::context->zesDdiTable.Device.pfnGetCardPowerDomain;
+    auto pfnGetCardPowerDomain = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGetCardPowerDomain;
     if( nullptr == pfnGetCardPowerDomain ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetCardPowerDomain = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGetCardPowerDomain;
+        if( nullptr == pfnGetCardPowerDomain )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3955,11 +4954,22 @@ zesPowerGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.Power.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Power.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Power.pfnGetProperties;
+        if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -3994,11 +5004,22 @@ zesPowerGetEnergyCounter(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetEnergyCounter = ze_lib::context->zesDdiTable.Power.pfnGetEnergyCounter;
+    auto pfnGetEnergyCounter = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Power.pfnGetEnergyCounter;
     if( nullptr == pfnGetEnergyCounter ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetEnergyCounter = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Power.pfnGetEnergyCounter;
+        if( nullptr == pfnGetEnergyCounter )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4037,11 +5058,22 @@ zesPowerGetLimits(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetLimits = ze_lib::context->zesDdiTable.Power.pfnGetLimits;
+    auto pfnGetLimits = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Power.pfnGetLimits;
     if( nullptr == pfnGetLimits ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetLimits = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Power.pfnGetLimits;
+        if( nullptr == pfnGetLimits )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4084,11 +5116,22 @@ zesPowerSetLimits(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetLimits = ze_lib::context->zesDdiTable.Power.pfnSetLimits;
+    auto pfnSetLimits = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Power.pfnSetLimits;
     if( nullptr == pfnSetLimits ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnSetLimits = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Power.pfnSetLimits;
+        if( nullptr == pfnSetLimits )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4127,11 +5170,22 @@ zesPowerGetEnergyThreshold(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetEnergyThreshold = ze_lib::context->zesDdiTable.Power.pfnGetEnergyThreshold;
+    auto pfnGetEnergyThreshold = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Power.pfnGetEnergyThreshold;
     if( nullptr == pfnGetEnergyThreshold ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetEnergyThreshold = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Power.pfnGetEnergyThreshold;
+        if( nullptr == pfnGetEnergyThreshold )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4183,11 +5237,22 @@ zesPowerSetEnergyThreshold(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetEnergyThreshold = ze_lib::context->zesDdiTable.Power.pfnSetEnergyThreshold;
+    auto pfnSetEnergyThreshold = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Power.pfnSetEnergyThreshold;
     if( nullptr == pfnSetEnergyThreshold ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnSetEnergyThreshold = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Power.pfnSetEnergyThreshold;
+        if( nullptr == pfnSetEnergyThreshold )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4231,11 +5296,22 @@ zesDeviceEnumPsus(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumPsus = ze_lib::context->zesDdiTable.Device.pfnEnumPsus;
+    auto pfnEnumPsus = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnEnumPsus;
     if( nullptr == pfnEnumPsus ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnEnumPsus = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnEnumPsus;
+        if( nullptr == pfnEnumPsus )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4269,11 +5345,22 @@ zesPsuGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.Psu.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Psu.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Psu.pfnGetProperties;
+        if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4307,11 +5394,22 @@ zesPsuGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetState = ze_lib::context->zesDdiTable.Psu.pfnGetState;
+    auto pfnGetState = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Psu.pfnGetState;
     if( nullptr == pfnGetState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetState = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Psu.pfnGetState;
+        if( nullptr == pfnGetState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4365,11 +5463,22 @@ zesDeviceEnumRasErrorSets(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumRasErrorSets = ze_lib::context->zesDdiTable.Device.pfnEnumRasErrorSets;
+    auto pfnEnumRasErrorSets = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnEnumRasErrorSets;
     if( nullptr == pfnEnumRasErrorSets ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnEnumRasErrorSets = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnEnumRasErrorSets;
+        if( nullptr == pfnEnumRasErrorSets )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4405,11 +5514,22 @@ zesRasGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.Ras.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Ras.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Ras.pfnGetProperties;
+        if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4453,11 +5573,22 @@ zesRasGetConfig(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetConfig = ze_lib::context->zesDdiTable.Ras.pfnGetConfig;
+    auto pfnGetConfig = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Ras.pfnGetConfig;
     if( nullptr == pfnGetConfig ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetConfig = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Ras.pfnGetConfig;
+        if( nullptr == pfnGetConfig )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4506,11 +5637,22 @@ zesRasSetConfig(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetConfig = ze_lib::context->zesDdiTable.Ras.pfnSetConfig;
+    auto pfnSetConfig = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Ras.pfnSetConfig;
     if( nullptr == pfnSetConfig ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnSetConfig = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Ras.pfnSetConfig;
+        if( nullptr == pfnSetConfig )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4550,11 +5692,22 @@ zesRasGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetState = ze_lib::context->zesDdiTable.Ras.pfnGetState;
+    auto pfnGetState = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Ras.pfnGetState;
     if( nullptr == pfnGetState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetState = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Ras.pfnGetState;
+        if( nullptr == pfnGetState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4604,11 +5757,22 @@ zesDeviceEnumSchedulers(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumSchedulers = ze_lib::context->zesDdiTable.Device.pfnEnumSchedulers;
+    auto pfnEnumSchedulers = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnEnumSchedulers;
     if( nullptr == pfnEnumSchedulers ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnEnumSchedulers = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnEnumSchedulers;
+        if( nullptr == pfnEnumSchedulers )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4642,11 +5806,22 @@ zesSchedulerGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.Scheduler.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Scheduler.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Scheduler.pfnGetProperties;
+        if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4682,11 +5857,22 @@ zesSchedulerGetCurrentMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetCurrentMode = ze_lib::context->zesDdiTable.Scheduler.pfnGetCurrentMode;
+    auto pfnGetCurrentMode = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Scheduler.pfnGetCurrentMode;
     if( nullptr == pfnGetCurrentMode ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetCurrentMode = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Scheduler.pfnGetCurrentMode;
+        if( nullptr == pfnGetCurrentMode )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4724,11 +5910,22 @@ zesSchedulerGetTimeoutModeProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetTimeoutModeProperties = ze_lib::context->zesDdiTable.Scheduler.pfnGetTimeoutModeProperties;
+    auto pfnGetTimeoutModeProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Scheduler.pfnGetTimeoutModeProperties;
     if( nullptr == pfnGetTimeoutModeProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetTimeoutModeProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Scheduler.pfnGetTimeoutModeProperties;
+        if( nullptr == pfnGetTimeoutModeProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4766,11 +5963,22 @@ zesSchedulerGetTimesliceModeProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetTimesliceModeProperties = ze_lib::context->zesDdiTable.Scheduler.pfnGetTimesliceModeProperties;
+    auto pfnGetTimesliceModeProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Scheduler.pfnGetTimesliceModeProperties;
     if( nullptr == pfnGetTimesliceModeProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetTimesliceModeProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Scheduler.pfnGetTimesliceModeProperties;
+        if( nullptr == pfnGetTimesliceModeProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4816,11 +6024,22 @@ zesSchedulerSetTimeoutMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetTimeoutMode = ze_lib::context->zesDdiTable.Scheduler.pfnSetTimeoutMode;
+    auto pfnSetTimeoutMode = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Scheduler.pfnSetTimeoutMode;
     if( nullptr == pfnSetTimeoutMode ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnSetTimeoutMode = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Scheduler.pfnSetTimeoutMode;
+        if( nullptr == pfnSetTimeoutMode )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4865,11 +6084,22 @@ zesSchedulerSetTimesliceMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetTimesliceMode = ze_lib::context->zesDdiTable.Scheduler.pfnSetTimesliceMode;
+    auto pfnSetTimesliceMode = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Scheduler.pfnSetTimesliceMode;
     if( nullptr == pfnSetTimesliceMode ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnSetTimesliceMode = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Scheduler.pfnSetTimesliceMode;
+        if( nullptr == pfnSetTimesliceMode )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4912,11 +6142,22 @@ zesSchedulerSetExclusiveMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetExclusiveMode = ze_lib::context->zesDdiTable.Scheduler.pfnSetExclusiveMode;
+    auto pfnSetExclusiveMode = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Scheduler.pfnSetExclusiveMode;
     if( nullptr == pfnSetExclusiveMode ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnSetExclusiveMode = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Scheduler.pfnSetExclusiveMode;
+        if( nullptr == pfnSetExclusiveMode )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -4960,11 +6201,22 @@ zesSchedulerSetComputeUnitDebugMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetComputeUnitDebugMode = ze_lib::context->zesDdiTable.Scheduler.pfnSetComputeUnitDebugMode;
+    auto pfnSetComputeUnitDebugMode = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Scheduler.pfnSetComputeUnitDebugMode;
     if( nullptr == pfnSetComputeUnitDebugMode ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnSetComputeUnitDebugMode = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Scheduler.pfnSetComputeUnitDebugMode;
+        if( nullptr == pfnSetComputeUnitDebugMode )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -5008,11 +6260,22 @@ zesDeviceEnumStandbyDomains(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumStandbyDomains = ze_lib::context->zesDdiTable.Device.pfnEnumStandbyDomains;
+    auto pfnEnumStandbyDomains = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnEnumStandbyDomains;
     if( nullptr == pfnEnumStandbyDomains ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnEnumStandbyDomains = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnEnumStandbyDomains;
+        if( nullptr == pfnEnumStandbyDomains )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -5046,11 +6309,22 @@ zesStandbyGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.Standby.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Standby.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Standby.pfnGetProperties;
+        if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -5084,11 +6358,22 @@ zesStandbyGetMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetMode = ze_lib::context->zesDdiTable.Standby.pfnGetMode;
+    auto pfnGetMode = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Standby.pfnGetMode;
     if( nullptr == pfnGetMode ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetMode = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Standby.pfnGetMode;
+        if( nullptr == pfnGetMode )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -5124,11 +6409,22 @@ zesStandbySetMode(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetMode = ze_lib::context->zesDdiTable.Standby.pfnSetMode;
+    auto pfnSetMode = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Standby.pfnSetMode;
     if( nullptr == pfnSetMode ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnSetMode = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Standby.pfnSetMode;
+        if( nullptr == pfnSetMode )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -5172,11 +6468,22 @@ zesDeviceEnumTemperatureSensors(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnEnumTemperatureSensors = ze_lib::context->zesDdiTable.Device.pfnEnumTemperatureSensors;
+    auto pfnEnumTemperatureSensors = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnEnumTemperatureSensors;
     if( nullptr == pfnEnumTemperatureSensors ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnEnumTemperatureSensors = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Device.pfnEnumTemperatureSensors;
+        if( nullptr == pfnEnumTemperatureSensors )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -5210,11 +6517,22 @@ zesTemperatureGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zesDdiTable.Temperature.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Temperature.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetProperties = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Temperature.pfnGetProperties;
+        if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -5254,11 +6572,22 @@ zesTemperatureGetConfig(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetConfig = ze_lib::context->zesDdiTable.Temperature.pfnGetConfig;
+    auto pfnGetConfig = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Temperature.pfnGetConfig;
     if( nullptr == pfnGetConfig ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetConfig = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Temperature.pfnGetConfig;
+        if( nullptr == pfnGetConfig )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -5315,11 +6644,22 @@ zesTemperatureSetConfig(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetConfig = ze_lib::context->zesDdiTable.Temperature.pfnSetConfig;
+    auto pfnSetConfig = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Temperature.pfnSetConfig;
     if( nullptr == pfnSetConfig ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnSetConfig = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Temperature.pfnSetConfig;
+        if( nullptr == pfnSetConfig )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -5354,11 +6694,22 @@ zesTemperatureGetState(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetState = ze_lib::context->zesDdiTable.Temperature.pfnGetState;
+    auto pfnGetState = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Temperature.pfnGetState;
     if( nullptr == pfnGetState ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetState = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Temperature.pfnGetState;
+        if( nullptr == pfnGetState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -5402,11 +6753,22 @@ zesPowerGetLimitsExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetLimitsExt = ze_lib::context->zesDdiTable.Power.pfnGetLimitsExt;
+    auto pfnGetLimitsExt = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Power.pfnGetLimitsExt;
     if( nullptr == pfnGetLimitsExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetLimitsExt = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Power.pfnGetLimitsExt;
+        if( nullptr == pfnGetLimitsExt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -5453,11 +6815,22 @@ zesPowerSetLimitsExt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetLimitsExt = ze_lib::context->zesDdiTable.Power.pfnSetLimitsExt;
+    auto pfnSetLimitsExt = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Power.pfnSetLimitsExt;
     if( nullptr == pfnSetLimitsExt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zesTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zesLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnSetLimitsExt = ze_lib::context->zesActiveDdiTable.load( std::memory_order_acquire )->Power.pfnSetLimitsExt;
+        if( nullptr == pfnSetLimitsExt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
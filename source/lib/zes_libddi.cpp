@@ -154,6 +154,9 @@ namespace ze_lib
             result = getTable( ZE_API_VERSION_CURRENT, &zesDdiTable.Temperature );
         }
 
+        if( ( ZE_RESULT_SUCCESS == result ) && ( nullptr != tracing_lib ) )
+            result = zesTracingInit();
+
         return result;
     }
 #else
@@ -256,8 +259,200 @@ namespace ze_lib
             result = zesGetTemperatureProcAddrTable( ZE_API_VERSION_CURRENT, &zesDdiTable.Temperature );
         }
 
+        if( ( ZE_RESULT_SUCCESS == result ) && ( nullptr != tracing_lib ) )
+            result = zesTracingInit();
+
         return result;
     }
 #endif
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// fills zesTracingDdiTable with the tracing layer's intercepts of a copy of
+    /// zesDdiTable; the exported functions switch to it while a tracer is enabled
+    __zedlllocal ze_result_t context_t::zesTracingInit()
+    {
+        ze_result_t result = ZE_RESULT_SUCCESS;
+        zesTracingDdiTable = zesDdiTable;
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zes_pfnGetGlobalProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zesGetGlobalProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zesTracingDdiTable.Global );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zes_pfnGetDeviceProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zesGetDeviceProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zesTracingDdiTable.Device );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zes_pfnGetDriverProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zesGetDriverProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zesTracingDdiTable.Driver );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zes_pfnGetDiagnosticsProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zesGetDiagnosticsProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zesTracingDdiTable.Diagnostics );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zes_pfnGetEngineProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zesGetEngineProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zesTracingDdiTable.Engine );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zes_pfnGetFabricPortProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zesGetFabricPortProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zesTracingDdiTable.FabricPort );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zes_pfnGetFanProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zesGetFanProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zesTracingDdiTable.Fan );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zes_pfnGetFirmwareProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zesGetFirmwareProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zesTracingDdiTable.Firmware );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zes_pfnGetFrequencyProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zesGetFrequencyProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zesTracingDdiTable.Frequency );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zes_pfnGetLedProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zesGetLedProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zesTracingDdiTable.Led );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zes_pfnGetMemoryProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zesGetMemoryProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zesTracingDdiTable.Memory );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zes_pfnGetOverclockProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zesGetOverclockProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zesTracingDdiTable.Overclock );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zes_pfnGetPerformanceFactorProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zesGetPerformanceFactorProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zesTracingDdiTable.PerformanceFactor );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zes_pfnGetPowerProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zesGetPowerProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zesTracingDdiTable.Power );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zes_pfnGetPsuProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zesGetPsuProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zesTracingDdiTable.Psu );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zes_pfnGetRasProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zesGetRasProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zesTracingDdiTable.Ras );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zes_pfnGetSchedulerProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zesGetSchedulerProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zesTracingDdiTable.Scheduler );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zes_pfnGetStandbyProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zesGetStandbyProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zesTracingDdiTable.Standby );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zes_pfnGetTemperatureProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zesGetTemperatureProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zesTracingDdiTable.Temperature );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            std::lock_guard<std::mutex> lock( tracingMutex );
+            zesTracingTablesLoaded = true;
+            updateActiveTables();
+        }
+
+        return result;
+    }
+
 } // namespace ze_lib
@@ -48,11 +48,22 @@ zetModuleGetDebugInfo(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetDebugInfo = ze_lib::context->zetDdiTable.Module.pfnGetDebugInfo;
+    auto pfnGetDebugInfo = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->Module.pfnGetDebugInfo;
     if( nullptr == pfnGetDebugInfo ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zetTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zetLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetDebugInfo = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->Module.pfnGetDebugInfo;
+        if( nullptr == pfnGetDebugInfo )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -82,11 +93,22 @@ zetDeviceGetDebugProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetDebugProperties = ze_lib::context->zetDdiTable.Device.pfnGetDebugProperties;
+    auto pfnGetDebugProperties = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGetDebugProperties;
     if( nullptr == pfnGetDebugProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zetTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zetLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetDebugProperties = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->Device.pfnGetDebugProperties;
+        if( nullptr == pfnGetDebugProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -128,11 +150,22 @@ zetDebugAttach(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAttach = ze_lib::context->zetDdiTable.Debug.pfnAttach;
+    auto pfnAttach = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->Debug.pfnAttach;
     if( nullptr == pfnAttach ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zetTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zetLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnAttach = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->Debug.pfnAttach;
+        if( nullptr == pfnAttach )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -159,11 +192,22 @@ zetDebugDetach(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDetach = ze_lib::context->zetDdiTable.Debug.pfnDetach;
+    auto pfnDetach = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->Debug.pfnDetach;
     if( nullptr == pfnDetach ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zetTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zetLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnDetach = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->Debug.pfnDetach;
+        if( nullptr == pfnDetach )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -202,11 +246,22 @@ zetDebugReadEvent(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnReadEvent = ze_lib::context->zetDdiTable.Debug.pfnReadEvent;
+    auto pfnReadEvent = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->Debug.pfnReadEvent;
     if( nullptr == pfnReadEvent ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zetTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zetLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnReadEvent = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->Debug.pfnReadEvent;
+        if( nullptr == pfnReadEvent )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -236,11 +291,22 @@ zetDebugAcknowledgeEvent(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAcknowledgeEvent = ze_lib::context->zetDdiTable.Debug.pfnAcknowledgeEvent;
+    auto pfnAcknowledgeEvent = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->Debug.pfnAcknowledgeEvent;
     if( nullptr == pfnAcknowledgeEvent ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zetTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zetLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnAcknowledgeEvent = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->Debug.pfnAcknowledgeEvent;
+        if( nullptr == pfnAcknowledgeEvent )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -270,11 +336,22 @@ zetDebugInterrupt(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnInterrupt = ze_lib::context->zetDdiTable.Debug.pfnInterrupt;
+    auto pfnInterrupt = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->Debug.pfnInterrupt;
     if( nullptr == pfnInterrupt ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zetTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zetLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnInterrupt = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->Debug.pfnInterrupt;
+        if( nullptr == pfnInterrupt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -304,11 +381,22 @@ zetDebugResume(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnResume = ze_lib::context->zetDdiTable.Debug.pfnResume;
+    auto pfnResume = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->Debug.pfnResume;
     if( nullptr == pfnResume ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zetTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zetLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnResume = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->Debug.pfnResume;
+        if( nullptr == pfnResume )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -351,11 +439,22 @@ zetDebugReadMemory(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnReadMemory = ze_lib::context->zetDdiTable.Debug.pfnReadMemory;
+    auto pfnReadMemory = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->Debug.pfnReadMemory;
     if( nullptr == pfnReadMemory ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zetTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zetLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnReadMemory = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->Debug.pfnReadMemory;
+        if( nullptr == pfnReadMemory )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -398,11 +497,22 @@ zetDebugWriteMemory(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnWriteMemory = ze_lib::context->zetDdiTable.Debug.pfnWriteMemory;
+    auto pfnWriteMemory = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->Debug.pfnWriteMemory;
     if( nullptr == pfnWriteMemory ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zetTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zetLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnWriteMemory = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->Debug.pfnWriteMemory;
+        if( nullptr == pfnWriteMemory )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -441,11 +551,22 @@ zetDebugGetRegisterSetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetRegisterSetProperties = ze_lib::context->zetDdiTable.Debug.pfnGetRegisterSetProperties;
+    auto pfnGetRegisterSetProperties = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->Debug.pfnGetRegisterSetProperties;
     if( nullptr == pfnGetRegisterSetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zetTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zetLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetRegisterSetProperties = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->Debug.pfnGetRegisterSetProperties;
+        if( nullptr == pfnGetRegisterSetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -489,11 +610,22 @@ zetDebugGetThreadRegisterSetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetThreadRegisterSetProperties = ze_lib::context->zetDdiTable.Debug.pfnGetThreadRegisterSetProperties;
+    auto pfnGetThreadRegisterSetProperties = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->Debug.pfnGetThreadRegisterSetProperties;
     if( nullptr == pfnGetThreadRegisterSetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zetTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zetLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetThreadRegisterSetProperties = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->Debug.pfnGetThreadRegisterSetProperties;
+        if( nullptr == pfnGetThreadRegisterSetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -529,11 +661,22 @@ zetDebugReadRegisters(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnReadRegisters = ze_lib::context->zetDdiTable.Debug.pfnReadRegisters;
+    auto pfnReadRegisters = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->Debug.pfnReadRegisters;
     if( nullptr == pfnReadRegisters ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zetTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zetLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnReadRegisters = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->Debug.pfnReadRegisters;
+        if( nullptr == pfnReadRegisters )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -569,11 +712,22 @@ zetDebugWriteRegisters(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnWriteRegisters = ze_lib::context->zetDdiTable.Debug.pfnWriteRegisters;
+    auto pfnWriteRegisters = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->Debug.pfnWriteRegisters;
     if( nullptr == pfnWriteRegisters ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zetTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zetLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnWriteRegisters = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->Debug.pfnWriteRegisters;
+        if( nullptr == pfnWriteRegisters )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -614,11 +768,22 @@ zetMetricGroupGet(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGet = ze_lib::context->zetDdiTable.MetricGroup.pfnGet;
+    auto pfnGet = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->MetricGroup.pfnGet;
     if( nullptr == pfnGet ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zetTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zetLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGet = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->MetricGroup.pfnGet;
+        if( nullptr == pfnGet )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -651,11 +816,22 @@ zetMetricGroupGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zetDdiTable.MetricGroup.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->MetricGroup.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zetTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zetLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetProperties = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->MetricGroup.pfnGetProperties;
+        if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -702,11 +878,22 @@ zetMetricGroupCalculateMetricValues(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCalculateMetricValues = ze_lib::context->zetDdiTable.MetricGroup.pfnCalculateMetricValues;
+    auto pfnCalculateMetricValues = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->MetricGroup.pfnCalculateMetricValues;
     if( nullptr == pfnCalculateMetricValues ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zetTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zetLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnCalculateMetricValues = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->MetricGroup.pfnCalculateMetricValues;
+        if( nullptr == pfnCalculateMetricValues )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -746,11 +933,22 @@ zetMetricGet(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGet = ze_lib::context->zetDdiTable.Metric.pfnGet;
+    auto pfnGet = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->Metric.pfnGet;
     if( nullptr == pfnGet ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zetTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zetLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGet = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->Metric.pfnGet;
+        if( nullptr == pfnGet )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -783,11 +981,22 @@ zetMetricGetProperties(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProperties = ze_lib::context->zetDdiTable.Metric.pfnGetProperties;
+    auto pfnGetProperties = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->Metric.pfnGetProperties;
     if( nullptr == pfnGetProperties ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zetTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zetLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetProperties = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->Metric.pfnGetProperties;
+        if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -838,11 +1047,22 @@ zetContextActivateMetricGroups(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnActivateMetricGroups = ze_lib::context->zetDdiTable.Context.pfnActivateMetricGroups;
+    auto pfnActivateMetricGroups = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->Context.pfnActivateMetricGroups;
     if( nullptr == pfnActivateMetricGroups ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zetTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zetLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnActivateMetricGroups = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->Context.pfnActivateMetricGroups;
+        if( nullptr == pfnActivateMetricGroups )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -890,11 +1110,22 @@ zetMetricStreamerOpen(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnOpen = ze_lib::context->zetDdiTable.MetricStreamer.pfnOpen;
+    auto pfnOpen = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->MetricStreamer.pfnOpen;
     if( nullptr == pfnOpen ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zetTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zetLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnOpen = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->MetricStreamer.pfnOpen;
+        if( nullptr == pfnOpen )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -934,11 +1165,22 @@ zetCommandListAppendMetricStreamerMarker(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendMetricStreamerMarker = ze_lib::context->zetDdiTable.CommandList.pfnAppendMetricStreamerMarker;
+    auto pfnAppendMetricStreamerMarker = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendMetricStreamerMarker;
     if( nullptr == pfnAppendMetricStreamerMarker ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zetTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zetLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnAppendMetricStreamerMarker = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendMetricStreamerMarker;
+        if( nullptr == pfnAppendMetricStreamerMarker )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -969,11 +1211,22 @@ zetMetricStreamerClose(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnClose = ze_lib::context->zetDdiTable.MetricStreamer.pfnClose;
+    auto pfnClose = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->MetricStreamer.pfnClose;
     if( nullptr == pfnClose ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zetTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zetLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnClose = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->MetricStreamer.pfnClose;
+        if( nullptr == pfnClose )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1017,11 +1270,22 @@ zetMetricStreamerReadData(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnReadData = ze_lib::context->zetDdiTable.MetricStreamer.pfnReadData;
+    auto pfnReadData = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->MetricStreamer.pfnReadData;
     if( nullptr == pfnReadData ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zetTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zetLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnReadData = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->MetricStreamer.pfnReadData;
+        if( nullptr == pfnReadData )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1063,11 +1327,22 @@ zetMetricQueryPoolCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zetDdiTable.MetricQueryPool.pfnCreate;
+    auto pfnCreate = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->MetricQueryPool.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zetTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zetLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnCreate = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->MetricQueryPool.pfnCreate;
+        if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1104,11 +1379,22 @@ zetMetricQueryPoolDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zetDdiTable.MetricQueryPool.pfnDestroy;
+    auto pfnDestroy = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->MetricQueryPool.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zetTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zetLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnDestroy = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->MetricQueryPool.pfnDestroy;
+        if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1143,11 +1429,22 @@ zetMetricQueryCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zetDdiTable.MetricQuery.pfnCreate;
+    auto pfnCreate = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->MetricQuery.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zetTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zetLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnCreate = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->MetricQuery.pfnCreate;
+        if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1182,11 +1479,22 @@ zetMetricQueryDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zetDdiTable.MetricQuery.pfnDestroy;
+    auto pfnDestroy = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->MetricQuery.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zetTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zetLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnDestroy = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->MetricQuery.pfnDestroy;
+        if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1219,11 +1527,22 @@ zetMetricQueryReset(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnReset = ze_lib::context->zetDdiTable.MetricQuery.pfnReset;
+    auto pfnReset = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->MetricQuery.pfnReset;
     if( nullptr == pfnReset ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zetTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zetLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnReset = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->MetricQuery.pfnReset;
+        if( nullptr == pfnReset )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1262,11 +1581,22 @@ zetCommandListAppendMetricQueryBegin(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendMetricQueryBegin = ze_lib::context->zetDdiTable.CommandList.pfnAppendMetricQueryBegin;
+    auto pfnAppendMetricQueryBegin = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendMetricQueryBegin;
     if( nullptr == pfnAppendMetricQueryBegin ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zetTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zetLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnAppendMetricQueryBegin = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendMetricQueryBegin;
+        if( nullptr == pfnAppendMetricQueryBegin )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1319,11 +1649,22 @@ zetCommandListAppendMetricQueryEnd(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendMetricQueryEnd = ze_lib::context->zetDdiTable.CommandList.pfnAppendMetricQueryEnd;
+    auto pfnAppendMetricQueryEnd = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendMetricQueryEnd;
     if( nullptr == pfnAppendMetricQueryEnd ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zetTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zetLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnAppendMetricQueryEnd = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendMetricQueryEnd;
+        if( nullptr == pfnAppendMetricQueryEnd )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1354,11 +1695,22 @@ zetCommandListAppendMetricMemoryBarrier(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnAppendMetricMemoryBarrier = ze_lib::context->zetDdiTable.CommandList.pfnAppendMetricMemoryBarrier;
+    auto pfnAppendMetricMemoryBarrier = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendMetricMemoryBarrier;
     if( nullptr == pfnAppendMetricMemoryBarrier ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zetTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zetLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnAppendMetricMemoryBarrier = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->CommandList.pfnAppendMetricMemoryBarrier;
+        if( nullptr == pfnAppendMetricMemoryBarrier )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1399,11 +1751,22 @@ zetMetricQueryGetData(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetData = ze_lib::context->zetDdiTable.MetricQuery.pfnGetData;
+    auto pfnGetData = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->MetricQuery.pfnGetData;
     if( nullptr == pfnGetData ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zetTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zetLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetData = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->MetricQuery.pfnGetData;
+        if( nullptr == pfnGetData )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1441,11 +1804,22 @@ zetKernelGetProfileInfo(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetProfileInfo = ze_lib::context->zetDdiTable.Kernel.pfnGetProfileInfo;
+    auto pfnGetProfileInfo = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->Kernel.pfnGetProfileInfo;
     if( nullptr == pfnGetProfileInfo ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zetTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zetLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetProfileInfo = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->Kernel.pfnGetProfileInfo;
+        if( nullptr == pfnGetProfileInfo )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1485,11 +1859,22 @@ zetTracerExpCreate(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCreate = ze_lib::context->zetDdiTable.TracerExp.pfnCreate;
+    auto pfnCreate = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->TracerExp.pfnCreate;
     if( nullptr == pfnCreate ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zetTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zetLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnCreate = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->TracerExp.pfnCreate;
+        if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1525,11 +1910,22 @@ zetTracerExpDestroy(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnDestroy = ze_lib::context->zetDdiTable.TracerExp.pfnDestroy;
+    auto pfnDestroy = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->TracerExp.pfnDestroy;
     if( nullptr == pfnDestroy ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zetTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zetLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnDestroy = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->TracerExp.pfnDestroy;
+        if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1568,11 +1964,22 @@ zetTracerExpSetPrologues(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetPrologues = ze_lib::context->zetDdiTable.TracerExp.pfnSetPrologues;
+    auto pfnSetPrologues = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->TracerExp.pfnSetPrologues;
     if( nullptr == pfnSetPrologues ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zetTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zetLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnSetPrologues = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->TracerExp.pfnSetPrologues;
+        if( nullptr == pfnSetPrologues )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1611,11 +2018,22 @@ zetTracerExpSetEpilogues(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetEpilogues = ze_lib::context->zetDdiTable.TracerExp.pfnSetEpilogues;
+    auto pfnSetEpilogues = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->TracerExp.pfnSetEpilogues;
     if( nullptr == pfnSetEpilogues ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zetTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zetLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnSetEpilogues = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->TracerExp.pfnSetEpilogues;
+        if( nullptr == pfnSetEpilogues )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1647,11 +2065,22 @@ zetTracerExpSetEnabled(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnSetEnabled = ze_lib::context->zetDdiTable.TracerExp.pfnSetEnabled;
+    auto pfnSetEnabled = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->TracerExp.pfnSetEnabled;
     if( nullptr == pfnSetEnabled ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zetTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zetLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnSetEnabled = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->TracerExp.pfnSetEnabled;
+        if( nullptr == pfnSetEnabled )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1717,11 +2146,22 @@ zetMetricGroupCalculateMultipleMetricValuesExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnCalculateMultipleMetricValuesExp = ze_lib::context->zetDdiTable.MetricGroupExp.pfnCalculateMultipleMetricValuesExp;
+    auto pfnCalculateMultipleMetricValuesExp = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->MetricGroupExp.pfnCalculateMultipleMetricValuesExp;
     if( nullptr == pfnCalculateMultipleMetricValuesExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zetTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zetLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnCalculateMultipleMetricValuesExp = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->MetricGroupExp.pfnCalculateMultipleMetricValuesExp;
+        if( nullptr == pfnCalculateMultipleMetricValuesExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
@@ -1760,11 +2200,22 @@ zetMetricGroupGetGlobalTimestampsExp(
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
-    auto pfnGetGlobalTimestampsExp = ze_lib::context->zetDdiTable.MetricGroupExp.pfnGetGlobalTimestampsExp;
+    auto pfnGetGlobalTimestampsExp = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->MetricGroupExp.pfnGetGlobalTimestampsExp;
     if( nullptr == pfnGetGlobalTimestampsExp ) {
         if(!ze_lib::context->isInitialized)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        else
+
+        // entries still empty once the tables are filled are not supported
+        if( ze_lib::context->zetTablesFilled() )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+        // the tables are filled by the first call using them
+        auto loadResult = ze_lib::context->zetLoadTables();
+        if( ZE_RESULT_SUCCESS != loadResult )
+            return loadResult;
+
+        pfnGetGlobalTimestampsExp = ze_lib::context->zetActiveDdiTable.load( std::memory_order_acquire )->MetricGroupExp.pfnGetGlobalTimestampsExp;
+        if( nullptr == pfnGetGlobalTimestampsExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
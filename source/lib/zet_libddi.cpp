@@ -112,6 +112,9 @@ namespace ze_lib
             result = getTable( ZE_API_VERSION_CURRENT, &zetDdiTable.TracerExp );
         }
 
+        if( ( ZE_RESULT_SUCCESS == result ) && ( nullptr != tracing_lib ) )
+            result = zetTracingInit();
+
         return result;
     }
 #else
@@ -184,8 +187,146 @@ namespace ze_lib
             result = zetGetTracerExpProcAddrTable( ZE_API_VERSION_CURRENT, &zetDdiTable.TracerExp );
         }
 
+        if( ( ZE_RESULT_SUCCESS == result ) && ( nullptr != tracing_lib ) )
+            result = zetTracingInit();
+
         return result;
     }
 #endif
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// fills zetTracingDdiTable with the tracing layer's intercepts of a copy of
+    /// zetDdiTable; the exported functions switch to it while a tracer is enabled
+    __zedlllocal ze_result_t context_t::zetTracingInit()
+    {
+        ze_result_t result = ZE_RESULT_SUCCESS;
+        zetTracingDdiTable = zetDdiTable;
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zet_pfnGetDeviceProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zetGetDeviceProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zetTracingDdiTable.Device );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zet_pfnGetContextProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zetGetContextProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zetTracingDdiTable.Context );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zet_pfnGetCommandListProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zetGetCommandListProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zetTracingDdiTable.CommandList );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zet_pfnGetKernelProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zetGetKernelProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zetTracingDdiTable.Kernel );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zet_pfnGetModuleProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zetGetModuleProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zetTracingDdiTable.Module );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zet_pfnGetDebugProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zetGetDebugProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zetTracingDdiTable.Debug );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zet_pfnGetMetricProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zetGetMetricProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zetTracingDdiTable.Metric );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zet_pfnGetMetricGroupProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zetGetMetricGroupProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zetTracingDdiTable.MetricGroup );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zet_pfnGetMetricGroupExpProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zetGetMetricGroupExpProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zetTracingDdiTable.MetricGroupExp );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zet_pfnGetMetricQueryProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zetGetMetricQueryProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zetTracingDdiTable.MetricQuery );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zet_pfnGetMetricQueryPoolProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zetGetMetricQueryPoolProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zetTracingDdiTable.MetricQueryPool );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zet_pfnGetMetricStreamerProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zetGetMetricStreamerProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zetTracingDdiTable.MetricStreamer );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            auto getTable = reinterpret_cast<zet_pfnGetTracerExpProcAddrTable_t>(
+                GET_FUNCTION_PTR(tracing_lib, "zetGetTracerExpProcAddrTable") );
+            if( nullptr == getTable )
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            result = getTable( ZE_API_VERSION_CURRENT, &zetTracingDdiTable.TracerExp );
+        }
+
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            std::lock_guard<std::mutex> lock( tracingMutex );
+            zetTracingTablesLoaded = true;
+            updateActiveTables();
+        }
+
+        return result;
+    }
+
 } // namespace ze_lib
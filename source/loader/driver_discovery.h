@@ -1,6 +1,6 @@
 /*
  *
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include "ze_api.h"
+
 #include <string>
 #include <vector>
 
@@ -17,4 +19,53 @@ using DriverLibraryPath = std::string;
 
 std::vector<DriverLibraryPath> discoverEnabledDrivers();
 
+// The device types served by a driver the loader knows by name, as zeInit
+// flags, or 0 for any other driver.
+ze_init_flags_t getKnownDriverTypeFlags(const DriverLibraryPath &name);
+
+// Optional on-disk record of driver libraries that could not be found, so
+// that later processes can skip them. Enabled with
+// ZE_ENABLE_LOADER_DRIVER_CACHE=1 and stored in ZE_LOADER_DRIVER_CACHE_PATH,
+// $XDG_CACHE_HOME/level-zero/driver_cache or ~/.cache/level-zero/driver_cache.
+// Each entry carries the identity of the file it was derived from and is
+// ignored once that file changes. zeInit failures are not recorded, since
+// they can depend on devices, permissions and environment that change
+// between processes.
+class DriverDiscoveryCache {
+public:
+  DriverDiscoveryCache();
+
+  bool isEnabled() const { return enabled; }
+
+  bool isKnownMissing(const DriverLibraryPath &name);
+  void recordMissing(const DriverLibraryPath &name);
+
+  void save();
+
+private:
+  struct FileIdentity {
+    unsigned long long inode = 0;
+    long long mtime = 0;
+    long long size = 0;
+    bool operator==(const FileIdentity &other) const {
+      return inode == other.inode && mtime == other.mtime && size == other.size;
+    }
+  };
+
+  struct Entry {
+    FileIdentity identity;
+    std::string location; // LD_LIBRARY_PATH
+    DriverLibraryPath name;
+  };
+
+  void load();
+  Entry *find(const DriverLibraryPath &name);
+
+  bool enabled = false;
+  bool loaded = false;
+  bool dirty = false;
+  std::string cachePath;
+  std::vector<Entry> entries;
+};
+
 } // namespace loader
@@ -1,6 +1,6 @@
 /*
  *
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,17 +9,25 @@
 #include "source/loader/driver_discovery.h"
 
 #include "source/inc/ze_util.h"
+#include <fstream>
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <sys/stat.h>
+#include <unistd.h>
 
 namespace loader {
 
-static const char *knownDriverNames[] = {
-    MAKE_LIBRARY_NAME("ze_intel_gpu", "1"),
-    MAKE_LIBRARY_NAME("ze_intel_vpu", "1"),
+static const struct {
+  const char *name;
+  ze_init_flags_t typeFlags;
+} knownDrivers[] = {
+    {MAKE_LIBRARY_NAME("ze_intel_gpu", "1"), ZE_INIT_FLAG_GPU_ONLY},
+    {MAKE_LIBRARY_NAME("ze_intel_vpu", "1"), ZE_INIT_FLAG_VPU_ONLY},
 };
 
+static const char *cacheHeader = "level-zero driver cache 2";
+
 std::vector<DriverLibraryPath> discoverEnabledDrivers() {
   std::vector<DriverLibraryPath> enabledDrivers;
   const char *altDrivers = nullptr;
@@ -27,8 +35,8 @@ std::vector<DriverLibraryPath> discoverEnabledDrivers() {
   // ZE_ENABLE_ALT_DRIVERS is for development/debug only
   altDrivers = getenv("ZE_ENABLE_ALT_DRIVERS");
   if (altDrivers == nullptr) {
-    for (auto path : knownDriverNames) {
-      enabledDrivers.emplace_back(path);
+    for (auto &driver : knownDrivers) {
+      enabledDrivers.emplace_back(driver.name);
     }
   } else {
     std::stringstream ss(altDrivers);
@@ -41,4 +49,176 @@ std::vector<DriverLibraryPath> discoverEnabledDrivers() {
   return enabledDrivers;
 }
 
+// A known driver given by path through ZE_ENABLE_ALT_DRIVERS is matched by
+// its file name.
+ze_init_flags_t getKnownDriverTypeFlags(const DriverLibraryPath &name) {
+  auto separator = name.find_last_of('/');
+  auto fileName = (separator == std::string::npos) ? name : name.substr(separator + 1);
+  for (auto &driver : knownDrivers) {
+    if (fileName == driver.name)
+      return driver.typeFlags;
+  }
+  return 0;
+}
+
+DriverDiscoveryCache::DriverDiscoveryCache() {
+  enabled = getenv_tobool("ZE_ENABLE_LOADER_DRIVER_CACHE");
+  if (!enabled)
+    return;
+
+  const char *path = getenv("ZE_LOADER_DRIVER_CACHE_PATH");
+  if (path != nullptr && *path != '\0') {
+    cachePath = path;
+  } else {
+    const char *cacheHome = getenv("XDG_CACHE_HOME");
+    const char *home = getenv("HOME");
+    if (cacheHome != nullptr && *cacheHome != '\0')
+      cachePath = std::string(cacheHome) + "/level-zero/driver_cache";
+    else if (home != nullptr && *home != '\0')
+      cachePath = std::string(home) + "/.cache/level-zero/driver_cache";
+    else
+      enabled = false;
+  }
+}
+
+static bool getFileIdentity(const char *path, unsigned long long &inode,
+                            long long &mtime, long long &size) {
+  struct stat st;
+  if (stat(path, &st) != 0)
+    return false;
+  inode = static_cast<unsigned long long>(st.st_ino);
+  mtime = static_cast<long long>(st.st_mtim.tv_sec) * 1000000000LL + st.st_mtim.tv_nsec;
+  size = static_cast<long long>(st.st_size);
+  return true;
+}
+
+static std::string getLibrarySearchPath() {
+  const char *searchPath = getenv("LD_LIBRARY_PATH");
+  return searchPath ? searchPath : "";
+}
+
+static bool isCacheable(const std::string &field) {
+  return field.find_first_of("\t\n") == std::string::npos;
+}
+
+void DriverDiscoveryCache::load() {
+  loaded = true;
+
+  std::ifstream file(cachePath);
+  std::string line;
+  if (!std::getline(file, line) || line != cacheHeader)
+    return;
+
+  while (std::getline(file, line)) {
+    std::vector<std::string> fields;
+    std::stringstream ss(line);
+    std::string field;
+    while (std::getline(ss, field, '\t'))
+      fields.push_back(field);
+    if (fields.size() != 5)
+      continue;
+
+    Entry entry;
+    entry.identity.inode = strtoull(fields[0].c_str(), nullptr, 10);
+    entry.identity.mtime = strtoll(fields[1].c_str(), nullptr, 10);
+    entry.identity.size = strtoll(fields[2].c_str(), nullptr, 10);
+    entry.location = fields[3];
+    entry.name = fields[4];
+    entries.push_back(entry);
+  }
+}
+
+DriverDiscoveryCache::Entry *DriverDiscoveryCache::find(const DriverLibraryPath &name) {
+  if (!loaded)
+    load();
+  for (auto &entry : entries) {
+    if (entry.name == name)
+      return &entry;
+  }
+  return nullptr;
+}
+
+// A missing bare library name can only appear through a new ld.so cache or
+// a different LD_LIBRARY_PATH; an explicit path must still not exist.
+static bool getMissingIdentity(const DriverLibraryPath &name, unsigned long long &inode,
+                               long long &mtime, long long &size) {
+  inode = 0;
+  mtime = 0;
+  size = 0;
+  if (name.find('/') != std::string::npos) {
+    unsigned long long existingInode;
+    long long existingMtime, existingSize;
+    return !getFileIdentity(name.c_str(), existingInode, existingMtime, existingSize);
+  }
+  getFileIdentity("/etc/ld.so.cache", inode, mtime, size);
+  return true;
+}
+
+bool DriverDiscoveryCache::isKnownMissing(const DriverLibraryPath &name) {
+  if (!enabled)
+    return false;
+  auto entry = find(name);
+  if (entry == nullptr)
+    return false;
+
+  FileIdentity identity;
+  if (!getMissingIdentity(name, identity.inode, identity.mtime, identity.size))
+    return false;
+  return identity == entry->identity && entry->location == getLibrarySearchPath();
+}
+
+void DriverDiscoveryCache::recordMissing(const DriverLibraryPath &name) {
+  if (!enabled || !isCacheable(name))
+    return;
+  Entry entry;
+  entry.name = name;
+  entry.location = getLibrarySearchPath();
+  if (!isCacheable(entry.location) ||
+      !getMissingIdentity(name, entry.identity.inode, entry.identity.mtime, entry.identity.size))
+    return;
+
+  auto existing = find(name);
+  if (existing != nullptr)
+    *existing = entry;
+  else
+    entries.push_back(entry);
+  dirty = true;
+}
+
+// Creates the parent directories of path, ignoring those that exist.
+static void createParentDirectories(const std::string &path) {
+  for (auto pos = path.find('/', 1); pos != std::string::npos; pos = path.find('/', pos + 1))
+    mkdir(path.substr(0, pos).c_str(), 0700);
+}
+
+void DriverDiscoveryCache::save() {
+  if (!enabled || !dirty)
+    return;
+  dirty = false;
+
+  createParentDirectories(cachePath);
+
+  // write a private copy and rename it so that concurrent processes never
+  // observe a partially written cache
+  auto tempPath = cachePath + "." + std::to_string(getpid());
+  {
+    std::ofstream file(tempPath, std::ios::trunc);
+    if (!file)
+      return;
+    file << cacheHeader << '\n';
+    for (auto &entry : entries) {
+      file << entry.identity.inode << '\t' << entry.identity.mtime << '\t'
+           << entry.identity.size << '\t' << entry.location << '\t' << entry.name
+           << '\n';
+    }
+    if (!file.flush()) {
+      file.close();
+      unlink(tempPath.c_str());
+      return;
+    }
+  }
+  if (rename(tempPath.c_str(), cachePath.c_str()) != 0)
+    unlink(tempPath.c_str());
+}
+
 } // namespace loader
@@ -1,6 +1,6 @@
 /*
  *
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -49,6 +49,23 @@ std::vector<DriverLibraryPath> discoverEnabledDrivers() {
     return enabledDrivers;
 }
 
+// Drivers are found by path through the adapters, so none is known by name.
+ze_init_flags_t getKnownDriverTypeFlags(const DriverLibraryPath &name) {
+    return 0;
+}
+
+// The discovery cache is not implemented on Windows, where drivers are
+// found through the display and compute adapters present in the system.
+DriverDiscoveryCache::DriverDiscoveryCache() {}
+
+bool DriverDiscoveryCache::isKnownMissing(const DriverLibraryPath &name) {
+    return false;
+}
+
+void DriverDiscoveryCache::recordMissing(const DriverLibraryPath &name) {}
+
+void DriverDiscoveryCache::save() {}
+
 bool isDeviceAvailable(DEVINST devnode) {
     ULONG devStatus = {};
     ULONG devProblem = {};
@@ -0,0 +1,124 @@
+/*
+ *
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file ze_handle_array.h
+ *
+ */
+#pragma once
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#include "ze_util.h"
+
+namespace loader
+{
+    //////////////////////////////////////////////////////////////////////////
+    /// per-thread growable scratch buffer used for handle arrays that do not
+    /// fit in a handle_array_t's inline storage
+    ///
+    /// allocations are released in LIFO order; the buffer only grows while
+    /// nothing is outstanding, so steady state runs without touching the heap
+    class __zedlllocal scratch_arena_t
+    {
+    public:
+        scratch_arena_t() = default;
+        scratch_arena_t( const scratch_arena_t& ) = delete;
+        scratch_arena_t& operator=( const scratch_arena_t& ) = delete;
+
+        ~scratch_arena_t()
+        {
+            free( buffer );
+        }
+
+        static scratch_arena_t& get()
+        {
+            static thread_local scratch_arena_t arena;
+            return arena;
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        /// returns nullptr when the request cannot be served from the buffer
+        void* allocate( size_t bytes )
+        {
+            if( used + bytes > capacity )
+            {
+                if( 0 != used )
+                    return nullptr;
+
+                size_t newCapacity = capacity ? capacity : 4096;
+                while( newCapacity < bytes )
+                    newCapacity *= 2;
+
+                void* newBuffer = realloc( buffer, newCapacity );
+                if( nullptr == newBuffer )
+                    return nullptr;
+                buffer = static_cast<char*>( newBuffer );
+                capacity = newCapacity;
+            }
+            void* ptr = buffer + used;
+            used += bytes;
+            return ptr;
+        }
+
+        void release( size_t bytes )
+        {
+            used -= bytes;
+        }
+
+    protected:
+        char* buffer = nullptr;
+        size_t capacity = 0;
+        size_t used = 0;
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    /// temporary array for translating loader handles into driver handles
+    ///
+    /// typical sizes are held inline on the caller's stack; larger arrays
+    /// borrow space from the calling thread's scratch_arena_t and only fall
+    /// back to the heap when the arena is already in use
+    template<typename _handle_t, size_t _inline_count = 16>
+    class __zedlllocal handle_array_t
+    {
+    public:
+        explicit handle_array_t( size_t _count )
+            : data( storage ), bytes( 0 )
+        {
+            if( _count <= _inline_count )
+                return;
+
+            bytes = _count * sizeof( _handle_t );
+            data = static_cast<_handle_t*>( scratch_arena_t::get().allocate( bytes ) );
+            if( nullptr == data )
+            {
+                data = new _handle_t[ _count ];
+                heap = true;
+            }
+        }
+
+        handle_array_t( const handle_array_t& ) = delete;
+        handle_array_t& operator=( const handle_array_t& ) = delete;
+
+        ~handle_array_t()
+        {
+            if( heap )
+                delete[] data;
+            else if( 0 != bytes )
+                scratch_arena_t::get().release( bytes );
+        }
+
+        _handle_t& operator[]( size_t i ) { return data[ i ]; }
+        operator _handle_t*() { return data; }
+
+    protected:
+        _handle_t storage[ _inline_count ];
+        _handle_t* data;
+        size_t bytes;
+        bool heap = false;
+    };
+
+} // namespace loader
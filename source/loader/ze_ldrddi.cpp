@@ -31,6 +31,28 @@ namespace loader
     ///////////////////////////////////////////////////////////////////////////////
     std::unordered_map<ze_image_object_t *, ze_image_handle_t>            image_handle_map;
     std::unordered_map<ze_sampler_object_t *, ze_sampler_handle_t>        sampler_handle_map;
+    std::mutex                                                            handle_map_mutex; ///< guards both maps
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// images and samplers released along with their context also leave the
+    /// kernel argument maps
+    static void releaseImageLink( object_link_t* _link )
+    {
+        {
+            std::lock_guard<std::mutex> lock( handle_map_mutex );
+            image_handle_map.erase( ze_image_object_t::fromLink( _link ) );
+        }
+        ze_image_object_t::releaseLink( _link );
+    }
+
+    static void releaseSamplerLink( object_link_t* _link )
+    {
+        {
+            std::lock_guard<std::mutex> lock( handle_map_mutex );
+            sampler_handle_map.erase( ze_sampler_object_t::fromLink( _link ) );
+        }
+        ze_sampler_object_t::releaseLink( _link );
+    }
 
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Intercept function for zeInit
@@ -47,8 +69,9 @@ namespace loader
         {
             if(drv.initStatus != ZE_RESULT_SUCCESS)
                 continue;
-            drv.initStatus = drv.dditable.ze.Global.pfnInit( flags );
-            if(drv.initStatus == ZE_RESULT_SUCCESS)
+            // a driver stays in use when a later call admits other device
+            // types only; the first call's rejections were dropped by the loader
+            if(drv.dditable.ze.Global.pfnInit( flags ) == ZE_RESULT_SUCCESS)
                 atLeastOneDriverValid = true;
         }
 
@@ -101,8 +124,8 @@ namespace loader
                 {
                     for( uint32_t i = 0; i < library_driver_handle_count; ++i ) {
                         uint32_t driver_index = total_driver_handle_count + i;
-                        phDrivers[ driver_index ] = reinterpret_cast<ze_driver_handle_t>(
-                            ze_driver_factory.getInstance( phDrivers[ driver_index ], &drv.dditable ) );
+                        phDrivers[ driver_index ] = ze_driver_object_t::wrap(
+                            ze_driver_factory, phDrivers[ driver_index ], &drv.dditable );
                     }
                 }
                 catch( std::bad_alloc& )
@@ -137,7 +160,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
+        hDriver = ze_driver_object_t::unwrap( hDriver, dditable );
 
         // forward to device-driver
         result = pfnGetApiVersion( hDriver, version );
@@ -162,7 +185,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
+        hDriver = ze_driver_object_t::unwrap( hDriver, dditable );
 
         // forward to device-driver
         result = pfnGetProperties( hDriver, pDriverProperties );
@@ -187,7 +210,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
+        hDriver = ze_driver_object_t::unwrap( hDriver, dditable );
 
         // forward to device-driver
         result = pfnGetIpcProperties( hDriver, pIpcProperties );
@@ -221,7 +244,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
+        hDriver = ze_driver_object_t::unwrap( hDriver, dditable );
 
         // forward to device-driver
         result = pfnGetExtensionProperties( hDriver, pCount, pExtensionProperties );
@@ -247,7 +270,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
+        hDriver = ze_driver_object_t::unwrap( hDriver, dditable );
 
         // forward to device-driver
         result = pfnGetExtensionFunctionAddress( hDriver, name, ppFunctionAddress );
@@ -273,7 +296,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
+        hDriver = ze_driver_object_t::unwrap( hDriver, dditable );
 
         // forward to device-driver
         result = pfnGetLastErrorDescription( hDriver, ppString );
@@ -305,7 +328,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
+        hDriver = ze_driver_object_t::unwrap( hDriver, dditable );
 
         // forward to device-driver
         result = pfnGet( hDriver, pCount, phDevices );
@@ -317,8 +340,7 @@ namespace loader
         {
             // convert driver handles to loader handles
             for( size_t i = 0; ( nullptr != phDevices ) && ( i < *pCount ); ++i )
-                phDevices[ i ] = reinterpret_cast<ze_device_handle_t>(
-                    ze_device_factory.getInstance( phDevices[ i ], dditable ) );
+                phDevices[ i ] = ze_device_object_t::wrap( ze_device_factory, phDevices[ i ], dditable );
         }
         catch( std::bad_alloc& )
         {
@@ -352,7 +374,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
+        hDevice = ze_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnGetSubDevices( hDevice, pCount, phSubdevices );
@@ -364,8 +386,7 @@ namespace loader
         {
             // convert driver handles to loader handles
             for( size_t i = 0; ( nullptr != phSubdevices ) && ( i < *pCount ); ++i )
-                phSubdevices[ i ] = reinterpret_cast<ze_device_handle_t>(
-                    ze_device_factory.getInstance( phSubdevices[ i ], dditable ) );
+                phSubdevices[ i ] = ze_device_object_t::wrap( ze_device_factory, phSubdevices[ i ], dditable );
         }
         catch( std::bad_alloc& )
         {
@@ -392,7 +413,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
+        hDevice = ze_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnGetProperties( hDevice, pDeviceProperties );
@@ -417,7 +438,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
+        hDevice = ze_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnGetComputeProperties( hDevice, pComputeProperties );
@@ -442,7 +463,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
+        hDevice = ze_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnGetModuleProperties( hDevice, pModuleProperties );
@@ -477,7 +498,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
+        hDevice = ze_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnGetCommandQueueGroupProperties( hDevice, pCount, pCommandQueueGroupProperties );
@@ -511,7 +532,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
+        hDevice = ze_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnGetMemoryProperties( hDevice, pCount, pMemProperties );
@@ -536,7 +557,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
+        hDevice = ze_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnGetMemoryAccessProperties( hDevice, pMemAccessProperties );
@@ -569,7 +590,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
+        hDevice = ze_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnGetCacheProperties( hDevice, pCount, pCacheProperties );
@@ -594,7 +615,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
+        hDevice = ze_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnGetImageProperties( hDevice, pImageProperties );
@@ -619,7 +640,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
+        hDevice = ze_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnGetExternalMemoryProperties( hDevice, pExternalMemoryProperties );
@@ -645,10 +666,10 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
+        hDevice = ze_device_object_t::unwrap( hDevice, dditable );
 
         // convert loader handle to driver handle
-        hPeerDevice = reinterpret_cast<ze_device_object_t*>( hPeerDevice )->handle;
+        hPeerDevice = ze_device_object_t::unwrap( hPeerDevice, dditable );
 
         // forward to device-driver
         result = pfnGetP2PProperties( hDevice, hPeerDevice, pP2PProperties );
@@ -674,10 +695,10 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
+        hDevice = ze_device_object_t::unwrap( hDevice, dditable );
 
         // convert loader handle to driver handle
-        hPeerDevice = reinterpret_cast<ze_device_object_t*>( hPeerDevice )->handle;
+        hPeerDevice = ze_device_object_t::unwrap( hPeerDevice, dditable );
 
         // forward to device-driver
         result = pfnCanAccessPeer( hDevice, hPeerDevice, value );
@@ -701,7 +722,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
+        hDevice = ze_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnGetStatus( hDevice );
@@ -729,7 +750,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
+        hDevice = ze_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnGetGlobalTimestamps( hDevice, hostTimestamp, deviceTimestamp );
@@ -755,7 +776,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
+        hDriver = ze_driver_object_t::unwrap( hDriver, dditable );
 
         // forward to device-driver
         result = pfnCreate( hDriver, desc, phContext );
@@ -766,8 +787,7 @@ namespace loader
         try
         {
             // convert driver handle to loader handle
-            *phContext = reinterpret_cast<ze_context_handle_t>(
-                ze_context_factory.getInstance( *phContext, dditable ) );
+            *phContext = ze_context_object_t::wrap( ze_context_factory, *phContext, dditable );
         }
         catch( std::bad_alloc& )
         {
@@ -805,16 +825,15 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
+        hDriver = ze_driver_object_t::unwrap( hDriver, dditable );
 
         // convert loader handles to driver handles
-        auto phDevicesLocal = new ze_device_handle_t [numDevices];
+        handle_array_t<ze_device_handle_t> phDevicesLocal( numDevices );
         for( size_t i = 0; ( nullptr != phDevices ) && ( i < numDevices ); ++i )
-            phDevicesLocal[ i ] = reinterpret_cast<ze_device_object_t*>( phDevices[ i ] )->handle;
+            phDevicesLocal[ i ] = ze_device_object_t::unwrap( phDevices[ i ], dditable );
 
         // forward to device-driver
         result = pfnCreateEx( hDriver, desc, numDevices, phDevicesLocal, phContext );
-        delete []phDevicesLocal;
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -822,8 +841,7 @@ namespace loader
         try
         {
             // convert driver handle to loader handle
-            *phContext = reinterpret_cast<ze_context_handle_t>(
-                ze_context_factory.getInstance( *phContext, dditable ) );
+            *phContext = ze_context_object_t::wrap( ze_context_factory, *phContext, dditable );
         }
         catch( std::bad_alloc& )
         {
@@ -848,8 +866,11 @@ namespace loader
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // keep the loader handle, which tracks the loader handles created under it
+        auto hContextLoader = hContext;
+
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
+        hContext = ze_context_object_t::unwrap( hContext, dditable );
 
         // forward to device-driver
         result = pfnDestroy( hContext );
@@ -858,7 +879,7 @@ namespace loader
             return result;
 
         // release loader handle
-        ze_context_factory.release( hContext );
+        ze_context_object_t::release( ze_context_factory, hContextLoader, dditable );
 
         return result;
     }
@@ -879,7 +900,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
+        hContext = ze_context_object_t::unwrap( hContext, dditable );
 
         // forward to device-driver
         result = pfnGetStatus( hContext );
@@ -905,11 +926,14 @@ namespace loader
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // keep the loader handle, which tracks the loader handles created under it
+        auto hContextLoader = hContext;
+
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
+        hContext = ze_context_object_t::unwrap( hContext, dditable );
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
+        hDevice = ze_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnCreate( hContext, hDevice, desc, phCommandQueue );
@@ -920,8 +944,7 @@ namespace loader
         try
         {
             // convert driver handle to loader handle
-            *phCommandQueue = reinterpret_cast<ze_command_queue_handle_t>(
-                ze_command_queue_factory.getInstance( *phCommandQueue, dditable ) );
+            *phCommandQueue = ze_command_queue_object_t::wrap( ze_command_queue_factory, *phCommandQueue, dditable, ze_context_object_t::owner( hContextLoader, dditable ) );
         }
         catch( std::bad_alloc& )
         {
@@ -946,8 +969,11 @@ namespace loader
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // keep the loader handle, which tracks the loader handles created under it
+        auto hCommandQueueLoader = hCommandQueue;
+
         // convert loader handle to driver handle
-        hCommandQueue = reinterpret_cast<ze_command_queue_object_t*>( hCommandQueue )->handle;
+        hCommandQueue = ze_command_queue_object_t::unwrap( hCommandQueue, dditable );
 
         // forward to device-driver
         result = pfnDestroy( hCommandQueue );
@@ -956,7 +982,7 @@ namespace loader
             return result;
 
         // release loader handle
-        ze_command_queue_factory.release( hCommandQueue );
+        ze_command_queue_object_t::release( ze_command_queue_factory, hCommandQueueLoader, dditable );
 
         return result;
     }
@@ -981,19 +1007,18 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hCommandQueue = reinterpret_cast<ze_command_queue_object_t*>( hCommandQueue )->handle;
+        hCommandQueue = ze_command_queue_object_t::unwrap( hCommandQueue, dditable );
 
         // convert loader handles to driver handles
-        auto phCommandListsLocal = new ze_command_list_handle_t [numCommandLists];
+        handle_array_t<ze_command_list_handle_t> phCommandListsLocal( numCommandLists );
         for( size_t i = 0; ( nullptr != phCommandLists ) && ( i < numCommandLists ); ++i )
-            phCommandListsLocal[ i ] = reinterpret_cast<ze_command_list_object_t*>( phCommandLists[ i ] )->handle;
+            phCommandListsLocal[ i ] = ze_command_list_object_t::unwrap( phCommandLists[ i ], dditable );
 
         // convert loader handle to driver handle
-        hFence = ( hFence ) ? reinterpret_cast<ze_fence_object_t*>( hFence )->handle : nullptr;
+        hFence = ( hFence ) ? ze_fence_object_t::unwrap( hFence, dditable ) : nullptr;
 
         // forward to device-driver
         result = pfnExecuteCommandLists( hCommandQueue, numCommandLists, phCommandListsLocal, hFence );
-        delete []phCommandListsLocal;
 
         return result;
     }
@@ -1021,7 +1046,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hCommandQueue = reinterpret_cast<ze_command_queue_object_t*>( hCommandQueue )->handle;
+        hCommandQueue = ze_command_queue_object_t::unwrap( hCommandQueue, dditable );
 
         // forward to device-driver
         result = pfnSynchronize( hCommandQueue, timeout );
@@ -1047,11 +1072,14 @@ namespace loader
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // keep the loader handle, which tracks the loader handles created under it
+        auto hContextLoader = hContext;
+
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
+        hContext = ze_context_object_t::unwrap( hContext, dditable );
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
+        hDevice = ze_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnCreate( hContext, hDevice, desc, phCommandList );
@@ -1062,8 +1090,7 @@ namespace loader
         try
         {
             // convert driver handle to loader handle
-            *phCommandList = reinterpret_cast<ze_command_list_handle_t>(
-                ze_command_list_factory.getInstance( *phCommandList, dditable ) );
+            *phCommandList = ze_command_list_object_t::wrap( ze_command_list_factory, *phCommandList, dditable, ze_context_object_t::owner( hContextLoader, dditable ) );
         }
         catch( std::bad_alloc& )
         {
@@ -1091,11 +1118,14 @@ namespace loader
         if( nullptr == pfnCreateImmediate )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // keep the loader handle, which tracks the loader handles created under it
+        auto hContextLoader = hContext;
+
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
+        hContext = ze_context_object_t::unwrap( hContext, dditable );
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
+        hDevice = ze_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnCreateImmediate( hContext, hDevice, altdesc, phCommandList );
@@ -1106,8 +1136,7 @@ namespace loader
         try
         {
             // convert driver handle to loader handle
-            *phCommandList = reinterpret_cast<ze_command_list_handle_t>(
-                ze_command_list_factory.getInstance( *phCommandList, dditable ) );
+            *phCommandList = ze_command_list_object_t::wrap( ze_command_list_factory, *phCommandList, dditable, ze_context_object_t::owner( hContextLoader, dditable ) );
         }
         catch( std::bad_alloc& )
         {
@@ -1132,8 +1161,11 @@ namespace loader
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // keep the loader handle, which tracks the loader handles created under it
+        auto hCommandListLoader = hCommandList;
+
         // convert loader handle to driver handle
-        hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
+        hCommandList = ze_command_list_object_t::unwrap( hCommandList, dditable );
 
         // forward to device-driver
         result = pfnDestroy( hCommandList );
@@ -1142,7 +1174,7 @@ namespace loader
             return result;
 
         // release loader handle
-        ze_command_list_factory.release( hCommandList );
+        ze_command_list_object_t::release( ze_command_list_factory, hCommandListLoader, dditable );
 
         return result;
     }
@@ -1163,7 +1195,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
+        hCommandList = ze_command_list_object_t::unwrap( hCommandList, dditable );
 
         // forward to device-driver
         result = pfnClose( hCommandList );
@@ -1187,7 +1219,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
+        hCommandList = ze_command_list_object_t::unwrap( hCommandList, dditable );
 
         // forward to device-driver
         result = pfnReset( hCommandList );
@@ -1218,19 +1250,18 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
+        hCommandList = ze_command_list_object_t::unwrap( hCommandList, dditable );
 
         // convert loader handle to driver handle
-        hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
+        hSignalEvent = ( hSignalEvent ) ? ze_event_object_t::unwrap( hSignalEvent, dditable ) : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        handle_array_t<ze_event_handle_t> phWaitEventsLocal( numWaitEvents );
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
-            phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
+            phWaitEventsLocal[ i ] = ze_event_object_t::unwrap( phWaitEvents[ i ], dditable );
 
         // forward to device-driver
         result = pfnAppendWriteGlobalTimestamp( hCommandList, dstptr, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -1258,7 +1289,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
+        hCommandList = ze_command_list_object_t::unwrap( hCommandList, dditable );
 
         // forward to device-driver
         result = pfnHostSynchronize( hCommandList, timeout );
@@ -1287,19 +1318,18 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
+        hCommandList = ze_command_list_object_t::unwrap( hCommandList, dditable );
 
         // convert loader handle to driver handle
-        hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
+        hSignalEvent = ( hSignalEvent ) ? ze_event_object_t::unwrap( hSignalEvent, dditable ) : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        handle_array_t<ze_event_handle_t> phWaitEventsLocal( numWaitEvents );
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
-            phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
+            phWaitEventsLocal[ i ] = ze_event_object_t::unwrap( phWaitEvents[ i ], dditable );
 
         // forward to device-driver
         result = pfnAppendBarrier( hCommandList, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -1328,19 +1358,18 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
+        hCommandList = ze_command_list_object_t::unwrap( hCommandList, dditable );
 
         // convert loader handle to driver handle
-        hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
+        hSignalEvent = ( hSignalEvent ) ? ze_event_object_t::unwrap( hSignalEvent, dditable ) : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        handle_array_t<ze_event_handle_t> phWaitEventsLocal( numWaitEvents );
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
-            phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
+            phWaitEventsLocal[ i ] = ze_event_object_t::unwrap( phWaitEvents[ i ], dditable );
 
         // forward to device-driver
         result = pfnAppendMemoryRangesBarrier( hCommandList, numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -1362,10 +1391,10 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
+        hContext = ze_context_object_t::unwrap( hContext, dditable );
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
+        hDevice = ze_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnSystemBarrier( hContext, hDevice );
@@ -1397,19 +1426,18 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
+        hCommandList = ze_command_list_object_t::unwrap( hCommandList, dditable );
 
         // convert loader handle to driver handle
-        hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
+        hSignalEvent = ( hSignalEvent ) ? ze_event_object_t::unwrap( hSignalEvent, dditable ) : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        handle_array_t<ze_event_handle_t> phWaitEventsLocal( numWaitEvents );
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
-            phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
+            phWaitEventsLocal[ i ] = ze_event_object_t::unwrap( phWaitEvents[ i ], dditable );
 
         // forward to device-driver
         result = pfnAppendMemoryCopy( hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -1439,19 +1467,18 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
+        hCommandList = ze_command_list_object_t::unwrap( hCommandList, dditable );
 
         // convert loader handle to driver handle
-        hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
+        hSignalEvent = ( hSignalEvent ) ? ze_event_object_t::unwrap( hSignalEvent, dditable ) : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        handle_array_t<ze_event_handle_t> phWaitEventsLocal( numWaitEvents );
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
-            phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
+            phWaitEventsLocal[ i ] = ze_event_object_t::unwrap( phWaitEvents[ i ], dditable );
 
         // forward to device-driver
         result = pfnAppendMemoryFill( hCommandList, ptr, pattern, pattern_size, size, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -1489,19 +1516,18 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
+        hCommandList = ze_command_list_object_t::unwrap( hCommandList, dditable );
 
         // convert loader handle to driver handle
-        hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
+        hSignalEvent = ( hSignalEvent ) ? ze_event_object_t::unwrap( hSignalEvent, dditable ) : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        handle_array_t<ze_event_handle_t> phWaitEventsLocal( numWaitEvents );
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
-            phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
+            phWaitEventsLocal[ i ] = ze_event_object_t::unwrap( phWaitEvents[ i ], dditable );
 
         // forward to device-driver
         result = pfnAppendMemoryCopyRegion( hCommandList, dstptr, dstRegion, dstPitch, dstSlicePitch, srcptr, srcRegion, srcPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -1531,22 +1557,21 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
+        hCommandList = ze_command_list_object_t::unwrap( hCommandList, dditable );
 
         // convert loader handle to driver handle
-        hContextSrc = reinterpret_cast<ze_context_object_t*>( hContextSrc )->handle;
+        hContextSrc = ze_context_object_t::unwrap( hContextSrc, dditable );
 
         // convert loader handle to driver handle
-        hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
+        hSignalEvent = ( hSignalEvent ) ? ze_event_object_t::unwrap( hSignalEvent, dditable ) : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        handle_array_t<ze_event_handle_t> phWaitEventsLocal( numWaitEvents );
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
-            phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
+            phWaitEventsLocal[ i ] = ze_event_object_t::unwrap( phWaitEvents[ i ], dditable );
 
         // forward to device-driver
         result = pfnAppendMemoryCopyFromContext( hCommandList, dstptr, hContextSrc, srcptr, size, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -1574,25 +1599,24 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
+        hCommandList = ze_command_list_object_t::unwrap( hCommandList, dditable );
 
         // convert loader handle to driver handle
-        hDstImage = reinterpret_cast<ze_image_object_t*>( hDstImage )->handle;
+        hDstImage = ze_image_object_t::unwrap( hDstImage, dditable );
 
         // convert loader handle to driver handle
-        hSrcImage = reinterpret_cast<ze_image_object_t*>( hSrcImage )->handle;
+        hSrcImage = ze_image_object_t::unwrap( hSrcImage, dditable );
 
         // convert loader handle to driver handle
-        hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
+        hSignalEvent = ( hSignalEvent ) ? ze_event_object_t::unwrap( hSignalEvent, dditable ) : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        handle_array_t<ze_event_handle_t> phWaitEventsLocal( numWaitEvents );
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
-            phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
+            phWaitEventsLocal[ i ] = ze_event_object_t::unwrap( phWaitEvents[ i ], dditable );
 
         // forward to device-driver
         result = pfnAppendImageCopy( hCommandList, hDstImage, hSrcImage, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -1622,25 +1646,24 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
+        hCommandList = ze_command_list_object_t::unwrap( hCommandList, dditable );
 
         // convert loader handle to driver handle
-        hDstImage = reinterpret_cast<ze_image_object_t*>( hDstImage )->handle;
+        hDstImage = ze_image_object_t::unwrap( hDstImage, dditable );
 
         // convert loader handle to driver handle
-        hSrcImage = reinterpret_cast<ze_image_object_t*>( hSrcImage )->handle;
+        hSrcImage = ze_image_object_t::unwrap( hSrcImage, dditable );
 
         // convert loader handle to driver handle
-        hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
+        hSignalEvent = ( hSignalEvent ) ? ze_event_object_t::unwrap( hSignalEvent, dditable ) : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        handle_array_t<ze_event_handle_t> phWaitEventsLocal( numWaitEvents );
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
-            phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
+            phWaitEventsLocal[ i ] = ze_event_object_t::unwrap( phWaitEvents[ i ], dditable );
 
         // forward to device-driver
         result = pfnAppendImageCopyRegion( hCommandList, hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -1669,22 +1692,21 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
+        hCommandList = ze_command_list_object_t::unwrap( hCommandList, dditable );
 
         // convert loader handle to driver handle
-        hSrcImage = reinterpret_cast<ze_image_object_t*>( hSrcImage )->handle;
+        hSrcImage = ze_image_object_t::unwrap( hSrcImage, dditable );
 
         // convert loader handle to driver handle
-        hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
+        hSignalEvent = ( hSignalEvent ) ? ze_event_object_t::unwrap( hSignalEvent, dditable ) : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        handle_array_t<ze_event_handle_t> phWaitEventsLocal( numWaitEvents );
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
-            phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
+            phWaitEventsLocal[ i ] = ze_event_object_t::unwrap( phWaitEvents[ i ], dditable );
 
         // forward to device-driver
         result = pfnAppendImageCopyToMemory( hCommandList, dstptr, hSrcImage, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -1713,22 +1735,21 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
+        hCommandList = ze_command_list_object_t::unwrap( hCommandList, dditable );
 
         // convert loader handle to driver handle
-        hDstImage = reinterpret_cast<ze_image_object_t*>( hDstImage )->handle;
+        hDstImage = ze_image_object_t::unwrap( hDstImage, dditable );
 
         // convert loader handle to driver handle
-        hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
+        hSignalEvent = ( hSignalEvent ) ? ze_event_object_t::unwrap( hSignalEvent, dditable ) : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        handle_array_t<ze_event_handle_t> phWaitEventsLocal( numWaitEvents );
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
-            phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
+            phWaitEventsLocal[ i ] = ze_event_object_t::unwrap( phWaitEvents[ i ], dditable );
 
         // forward to device-driver
         result = pfnAppendImageCopyFromMemory( hCommandList, hDstImage, srcptr, pDstRegion, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -1751,7 +1772,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
+        hCommandList = ze_command_list_object_t::unwrap( hCommandList, dditable );
 
         // forward to device-driver
         result = pfnAppendMemoryPrefetch( hCommandList, ptr, size );
@@ -1779,10 +1800,10 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
+        hCommandList = ze_command_list_object_t::unwrap( hCommandList, dditable );
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
+        hDevice = ze_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnAppendMemAdvise( hCommandList, hDevice, ptr, size, advice );
@@ -1813,17 +1834,19 @@ namespace loader
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // keep the loader handle, which tracks the loader handles created under it
+        auto hContextLoader = hContext;
+
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
+        hContext = ze_context_object_t::unwrap( hContext, dditable );
 
         // convert loader handles to driver handles
-        auto phDevicesLocal = new ze_device_handle_t [numDevices];
+        handle_array_t<ze_device_handle_t> phDevicesLocal( numDevices );
         for( size_t i = 0; ( nullptr != phDevices ) && ( i < numDevices ); ++i )
-            phDevicesLocal[ i ] = reinterpret_cast<ze_device_object_t*>( phDevices[ i ] )->handle;
+            phDevicesLocal[ i ] = ze_device_object_t::unwrap( phDevices[ i ], dditable );
 
         // forward to device-driver
         result = pfnCreate( hContext, desc, numDevices, phDevicesLocal, phEventPool );
-        delete []phDevicesLocal;
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -1831,8 +1854,7 @@ namespace loader
         try
         {
             // convert driver handle to loader handle
-            *phEventPool = reinterpret_cast<ze_event_pool_handle_t>(
-                ze_event_pool_factory.getInstance( *phEventPool, dditable ) );
+            *phEventPool = ze_event_pool_object_t::wrap( ze_event_pool_factory, *phEventPool, dditable, ze_context_object_t::owner( hContextLoader, dditable ) );
         }
         catch( std::bad_alloc& )
         {
@@ -1857,8 +1879,11 @@ namespace loader
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // keep the loader handle, which tracks the loader handles created under it
+        auto hEventPoolLoader = hEventPool;
+
         // convert loader handle to driver handle
-        hEventPool = reinterpret_cast<ze_event_pool_object_t*>( hEventPool )->handle;
+        hEventPool = ze_event_pool_object_t::unwrap( hEventPool, dditable );
 
         // forward to device-driver
         result = pfnDestroy( hEventPool );
@@ -1867,7 +1892,7 @@ namespace loader
             return result;
 
         // release loader handle
-        ze_event_pool_factory.release( hEventPool );
+        ze_event_pool_object_t::release( ze_event_pool_factory, hEventPoolLoader, dditable );
 
         return result;
     }
@@ -1889,8 +1914,11 @@ namespace loader
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // keep the loader handle, which tracks the loader handles created under it
+        auto hEventPoolLoader = hEventPool;
+
         // convert loader handle to driver handle
-        hEventPool = reinterpret_cast<ze_event_pool_object_t*>( hEventPool )->handle;
+        hEventPool = ze_event_pool_object_t::unwrap( hEventPool, dditable );
 
         // forward to device-driver
         result = pfnCreate( hEventPool, desc, phEvent );
@@ -1901,8 +1929,7 @@ namespace loader
         try
         {
             // convert driver handle to loader handle
-            *phEvent = reinterpret_cast<ze_event_handle_t>(
-                ze_event_factory.getInstance( *phEvent, dditable ) );
+            *phEvent = ze_event_object_t::wrap( ze_event_factory, *phEvent, dditable, ze_event_pool_object_t::owner( hEventPoolLoader, dditable ) );
         }
         catch( std::bad_alloc& )
         {
@@ -1927,8 +1954,11 @@ namespace loader
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // keep the loader handle, which tracks the loader handles created under it
+        auto hEventLoader = hEvent;
+
         // convert loader handle to driver handle
-        hEvent = reinterpret_cast<ze_event_object_t*>( hEvent )->handle;
+        hEvent = ze_event_object_t::unwrap( hEvent, dditable );
 
         // forward to device-driver
         result = pfnDestroy( hEvent );
@@ -1937,7 +1967,7 @@ namespace loader
             return result;
 
         // release loader handle
-        ze_event_factory.release( hEvent );
+        ze_event_object_t::release( ze_event_factory, hEventLoader, dditable );
 
         return result;
     }
@@ -1959,7 +1989,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hEventPool = reinterpret_cast<ze_event_pool_object_t*>( hEventPool )->handle;
+        hEventPool = ze_event_pool_object_t::unwrap( hEventPool, dditable );
 
         // forward to device-driver
         result = pfnGetIpcHandle( hEventPool, phIpc );
@@ -1985,7 +2015,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
+        hContext = ze_context_object_t::unwrap( hContext, dditable );
 
         // forward to device-driver
         result = pfnPutIpcHandle( hContext, hIpc );
@@ -2011,8 +2041,11 @@ namespace loader
         if( nullptr == pfnOpenIpcHandle )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // keep the loader handle, which tracks the loader handles created under it
+        auto hContextLoader = hContext;
+
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
+        hContext = ze_context_object_t::unwrap( hContext, dditable );
 
         // forward to device-driver
         result = pfnOpenIpcHandle( hContext, hIpc, phEventPool );
@@ -2023,8 +2056,7 @@ namespace loader
         try
         {
             // convert driver handle to loader handle
-            *phEventPool = reinterpret_cast<ze_event_pool_handle_t>(
-                ze_event_pool_factory.getInstance( *phEventPool, dditable ) );
+            *phEventPool = ze_event_pool_object_t::wrap( ze_event_pool_factory, *phEventPool, dditable, ze_context_object_t::owner( hContextLoader, dditable ) );
         }
         catch( std::bad_alloc& )
         {
@@ -2049,8 +2081,11 @@ namespace loader
         if( nullptr == pfnCloseIpcHandle )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // keep the loader handle, which tracks the loader handles created under it
+        auto hEventPoolLoader = hEventPool;
+
         // convert loader handle to driver handle
-        hEventPool = reinterpret_cast<ze_event_pool_object_t*>( hEventPool )->handle;
+        hEventPool = ze_event_pool_object_t::unwrap( hEventPool, dditable );
 
         // forward to device-driver
         result = pfnCloseIpcHandle( hEventPool );
@@ -2059,7 +2094,7 @@ namespace loader
             return result;
 
         // release loader handle
-        ze_event_pool_factory.release( hEventPool );
+        ze_event_pool_object_t::release( ze_event_pool_factory, hEventPoolLoader, dditable );
 
         return result;
     }
@@ -2081,10 +2116,10 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
+        hCommandList = ze_command_list_object_t::unwrap( hCommandList, dditable );
 
         // convert loader handle to driver handle
-        hEvent = reinterpret_cast<ze_event_object_t*>( hEvent )->handle;
+        hEvent = ze_event_object_t::unwrap( hEvent, dditable );
 
         // forward to device-driver
         result = pfnAppendSignalEvent( hCommandList, hEvent );
@@ -2111,16 +2146,15 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
+        hCommandList = ze_command_list_object_t::unwrap( hCommandList, dditable );
 
         // convert loader handles to driver handles
-        auto phEventsLocal = new ze_event_handle_t [numEvents];
+        handle_array_t<ze_event_handle_t> phEventsLocal( numEvents );
         for( size_t i = 0; ( nullptr != phEvents ) && ( i < numEvents ); ++i )
-            phEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phEvents[ i ] )->handle;
+            phEventsLocal[ i ] = ze_event_object_t::unwrap( phEvents[ i ], dditable );
 
         // forward to device-driver
         result = pfnAppendWaitOnEvents( hCommandList, numEvents, phEventsLocal );
-        delete []phEventsLocal;
 
         return result;
     }
@@ -2141,7 +2175,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hEvent = reinterpret_cast<ze_event_object_t*>( hEvent )->handle;
+        hEvent = ze_event_object_t::unwrap( hEvent, dditable );
 
         // forward to device-driver
         result = pfnHostSignal( hEvent );
@@ -2172,7 +2206,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hEvent = reinterpret_cast<ze_event_object_t*>( hEvent )->handle;
+        hEvent = ze_event_object_t::unwrap( hEvent, dditable );
 
         // forward to device-driver
         result = pfnHostSynchronize( hEvent, timeout );
@@ -2196,7 +2230,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hEvent = reinterpret_cast<ze_event_object_t*>( hEvent )->handle;
+        hEvent = ze_event_object_t::unwrap( hEvent, dditable );
 
         // forward to device-driver
         result = pfnQueryStatus( hEvent );
@@ -2221,10 +2255,10 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
+        hCommandList = ze_command_list_object_t::unwrap( hCommandList, dditable );
 
         // convert loader handle to driver handle
-        hEvent = reinterpret_cast<ze_event_object_t*>( hEvent )->handle;
+        hEvent = ze_event_object_t::unwrap( hEvent, dditable );
 
         // forward to device-driver
         result = pfnAppendEventReset( hCommandList, hEvent );
@@ -2248,7 +2282,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hEvent = reinterpret_cast<ze_event_object_t*>( hEvent )->handle;
+        hEvent = ze_event_object_t::unwrap( hEvent, dditable );
 
         // forward to device-driver
         result = pfnHostReset( hEvent );
@@ -2273,7 +2307,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hEvent = reinterpret_cast<ze_event_object_t*>( hEvent )->handle;
+        hEvent = ze_event_object_t::unwrap( hEvent, dditable );
 
         // forward to device-driver
         result = pfnQueryKernelTimestamp( hEvent, dstptr );
@@ -2309,25 +2343,23 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
+        hCommandList = ze_command_list_object_t::unwrap( hCommandList, dditable );
 
         // convert loader handles to driver handles
-        auto phEventsLocal = new ze_event_handle_t [numEvents];
+        handle_array_t<ze_event_handle_t> phEventsLocal( numEvents );
         for( size_t i = 0; ( nullptr != phEvents ) && ( i < numEvents ); ++i )
-            phEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phEvents[ i ] )->handle;
+            phEventsLocal[ i ] = ze_event_object_t::unwrap( phEvents[ i ], dditable );
 
         // convert loader handle to driver handle
-        hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
+        hSignalEvent = ( hSignalEvent ) ? ze_event_object_t::unwrap( hSignalEvent, dditable ) : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        handle_array_t<ze_event_handle_t> phWaitEventsLocal( numWaitEvents );
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
-            phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
+            phWaitEventsLocal[ i ] = ze_event_object_t::unwrap( phWaitEvents[ i ], dditable );
 
         // forward to device-driver
         result = pfnAppendQueryKernelTimestamps( hCommandList, numEvents, phEventsLocal, dstptr, pOffsets, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phEventsLocal;
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -2349,8 +2381,11 @@ namespace loader
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // keep the loader handle, which tracks the loader handles created under it
+        auto hCommandQueueLoader = hCommandQueue;
+
         // convert loader handle to driver handle
-        hCommandQueue = reinterpret_cast<ze_command_queue_object_t*>( hCommandQueue )->handle;
+        hCommandQueue = ze_command_queue_object_t::unwrap( hCommandQueue, dditable );
 
         // forward to device-driver
         result = pfnCreate( hCommandQueue, desc, phFence );
@@ -2361,8 +2396,7 @@ namespace loader
         try
         {
             // convert driver handle to loader handle
-            *phFence = reinterpret_cast<ze_fence_handle_t>(
-                ze_fence_factory.getInstance( *phFence, dditable ) );
+            *phFence = ze_fence_object_t::wrap( ze_fence_factory, *phFence, dditable, ze_command_queue_object_t::owner( hCommandQueueLoader, dditable ) );
         }
         catch( std::bad_alloc& )
         {
@@ -2387,8 +2421,11 @@ namespace loader
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // keep the loader handle, which tracks the loader handles created under it
+        auto hFenceLoader = hFence;
+
         // convert loader handle to driver handle
-        hFence = reinterpret_cast<ze_fence_object_t*>( hFence )->handle;
+        hFence = ze_fence_object_t::unwrap( hFence, dditable );
 
         // forward to device-driver
         result = pfnDestroy( hFence );
@@ -2397,7 +2434,7 @@ namespace loader
             return result;
 
         // release loader handle
-        ze_fence_factory.release( hFence );
+        ze_fence_object_t::release( ze_fence_factory, hFenceLoader, dditable );
 
         return result;
     }
@@ -2425,7 +2462,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hFence = reinterpret_cast<ze_fence_object_t*>( hFence )->handle;
+        hFence = ze_fence_object_t::unwrap( hFence, dditable );
 
         // forward to device-driver
         result = pfnHostSynchronize( hFence, timeout );
@@ -2449,7 +2486,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hFence = reinterpret_cast<ze_fence_object_t*>( hFence )->handle;
+        hFence = ze_fence_object_t::unwrap( hFence, dditable );
 
         // forward to device-driver
         result = pfnQueryStatus( hFence );
@@ -2473,7 +2510,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hFence = reinterpret_cast<ze_fence_object_t*>( hFence )->handle;
+        hFence = ze_fence_object_t::unwrap( hFence, dditable );
 
         // forward to device-driver
         result = pfnReset( hFence );
@@ -2499,7 +2536,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
+        hDevice = ze_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnGetProperties( hDevice, desc, pImageProperties );
@@ -2525,11 +2562,14 @@ namespace loader
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // keep the loader handle, which tracks the loader handles created under it
+        auto hContextLoader = hContext;
+
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
+        hContext = ze_context_object_t::unwrap( hContext, dditable );
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
+        hDevice = ze_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnCreate( hContext, hDevice, desc, phImage );
@@ -2541,10 +2581,12 @@ namespace loader
         {
             // convert driver handle to loader handle
             ze_image_handle_t internalHandlePtr = *phImage;
-            *phImage = reinterpret_cast<ze_image_handle_t>(
-                ze_image_factory.getInstance( *phImage, dditable ) );
+            *phImage = ze_image_object_t::wrap( ze_image_factory, *phImage, dditable, ze_context_object_t::owner( hContextLoader, dditable ), releaseImageLink );
             // convert loader handle to driver handle and store in map
-            image_handle_map.insert({ze_image_factory.getInstance( internalHandlePtr, dditable ), internalHandlePtr});
+            if( !dditable->dispatchable ) {
+                std::lock_guard<std::mutex> lock( handle_map_mutex );
+                image_handle_map[reinterpret_cast<ze_image_object_t*>( *phImage )] = internalHandlePtr;
+            }
         }
         catch( std::bad_alloc& )
         {
@@ -2570,9 +2612,15 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // remove the handle from the kernel arugment map
-        image_handle_map.erase(reinterpret_cast<ze_image_object_t*>(hImage));
+        {
+            std::lock_guard<std::mutex> lock( handle_map_mutex );
+            image_handle_map.erase(reinterpret_cast<ze_image_object_t*>(hImage));
+        }
+        // keep the loader handle, which tracks the loader handles created under it
+        auto hImageLoader = hImage;
+
         // convert loader handle to driver handle
-        hImage = reinterpret_cast<ze_image_object_t*>( hImage )->handle;
+        hImage = ze_image_object_t::unwrap( hImage, dditable );
 
         // forward to device-driver
         result = pfnDestroy( hImage );
@@ -2581,7 +2629,7 @@ namespace loader
             return result;
 
         // release loader handle
-        ze_image_factory.release( hImage );
+        ze_image_object_t::release( ze_image_factory, hImageLoader, dditable );
 
         return result;
     }
@@ -2610,10 +2658,10 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
+        hContext = ze_context_object_t::unwrap( hContext, dditable );
 
         // convert loader handle to driver handle
-        hDevice = ( hDevice ) ? reinterpret_cast<ze_device_object_t*>( hDevice )->handle : nullptr;
+        hDevice = ( hDevice ) ? ze_device_object_t::unwrap( hDevice, dditable ) : nullptr;
 
         // forward to device-driver
         result = pfnAllocShared( hContext, device_desc, host_desc, size, alignment, hDevice, pptr );
@@ -2644,10 +2692,10 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
+        hContext = ze_context_object_t::unwrap( hContext, dditable );
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
+        hDevice = ze_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnAllocDevice( hContext, device_desc, size, alignment, hDevice, pptr );
@@ -2677,7 +2725,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
+        hContext = ze_context_object_t::unwrap( hContext, dditable );
 
         // forward to device-driver
         result = pfnAllocHost( hContext, host_desc, size, alignment, pptr );
@@ -2702,7 +2750,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
+        hContext = ze_context_object_t::unwrap( hContext, dditable );
 
         // forward to device-driver
         result = pfnFree( hContext, ptr );
@@ -2729,7 +2777,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
+        hContext = ze_context_object_t::unwrap( hContext, dditable );
 
         // forward to device-driver
         result = pfnGetAllocProperties( hContext, ptr, pMemAllocProperties, phDevice );
@@ -2741,8 +2789,7 @@ namespace loader
         {
             // convert driver handle to loader handle
             if( nullptr != phDevice )
-                *phDevice = reinterpret_cast<ze_device_handle_t>(
-                    ze_device_factory.getInstance( *phDevice, dditable ) );
+                *phDevice = ze_device_object_t::wrap( ze_device_factory, *phDevice, dditable );
         }
         catch( std::bad_alloc& )
         {
@@ -2771,7 +2818,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
+        hContext = ze_context_object_t::unwrap( hContext, dditable );
 
         // forward to device-driver
         result = pfnGetAddressRange( hContext, ptr, pBase, pSize );
@@ -2797,7 +2844,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
+        hContext = ze_context_object_t::unwrap( hContext, dditable );
 
         // forward to device-driver
         result = pfnGetIpcHandle( hContext, ptr, pIpcHandle );
@@ -2823,7 +2870,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
+        hContext = ze_context_object_t::unwrap( hContext, dditable );
 
         // forward to device-driver
         result = pfnGetIpcHandleFromFileDescriptorExp( hContext, handle, pIpcHandle );
@@ -2849,7 +2896,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
+        hContext = ze_context_object_t::unwrap( hContext, dditable );
 
         // forward to device-driver
         result = pfnGetFileDescriptorFromIpcHandleExp( hContext, ipcHandle, pHandle );
@@ -2874,7 +2921,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
+        hContext = ze_context_object_t::unwrap( hContext, dditable );
 
         // forward to device-driver
         result = pfnPutIpcHandle( hContext, handle );
@@ -2902,11 +2949,14 @@ namespace loader
         if( nullptr == pfnOpenIpcHandle )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // keep the loader handle, which tracks the loader handles created under it
+        auto hContextLoader = hContext;
+
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
+        hContext = ze_context_object_t::unwrap( hContext, dditable );
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
+        hDevice = ze_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnOpenIpcHandle( hContext, hDevice, handle, flags, pptr );
@@ -2931,7 +2981,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
+        hContext = ze_context_object_t::unwrap( hContext, dditable );
 
         // forward to device-driver
         result = pfnCloseIpcHandle( hContext, ptr );
@@ -2958,11 +3008,14 @@ namespace loader
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // keep the loader handle, which tracks the loader handles created under it
+        auto hContextLoader = hContext;
+
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
+        hContext = ze_context_object_t::unwrap( hContext, dditable );
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
+        hDevice = ze_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnCreate( hContext, hDevice, desc, phModule, phBuildLog );
@@ -2973,8 +3026,7 @@ namespace loader
         try
         {
             // convert driver handle to loader handle
-            *phModule = reinterpret_cast<ze_module_handle_t>(
-                ze_module_factory.getInstance( *phModule, dditable ) );
+            *phModule = ze_module_object_t::wrap( ze_module_factory, *phModule, dditable, ze_context_object_t::owner( hContextLoader, dditable ) );
         }
         catch( std::bad_alloc& )
         {
@@ -2985,8 +3037,7 @@ namespace loader
         {
             // convert driver handle to loader handle
             if( nullptr != phBuildLog )
-                *phBuildLog = reinterpret_cast<ze_module_build_log_handle_t>(
-                    ze_module_build_log_factory.getInstance( *phBuildLog, dditable ) );
+                *phBuildLog = ze_module_build_log_object_t::wrap( ze_module_build_log_factory, *phBuildLog, dditable, ze_context_object_t::owner( hContextLoader, dditable ) );
         }
         catch( std::bad_alloc& )
         {
@@ -3011,8 +3062,11 @@ namespace loader
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // keep the loader handle, which tracks the loader handles created under it
+        auto hModuleLoader = hModule;
+
         // convert loader handle to driver handle
-        hModule = reinterpret_cast<ze_module_object_t*>( hModule )->handle;
+        hModule = ze_module_object_t::unwrap( hModule, dditable );
 
         // forward to device-driver
         result = pfnDestroy( hModule );
@@ -3021,7 +3075,7 @@ namespace loader
             return result;
 
         // release loader handle
-        ze_module_factory.release( hModule );
+        ze_module_object_t::release( ze_module_factory, hModuleLoader, dditable );
 
         return result;
     }
@@ -3045,13 +3099,12 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handles to driver handles
-        auto phModulesLocal = new ze_module_handle_t [numModules];
+        handle_array_t<ze_module_handle_t> phModulesLocal( numModules );
         for( size_t i = 0; ( nullptr != phModules ) && ( i < numModules ); ++i )
-            phModulesLocal[ i ] = reinterpret_cast<ze_module_object_t*>( phModules[ i ] )->handle;
+            phModulesLocal[ i ] = ze_module_object_t::unwrap( phModules[ i ], dditable );
 
         // forward to device-driver
         result = pfnDynamicLink( numModules, phModulesLocal, phLinkLog );
-        delete []phModulesLocal;
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -3060,8 +3113,7 @@ namespace loader
         {
             // convert driver handle to loader handle
             if( nullptr != phLinkLog )
-                *phLinkLog = reinterpret_cast<ze_module_build_log_handle_t>(
-                    ze_module_build_log_factory.getInstance( *phLinkLog, dditable ) );
+                *phLinkLog = ze_module_build_log_object_t::wrap( ze_module_build_log_factory, *phLinkLog, dditable );
         }
         catch( std::bad_alloc& )
         {
@@ -3086,8 +3138,11 @@ namespace loader
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // keep the loader handle, which tracks the loader handles created under it
+        auto hModuleBuildLogLoader = hModuleBuildLog;
+
         // convert loader handle to driver handle
-        hModuleBuildLog = reinterpret_cast<ze_module_build_log_object_t*>( hModuleBuildLog )->handle;
+        hModuleBuildLog = ze_module_build_log_object_t::unwrap( hModuleBuildLog, dditable );
 
         // forward to device-driver
         result = pfnDestroy( hModuleBuildLog );
@@ -3096,7 +3151,7 @@ namespace loader
             return result;
 
         // release loader handle
-        ze_module_build_log_factory.release( hModuleBuildLog );
+        ze_module_build_log_object_t::release( ze_module_build_log_factory, hModuleBuildLogLoader, dditable );
 
         return result;
     }
@@ -3119,7 +3174,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hModuleBuildLog = reinterpret_cast<ze_module_build_log_object_t*>( hModuleBuildLog )->handle;
+        hModuleBuildLog = ze_module_build_log_object_t::unwrap( hModuleBuildLog, dditable );
 
         // forward to device-driver
         result = pfnGetString( hModuleBuildLog, pSize, pBuildLog );
@@ -3145,7 +3200,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hModule = reinterpret_cast<ze_module_object_t*>( hModule )->handle;
+        hModule = ze_module_object_t::unwrap( hModule, dditable );
 
         // forward to device-driver
         result = pfnGetNativeBinary( hModule, pSize, pModuleNativeBinary );
@@ -3172,7 +3227,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hModule = reinterpret_cast<ze_module_object_t*>( hModule )->handle;
+        hModule = ze_module_object_t::unwrap( hModule, dditable );
 
         // forward to device-driver
         result = pfnGetGlobalPointer( hModule, pGlobalName, pSize, pptr );
@@ -3204,7 +3259,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hModule = reinterpret_cast<ze_module_object_t*>( hModule )->handle;
+        hModule = ze_module_object_t::unwrap( hModule, dditable );
 
         // forward to device-driver
         result = pfnGetKernelNames( hModule, pCount, pNames );
@@ -3229,7 +3284,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hModule = reinterpret_cast<ze_module_object_t*>( hModule )->handle;
+        hModule = ze_module_object_t::unwrap( hModule, dditable );
 
         // forward to device-driver
         result = pfnGetProperties( hModule, pModuleProperties );
@@ -3254,8 +3309,11 @@ namespace loader
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // keep the loader handle, which tracks the loader handles created under it
+        auto hModuleLoader = hModule;
+
         // convert loader handle to driver handle
-        hModule = reinterpret_cast<ze_module_object_t*>( hModule )->handle;
+        hModule = ze_module_object_t::unwrap( hModule, dditable );
 
         // forward to device-driver
         result = pfnCreate( hModule, desc, phKernel );
@@ -3266,8 +3324,7 @@ namespace loader
         try
         {
             // convert driver handle to loader handle
-            *phKernel = reinterpret_cast<ze_kernel_handle_t>(
-                ze_kernel_factory.getInstance( *phKernel, dditable ) );
+            *phKernel = ze_kernel_object_t::wrap( ze_kernel_factory, *phKernel, dditable, ze_module_object_t::owner( hModuleLoader, dditable ) );
         }
         catch( std::bad_alloc& )
         {
@@ -3292,8 +3349,11 @@ namespace loader
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // keep the loader handle, which tracks the loader handles created under it
+        auto hKernelLoader = hKernel;
+
         // convert loader handle to driver handle
-        hKernel = reinterpret_cast<ze_kernel_object_t*>( hKernel )->handle;
+        hKernel = ze_kernel_object_t::unwrap( hKernel, dditable );
 
         // forward to device-driver
         result = pfnDestroy( hKernel );
@@ -3302,7 +3362,7 @@ namespace loader
             return result;
 
         // release loader handle
-        ze_kernel_factory.release( hKernel );
+        ze_kernel_object_t::release( ze_kernel_factory, hKernelLoader, dditable );
 
         return result;
     }
@@ -3325,7 +3385,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hModule = reinterpret_cast<ze_module_object_t*>( hModule )->handle;
+        hModule = ze_module_object_t::unwrap( hModule, dditable );
 
         // forward to device-driver
         result = pfnGetFunctionPointer( hModule, pFunctionName, pfnFunction );
@@ -3352,7 +3412,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hKernel = reinterpret_cast<ze_kernel_object_t*>( hKernel )->handle;
+        hKernel = ze_kernel_object_t::unwrap( hKernel, dditable );
 
         // forward to device-driver
         result = pfnSetGroupSize( hKernel, groupSizeX, groupSizeY, groupSizeZ );
@@ -3382,7 +3442,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hKernel = reinterpret_cast<ze_kernel_object_t*>( hKernel )->handle;
+        hKernel = ze_kernel_object_t::unwrap( hKernel, dditable );
 
         // forward to device-driver
         result = pfnSuggestGroupSize( hKernel, globalSizeX, globalSizeY, globalSizeZ, groupSizeX, groupSizeY, groupSizeZ );
@@ -3407,7 +3467,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hKernel = reinterpret_cast<ze_kernel_object_t*>( hKernel )->handle;
+        hKernel = ze_kernel_object_t::unwrap( hKernel, dditable );
 
         // forward to device-driver
         result = pfnSuggestMaxCooperativeGroupCount( hKernel, totalGroupCount );
@@ -3435,18 +3495,27 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hKernel = reinterpret_cast<ze_kernel_object_t*>( hKernel )->handle;
+        hKernel = ze_kernel_object_t::unwrap( hKernel, dditable );
 
         // convert pArgValue to correct handle if applicable
         void *internalArgValue = const_cast<void *>(pArgValue);
-        if (pArgValue) {
-            // check if the arg value is a translated handle
+        void *internalHandle = nullptr;
+        if( pArgValue && !dditable->dispatchable ) {
+            // check if the arg value is a translated handle; the driver handle
+            // is copied out, since the map may change once the lock is dropped
             ze_image_object_t **imageHandle = static_cast<ze_image_object_t **>(internalArgValue);
             ze_sampler_object_t **samplerHandle = static_cast<ze_sampler_object_t **>(internalArgValue);
-            if( image_handle_map.find(*imageHandle) != image_handle_map.end() ) {
-                internalArgValue = &image_handle_map[*imageHandle];
-            } else if( sampler_handle_map.find(*samplerHandle) != sampler_handle_map.end() ) {
-                internalArgValue = &sampler_handle_map[*samplerHandle];
+            std::lock_guard<std::mutex> lock( handle_map_mutex );
+            auto image = image_handle_map.find(*imageHandle);
+            if( image != image_handle_map.end() ) {
+                internalHandle = image->second;
+                internalArgValue = &internalHandle;
+            } else {
+                auto sampler = sampler_handle_map.find(*samplerHandle);
+                if( sampler != sampler_handle_map.end() ) {
+                    internalHandle = sampler->second;
+                    internalArgValue = &internalHandle;
+                }
             }
         }
         // forward to device-driver
@@ -3472,7 +3541,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hKernel = reinterpret_cast<ze_kernel_object_t*>( hKernel )->handle;
+        hKernel = ze_kernel_object_t::unwrap( hKernel, dditable );
 
         // forward to device-driver
         result = pfnSetIndirectAccess( hKernel, flags );
@@ -3497,7 +3566,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hKernel = reinterpret_cast<ze_kernel_object_t*>( hKernel )->handle;
+        hKernel = ze_kernel_object_t::unwrap( hKernel, dditable );
 
         // forward to device-driver
         result = pfnGetIndirectAccess( hKernel, pFlags );
@@ -3530,7 +3599,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hKernel = reinterpret_cast<ze_kernel_object_t*>( hKernel )->handle;
+        hKernel = ze_kernel_object_t::unwrap( hKernel, dditable );
 
         // forward to device-driver
         result = pfnGetSourceAttributes( hKernel, pSize, pString );
@@ -3556,7 +3625,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hKernel = reinterpret_cast<ze_kernel_object_t*>( hKernel )->handle;
+        hKernel = ze_kernel_object_t::unwrap( hKernel, dditable );
 
         // forward to device-driver
         result = pfnSetCacheConfig( hKernel, flags );
@@ -3581,7 +3650,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hKernel = reinterpret_cast<ze_kernel_object_t*>( hKernel )->handle;
+        hKernel = ze_kernel_object_t::unwrap( hKernel, dditable );
 
         // forward to device-driver
         result = pfnGetProperties( hKernel, pKernelProperties );
@@ -3608,7 +3677,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hKernel = reinterpret_cast<ze_kernel_object_t*>( hKernel )->handle;
+        hKernel = ze_kernel_object_t::unwrap( hKernel, dditable );
 
         // forward to device-driver
         result = pfnGetName( hKernel, pSize, pName );
@@ -3639,22 +3708,21 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
+        hCommandList = ze_command_list_object_t::unwrap( hCommandList, dditable );
 
         // convert loader handle to driver handle
-        hKernel = reinterpret_cast<ze_kernel_object_t*>( hKernel )->handle;
+        hKernel = ze_kernel_object_t::unwrap( hKernel, dditable );
 
         // convert loader handle to driver handle
-        hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
+        hSignalEvent = ( hSignalEvent ) ? ze_event_object_t::unwrap( hSignalEvent, dditable ) : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        handle_array_t<ze_event_handle_t> phWaitEventsLocal( numWaitEvents );
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
-            phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
+            phWaitEventsLocal[ i ] = ze_event_object_t::unwrap( phWaitEvents[ i ], dditable );
 
         // forward to device-driver
         result = pfnAppendLaunchKernel( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -3682,22 +3750,21 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
+        hCommandList = ze_command_list_object_t::unwrap( hCommandList, dditable );
 
         // convert loader handle to driver handle
-        hKernel = reinterpret_cast<ze_kernel_object_t*>( hKernel )->handle;
+        hKernel = ze_kernel_object_t::unwrap( hKernel, dditable );
 
         // convert loader handle to driver handle
-        hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
+        hSignalEvent = ( hSignalEvent ) ? ze_event_object_t::unwrap( hSignalEvent, dditable ) : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        handle_array_t<ze_event_handle_t> phWaitEventsLocal( numWaitEvents );
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
-            phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
+            phWaitEventsLocal[ i ] = ze_event_object_t::unwrap( phWaitEvents[ i ], dditable );
 
         // forward to device-driver
         result = pfnAppendLaunchCooperativeKernel( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -3726,22 +3793,21 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
+        hCommandList = ze_command_list_object_t::unwrap( hCommandList, dditable );
 
         // convert loader handle to driver handle
-        hKernel = reinterpret_cast<ze_kernel_object_t*>( hKernel )->handle;
+        hKernel = ze_kernel_object_t::unwrap( hKernel, dditable );
 
         // convert loader handle to driver handle
-        hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
+        hSignalEvent = ( hSignalEvent ) ? ze_event_object_t::unwrap( hSignalEvent, dditable ) : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        handle_array_t<ze_event_handle_t> phWaitEventsLocal( numWaitEvents );
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
-            phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
+            phWaitEventsLocal[ i ] = ze_event_object_t::unwrap( phWaitEvents[ i ], dditable );
 
         // forward to device-driver
         result = pfnAppendLaunchKernelIndirect( hCommandList, hKernel, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -3774,25 +3840,23 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
+        hCommandList = ze_command_list_object_t::unwrap( hCommandList, dditable );
 
         // convert loader handles to driver handles
-        auto phKernelsLocal = new ze_kernel_handle_t [numKernels];
+        handle_array_t<ze_kernel_handle_t> phKernelsLocal( numKernels );
         for( size_t i = 0; ( nullptr != phKernels ) && ( i < numKernels ); ++i )
-            phKernelsLocal[ i ] = reinterpret_cast<ze_kernel_object_t*>( phKernels[ i ] )->handle;
+            phKernelsLocal[ i ] = ze_kernel_object_t::unwrap( phKernels[ i ], dditable );
 
         // convert loader handle to driver handle
-        hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
+        hSignalEvent = ( hSignalEvent ) ? ze_event_object_t::unwrap( hSignalEvent, dditable ) : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        handle_array_t<ze_event_handle_t> phWaitEventsLocal( numWaitEvents );
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
-            phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
+            phWaitEventsLocal[ i ] = ze_event_object_t::unwrap( phWaitEvents[ i ], dditable );
 
         // forward to device-driver
         result = pfnAppendLaunchMultipleKernelsIndirect( hCommandList, numKernels, phKernelsLocal, pCountBuffer, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phKernelsLocal;
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -3816,10 +3880,10 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
+        hContext = ze_context_object_t::unwrap( hContext, dditable );
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
+        hDevice = ze_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnMakeMemoryResident( hContext, hDevice, ptr, size );
@@ -3846,10 +3910,10 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
+        hContext = ze_context_object_t::unwrap( hContext, dditable );
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
+        hDevice = ze_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnEvictMemory( hContext, hDevice, ptr, size );
@@ -3875,13 +3939,13 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
+        hContext = ze_context_object_t::unwrap( hContext, dditable );
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
+        hDevice = ze_device_object_t::unwrap( hDevice, dditable );
 
         // convert loader handle to driver handle
-        hImage = reinterpret_cast<ze_image_object_t*>( hImage )->handle;
+        hImage = ze_image_object_t::unwrap( hImage, dditable );
 
         // forward to device-driver
         result = pfnMakeImageResident( hContext, hDevice, hImage );
@@ -3907,13 +3971,13 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
+        hContext = ze_context_object_t::unwrap( hContext, dditable );
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
+        hDevice = ze_device_object_t::unwrap( hDevice, dditable );
 
         // convert loader handle to driver handle
-        hImage = reinterpret_cast<ze_image_object_t*>( hImage )->handle;
+        hImage = ze_image_object_t::unwrap( hImage, dditable );
 
         // forward to device-driver
         result = pfnEvictImage( hContext, hDevice, hImage );
@@ -3939,11 +4003,14 @@ namespace loader
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // keep the loader handle, which tracks the loader handles created under it
+        auto hContextLoader = hContext;
+
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
+        hContext = ze_context_object_t::unwrap( hContext, dditable );
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
+        hDevice = ze_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnCreate( hContext, hDevice, desc, phSampler );
@@ -3955,10 +4022,12 @@ namespace loader
         {
             // convert driver handle to loader handle
             ze_sampler_handle_t internalHandlePtr = *phSampler;
-            *phSampler = reinterpret_cast<ze_sampler_handle_t>(
-                ze_sampler_factory.getInstance( *phSampler, dditable ) );
+            *phSampler = ze_sampler_object_t::wrap( ze_sampler_factory, *phSampler, dditable, ze_context_object_t::owner( hContextLoader, dditable ), releaseSamplerLink );
             // convert loader handle to driver handle and store in map
-            sampler_handle_map.insert({ze_sampler_factory.getInstance( internalHandlePtr, dditable ), internalHandlePtr});
+            if( !dditable->dispatchable ) {
+                std::lock_guard<std::mutex> lock( handle_map_mutex );
+                sampler_handle_map[reinterpret_cast<ze_sampler_object_t*>( *phSampler )] = internalHandlePtr;
+            }
         }
         catch( std::bad_alloc& )
         {
@@ -3984,9 +4053,15 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // remove the handle from the kernel arugment map
-        sampler_handle_map.erase(reinterpret_cast<ze_sampler_object_t*>(hSampler));
+        {
+            std::lock_guard<std::mutex> lock( handle_map_mutex );
+            sampler_handle_map.erase(reinterpret_cast<ze_sampler_object_t*>(hSampler));
+        }
+        // keep the loader handle, which tracks the loader handles created under it
+        auto hSamplerLoader = hSampler;
+
         // convert loader handle to driver handle
-        hSampler = reinterpret_cast<ze_sampler_object_t*>( hSampler )->handle;
+        hSampler = ze_sampler_object_t::unwrap( hSampler, dditable );
 
         // forward to device-driver
         result = pfnDestroy( hSampler );
@@ -3995,7 +4070,7 @@ namespace loader
             return result;
 
         // release loader handle
-        ze_sampler_factory.release( hSampler );
+        ze_sampler_object_t::release( ze_sampler_factory, hSamplerLoader, dditable );
 
         return result;
     }
@@ -4020,7 +4095,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
+        hContext = ze_context_object_t::unwrap( hContext, dditable );
 
         // forward to device-driver
         result = pfnReserve( hContext, pStart, size, pptr );
@@ -4046,7 +4121,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
+        hContext = ze_context_object_t::unwrap( hContext, dditable );
 
         // forward to device-driver
         result = pfnFree( hContext, ptr, size );
@@ -4074,10 +4149,10 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
+        hContext = ze_context_object_t::unwrap( hContext, dditable );
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
+        hDevice = ze_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnQueryPageSize( hContext, hDevice, size, pagesize );
@@ -4103,11 +4178,14 @@ namespace loader
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // keep the loader handle, which tracks the loader handles created under it
+        auto hContextLoader = hContext;
+
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
+        hContext = ze_context_object_t::unwrap( hContext, dditable );
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
+        hDevice = ze_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnCreate( hContext, hDevice, desc, phPhysicalMemory );
@@ -4118,8 +4196,7 @@ namespace loader
         try
         {
             // convert driver handle to loader handle
-            *phPhysicalMemory = reinterpret_cast<ze_physical_mem_handle_t>(
-                ze_physical_mem_factory.getInstance( *phPhysicalMemory, dditable ) );
+            *phPhysicalMemory = ze_physical_mem_object_t::wrap( ze_physical_mem_factory, *phPhysicalMemory, dditable, ze_context_object_t::owner( hContextLoader, dditable ) );
         }
         catch( std::bad_alloc& )
         {
@@ -4146,10 +4223,13 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
+        hContext = ze_context_object_t::unwrap( hContext, dditable );
+
+        // keep the loader handle, which tracks the loader handles created under it
+        auto hPhysicalMemoryLoader = hPhysicalMemory;
 
         // convert loader handle to driver handle
-        hPhysicalMemory = reinterpret_cast<ze_physical_mem_object_t*>( hPhysicalMemory )->handle;
+        hPhysicalMemory = ze_physical_mem_object_t::unwrap( hPhysicalMemory, dditable );
 
         // forward to device-driver
         result = pfnDestroy( hContext, hPhysicalMemory );
@@ -4158,7 +4238,7 @@ namespace loader
             return result;
 
         // release loader handle
-        ze_physical_mem_factory.release( hPhysicalMemory );
+        ze_physical_mem_object_t::release( ze_physical_mem_factory, hPhysicalMemoryLoader, dditable );
 
         return result;
     }
@@ -4187,10 +4267,10 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
+        hContext = ze_context_object_t::unwrap( hContext, dditable );
 
         // convert loader handle to driver handle
-        hPhysicalMemory = reinterpret_cast<ze_physical_mem_object_t*>( hPhysicalMemory )->handle;
+        hPhysicalMemory = ze_physical_mem_object_t::unwrap( hPhysicalMemory, dditable );
 
         // forward to device-driver
         result = pfnMap( hContext, ptr, size, hPhysicalMemory, offset, access );
@@ -4216,7 +4296,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
+        hContext = ze_context_object_t::unwrap( hContext, dditable );
 
         // forward to device-driver
         result = pfnUnmap( hContext, ptr, size );
@@ -4244,7 +4324,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
+        hContext = ze_context_object_t::unwrap( hContext, dditable );
 
         // forward to device-driver
         result = pfnSetAccessAttribute( hContext, ptr, size, access );
@@ -4273,7 +4353,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
+        hContext = ze_context_object_t::unwrap( hContext, dditable );
 
         // forward to device-driver
         result = pfnGetAccessAttribute( hContext, ptr, size, access, outSize );
@@ -4300,7 +4380,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hKernel = reinterpret_cast<ze_kernel_object_t*>( hKernel )->handle;
+        hKernel = ze_kernel_object_t::unwrap( hKernel, dditable );
 
         // forward to device-driver
         result = pfnSetGlobalOffsetExp( hKernel, offsetX, offsetY, offsetZ );
@@ -4329,7 +4409,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
+        hDevice = ze_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnReserveCacheExt( hDevice, cacheLevel, cacheReservationSize );
@@ -4356,7 +4436,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
+        hDevice = ze_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnSetCacheAdviceExt( hDevice, ptr, regionSize, cacheRegion );
@@ -4389,10 +4469,10 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hEvent = reinterpret_cast<ze_event_object_t*>( hEvent )->handle;
+        hEvent = ze_event_object_t::unwrap( hEvent, dditable );
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
+        hDevice = ze_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnQueryTimestampsExp( hEvent, hDevice, pCount, pTimestamps );
@@ -4417,7 +4497,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hImage = reinterpret_cast<ze_image_object_t*>( hImage )->handle;
+        hImage = ze_image_object_t::unwrap( hImage, dditable );
 
         // forward to device-driver
         result = pfnGetMemoryPropertiesExp( hImage, pMemoryProperties );
@@ -4444,14 +4524,17 @@ namespace loader
         if( nullptr == pfnViewCreateExt )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // keep the loader handle, which tracks the loader handles created under it
+        auto hContextLoader = hContext;
+
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
+        hContext = ze_context_object_t::unwrap( hContext, dditable );
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
+        hDevice = ze_device_object_t::unwrap( hDevice, dditable );
 
         // convert loader handle to driver handle
-        hImage = reinterpret_cast<ze_image_object_t*>( hImage )->handle;
+        hImage = ze_image_object_t::unwrap( hImage, dditable );
 
         // forward to device-driver
         result = pfnViewCreateExt( hContext, hDevice, desc, hImage, phImageView );
@@ -4462,8 +4545,7 @@ namespace loader
         try
         {
             // convert driver handle to loader handle
-            *phImageView = reinterpret_cast<ze_image_handle_t>(
-                ze_image_factory.getInstance( *phImageView, dditable ) );
+            *phImageView = ze_image_object_t::wrap( ze_image_factory, *phImageView, dditable, ze_context_object_t::owner( hContextLoader, dditable ) );
         }
         catch( std::bad_alloc& )
         {
@@ -4492,14 +4574,17 @@ namespace loader
         if( nullptr == pfnViewCreateExp )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // keep the loader handle, which tracks the loader handles created under it
+        auto hContextLoader = hContext;
+
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
+        hContext = ze_context_object_t::unwrap( hContext, dditable );
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
+        hDevice = ze_device_object_t::unwrap( hDevice, dditable );
 
         // convert loader handle to driver handle
-        hImage = reinterpret_cast<ze_image_object_t*>( hImage )->handle;
+        hImage = ze_image_object_t::unwrap( hImage, dditable );
 
         // forward to device-driver
         result = pfnViewCreateExp( hContext, hDevice, desc, hImage, phImageView );
@@ -4511,10 +4596,12 @@ namespace loader
         {
             // convert driver handle to loader handle
             ze_image_handle_t internalHandlePtr = *phImageView;
-            *phImageView = reinterpret_cast<ze_image_handle_t>(
-                ze_image_factory.getInstance( *phImageView, dditable ) );
+            *phImageView = ze_image_object_t::wrap( ze_image_factory, *phImageView, dditable, ze_context_object_t::owner( hContextLoader, dditable ), releaseImageLink );
             // convert loader handle to driver handle and store in map
-            image_handle_map.insert({ze_image_factory.getInstance( internalHandlePtr, dditable ), internalHandlePtr});
+            if( !dditable->dispatchable ) {
+                std::lock_guard<std::mutex> lock( handle_map_mutex );
+                image_handle_map[reinterpret_cast<ze_image_object_t*>( *phImageView )] = internalHandlePtr;
+            }
         }
         catch( std::bad_alloc& )
         {
@@ -4541,7 +4628,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hKernel = reinterpret_cast<ze_kernel_object_t*>( hKernel )->handle;
+        hKernel = ze_kernel_object_t::unwrap( hKernel, dditable );
 
         // forward to device-driver
         result = pfnSchedulingHintExp( hKernel, pHint );
@@ -4566,7 +4653,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
+        hDevice = ze_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnPciGetPropertiesExt( hDevice, pPciProperties );
@@ -4602,22 +4689,21 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
+        hCommandList = ze_command_list_object_t::unwrap( hCommandList, dditable );
 
         // convert loader handle to driver handle
-        hSrcImage = reinterpret_cast<ze_image_object_t*>( hSrcImage )->handle;
+        hSrcImage = ze_image_object_t::unwrap( hSrcImage, dditable );
 
         // convert loader handle to driver handle
-        hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
+        hSignalEvent = ( hSignalEvent ) ? ze_event_object_t::unwrap( hSignalEvent, dditable ) : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        handle_array_t<ze_event_handle_t> phWaitEventsLocal( numWaitEvents );
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
-            phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
+            phWaitEventsLocal[ i ] = ze_event_object_t::unwrap( phWaitEvents[ i ], dditable );
 
         // forward to device-driver
         result = pfnAppendImageCopyToMemoryExt( hCommandList, dstptr, hSrcImage, pSrcRegion, destRowPitch, destSlicePitch, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -4650,22 +4736,21 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
+        hCommandList = ze_command_list_object_t::unwrap( hCommandList, dditable );
 
         // convert loader handle to driver handle
-        hDstImage = reinterpret_cast<ze_image_object_t*>( hDstImage )->handle;
+        hDstImage = ze_image_object_t::unwrap( hDstImage, dditable );
 
         // convert loader handle to driver handle
-        hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
+        hSignalEvent = ( hSignalEvent ) ? ze_event_object_t::unwrap( hSignalEvent, dditable ) : nullptr;
 
         // convert loader handles to driver handles
-        auto phWaitEventsLocal = new ze_event_handle_t [numWaitEvents];
+        handle_array_t<ze_event_handle_t> phWaitEventsLocal( numWaitEvents );
         for( size_t i = 0; ( nullptr != phWaitEvents ) && ( i < numWaitEvents ); ++i )
-            phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
+            phWaitEventsLocal[ i ] = ze_event_object_t::unwrap( phWaitEvents[ i ], dditable );
 
         // forward to device-driver
         result = pfnAppendImageCopyFromMemoryExt( hCommandList, hDstImage, srcptr, pDstRegion, srcRowPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEventsLocal );
-        delete []phWaitEventsLocal;
 
         return result;
     }
@@ -4688,10 +4773,10 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
+        hContext = ze_context_object_t::unwrap( hContext, dditable );
 
         // convert loader handle to driver handle
-        hImage = reinterpret_cast<ze_image_object_t*>( hImage )->handle;
+        hImage = ze_image_object_t::unwrap( hImage, dditable );
 
         // forward to device-driver
         result = pfnGetAllocPropertiesExt( hContext, hImage, pImageAllocProperties );
@@ -4720,13 +4805,12 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handles to driver handles
-        auto phModulesLocal = new ze_module_handle_t [numModules];
+        handle_array_t<ze_module_handle_t> phModulesLocal( numModules );
         for( size_t i = 0; ( nullptr != phModules ) && ( i < numModules ); ++i )
-            phModulesLocal[ i ] = reinterpret_cast<ze_module_object_t*>( phModules[ i ] )->handle;
+            phModulesLocal[ i ] = ze_module_object_t::unwrap( phModules[ i ], dditable );
 
         // forward to device-driver
         result = pfnInspectLinkageExt( pInspectDesc, numModules, phModulesLocal, phLog );
-        delete []phModulesLocal;
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -4734,8 +4818,7 @@ namespace loader
         try
         {
             // convert driver handle to loader handle
-            *phLog = reinterpret_cast<ze_module_build_log_handle_t>(
-                ze_module_build_log_factory.getInstance( *phLog, dditable ) );
+            *phLog = ze_module_build_log_object_t::wrap( ze_module_build_log_factory, *phLog, dditable );
         }
         catch( std::bad_alloc& )
         {
@@ -4763,7 +4846,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
+        hContext = ze_context_object_t::unwrap( hContext, dditable );
 
         // forward to device-driver
         result = pfnFreeExt( hContext, pMemFreeDesc, ptr );
@@ -4796,7 +4879,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
+        hDriver = ze_driver_object_t::unwrap( hDriver, dditable );
 
         // forward to device-driver
         result = pfnGetExp( hDriver, pCount, phVertices );
@@ -4808,8 +4891,7 @@ namespace loader
         {
             // convert driver handles to loader handles
             for( size_t i = 0; ( nullptr != phVertices ) && ( i < *pCount ); ++i )
-                phVertices[ i ] = reinterpret_cast<ze_fabric_vertex_handle_t>(
-                    ze_fabric_vertex_factory.getInstance( phVertices[ i ], dditable ) );
+                phVertices[ i ] = ze_fabric_vertex_object_t::wrap( ze_fabric_vertex_factory, phVertices[ i ], dditable );
         }
         catch( std::bad_alloc& )
         {
@@ -4844,7 +4926,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hVertex = reinterpret_cast<ze_fabric_vertex_object_t*>( hVertex )->handle;
+        hVertex = ze_fabric_vertex_object_t::unwrap( hVertex, dditable );
 
         // forward to device-driver
         result = pfnGetSubVerticesExp( hVertex, pCount, phSubvertices );
@@ -4856,8 +4938,7 @@ namespace loader
         {
             // convert driver handles to loader handles
             for( size_t i = 0; ( nullptr != phSubvertices ) && ( i < *pCount ); ++i )
-                phSubvertices[ i ] = reinterpret_cast<ze_fabric_vertex_handle_t>(
-                    ze_fabric_vertex_factory.getInstance( phSubvertices[ i ], dditable ) );
+                phSubvertices[ i ] = ze_fabric_vertex_object_t::wrap( ze_fabric_vertex_factory, phSubvertices[ i ], dditable );
         }
         catch( std::bad_alloc& )
         {
@@ -4884,7 +4965,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hVertex = reinterpret_cast<ze_fabric_vertex_object_t*>( hVertex )->handle;
+        hVertex = ze_fabric_vertex_object_t::unwrap( hVertex, dditable );
 
         // forward to device-driver
         result = pfnGetPropertiesExp( hVertex, pVertexProperties );
@@ -4909,7 +4990,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hVertex = reinterpret_cast<ze_fabric_vertex_object_t*>( hVertex )->handle;
+        hVertex = ze_fabric_vertex_object_t::unwrap( hVertex, dditable );
 
         // forward to device-driver
         result = pfnGetDeviceExp( hVertex, phDevice );
@@ -4920,8 +5001,7 @@ namespace loader
         try
         {
             // convert driver handle to loader handle
-            *phDevice = reinterpret_cast<ze_device_handle_t>(
-                ze_device_factory.getInstance( *phDevice, dditable ) );
+            *phDevice = ze_device_object_t::wrap( ze_device_factory, *phDevice, dditable );
         }
         catch( std::bad_alloc& )
         {
@@ -4948,7 +5028,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
+        hDevice = ze_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnGetFabricVertexExp( hDevice, phVertex );
@@ -4959,8 +5039,7 @@ namespace loader
         try
         {
             // convert driver handle to loader handle
-            *phVertex = reinterpret_cast<ze_fabric_vertex_handle_t>(
-                ze_fabric_vertex_factory.getInstance( *phVertex, dditable ) );
+            *phVertex = ze_fabric_vertex_object_t::wrap( ze_fabric_vertex_factory, *phVertex, dditable );
         }
         catch( std::bad_alloc& )
         {
@@ -4996,10 +5075,10 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hVertexA = reinterpret_cast<ze_fabric_vertex_object_t*>( hVertexA )->handle;
+        hVertexA = ze_fabric_vertex_object_t::unwrap( hVertexA, dditable );
 
         // convert loader handle to driver handle
-        hVertexB = reinterpret_cast<ze_fabric_vertex_object_t*>( hVertexB )->handle;
+        hVertexB = ze_fabric_vertex_object_t::unwrap( hVertexB, dditable );
 
         // forward to device-driver
         result = pfnGetExp( hVertexA, hVertexB, pCount, phEdges );
@@ -5011,8 +5090,7 @@ namespace loader
         {
             // convert driver handles to loader handles
             for( size_t i = 0; ( nullptr != phEdges ) && ( i < *pCount ); ++i )
-                phEdges[ i ] = reinterpret_cast<ze_fabric_edge_handle_t>(
-                    ze_fabric_edge_factory.getInstance( phEdges[ i ], dditable ) );
+                phEdges[ i ] = ze_fabric_edge_object_t::wrap( ze_fabric_edge_factory, phEdges[ i ], dditable );
         }
         catch( std::bad_alloc& )
         {
@@ -5040,7 +5118,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hEdge = reinterpret_cast<ze_fabric_edge_object_t*>( hEdge )->handle;
+        hEdge = ze_fabric_edge_object_t::unwrap( hEdge, dditable );
 
         // forward to device-driver
         result = pfnGetVerticesExp( hEdge, phVertexA, phVertexB );
@@ -5051,8 +5129,7 @@ namespace loader
         try
         {
             // convert driver handle to loader handle
-            *phVertexA = reinterpret_cast<ze_fabric_vertex_handle_t>(
-                ze_fabric_vertex_factory.getInstance( *phVertexA, dditable ) );
+            *phVertexA = ze_fabric_vertex_object_t::wrap( ze_fabric_vertex_factory, *phVertexA, dditable );
         }
         catch( std::bad_alloc& )
         {
@@ -5062,8 +5139,7 @@ namespace loader
         try
         {
             // convert driver handle to loader handle
-            *phVertexB = reinterpret_cast<ze_fabric_vertex_handle_t>(
-                ze_fabric_vertex_factory.getInstance( *phVertexB, dditable ) );
+            *phVertexB = ze_fabric_vertex_object_t::wrap( ze_fabric_vertex_factory, *phVertexB, dditable );
         }
         catch( std::bad_alloc& )
         {
@@ -5090,7 +5166,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hEdge = reinterpret_cast<ze_fabric_edge_object_t*>( hEdge )->handle;
+        hEdge = ze_fabric_edge_object_t::unwrap( hEdge, dditable );
 
         // forward to device-driver
         result = pfnGetPropertiesExp( hEdge, pEdgeProperties );
@@ -5129,10 +5205,10 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hEvent = reinterpret_cast<ze_event_object_t*>( hEvent )->handle;
+        hEvent = ze_event_object_t::unwrap( hEvent, dditable );
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
+        hDevice = ze_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnQueryKernelTimestampsExt( hEvent, hDevice, pCount, pResults );
@@ -5140,6 +5216,185 @@ namespace loader
         return result;
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// fills the ze tables of a driver through its optional bulk export, once,
+    /// when they are first requested; tables of drivers without it are looked
+    /// up one by one
+    static void zeLoadAllDriverTables( driver_t& drv )
+    {
+        if( drv.zeAllTablesRequested )
+            return;
+        drv.zeAllTablesRequested = true;
+
+        auto getAllTables = reinterpret_cast<zel_pfnGetAllProcAddrTables_t>(
+            GET_FUNCTION_PTR( drv.handle, "zeGetAllProcAddrTables") );
+        if( !getAllTables )
+            return;
+
+        const char *tableNames[] = {
+            "zeGetGlobalProcAddrTable",
+            "zeGetDriverProcAddrTable",
+            "zeGetDeviceProcAddrTable",
+            "zeGetDeviceExpProcAddrTable",
+            "zeGetContextProcAddrTable",
+            "zeGetCommandQueueProcAddrTable",
+            "zeGetCommandListProcAddrTable",
+            "zeGetEventProcAddrTable",
+            "zeGetEventExpProcAddrTable",
+            "zeGetEventPoolProcAddrTable",
+            "zeGetFenceProcAddrTable",
+            "zeGetImageProcAddrTable",
+            "zeGetImageExpProcAddrTable",
+            "zeGetKernelProcAddrTable",
+            "zeGetKernelExpProcAddrTable",
+            "zeGetMemProcAddrTable",
+            "zeGetMemExpProcAddrTable",
+            "zeGetModuleProcAddrTable",
+            "zeGetModuleBuildLogProcAddrTable",
+            "zeGetPhysicalMemProcAddrTable",
+            "zeGetSamplerProcAddrTable",
+            "zeGetVirtualMemProcAddrTable",
+            "zeGetFabricEdgeExpProcAddrTable",
+            "zeGetFabricVertexExpProcAddrTable",
+        };
+        void *tables[] = {
+            &drv.dditable.ze.Global,
+            &drv.dditable.ze.Driver,
+            &drv.dditable.ze.Device,
+            &drv.dditable.ze.DeviceExp,
+            &drv.dditable.ze.Context,
+            &drv.dditable.ze.CommandQueue,
+            &drv.dditable.ze.CommandList,
+            &drv.dditable.ze.Event,
+            &drv.dditable.ze.EventExp,
+            &drv.dditable.ze.EventPool,
+            &drv.dditable.ze.Fence,
+            &drv.dditable.ze.Image,
+            &drv.dditable.ze.ImageExp,
+            &drv.dditable.ze.Kernel,
+            &drv.dditable.ze.KernelExp,
+            &drv.dditable.ze.Mem,
+            &drv.dditable.ze.MemExp,
+            &drv.dditable.ze.Module,
+            &drv.dditable.ze.ModuleBuildLog,
+            &drv.dditable.ze.PhysicalMem,
+            &drv.dditable.ze.Sampler,
+            &drv.dditable.ze.VirtualMem,
+            &drv.dditable.ze.FabricEdgeExp,
+            &drv.dditable.ze.FabricVertexExp,
+        };
+        auto count = static_cast<uint32_t>( sizeof( tables ) / sizeof( tables[ 0 ] ) );
+        drv.zeTablesLoaded = ( ZE_RESULT_SUCCESS == getAllTables( loader::context->version, count, tableNames, tables ) );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// fills the tables of a driver loaded by a later zeInit, after the
+    /// exports below may already have run
+    void zeLoadDriverTables( driver_t& drv )
+    {
+        zeLoadAllDriverTables( drv );
+        if( drv.zeTablesLoaded )
+            return;
+
+        auto getGlobalTable = reinterpret_cast<ze_pfnGetGlobalProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zeGetGlobalProcAddrTable") );
+        if( getGlobalTable )
+            getGlobalTable( loader::context->version, &drv.dditable.ze.Global );
+        auto getDriverTable = reinterpret_cast<ze_pfnGetDriverProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zeGetDriverProcAddrTable") );
+        if( getDriverTable )
+            getDriverTable( loader::context->version, &drv.dditable.ze.Driver );
+        auto getDeviceTable = reinterpret_cast<ze_pfnGetDeviceProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zeGetDeviceProcAddrTable") );
+        if( getDeviceTable )
+            getDeviceTable( loader::context->version, &drv.dditable.ze.Device );
+        auto getDeviceExpTable = reinterpret_cast<ze_pfnGetDeviceExpProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zeGetDeviceExpProcAddrTable") );
+        if( getDeviceExpTable )
+            getDeviceExpTable( loader::context->version, &drv.dditable.ze.DeviceExp );
+        auto getContextTable = reinterpret_cast<ze_pfnGetContextProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zeGetContextProcAddrTable") );
+        if( getContextTable )
+            getContextTable( loader::context->version, &drv.dditable.ze.Context );
+        auto getCommandQueueTable = reinterpret_cast<ze_pfnGetCommandQueueProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zeGetCommandQueueProcAddrTable") );
+        if( getCommandQueueTable )
+            getCommandQueueTable( loader::context->version, &drv.dditable.ze.CommandQueue );
+        auto getCommandListTable = reinterpret_cast<ze_pfnGetCommandListProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zeGetCommandListProcAddrTable") );
+        if( getCommandListTable )
+            getCommandListTable( loader::context->version, &drv.dditable.ze.CommandList );
+        auto getEventTable = reinterpret_cast<ze_pfnGetEventProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zeGetEventProcAddrTable") );
+        if( getEventTable )
+            getEventTable( loader::context->version, &drv.dditable.ze.Event );
+        auto getEventExpTable = reinterpret_cast<ze_pfnGetEventExpProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zeGetEventExpProcAddrTable") );
+        if( getEventExpTable )
+            getEventExpTable( loader::context->version, &drv.dditable.ze.EventExp );
+        auto getEventPoolTable = reinterpret_cast<ze_pfnGetEventPoolProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zeGetEventPoolProcAddrTable") );
+        if( getEventPoolTable )
+            getEventPoolTable( loader::context->version, &drv.dditable.ze.EventPool );
+        auto getFenceTable = reinterpret_cast<ze_pfnGetFenceProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zeGetFenceProcAddrTable") );
+        if( getFenceTable )
+            getFenceTable( loader::context->version, &drv.dditable.ze.Fence );
+        auto getImageTable = reinterpret_cast<ze_pfnGetImageProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zeGetImageProcAddrTable") );
+        if( getImageTable )
+            getImageTable( loader::context->version, &drv.dditable.ze.Image );
+        auto getImageExpTable = reinterpret_cast<ze_pfnGetImageExpProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zeGetImageExpProcAddrTable") );
+        if( getImageExpTable )
+            getImageExpTable( loader::context->version, &drv.dditable.ze.ImageExp );
+        auto getKernelTable = reinterpret_cast<ze_pfnGetKernelProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zeGetKernelProcAddrTable") );
+        if( getKernelTable )
+            getKernelTable( loader::context->version, &drv.dditable.ze.Kernel );
+        auto getKernelExpTable = reinterpret_cast<ze_pfnGetKernelExpProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zeGetKernelExpProcAddrTable") );
+        if( getKernelExpTable )
+            getKernelExpTable( loader::context->version, &drv.dditable.ze.KernelExp );
+        auto getMemTable = reinterpret_cast<ze_pfnGetMemProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zeGetMemProcAddrTable") );
+        if( getMemTable )
+            getMemTable( loader::context->version, &drv.dditable.ze.Mem );
+        auto getMemExpTable = reinterpret_cast<ze_pfnGetMemExpProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zeGetMemExpProcAddrTable") );
+        if( getMemExpTable )
+            getMemExpTable( loader::context->version, &drv.dditable.ze.MemExp );
+        auto getModuleTable = reinterpret_cast<ze_pfnGetModuleProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zeGetModuleProcAddrTable") );
+        if( getModuleTable )
+            getModuleTable( loader::context->version, &drv.dditable.ze.Module );
+        auto getModuleBuildLogTable = reinterpret_cast<ze_pfnGetModuleBuildLogProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zeGetModuleBuildLogProcAddrTable") );
+        if( getModuleBuildLogTable )
+            getModuleBuildLogTable( loader::context->version, &drv.dditable.ze.ModuleBuildLog );
+        auto getPhysicalMemTable = reinterpret_cast<ze_pfnGetPhysicalMemProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zeGetPhysicalMemProcAddrTable") );
+        if( getPhysicalMemTable )
+            getPhysicalMemTable( loader::context->version, &drv.dditable.ze.PhysicalMem );
+        auto getSamplerTable = reinterpret_cast<ze_pfnGetSamplerProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zeGetSamplerProcAddrTable") );
+        if( getSamplerTable )
+            getSamplerTable( loader::context->version, &drv.dditable.ze.Sampler );
+        auto getVirtualMemTable = reinterpret_cast<ze_pfnGetVirtualMemProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zeGetVirtualMemProcAddrTable") );
+        if( getVirtualMemTable )
+            getVirtualMemTable( loader::context->version, &drv.dditable.ze.VirtualMem );
+        auto getFabricEdgeExpTable = reinterpret_cast<ze_pfnGetFabricEdgeExpProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zeGetFabricEdgeExpProcAddrTable") );
+        if( getFabricEdgeExpTable )
+            getFabricEdgeExpTable( loader::context->version, &drv.dditable.ze.FabricEdgeExp );
+        auto getFabricVertexExpTable = reinterpret_cast<ze_pfnGetFabricVertexExpProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zeGetFabricVertexExpProcAddrTable") );
+        if( getFabricVertexExpTable )
+            getFabricVertexExpTable( loader::context->version, &drv.dditable.ze.FabricVertexExp );
+        drv.zeTablesLoaded = true;
+    }
+
 } // namespace loader
 
 #if defined(__cplusplus)
@@ -5178,6 +5433,13 @@ zeGetGlobalProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zeLoadAllDriverTables( drv );
+        if(drv.zeTablesLoaded)
+        {
+            // already filled by the driver's zeGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<ze_pfnGetGlobalProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zeGetGlobalProcAddrTable") );
         if(!getTable) 
@@ -5196,7 +5458,7 @@ zeGetGlobalProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnInit                                     = loader::zeInit;
@@ -5218,8 +5480,10 @@ zeGetGlobalProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
-    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    // If the API tracing layer is enabled, then intercept the loader's DDIs,
+    // unless ze_lib is filling its pass-through tables
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ) &&
+        !loader::context_t::passThroughTables )
     {
         auto getTable = reinterpret_cast<ze_pfnGetGlobalProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetGlobalProcAddrTable") );
@@ -5263,6 +5527,13 @@ zeGetDriverProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zeLoadAllDriverTables( drv );
+        if(drv.zeTablesLoaded)
+        {
+            // already filled by the driver's zeGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<ze_pfnGetDriverProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zeGetDriverProcAddrTable") );
         if(!getTable) 
@@ -5281,7 +5552,7 @@ zeGetDriverProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnGet                                      = loader::zeDriverGet;
@@ -5309,8 +5580,10 @@ zeGetDriverProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
-    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    // If the API tracing layer is enabled, then intercept the loader's DDIs,
+    // unless ze_lib is filling its pass-through tables
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ) &&
+        !loader::context_t::passThroughTables )
     {
         auto getTable = reinterpret_cast<ze_pfnGetDriverProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetDriverProcAddrTable") );
@@ -5354,6 +5627,13 @@ zeGetDeviceProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zeLoadAllDriverTables( drv );
+        if(drv.zeTablesLoaded)
+        {
+            // already filled by the driver's zeGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<ze_pfnGetDeviceProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zeGetDeviceProcAddrTable") );
         if(!getTable) 
@@ -5372,7 +5652,7 @@ zeGetDeviceProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnGet                                      = loader::zeDeviceGet;
@@ -5411,8 +5691,10 @@ zeGetDeviceProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
-    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    // If the API tracing layer is enabled, then intercept the loader's DDIs,
+    // unless ze_lib is filling its pass-through tables
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ) &&
+        !loader::context_t::passThroughTables )
     {
         auto getTable = reinterpret_cast<ze_pfnGetDeviceProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetDeviceProcAddrTable") );
@@ -5456,6 +5738,13 @@ zeGetDeviceExpProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zeLoadAllDriverTables( drv );
+        if(drv.zeTablesLoaded)
+        {
+            // already filled by the driver's zeGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<ze_pfnGetDeviceExpProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zeGetDeviceExpProcAddrTable") );
         if(!getTable) 
@@ -5468,7 +5757,7 @@ zeGetDeviceExpProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnGetFabricVertexExp                       = loader::zeDeviceGetFabricVertexExp;
@@ -5490,8 +5779,10 @@ zeGetDeviceExpProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
-    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    // If the API tracing layer is enabled, then intercept the loader's DDIs,
+    // unless ze_lib is filling its pass-through tables
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ) &&
+        !loader::context_t::passThroughTables )
     {
         auto getTable = reinterpret_cast<ze_pfnGetDeviceExpProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetDeviceExpProcAddrTable") );
@@ -5535,6 +5826,13 @@ zeGetContextProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zeLoadAllDriverTables( drv );
+        if(drv.zeTablesLoaded)
+        {
+            // already filled by the driver's zeGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<ze_pfnGetContextProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zeGetContextProcAddrTable") );
         if(!getTable) 
@@ -5553,7 +5851,7 @@ zeGetContextProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnCreate                                   = loader::zeContextCreate;
@@ -5583,8 +5881,10 @@ zeGetContextProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
-    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    // If the API tracing layer is enabled, then intercept the loader's DDIs,
+    // unless ze_lib is filling its pass-through tables
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ) &&
+        !loader::context_t::passThroughTables )
     {
         auto getTable = reinterpret_cast<ze_pfnGetContextProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetContextProcAddrTable") );
@@ -5628,6 +5928,13 @@ zeGetCommandQueueProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zeLoadAllDriverTables( drv );
+        if(drv.zeTablesLoaded)
+        {
+            // already filled by the driver's zeGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<ze_pfnGetCommandQueueProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zeGetCommandQueueProcAddrTable") );
         if(!getTable) 
@@ -5646,7 +5953,7 @@ zeGetCommandQueueProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnCreate                                   = loader::zeCommandQueueCreate;
@@ -5671,8 +5978,10 @@ zeGetCommandQueueProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
-    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    // If the API tracing layer is enabled, then intercept the loader's DDIs,
+    // unless ze_lib is filling its pass-through tables
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ) &&
+        !loader::context_t::passThroughTables )
     {
         auto getTable = reinterpret_cast<ze_pfnGetCommandQueueProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetCommandQueueProcAddrTable") );
@@ -5716,6 +6025,13 @@ zeGetCommandListProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zeLoadAllDriverTables( drv );
+        if(drv.zeTablesLoaded)
+        {
+            // already filled by the driver's zeGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<ze_pfnGetCommandListProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zeGetCommandListProcAddrTable") );
         if(!getTable) 
@@ -5734,7 +6050,7 @@ zeGetCommandListProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnCreate                                   = loader::zeCommandListCreate;
@@ -5784,8 +6100,10 @@ zeGetCommandListProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
-    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    // If the API tracing layer is enabled, then intercept the loader's DDIs,
+    // unless ze_lib is filling its pass-through tables
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ) &&
+        !loader::context_t::passThroughTables )
     {
         auto getTable = reinterpret_cast<ze_pfnGetCommandListProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetCommandListProcAddrTable") );
@@ -5829,6 +6147,13 @@ zeGetEventProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zeLoadAllDriverTables( drv );
+        if(drv.zeTablesLoaded)
+        {
+            // already filled by the driver's zeGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<ze_pfnGetEventProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zeGetEventProcAddrTable") );
         if(!getTable) 
@@ -5847,7 +6172,7 @@ zeGetEventProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnCreate                                   = loader::zeEventCreate;
@@ -5876,8 +6201,10 @@ zeGetEventProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
-    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    // If the API tracing layer is enabled, then intercept the loader's DDIs,
+    // unless ze_lib is filling its pass-through tables
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ) &&
+        !loader::context_t::passThroughTables )
     {
         auto getTable = reinterpret_cast<ze_pfnGetEventProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetEventProcAddrTable") );
@@ -5921,6 +6248,13 @@ zeGetEventExpProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zeLoadAllDriverTables( drv );
+        if(drv.zeTablesLoaded)
+        {
+            // already filled by the driver's zeGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<ze_pfnGetEventExpProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zeGetEventExpProcAddrTable") );
         if(!getTable) 
@@ -5933,7 +6267,7 @@ zeGetEventExpProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnQueryTimestampsExp                       = loader::zeEventQueryTimestampsExp;
@@ -5955,8 +6289,10 @@ zeGetEventExpProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
-    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    // If the API tracing layer is enabled, then intercept the loader's DDIs,
+    // unless ze_lib is filling its pass-through tables
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ) &&
+        !loader::context_t::passThroughTables )
     {
         auto getTable = reinterpret_cast<ze_pfnGetEventExpProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetEventExpProcAddrTable") );
@@ -6000,6 +6336,13 @@ zeGetEventPoolProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zeLoadAllDriverTables( drv );
+        if(drv.zeTablesLoaded)
+        {
+            // already filled by the driver's zeGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<ze_pfnGetEventPoolProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zeGetEventPoolProcAddrTable") );
         if(!getTable) 
@@ -6018,7 +6361,7 @@ zeGetEventPoolProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnCreate                                   = loader::zeEventPoolCreate;
@@ -6045,8 +6388,10 @@ zeGetEventPoolProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
-    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    // If the API tracing layer is enabled, then intercept the loader's DDIs,
+    // unless ze_lib is filling its pass-through tables
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ) &&
+        !loader::context_t::passThroughTables )
     {
         auto getTable = reinterpret_cast<ze_pfnGetEventPoolProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetEventPoolProcAddrTable") );
@@ -6090,6 +6435,13 @@ zeGetFenceProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zeLoadAllDriverTables( drv );
+        if(drv.zeTablesLoaded)
+        {
+            // already filled by the driver's zeGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<ze_pfnGetFenceProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zeGetFenceProcAddrTable") );
         if(!getTable) 
@@ -6108,7 +6460,7 @@ zeGetFenceProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnCreate                                   = loader::zeFenceCreate;
@@ -6134,8 +6486,10 @@ zeGetFenceProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
-    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    // If the API tracing layer is enabled, then intercept the loader's DDIs,
+    // unless ze_lib is filling its pass-through tables
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ) &&
+        !loader::context_t::passThroughTables )
     {
         auto getTable = reinterpret_cast<ze_pfnGetFenceProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetFenceProcAddrTable") );
@@ -6179,6 +6533,13 @@ zeGetImageProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zeLoadAllDriverTables( drv );
+        if(drv.zeTablesLoaded)
+        {
+            // already filled by the driver's zeGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<ze_pfnGetImageProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zeGetImageProcAddrTable") );
         if(!getTable) 
@@ -6197,7 +6558,7 @@ zeGetImageProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnGetProperties                            = loader::zeImageGetProperties;
@@ -6223,8 +6584,10 @@ zeGetImageProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
-    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    // If the API tracing layer is enabled, then intercept the loader's DDIs,
+    // unless ze_lib is filling its pass-through tables
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ) &&
+        !loader::context_t::passThroughTables )
     {
         auto getTable = reinterpret_cast<ze_pfnGetImageProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetImageProcAddrTable") );
@@ -6268,6 +6631,13 @@ zeGetImageExpProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zeLoadAllDriverTables( drv );
+        if(drv.zeTablesLoaded)
+        {
+            // already filled by the driver's zeGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<ze_pfnGetImageExpProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zeGetImageExpProcAddrTable") );
         if(!getTable) 
@@ -6280,7 +6650,7 @@ zeGetImageExpProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnGetMemoryPropertiesExp                   = loader::zeImageGetMemoryPropertiesExp;
@@ -6303,8 +6673,10 @@ zeGetImageExpProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
-    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    // If the API tracing layer is enabled, then intercept the loader's DDIs,
+    // unless ze_lib is filling its pass-through tables
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ) &&
+        !loader::context_t::passThroughTables )
     {
         auto getTable = reinterpret_cast<ze_pfnGetImageExpProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetImageExpProcAddrTable") );
@@ -6348,6 +6720,13 @@ zeGetKernelProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zeLoadAllDriverTables( drv );
+        if(drv.zeTablesLoaded)
+        {
+            // already filled by the driver's zeGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<ze_pfnGetKernelProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zeGetKernelProcAddrTable") );
         if(!getTable) 
@@ -6366,7 +6745,7 @@ zeGetKernelProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnCreate                                   = loader::zeKernelCreate;
@@ -6399,8 +6778,10 @@ zeGetKernelProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
-    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    // If the API tracing layer is enabled, then intercept the loader's DDIs,
+    // unless ze_lib is filling its pass-through tables
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ) &&
+        !loader::context_t::passThroughTables )
     {
         auto getTable = reinterpret_cast<ze_pfnGetKernelProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetKernelProcAddrTable") );
@@ -6444,6 +6825,13 @@ zeGetKernelExpProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zeLoadAllDriverTables( drv );
+        if(drv.zeTablesLoaded)
+        {
+            // already filled by the driver's zeGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<ze_pfnGetKernelExpProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zeGetKernelExpProcAddrTable") );
         if(!getTable) 
@@ -6456,7 +6844,7 @@ zeGetKernelExpProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnSetGlobalOffsetExp                       = loader::zeKernelSetGlobalOffsetExp;
@@ -6479,8 +6867,10 @@ zeGetKernelExpProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
-    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    // If the API tracing layer is enabled, then intercept the loader's DDIs,
+    // unless ze_lib is filling its pass-through tables
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ) &&
+        !loader::context_t::passThroughTables )
     {
         auto getTable = reinterpret_cast<ze_pfnGetKernelExpProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetKernelExpProcAddrTable") );
@@ -6524,6 +6914,13 @@ zeGetMemProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zeLoadAllDriverTables( drv );
+        if(drv.zeTablesLoaded)
+        {
+            // already filled by the driver's zeGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<ze_pfnGetMemProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zeGetMemProcAddrTable") );
         if(!getTable) 
@@ -6542,7 +6939,7 @@ zeGetMemProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnAllocShared                              = loader::zeMemAllocShared;
@@ -6574,8 +6971,10 @@ zeGetMemProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
-    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    // If the API tracing layer is enabled, then intercept the loader's DDIs,
+    // unless ze_lib is filling its pass-through tables
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ) &&
+        !loader::context_t::passThroughTables )
     {
         auto getTable = reinterpret_cast<ze_pfnGetMemProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetMemProcAddrTable") );
@@ -6619,6 +7018,13 @@ zeGetMemExpProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zeLoadAllDriverTables( drv );
+        if(drv.zeTablesLoaded)
+        {
+            // already filled by the driver's zeGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<ze_pfnGetMemExpProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zeGetMemExpProcAddrTable") );
         if(!getTable) 
@@ -6631,7 +7037,7 @@ zeGetMemExpProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnGetIpcHandleFromFileDescriptorExp        = loader::zeMemGetIpcHandleFromFileDescriptorExp;
@@ -6654,8 +7060,10 @@ zeGetMemExpProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
-    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    // If the API tracing layer is enabled, then intercept the loader's DDIs,
+    // unless ze_lib is filling its pass-through tables
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ) &&
+        !loader::context_t::passThroughTables )
     {
         auto getTable = reinterpret_cast<ze_pfnGetMemExpProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetMemExpProcAddrTable") );
@@ -6699,6 +7107,13 @@ zeGetModuleProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zeLoadAllDriverTables( drv );
+        if(drv.zeTablesLoaded)
+        {
+            // already filled by the driver's zeGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<ze_pfnGetModuleProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zeGetModuleProcAddrTable") );
         if(!getTable) 
@@ -6717,7 +7132,7 @@ zeGetModuleProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnCreate                                   = loader::zeModuleCreate;
@@ -6747,8 +7162,10 @@ zeGetModuleProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
-    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    // If the API tracing layer is enabled, then intercept the loader's DDIs,
+    // unless ze_lib is filling its pass-through tables
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ) &&
+        !loader::context_t::passThroughTables )
     {
         auto getTable = reinterpret_cast<ze_pfnGetModuleProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetModuleProcAddrTable") );
@@ -6792,6 +7209,13 @@ zeGetModuleBuildLogProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zeLoadAllDriverTables( drv );
+        if(drv.zeTablesLoaded)
+        {
+            // already filled by the driver's zeGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<ze_pfnGetModuleBuildLogProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zeGetModuleBuildLogProcAddrTable") );
         if(!getTable) 
@@ -6810,7 +7234,7 @@ zeGetModuleBuildLogProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnDestroy                                  = loader::zeModuleBuildLogDestroy;
@@ -6833,8 +7257,10 @@ zeGetModuleBuildLogProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
-    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    // If the API tracing layer is enabled, then intercept the loader's DDIs,
+    // unless ze_lib is filling its pass-through tables
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ) &&
+        !loader::context_t::passThroughTables )
     {
         auto getTable = reinterpret_cast<ze_pfnGetModuleBuildLogProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetModuleBuildLogProcAddrTable") );
@@ -6878,6 +7304,13 @@ zeGetPhysicalMemProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zeLoadAllDriverTables( drv );
+        if(drv.zeTablesLoaded)
+        {
+            // already filled by the driver's zeGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<ze_pfnGetPhysicalMemProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zeGetPhysicalMemProcAddrTable") );
         if(!getTable) 
@@ -6896,7 +7329,7 @@ zeGetPhysicalMemProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnCreate                                   = loader::zePhysicalMemCreate;
@@ -6919,8 +7352,10 @@ zeGetPhysicalMemProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
-    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    // If the API tracing layer is enabled, then intercept the loader's DDIs,
+    // unless ze_lib is filling its pass-through tables
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ) &&
+        !loader::context_t::passThroughTables )
     {
         auto getTable = reinterpret_cast<ze_pfnGetPhysicalMemProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetPhysicalMemProcAddrTable") );
@@ -6964,6 +7399,13 @@ zeGetSamplerProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zeLoadAllDriverTables( drv );
+        if(drv.zeTablesLoaded)
+        {
+            // already filled by the driver's zeGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<ze_pfnGetSamplerProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zeGetSamplerProcAddrTable") );
         if(!getTable) 
@@ -6982,7 +7424,7 @@ zeGetSamplerProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnCreate                                   = loader::zeSamplerCreate;
@@ -7005,8 +7447,10 @@ zeGetSamplerProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
-    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    // If the API tracing layer is enabled, then intercept the loader's DDIs,
+    // unless ze_lib is filling its pass-through tables
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ) &&
+        !loader::context_t::passThroughTables )
     {
         auto getTable = reinterpret_cast<ze_pfnGetSamplerProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetSamplerProcAddrTable") );
@@ -7050,6 +7494,13 @@ zeGetVirtualMemProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zeLoadAllDriverTables( drv );
+        if(drv.zeTablesLoaded)
+        {
+            // already filled by the driver's zeGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<ze_pfnGetVirtualMemProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zeGetVirtualMemProcAddrTable") );
         if(!getTable) 
@@ -7068,7 +7519,7 @@ zeGetVirtualMemProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnReserve                                  = loader::zeVirtualMemReserve;
@@ -7096,8 +7547,10 @@ zeGetVirtualMemProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
-    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    // If the API tracing layer is enabled, then intercept the loader's DDIs,
+    // unless ze_lib is filling its pass-through tables
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ) &&
+        !loader::context_t::passThroughTables )
     {
         auto getTable = reinterpret_cast<ze_pfnGetVirtualMemProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetVirtualMemProcAddrTable") );
@@ -7141,6 +7594,13 @@ zeGetFabricEdgeExpProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zeLoadAllDriverTables( drv );
+        if(drv.zeTablesLoaded)
+        {
+            // already filled by the driver's zeGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<ze_pfnGetFabricEdgeExpProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zeGetFabricEdgeExpProcAddrTable") );
         if(!getTable) 
@@ -7153,7 +7613,7 @@ zeGetFabricEdgeExpProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnGetExp                                   = loader::zeFabricEdgeGetExp;
@@ -7177,8 +7637,10 @@ zeGetFabricEdgeExpProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
-    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    // If the API tracing layer is enabled, then intercept the loader's DDIs,
+    // unless ze_lib is filling its pass-through tables
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ) &&
+        !loader::context_t::passThroughTables )
     {
         auto getTable = reinterpret_cast<ze_pfnGetFabricEdgeExpProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetFabricEdgeExpProcAddrTable") );
@@ -7222,6 +7684,13 @@ zeGetFabricVertexExpProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zeLoadAllDriverTables( drv );
+        if(drv.zeTablesLoaded)
+        {
+            // already filled by the driver's zeGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<ze_pfnGetFabricVertexExpProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zeGetFabricVertexExpProcAddrTable") );
         if(!getTable) 
@@ -7234,7 +7703,7 @@ zeGetFabricVertexExpProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnGetExp                                   = loader::zeFabricVertexGetExp;
@@ -7259,8 +7728,10 @@ zeGetFabricVertexExpProcAddrTable(
         result = getTable( version, pDdiTable );
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
-    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
+    // If the API tracing layer is enabled, then intercept the loader's DDIs,
+    // unless ze_lib is filling its pass-through tables
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ) &&
+        !loader::context_t::passThroughTables )
     {
         auto getTable = reinterpret_cast<ze_pfnGetFabricVertexExpProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->tracingLayer, "zeGetFabricVertexExpProcAddrTable") );
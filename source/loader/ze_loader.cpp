@@ -1,6 +1,6 @@
 /*
  *
- * Copyright (C) 2019-2021 Intel Corporation
+ * Copyright (C) 2019-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,27 +8,42 @@
 #include "ze_loader_internal.h"
 
 #include "driver_discovery.h"
+#include <algorithm>
 #include <iostream>
+#include <thread>
 
 namespace loader
 {
     ///////////////////////////////////////////////////////////////////////////////
     context_t *context;
+    thread_local bool context_t::passThroughTables = false;
 
+    /// loads the drivers newly admitted by flags and initializes them; drivers
+    /// admitted by an earlier call are in use and are left as they are
     ze_result_t context_t::check_drivers(ze_init_flags_t flags) {
+        std::lock_guard<std::mutex> lock(driversMutex);
+
+        auto first = drivers.size();
+        load_new_drivers(flags);
+        if(first == drivers.size())
+            return drivers.empty() ? ZE_RESULT_ERROR_UNINITIALIZED : ZE_RESULT_SUCCESS;
+
         bool return_first_driver_result=false;
-        if(drivers.size()==1) {
+        if(first == 0 && drivers.size()==1) {
             return_first_driver_result=true;
         }
 
-        for(auto it = drivers.begin(); it != drivers.end(); )
+        std::vector<ze_result_t> results(drivers.size() - first, ZE_RESULT_SUCCESS);
+        init_drivers(flags, first, results);
+
+        auto result = results.begin();
+        for(auto it = drivers.begin() + first; it != drivers.end(); ++result)
         {
-            ze_result_t result = init_driver(*it, flags);
-            if(result != ZE_RESULT_SUCCESS) {
+            if(*result != ZE_RESULT_SUCCESS) {
                 FREE_DRIVER_LIBRARY(it->handle);
                 it = drivers.erase(it);
                 if(return_first_driver_result)
-                    return result;
+                    return *result;
             }
             else {
                 it++;
@@ -38,21 +53,129 @@ namespace loader
         if(drivers.size() == 0)
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // drivers that initialize but expose no devices only cost handle
+        // wrapping on every call; stop routing to them while one with devices
+        // remains, but keep them loaded, since unloading an initialized
+        // driver would leave its threads and exit handlers behind
+        if(drivers.size() > 1) {
+            std::vector<bool> hasDevices;
+            hasDevices.reserve(drivers.size() - first);
+            for(auto it = drivers.begin() + first; it != drivers.end(); ++it)
+                hasDevices.push_back(driver_has_devices(*it));
+
+            if(first > 0 || std::find(hasDevices.begin(), hasDevices.end(), true) != hasDevices.end()) {
+                auto keep = hasDevices.begin();
+                for(auto it = drivers.begin() + first; it != drivers.end(); ++keep)
+                {
+                    if(!*keep) {
+                        idleDrivers.push_back(*it);
+                        it = drivers.erase(it);
+                    }
+                    else {
+                        it++;
+                    }
+                }
+            }
+        }
+
+        // with a single usable driver left, the DDI tables handed out
+        // afterwards point directly at that driver
+        update_intercept();
+
         return ZE_RESULT_SUCCESS;
     }
 
-    ze_result_t context_t::init_driver(driver_t driver, ze_init_flags_t flags) {
+    ///////////////////////////////////////////////////////////////////////////////
+    /// returns false only when the driver positively reports no devices
+    bool context_t::driver_has_devices(const driver_t &driver) {
+        ze_driver_dditable_t driverTable = {};
+        ze_device_dditable_t deviceTable = {};
+        if(driver.zeTablesLoaded) {
+            driverTable = driver.dditable.ze.Driver;
+            deviceTable = driver.dditable.ze.Device;
+        }
+        else {
+            auto getDriverTable = reinterpret_cast<ze_pfnGetDriverProcAddrTable_t>(
+                GET_FUNCTION_PTR(driver.handle, "zeGetDriverProcAddrTable"));
+            auto getDeviceTable = reinterpret_cast<ze_pfnGetDeviceProcAddrTable_t>(
+                GET_FUNCTION_PTR(driver.handle, "zeGetDeviceProcAddrTable"));
+            if(!getDriverTable || !getDeviceTable ||
+               getDriverTable(version, &driverTable) != ZE_RESULT_SUCCESS ||
+               getDeviceTable(version, &deviceTable) != ZE_RESULT_SUCCESS)
+                return true;
+        }
+
+        if(nullptr == driverTable.pfnGet || nullptr == deviceTable.pfnGet)
+            return true;
 
-        auto getTable = reinterpret_cast<ze_pfnGetGlobalProcAddrTable_t>(
-            GET_FUNCTION_PTR(driver.handle, "zeGetGlobalProcAddrTable"));
-        if(!getTable) {
-            return ZE_RESULT_ERROR_UNINITIALIZED;
+        uint32_t driverCount = 0;
+        if(driverTable.pfnGet(&driverCount, nullptr) != ZE_RESULT_SUCCESS)
+            return true;
+
+        std::vector<ze_driver_handle_t> driverHandles(driverCount);
+        if(driverCount > 0 && driverTable.pfnGet(&driverCount, driverHandles.data()) != ZE_RESULT_SUCCESS)
+            return true;
+
+        for(uint32_t i = 0; i < driverCount; ++i) {
+            uint32_t deviceCount = 0;
+            if(deviceTable.pfnGet(driverHandles[i], &deviceCount, nullptr) != ZE_RESULT_SUCCESS || deviceCount > 0)
+                return true;
         }
-        
+
+        return false;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// initializes the drivers from first on, one worker thread per driver, so
+    /// that startup takes as long as the slowest driver; results[i] belongs to
+    /// drivers[first + i]
+    void context_t::init_drivers(ze_init_flags_t flags, size_t first, std::vector<ze_result_t> &results) {
+        // the layers keep a single table for the level below them, so while
+        // they are loaded only one driver at a time may be wired through them
+        size_t count = drivers.size() - first;
+        size_t started = 1;
+        std::vector<std::thread> workers;
+        if(nullptr == validationLayer && nullptr == tracingLayer) {
+            try {
+                workers.reserve(count);
+                for(; started < count; ++started) {
+                    auto i = started;
+                    workers.emplace_back([this, flags, first, i, &results]() {
+                        results[i] = init_driver(drivers[first + i], flags);
+                    });
+                }
+            }
+            catch(std::exception&) {
+                // drivers without a worker are initialized below
+            }
+        }
+
+        if(count > 0)
+            results[0] = init_driver(drivers[first], flags);
+        for(size_t i = started; i < count; ++i)
+            results[i] = init_driver(drivers[first + i], flags);
+
+        for(auto &worker : workers)
+            worker.join();
+    }
+
+    ze_result_t context_t::init_driver(const driver_t &driver, ze_init_flags_t flags) {
+
         ze_global_dditable_t global;
-        auto getTableResult = getTable(ZE_API_VERSION_CURRENT, &global);
-        if(getTableResult != ZE_RESULT_SUCCESS) {
-            return ZE_RESULT_ERROR_UNINITIALIZED;
+        if(driver.zeTablesLoaded) {
+            global = driver.dditable.ze.Global;
+        }
+        else {
+            auto getTable = reinterpret_cast<ze_pfnGetGlobalProcAddrTable_t>(
+                GET_FUNCTION_PTR(driver.handle, "zeGetGlobalProcAddrTable"));
+            if(!getTable) {
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            }
+
+            auto getTableResult = getTable(ZE_API_VERSION_CURRENT, &global);
+            if(getTableResult != ZE_RESULT_SUCCESS) {
+                return ZE_RESULT_ERROR_UNINITIALIZED;
+            }
         }
         
         if(nullptr == global.pfnInit) {
@@ -90,32 +213,102 @@ namespace loader
     }
 
     ///////////////////////////////////////////////////////////////////////////////
-    ze_result_t context_t::init()
+    /// loads the discovered driver libraries admitted by flags that are not
+    /// loaded yet, for callers that do not go through check_drivers
+    ze_result_t context_t::load_drivers(ze_init_flags_t flags)
     {
-        auto discoveredDrivers = discoverEnabledDrivers();
+        std::lock_guard<std::mutex> lock(driversMutex);
 
-        drivers.reserve( discoveredDrivers.size() + getenv_tobool( "ZE_ENABLE_NULL_DRIVER" ) );
-        if( getenv_tobool( "ZE_ENABLE_NULL_DRIVER" ) )
+        load_new_drivers(flags);
+        update_intercept();
+
+        if(drivers.size()==0)
+            return ZE_RESULT_ERROR_UNINITIALIZED;
+
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// loads each discovered driver library once, on the first call whose flags
+    /// admit it; known drivers that serve only device types excluded by flags
+    /// are not opened until a later call admits them, others are loaded and
+    /// left to reject the flags in zeInit. Called with driversMutex held.
+    void context_t::load_new_drivers(ze_init_flags_t flags)
+    {
+        // drivers never move once added, since handles point at their tables
+        drivers.reserve( discoveredDrivers.size() );
+        discoveredDriversConsidered.resize( discoveredDrivers.size(), false );
+
+        bool loaded = false;
+        for( size_t i = 0; i < discoveredDrivers.size(); ++i )
         {
-            auto handle = LOAD_DRIVER_LIBRARY( MAKE_LIBRARY_NAME( "ze_null", L0_LOADER_VERSION ) );
-            if( NULL != handle )
+            if( discoveredDriversConsidered[ i ] )
+                continue;
+
+            auto& name = discoveredDrivers[ i ];
+            auto typeFlags = getKnownDriverTypeFlags( name );
+            if( ( 0 != flags ) && ( 0 != typeFlags ) && ( 0 == ( flags & typeFlags ) ) )
+                continue;
+
+            discoveredDriversConsidered[ i ] = true;
+            loaded = true;
+
+            if( driverCache.isKnownMissing( name ) )
+                continue;
+
+            auto handle = LOAD_DRIVER_LIBRARY( name.c_str() );
+            if( NULL == handle )
             {
-                drivers.emplace_back();
-                drivers.rbegin()->handle = handle;
+                driverCache.recordMissing( name );
+                continue;
             }
-        }
 
-        for( auto name : discoveredDrivers )
-        {
-            auto handle = LOAD_DRIVER_LIBRARY( name.c_str() );
-            if( NULL != handle )
+            drivers.emplace_back();
+            auto& drv = *drivers.rbegin();
+            drv.handle = handle;
+            drv.name = name;
+
+            auto getDispatchableHandleSupport = reinterpret_cast<zel_pfnDriverGetDispatchableHandleSupport_t>(
+                GET_FUNCTION_PTR( drv.handle, "zelDriverGetDispatchableHandleSupport" ) );
+            ze_bool_t supported = false;
+            if( getDispatchableHandleSupport && ZE_RESULT_SUCCESS == getDispatchableHandleSupport( version, &supported ) )
+                drv.dditable.dispatchable = ( 0 != supported );
+
+            // the tables of the drivers loaded first are filled by the
+            // exports; those added later may find them already run
+            if( driversLoaded )
             {
-                drivers.emplace_back();
-                drivers.rbegin()->handle = handle;
+                zeLoadDriverTables( drv );
+                zetLoadDriverTables( drv );
+                zesLoadDriverTables( drv );
             }
         }
+        driversLoaded = true;
 
-        if(drivers.size()==0)
+        if( loaded )
+            driverCache.save();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// the loader keeps intercepting while a discovered library waits for a
+    /// later zeInit to admit it, since the tables handed out before then could
+    /// not reach the drivers it adds. Called with driversMutex held.
+    void context_t::update_intercept()
+    {
+        intercept_enabled = forceIntercept || drivers.size() > 1 ||
+            std::find( discoveredDriversConsidered.begin(), discoveredDriversConsidered.end(), false ) !=
+                discoveredDriversConsidered.end();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    ze_result_t context_t::init()
+    {
+        // drivers are only loaded once the zeInit flags are known
+        discoveredDrivers = discoverEnabledDrivers();
+        if( getenv_tobool( "ZE_ENABLE_NULL_DRIVER" ) )
+            discoveredDrivers.insert( discoveredDrivers.begin(), MAKE_LIBRARY_NAME( "ze_null", L0_LOADER_VERSION ) );
+
+        if(discoveredDrivers.size()==0)
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         add_loader_version();
@@ -140,7 +333,10 @@ namespace loader
             }
         }
 
-        if( getenv_tobool( "ZE_ENABLE_TRACING_LAYER" ) )
+        // the trace recorder and the profiler live in the tracing layer
+        if( getenv_tobool( "ZE_ENABLE_TRACING_LAYER" ) ||
+            getenv_tobool( "ZE_ENABLE_TRACING_RECORDER" ) ||
+            getenv_tobool( "ZE_ENABLE_TRACING_PROFILER" ) )
         {
             std::string tracingLayerLibraryPath = create_library_path(MAKE_LAYER_NAME( "ze_tracing_layer" ), loaderLibraryPath.c_str());
             tracingLayer = LOAD_DRIVER_LIBRARY( tracingLayerLibraryPath.c_str() );
@@ -162,9 +358,6 @@ namespace loader
 
         forceIntercept = getenv_tobool( "ZE_ENABLE_LOADER_INTERCEPT" );
 
-        if(forceIntercept || drivers.size() > 1)
-             intercept_enabled = true;
-
         return ZE_RESULT_SUCCESS;
     };
 
@@ -178,6 +371,10 @@ namespace loader
         {
             FREE_DRIVER_LIBRARY( drv.handle );
         }
+        for( auto& drv : idleDrivers )
+        {
+            FREE_DRIVER_LIBRARY( drv.handle );
+        }
     };
 
     void context_t::add_loader_version(){
@@ -1,6 +1,6 @@
 /*
  *
- * Copyright (C) 2020-2021 Intel Corporation
+ * Copyright (C) 2020-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,9 +23,28 @@ extern "C" {
 ZE_DLLEXPORT ze_result_t ZE_APICALL
 zeLoaderInit()
 {
+#ifdef L0_STATIC_LOADER_BUILD
+    // a static archive runs no library constructor; the context is created
+    // by the first zeInit and destroyed at exit
+    static loader::context_t staticContext;
+    loader::context = &staticContext;
+#endif
     return loader::context->init();
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for loading the L0 Drivers matching the flags,
+///        for callers that do not go through zelLoaderDriverCheck
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_UNINITIALIZED
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zelLoaderDriverLoad(ze_init_flags_t flags)
+{
+    return loader::context->load_drivers(flags);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Exported function for verifying usable L0 Drivers for Loader to report
 ///
@@ -49,11 +68,23 @@ zeLoaderGetTracingHandle()
     return loader::context->tracingLayer;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for having the zeGet*ProcAddrTable exports called
+///        on this thread leave out the tracing layer
+ZE_DLLEXPORT void ZE_APICALL
+zeLoaderSetPassThroughTables(ze_bool_t passThrough)
+{
+    loader::context_t::passThroughTables = passThrough;
+}
+
 ZE_DLLEXPORT ze_result_t ZE_APICALL
 zelLoaderGetVersionsInternal(
    size_t *num_elems,                     //Pointer to num versions to get.  
    zel_component_version_t *versions)    //Pointer to array of versions. If set to NULL, num_elems is returned
 {
+    if(nullptr == loader::context)
+        return ZE_RESULT_ERROR_UNINITIALIZED;
+
     if(nullptr == versions){
         *num_elems = loader::context->compVersions.size();
         return ZE_RESULT_SUCCESS;
@@ -71,6 +102,8 @@ zelLoaderTranslateHandleInternal(
    void *handleIn,                       
    void **handleOut)
 {
+    if(nullptr == loader::context)
+        return ZE_RESULT_ERROR_UNINITIALIZED;
 
     if(!loader::context->intercept_enabled) {
         *handleOut = handleIn;
@@ -79,46 +112,46 @@ zelLoaderTranslateHandleInternal(
 
     switch(handleType){
         case ZEL_HANDLE_DRIVER: 
-            *handleOut = reinterpret_cast<loader::ze_driver_object_t*>( handleIn )->handle;
+            *handleOut = loader::ze_driver_object_t::unwrap( handleIn );
             break;
         case ZEL_HANDLE_DEVICE: 
-            *handleOut = reinterpret_cast<loader::ze_device_object_t*>( handleIn )->handle;
+            *handleOut = loader::ze_device_object_t::unwrap( handleIn );
             break;
         case ZEL_HANDLE_CONTEXT: 
-            *handleOut = reinterpret_cast<loader::ze_context_object_t*>( handleIn )->handle;
+            *handleOut = loader::ze_context_object_t::unwrap( handleIn );
             break;            
         case ZEL_HANDLE_COMMAND_QUEUE: 
-            *handleOut = reinterpret_cast<loader::ze_command_queue_object_t*>( handleIn )->handle;
+            *handleOut = loader::ze_command_queue_object_t::unwrap( handleIn );
             break;
         case ZEL_HANDLE_COMMAND_LIST: 
-            *handleOut = reinterpret_cast<loader::ze_command_list_object_t*>( handleIn )->handle;
+            *handleOut = loader::ze_command_list_object_t::unwrap( handleIn );
             break;
         case ZEL_HANDLE_FENCE: 
-            *handleOut = reinterpret_cast<loader::ze_fence_object_t*>( handleIn )->handle;
+            *handleOut = loader::ze_fence_object_t::unwrap( handleIn );
             break;
         case ZEL_HANDLE_EVENT_POOL: 
-            *handleOut = reinterpret_cast<loader::ze_event_pool_object_t*>( handleIn )->handle;
+            *handleOut = loader::ze_event_pool_object_t::unwrap( handleIn );
             break;
         case ZEL_HANDLE_EVENT: 
-            *handleOut = reinterpret_cast<loader::ze_event_object_t*>( handleIn )->handle;
+            *handleOut = loader::ze_event_object_t::unwrap( handleIn );
             break;
         case ZEL_HANDLE_IMAGE: 
-            *handleOut = reinterpret_cast<loader::ze_image_object_t*>( handleIn )->handle;
+            *handleOut = loader::ze_image_object_t::unwrap( handleIn );
             break;
         case ZEL_HANDLE_MODULE: 
-            *handleOut = reinterpret_cast<loader::ze_module_object_t*>( handleIn )->handle;
+            *handleOut = loader::ze_module_object_t::unwrap( handleIn );
             break;
         case ZEL_HANDLE_MODULE_BUILD_LOG: 
-            *handleOut = reinterpret_cast<loader::ze_module_build_log_object_t*>( handleIn )->handle;
+            *handleOut = loader::ze_module_build_log_object_t::unwrap( handleIn );
             break;
         case ZEL_HANDLE_KERNEL: 
-            *handleOut = reinterpret_cast<loader::ze_kernel_object_t*>( handleIn )->handle;
+            *handleOut = loader::ze_kernel_object_t::unwrap( handleIn );
             break;
         case ZEL_HANDLE_SAMPLER: 
-            *handleOut = reinterpret_cast<loader::ze_sampler_object_t*>( handleIn )->handle;
+            *handleOut = loader::ze_sampler_object_t::unwrap( handleIn );
             break;
         case ZEL_HANDLE_PHYSICAL_MEM: 
-            *handleOut = reinterpret_cast<loader::ze_physical_mem_object_t*>( handleIn )->handle;
+            *handleOut = loader::ze_physical_mem_object_t::unwrap( handleIn );
             break;
         default:
             return ZE_RESULT_ERROR_INVALID_ENUMERATION;
@@ -1,6 +1,6 @@
 /*
  *
- * Copyright (C) 2020-2021 Intel Corporation
+ * Copyright (C) 2020-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,16 @@ extern "C" {
 ZE_DLLEXPORT ze_result_t ZE_APICALL
 zeLoaderInit();
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for loading the L0 Drivers matching the flags,
+///        for callers that do not go through zelLoaderDriverCheck
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_UNINITIALIZED
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zelLoaderDriverLoad(ze_init_flags_t flags);
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Exported function for verifying usable L0 Drivers for Loader to report
 ///
@@ -45,6 +55,14 @@ ZE_DLLEXPORT HMODULE ZE_APICALL
 zeLoaderGetTracingHandle();
 
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for having the zeGet*ProcAddrTable exports called
+///        on this thread leave out the tracing layer, for ze_lib, which
+///        intercepts a copy of the tables with the tracing layer itself
+ZE_DLLEXPORT void ZE_APICALL
+zeLoaderSetPassThroughTables(ze_bool_t passThrough);
+
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Exported function for getting version
 ///
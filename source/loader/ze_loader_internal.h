@@ -1,6 +1,6 @@
 /*
  *
- * Copyright (C) 2019-2022 Intel Corporation
+ * Copyright (C) 2019-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,8 @@
 #pragma once
 #include <vector>
 #include <map>
+#include <unordered_map>
+#include <mutex>
 
 #include "ze_ddi.h"
 #include "zet_ddi.h"
@@ -15,6 +17,8 @@
 
 #include "ze_util.h"
 #include "ze_object.h"
+#include "ze_handle_array.h"
+#include "driver_discovery.h"
 
 #include "ze_ldrddi.h"
 #include "zet_ldrddi.h"
@@ -28,8 +32,17 @@ namespace loader
     struct driver_t
     {
         HMODULE handle = NULL;
+        DriverLibraryPath name;
         ze_result_t initStatus = ZE_RESULT_SUCCESS;
         dditable_t dditable = {};
+
+        bool zeTablesLoaded = false;    ///< dditable.ze filled up front, so the exports skip it
+        bool zetTablesLoaded = false;   ///< dditable.zet filled up front, so the exports skip it
+        bool zesTablesLoaded = false;   ///< dditable.zes filled up front, so the exports skip it
+
+        bool zeAllTablesRequested = false;  ///< zeGetAllProcAddrTables tried
+        bool zetAllTablesRequested = false; ///< zetGetAllProcAddrTables tried
+        bool zesAllTablesRequested = false; ///< zesGetAllProcAddrTables tried
     };
 
     using driver_vector_t = std::vector< driver_t >;
@@ -40,18 +53,30 @@ namespace loader
     public:
         ze_api_version_t version = ZE_API_VERSION_CURRENT;
 
+        std::vector<DriverLibraryPath> discoveredDrivers;
+        std::vector<bool> discoveredDriversConsidered;  ///< per discovered library, admitted by the flags of an earlier call
+        bool driversLoaded = false;     ///< set once the first call loaded the libraries its flags admit
+        std::mutex driversMutex;
         driver_vector_t drivers;
+        driver_vector_t idleDrivers;   ///< initialized drivers without devices, loaded but not routed to
 
         HMODULE validationLayer = nullptr;
         HMODULE tracingLayer = nullptr;
+        static thread_local bool passThroughTables;    ///< zeGet*ProcAddrTable leave out the tracing layer on this thread
 
         bool forceIntercept = false;
+        DriverDiscoveryCache driverCache;
         std::vector<zel_component_version_t> compVersions;
         const char *LOADER_COMP_NAME = "loader";
 
         ze_result_t check_drivers(ze_init_flags_t flags);
         ze_result_t init();
-        ze_result_t init_driver(driver_t driver, ze_init_flags_t flags);
+        ze_result_t load_drivers(ze_init_flags_t flags);
+        void load_new_drivers(ze_init_flags_t flags);
+        void update_intercept();
+        void init_drivers(ze_init_flags_t flags, size_t first, std::vector<ze_result_t> &results);
+        ze_result_t init_driver(const driver_t &driver, ze_init_flags_t flags);
+        bool driver_has_devices(const driver_t &driver);
         void add_loader_version();
         ~context_t();
         bool intercept_enabled = false;
@@ -1,6 +1,6 @@
 /*
  *
- * Copyright (C) 2019-2021 Intel Corporation
+ * Copyright (C) 2019-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,10 @@
  *
  */
 #pragma once
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
 #include "ze_singleton.h"
 
 //////////////////////////////////////////////////////////////////////////
@@ -16,24 +20,256 @@ struct dditable_t
     ze_dditable_t   ze;
     zet_dditable_t  zet;
     zes_dditable_t  zes;
+
+    bool            dispatchable;   ///< driver reserves the first word of its handles for the loader
+};
+
+struct object_owner_link_t;
+
+//////////////////////////////////////////////////////////////////////////
+/// ownership of a loader handle by the handle it was created from
+///
+/// destroying an owner releases the loader handles of everything created
+/// under it, so that children the application never destroyed explicitly
+/// (events of a pool, kernels of a module, ...) do not stay behind. Only the
+/// loader handles of types created under an owner carry a link.
+struct __zedlllocal object_link_t
+{
+    object_owner_link_t*    parent = nullptr;
+    object_link_t*  prevSibling = nullptr;
+    object_link_t*  nextSibling = nullptr;
+    void            ( *release )( object_link_t* ) = nullptr;  ///< releases the owning loader handle
+    void*           factory = nullptr;                          ///< factory that made the owning loader handle
+    bool            claimed = false;    ///< taken over by the release of the parent, under its lock
+
+    //////////////////////////////////////////////////////////////////////////
+    /// the children of an owner are guarded by a lock striped on the owner
+    static std::mutex& lock( const object_owner_link_t* _owner )
+    {
+        static std::mutex locks[ 64 ];
+        return locks[ ( reinterpret_cast<uintptr_t>( _owner ) >> 6 ) & 63 ];
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// returns false if the release of the parent already took the handle
+    /// over, in which case that release also releases the loader handle
+    bool detach();
 };
 
 //////////////////////////////////////////////////////////////////////////
+/// link of the loader handles of types that own the handles created from
+/// them; only these keep a list of children. The link of the owner itself
+/// comes first, so that the owner can in turn be the child of another.
+struct __zedlllocal object_owner_link_t
+{
+    object_link_t   self;
+    object_link_t*  firstChild = nullptr;
+
+    //////////////////////////////////////////////////////////////////////////
+    void adopt( object_link_t* _child, void ( *_release )( object_link_t* ), void* _factory )
+    {
+        std::lock_guard<std::mutex> lk( object_link_t::lock( this ) );
+        if( nullptr != _child->parent )
+            return; // driver returned a handle that is already tracked
+
+        _child->parent = this;
+        _child->release = _release;
+        _child->factory = _factory;
+        _child->nextSibling = firstChild;
+        if( nullptr != firstChild )
+            firstChild->prevSibling = _child;
+        firstChild = _child;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// releases the loader handles of all children, depth first; children
+    /// are claimed under the lock, so a concurrent destroy of one of them
+    /// leaves it to this release
+    void releaseChildren()
+    {
+        object_link_t* child = nullptr;
+        {
+            std::lock_guard<std::mutex> lk( object_link_t::lock( this ) );
+            child = firstChild;
+            firstChild = nullptr;
+            for( auto claimed = child; nullptr != claimed; claimed = claimed->nextSibling )
+                claimed->claimed = true;
+        }
+
+        while( nullptr != child )
+        {
+            auto next = child->nextSibling;
+            child->release( child );
+            child = next;
+        }
+    }
+};
+
+//////////////////////////////////////////////////////////////////////////
+inline bool object_link_t::detach()
+{
+    auto owner = parent;
+    if( nullptr == owner )
+        return true;
+
+    std::lock_guard<std::mutex> lk( lock( owner ) );
+    if( claimed )
+        return false;
+
+    if( nullptr != prevSibling )
+        prevSibling->nextSibling = nextSibling;
+    else
+        owner->firstChild = nextSibling;
+    if( nullptr != nextSibling )
+        nextSibling->prevSibling = prevSibling;
+    parent = nullptr;
+    prevSibling = nextSibling = nullptr;
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// members of a loader handle; _link_t is void for types that are neither
+/// created under an owner nor own other handles
+template<typename _handle_t, typename _link_t>
+struct __zedlllocal object_fields_t
+{
+    dditable_t*     dditable;
+    _handle_t       handle;
+    _link_t         link;
+
+    _link_t* getLink() { return &link; }
+};
+
 template<typename _handle_t>
-class __zedlllocal object_t
+struct __zedlllocal object_fields_t<_handle_t, void>
+{
+    dditable_t*     dditable;
+    _handle_t       handle;
+
+    void* getLink() { return nullptr; }
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// loader handle wrapping a driver handle
+///
+/// the dispatch table is kept in the first word so that it is found at the
+/// same place as in the handles of drivers using dispatchable handles; those
+/// handles are given to the application as-is and never wrapped
+template<typename _handle_t, typename _link_t = void>
+class __zedlllocal object_t : public object_fields_t<_handle_t, _link_t>
 {
 public:
     using handle_t = _handle_t;
-
-    handle_t    handle;
-    dditable_t* dditable;
+    using fields_t = object_fields_t<_handle_t, _link_t>;
+    using factory_t = singleton_factory_t<object_t, handle_t>;
 
     object_t() = delete;
 
     object_t( handle_t _handle, dditable_t* _dditable )
-        : handle( _handle ), dditable( _dditable )
+        : fields_t{ _dditable, _handle }
     {
     }
 
     ~object_t() = default;
+
+    //////////////////////////////////////////////////////////////////////////
+    /// converts a handle given to the application into the driver's handle,
+    /// where _dditable is the dispatch table of the driver owning the handle
+    static handle_t unwrap( void* _handle, const dditable_t* _dditable )
+    {
+        return _dditable->dispatchable
+            ? reinterpret_cast<handle_t>( _handle )
+            : reinterpret_cast<object_t*>( _handle )->handle;
+    }
+
+    static handle_t unwrap( void* _handle )
+    {
+        return unwrap( _handle, reinterpret_cast<object_t*>( _handle )->dditable );
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// returns the link of a loader handle owning the handles created from
+    /// it, or nullptr for handles of drivers using dispatchable handles
+    static object_owner_link_t* owner( void* _handle, const dditable_t* _dditable )
+    {
+        if( _dditable->dispatchable || ( nullptr == _handle ) )
+            return nullptr;
+        return reinterpret_cast<object_t*>( _handle )->getLink();
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// converts a driver handle into the handle given to the application;
+    /// _owner is the link of the loader handle the object was created from,
+    /// if any, and _release releases the object along with its owner, which
+    /// defaults to releaseLink
+    static handle_t wrap( factory_t& factory, handle_t _handle, dditable_t* _dditable, object_owner_link_t* _owner = nullptr,
+        void ( *_release )( object_link_t* ) = nullptr )
+    {
+        if( !_dditable->dispatchable )
+        {
+            auto object = factory.getInstance( _handle, _dditable );
+            if( ( nullptr != object ) && ( nullptr != _owner ) )
+                adopt( _owner, object->getLink(), _release, &factory );
+            return reinterpret_cast<handle_t>( object );
+        }
+
+        if( nullptr != _handle )
+            *reinterpret_cast<dditable_t**>( _handle ) = _dditable;
+        return _handle;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// once the driver handle is destroyed, release its loader handle along
+    /// with the loader handles of everything created under it
+    static void release( factory_t& factory, void* _handle, dditable_t* _dditable )
+    {
+        if( _dditable->dispatchable )
+            return;
+
+        auto object = reinterpret_cast<object_t*>( _handle );
+        if( !detach( object->getLink() ) )
+            return;
+        releaseChildren( object->getLink() );
+        factory.release( object->handle );
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    static object_t* fromLink( object_link_t* _link )
+    {
+        return static_cast<object_t*>( reinterpret_cast<fields_t*>(
+            reinterpret_cast<char*>( _link ) - offsetof( fields_t, link ) ) );
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// releases the loader handle through the factory that made it, along
+    /// with the loader handles of everything created under it
+    static void releaseLink( object_link_t* _link )
+    {
+        auto object = fromLink( _link );
+        releaseChildren( object->getLink() );
+        reinterpret_cast<factory_t*>( _link->factory )->release( object->handle );
+    }
+
+protected:
+    //////////////////////////////////////////////////////////////////////////
+    /// link operations, which do nothing for handles without a link
+    static void adopt( object_owner_link_t* _owner, object_link_t* _link, void ( *_release )( object_link_t* ), void* _factory )
+    {
+        _owner->adopt( _link, _release ? _release : releaseLink, _factory );
+    }
+
+    static void adopt( object_owner_link_t* _owner, object_owner_link_t* _link, void ( *_release )( object_link_t* ), void* _factory )
+    {
+        _owner->adopt( &_link->self, _release ? _release : releaseLink, _factory );
+    }
+
+    static void adopt( object_owner_link_t*, void*, void ( * )( object_link_t* ), void* ) {}
+
+    static bool detach( object_link_t* _link ) { return _link->detach(); }
+    static bool detach( object_owner_link_t* _link ) { return _link->self.detach(); }
+    static bool detach( void* ) { return true; }
+
+    static void releaseChildren( object_owner_link_t* _link ) { _link->releaseChildren(); }
+    static void releaseChildren( object_link_t* ) {}
+    static void releaseChildren( void* ) {}
 };
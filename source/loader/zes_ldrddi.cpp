@@ -101,8 +101,8 @@ namespace loader
                 {
                     for( uint32_t i = 0; i < library_driver_handle_count; ++i ) {
                         uint32_t driver_index = total_driver_handle_count + i;
-                        phDrivers[ driver_index ] = reinterpret_cast<zes_driver_handle_t>(
-                            zes_driver_factory.getInstance( phDrivers[ driver_index ], &drv.dditable ) );
+                        phDrivers[ driver_index ] = zes_driver_object_t::wrap(
+                            zes_driver_factory, phDrivers[ driver_index ], &drv.dditable );
                     }
                 }
                 catch( std::bad_alloc& )
@@ -145,7 +145,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDriver = reinterpret_cast<zes_driver_object_t*>( hDriver )->handle;
+        hDriver = zes_driver_object_t::unwrap( hDriver, dditable );
 
         // forward to device-driver
         result = pfnGet( hDriver, pCount, phDevices );
@@ -157,8 +157,7 @@ namespace loader
         {
             // convert driver handles to loader handles
             for( size_t i = 0; ( nullptr != phDevices ) && ( i < *pCount ); ++i )
-                phDevices[ i ] = reinterpret_cast<zes_device_handle_t>(
-                    zes_device_factory.getInstance( phDevices[ i ], dditable ) );
+                phDevices[ i ] = zes_device_object_t::wrap( zes_device_factory, phDevices[ i ], dditable );
         }
         catch( std::bad_alloc& )
         {
@@ -185,7 +184,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
+        hDevice = zes_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnGetProperties( hDevice, pProperties );
@@ -210,7 +209,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
+        hDevice = zes_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnGetState( hDevice, pState );
@@ -236,7 +235,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
+        hDevice = zes_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnReset( hDevice, force );
@@ -270,7 +269,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
+        hDevice = zes_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnProcessesGetState( hDevice, pCount, pProcesses );
@@ -295,7 +294,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
+        hDevice = zes_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnPciGetProperties( hDevice, pProperties );
@@ -320,7 +319,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
+        hDevice = zes_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnPciGetState( hDevice, pState );
@@ -353,7 +352,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
+        hDevice = zes_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnPciGetBars( hDevice, pCount, pProperties );
@@ -378,7 +377,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
+        hDevice = zes_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnPciGetStats( hDevice, pStats );
@@ -402,7 +401,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
+        hDevice = zes_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnSetOverclockWaiver( hDevice );
@@ -429,7 +428,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
+        hDevice = zes_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnGetOverclockDomains( hDevice, pOverclockDomains );
@@ -457,7 +456,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
+        hDevice = zes_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnGetOverclockControls( hDevice, domainType, pAvailableControls );
@@ -483,7 +482,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
+        hDevice = zes_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnResetOverclockSettings( hDevice, onShippedState );
@@ -513,7 +512,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
+        hDevice = zes_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnReadOverclockState( hDevice, pOverclockMode, pWaiverSetting, pOverclockState, pPendingAction, pPendingReset );
@@ -548,7 +547,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
+        hDevice = zes_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnEnumOverclockDomains( hDevice, pCount, phDomainHandle );
@@ -560,8 +559,7 @@ namespace loader
         {
             // convert driver handles to loader handles
             for( size_t i = 0; ( nullptr != phDomainHandle ) && ( i < *pCount ); ++i )
-                phDomainHandle[ i ] = reinterpret_cast<zes_overclock_handle_t>(
-                    zes_overclock_factory.getInstance( phDomainHandle[ i ], dditable ) );
+                phDomainHandle[ i ] = zes_overclock_object_t::wrap( zes_overclock_factory, phDomainHandle[ i ], dditable );
         }
         catch( std::bad_alloc& )
         {
@@ -588,7 +586,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDomainHandle = reinterpret_cast<zes_overclock_object_t*>( hDomainHandle )->handle;
+        hDomainHandle = zes_overclock_object_t::unwrap( hDomainHandle, dditable );
 
         // forward to device-driver
         result = pfnGetDomainProperties( hDomainHandle, pDomainProperties );
@@ -613,7 +611,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDomainHandle = reinterpret_cast<zes_overclock_object_t*>( hDomainHandle )->handle;
+        hDomainHandle = zes_overclock_object_t::unwrap( hDomainHandle, dditable );
 
         // forward to device-driver
         result = pfnGetDomainVFProperties( hDomainHandle, pVFProperties );
@@ -639,7 +637,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDomainHandle = reinterpret_cast<zes_overclock_object_t*>( hDomainHandle )->handle;
+        hDomainHandle = zes_overclock_object_t::unwrap( hDomainHandle, dditable );
 
         // forward to device-driver
         result = pfnGetDomainControlProperties( hDomainHandle, DomainControl, pControlProperties );
@@ -665,7 +663,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDomainHandle = reinterpret_cast<zes_overclock_object_t*>( hDomainHandle )->handle;
+        hDomainHandle = zes_overclock_object_t::unwrap( hDomainHandle, dditable );
 
         // forward to device-driver
         result = pfnGetControlCurrentValue( hDomainHandle, DomainControl, pValue );
@@ -692,7 +690,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDomainHandle = reinterpret_cast<zes_overclock_object_t*>( hDomainHandle )->handle;
+        hDomainHandle = zes_overclock_object_t::unwrap( hDomainHandle, dditable );
 
         // forward to device-driver
         result = pfnGetControlPendingValue( hDomainHandle, DomainControl, pValue );
@@ -720,7 +718,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDomainHandle = reinterpret_cast<zes_overclock_object_t*>( hDomainHandle )->handle;
+        hDomainHandle = zes_overclock_object_t::unwrap( hDomainHandle, dditable );
 
         // forward to device-driver
         result = pfnSetControlUserValue( hDomainHandle, DomainControl, pValue, pPendingAction );
@@ -747,7 +745,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDomainHandle = reinterpret_cast<zes_overclock_object_t*>( hDomainHandle )->handle;
+        hDomainHandle = zes_overclock_object_t::unwrap( hDomainHandle, dditable );
 
         // forward to device-driver
         result = pfnGetControlState( hDomainHandle, DomainControl, pControlState, pPendingAction );
@@ -776,7 +774,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDomainHandle = reinterpret_cast<zes_overclock_object_t*>( hDomainHandle )->handle;
+        hDomainHandle = zes_overclock_object_t::unwrap( hDomainHandle, dditable );
 
         // forward to device-driver
         result = pfnGetVFPointValues( hDomainHandle, VFType, VFArrayType, PointIndex, PointValue );
@@ -804,7 +802,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDomainHandle = reinterpret_cast<zes_overclock_object_t*>( hDomainHandle )->handle;
+        hDomainHandle = zes_overclock_object_t::unwrap( hDomainHandle, dditable );
 
         // forward to device-driver
         result = pfnSetVFPointValues( hDomainHandle, VFType, PointIndex, PointValue );
@@ -839,7 +837,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
+        hDevice = zes_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnEnumDiagnosticTestSuites( hDevice, pCount, phDiagnostics );
@@ -851,8 +849,7 @@ namespace loader
         {
             // convert driver handles to loader handles
             for( size_t i = 0; ( nullptr != phDiagnostics ) && ( i < *pCount ); ++i )
-                phDiagnostics[ i ] = reinterpret_cast<zes_diag_handle_t>(
-                    zes_diag_factory.getInstance( phDiagnostics[ i ], dditable ) );
+                phDiagnostics[ i ] = zes_diag_object_t::wrap( zes_diag_factory, phDiagnostics[ i ], dditable );
         }
         catch( std::bad_alloc& )
         {
@@ -880,7 +877,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDiagnostics = reinterpret_cast<zes_diag_object_t*>( hDiagnostics )->handle;
+        hDiagnostics = zes_diag_object_t::unwrap( hDiagnostics, dditable );
 
         // forward to device-driver
         result = pfnGetProperties( hDiagnostics, pProperties );
@@ -913,7 +910,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDiagnostics = reinterpret_cast<zes_diag_object_t*>( hDiagnostics )->handle;
+        hDiagnostics = zes_diag_object_t::unwrap( hDiagnostics, dditable );
 
         // forward to device-driver
         result = pfnGetTests( hDiagnostics, pCount, pTests );
@@ -942,7 +939,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDiagnostics = reinterpret_cast<zes_diag_object_t*>( hDiagnostics )->handle;
+        hDiagnostics = zes_diag_object_t::unwrap( hDiagnostics, dditable );
 
         // forward to device-driver
         result = pfnRunTests( hDiagnostics, startIndex, endIndex, pResult );
@@ -967,7 +964,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
+        hDevice = zes_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnEccAvailable( hDevice, pAvailable );
@@ -992,7 +989,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
+        hDevice = zes_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnEccConfigurable( hDevice, pConfigurable );
@@ -1017,7 +1014,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
+        hDevice = zes_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnGetEccState( hDevice, pState );
@@ -1043,7 +1040,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
+        hDevice = zes_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnSetEccState( hDevice, newState, pState );
@@ -1078,7 +1075,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
+        hDevice = zes_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnEnumEngineGroups( hDevice, pCount, phEngine );
@@ -1090,8 +1087,7 @@ namespace loader
         {
             // convert driver handles to loader handles
             for( size_t i = 0; ( nullptr != phEngine ) && ( i < *pCount ); ++i )
-                phEngine[ i ] = reinterpret_cast<zes_engine_handle_t>(
-                    zes_engine_factory.getInstance( phEngine[ i ], dditable ) );
+                phEngine[ i ] = zes_engine_object_t::wrap( zes_engine_factory, phEngine[ i ], dditable );
         }
         catch( std::bad_alloc& )
         {
@@ -1118,7 +1114,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hEngine = reinterpret_cast<zes_engine_object_t*>( hEngine )->handle;
+        hEngine = zes_engine_object_t::unwrap( hEngine, dditable );
 
         // forward to device-driver
         result = pfnGetProperties( hEngine, pProperties );
@@ -1144,7 +1140,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hEngine = reinterpret_cast<zes_engine_object_t*>( hEngine )->handle;
+        hEngine = zes_engine_object_t::unwrap( hEngine, dditable );
 
         // forward to device-driver
         result = pfnGetActivity( hEngine, pStats );
@@ -1169,7 +1165,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
+        hDevice = zes_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnEventRegister( hDevice, events );
@@ -1210,16 +1206,15 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
+        hDriver = ze_driver_object_t::unwrap( hDriver, dditable );
 
         // convert loader handles to driver handles
-        auto phDevicesLocal = new zes_device_handle_t [count];
+        handle_array_t<zes_device_handle_t> phDevicesLocal( count );
         for( size_t i = 0; ( nullptr != phDevices ) && ( i < count ); ++i )
-            phDevicesLocal[ i ] = reinterpret_cast<zes_device_object_t*>( phDevices[ i ] )->handle;
+            phDevicesLocal[ i ] = zes_device_object_t::unwrap( phDevices[ i ], dditable );
 
         // forward to device-driver
         result = pfnEventListen( hDriver, timeout, count, phDevicesLocal, pNumDeviceEvents, pEvents );
-        delete []phDevicesLocal;
 
         return result;
     }
@@ -1257,16 +1252,15 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
+        hDriver = ze_driver_object_t::unwrap( hDriver, dditable );
 
         // convert loader handles to driver handles
-        auto phDevicesLocal = new zes_device_handle_t [count];
+        handle_array_t<zes_device_handle_t> phDevicesLocal( count );
         for( size_t i = 0; ( nullptr != phDevices ) && ( i < count ); ++i )
-            phDevicesLocal[ i ] = reinterpret_cast<zes_device_object_t*>( phDevices[ i ] )->handle;
+            phDevicesLocal[ i ] = zes_device_object_t::unwrap( phDevices[ i ], dditable );
 
         // forward to device-driver
         result = pfnEventListenEx( hDriver, timeout, count, phDevicesLocal, pNumDeviceEvents, pEvents );
-        delete []phDevicesLocal;
 
         return result;
     }
@@ -1298,7 +1292,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
+        hDevice = zes_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnEnumFabricPorts( hDevice, pCount, phPort );
@@ -1310,8 +1304,7 @@ namespace loader
         {
             // convert driver handles to loader handles
             for( size_t i = 0; ( nullptr != phPort ) && ( i < *pCount ); ++i )
-                phPort[ i ] = reinterpret_cast<zes_fabric_port_handle_t>(
-                    zes_fabric_port_factory.getInstance( phPort[ i ], dditable ) );
+                phPort[ i ] = zes_fabric_port_object_t::wrap( zes_fabric_port_factory, phPort[ i ], dditable );
         }
         catch( std::bad_alloc& )
         {
@@ -1338,7 +1331,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hPort = reinterpret_cast<zes_fabric_port_object_t*>( hPort )->handle;
+        hPort = zes_fabric_port_object_t::unwrap( hPort, dditable );
 
         // forward to device-driver
         result = pfnGetProperties( hPort, pProperties );
@@ -1364,7 +1357,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hPort = reinterpret_cast<zes_fabric_port_object_t*>( hPort )->handle;
+        hPort = zes_fabric_port_object_t::unwrap( hPort, dditable );
 
         // forward to device-driver
         result = pfnGetLinkType( hPort, pLinkType );
@@ -1389,7 +1382,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hPort = reinterpret_cast<zes_fabric_port_object_t*>( hPort )->handle;
+        hPort = zes_fabric_port_object_t::unwrap( hPort, dditable );
 
         // forward to device-driver
         result = pfnGetConfig( hPort, pConfig );
@@ -1414,7 +1407,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hPort = reinterpret_cast<zes_fabric_port_object_t*>( hPort )->handle;
+        hPort = zes_fabric_port_object_t::unwrap( hPort, dditable );
 
         // forward to device-driver
         result = pfnSetConfig( hPort, pConfig );
@@ -1439,7 +1432,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hPort = reinterpret_cast<zes_fabric_port_object_t*>( hPort )->handle;
+        hPort = zes_fabric_port_object_t::unwrap( hPort, dditable );
 
         // forward to device-driver
         result = pfnGetState( hPort, pState );
@@ -1464,7 +1457,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hPort = reinterpret_cast<zes_fabric_port_object_t*>( hPort )->handle;
+        hPort = zes_fabric_port_object_t::unwrap( hPort, dditable );
 
         // forward to device-driver
         result = pfnGetThroughput( hPort, pThroughput );
@@ -1499,7 +1492,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
+        hDevice = zes_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnEnumFans( hDevice, pCount, phFan );
@@ -1511,8 +1504,7 @@ namespace loader
         {
             // convert driver handles to loader handles
             for( size_t i = 0; ( nullptr != phFan ) && ( i < *pCount ); ++i )
-                phFan[ i ] = reinterpret_cast<zes_fan_handle_t>(
-                    zes_fan_factory.getInstance( phFan[ i ], dditable ) );
+                phFan[ i ] = zes_fan_object_t::wrap( zes_fan_factory, phFan[ i ], dditable );
         }
         catch( std::bad_alloc& )
         {
@@ -1539,7 +1531,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hFan = reinterpret_cast<zes_fan_object_t*>( hFan )->handle;
+        hFan = zes_fan_object_t::unwrap( hFan, dditable );
 
         // forward to device-driver
         result = pfnGetProperties( hFan, pProperties );
@@ -1564,7 +1556,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hFan = reinterpret_cast<zes_fan_object_t*>( hFan )->handle;
+        hFan = zes_fan_object_t::unwrap( hFan, dditable );
 
         // forward to device-driver
         result = pfnGetConfig( hFan, pConfig );
@@ -1588,7 +1580,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hFan = reinterpret_cast<zes_fan_object_t*>( hFan )->handle;
+        hFan = zes_fan_object_t::unwrap( hFan, dditable );
 
         // forward to device-driver
         result = pfnSetDefaultMode( hFan );
@@ -1613,7 +1605,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hFan = reinterpret_cast<zes_fan_object_t*>( hFan )->handle;
+        hFan = zes_fan_object_t::unwrap( hFan, dditable );
 
         // forward to device-driver
         result = pfnSetFixedSpeedMode( hFan, speed );
@@ -1638,7 +1630,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hFan = reinterpret_cast<zes_fan_object_t*>( hFan )->handle;
+        hFan = zes_fan_object_t::unwrap( hFan, dditable );
 
         // forward to device-driver
         result = pfnSetSpeedTableMode( hFan, speedTable );
@@ -1666,7 +1658,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hFan = reinterpret_cast<zes_fan_object_t*>( hFan )->handle;
+        hFan = zes_fan_object_t::unwrap( hFan, dditable );
 
         // forward to device-driver
         result = pfnGetState( hFan, units, pSpeed );
@@ -1701,7 +1693,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
+        hDevice = zes_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnEnumFirmwares( hDevice, pCount, phFirmware );
@@ -1713,8 +1705,7 @@ namespace loader
         {
             // convert driver handles to loader handles
             for( size_t i = 0; ( nullptr != phFirmware ) && ( i < *pCount ); ++i )
-                phFirmware[ i ] = reinterpret_cast<zes_firmware_handle_t>(
-                    zes_firmware_factory.getInstance( phFirmware[ i ], dditable ) );
+                phFirmware[ i ] = zes_firmware_object_t::wrap( zes_firmware_factory, phFirmware[ i ], dditable );
         }
         catch( std::bad_alloc& )
         {
@@ -1742,7 +1733,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hFirmware = reinterpret_cast<zes_firmware_object_t*>( hFirmware )->handle;
+        hFirmware = zes_firmware_object_t::unwrap( hFirmware, dditable );
 
         // forward to device-driver
         result = pfnGetProperties( hFirmware, pProperties );
@@ -1768,7 +1759,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hFirmware = reinterpret_cast<zes_firmware_object_t*>( hFirmware )->handle;
+        hFirmware = zes_firmware_object_t::unwrap( hFirmware, dditable );
 
         // forward to device-driver
         result = pfnFlash( hFirmware, pImage, size );
@@ -1803,7 +1794,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
+        hDevice = zes_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnEnumFrequencyDomains( hDevice, pCount, phFrequency );
@@ -1815,8 +1806,7 @@ namespace loader
         {
             // convert driver handles to loader handles
             for( size_t i = 0; ( nullptr != phFrequency ) && ( i < *pCount ); ++i )
-                phFrequency[ i ] = reinterpret_cast<zes_freq_handle_t>(
-                    zes_freq_factory.getInstance( phFrequency[ i ], dditable ) );
+                phFrequency[ i ] = zes_freq_object_t::wrap( zes_freq_factory, phFrequency[ i ], dditable );
         }
         catch( std::bad_alloc& )
         {
@@ -1843,7 +1833,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
+        hFrequency = zes_freq_object_t::unwrap( hFrequency, dditable );
 
         // forward to device-driver
         result = pfnGetProperties( hFrequency, pProperties );
@@ -1876,7 +1866,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
+        hFrequency = zes_freq_object_t::unwrap( hFrequency, dditable );
 
         // forward to device-driver
         result = pfnGetAvailableClocks( hFrequency, pCount, phFrequency );
@@ -1902,7 +1892,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
+        hFrequency = zes_freq_object_t::unwrap( hFrequency, dditable );
 
         // forward to device-driver
         result = pfnGetRange( hFrequency, pLimits );
@@ -1928,7 +1918,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
+        hFrequency = zes_freq_object_t::unwrap( hFrequency, dditable );
 
         // forward to device-driver
         result = pfnSetRange( hFrequency, pLimits );
@@ -1953,7 +1943,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
+        hFrequency = zes_freq_object_t::unwrap( hFrequency, dditable );
 
         // forward to device-driver
         result = pfnGetState( hFrequency, pState );
@@ -1979,7 +1969,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
+        hFrequency = zes_freq_object_t::unwrap( hFrequency, dditable );
 
         // forward to device-driver
         result = pfnGetThrottleTime( hFrequency, pThrottleTime );
@@ -2005,7 +1995,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
+        hFrequency = zes_freq_object_t::unwrap( hFrequency, dditable );
 
         // forward to device-driver
         result = pfnOcGetCapabilities( hFrequency, pOcCapabilities );
@@ -2032,7 +2022,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
+        hFrequency = zes_freq_object_t::unwrap( hFrequency, dditable );
 
         // forward to device-driver
         result = pfnOcGetFrequencyTarget( hFrequency, pCurrentOcFrequency );
@@ -2059,7 +2049,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
+        hFrequency = zes_freq_object_t::unwrap( hFrequency, dditable );
 
         // forward to device-driver
         result = pfnOcSetFrequencyTarget( hFrequency, CurrentOcFrequency );
@@ -2089,7 +2079,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
+        hFrequency = zes_freq_object_t::unwrap( hFrequency, dditable );
 
         // forward to device-driver
         result = pfnOcGetVoltageTarget( hFrequency, pCurrentVoltageTarget, pCurrentVoltageOffset );
@@ -2119,7 +2109,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
+        hFrequency = zes_freq_object_t::unwrap( hFrequency, dditable );
 
         // forward to device-driver
         result = pfnOcSetVoltageTarget( hFrequency, CurrentVoltageTarget, CurrentVoltageOffset );
@@ -2144,7 +2134,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
+        hFrequency = zes_freq_object_t::unwrap( hFrequency, dditable );
 
         // forward to device-driver
         result = pfnOcSetMode( hFrequency, CurrentOcMode );
@@ -2169,7 +2159,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
+        hFrequency = zes_freq_object_t::unwrap( hFrequency, dditable );
 
         // forward to device-driver
         result = pfnOcGetMode( hFrequency, pCurrentOcMode );
@@ -2195,7 +2185,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
+        hFrequency = zes_freq_object_t::unwrap( hFrequency, dditable );
 
         // forward to device-driver
         result = pfnOcGetIccMax( hFrequency, pOcIccMax );
@@ -2220,7 +2210,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
+        hFrequency = zes_freq_object_t::unwrap( hFrequency, dditable );
 
         // forward to device-driver
         result = pfnOcSetIccMax( hFrequency, ocIccMax );
@@ -2246,7 +2236,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
+        hFrequency = zes_freq_object_t::unwrap( hFrequency, dditable );
 
         // forward to device-driver
         result = pfnOcGetTjMax( hFrequency, pOcTjMax );
@@ -2271,7 +2261,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
+        hFrequency = zes_freq_object_t::unwrap( hFrequency, dditable );
 
         // forward to device-driver
         result = pfnOcSetTjMax( hFrequency, ocTjMax );
@@ -2306,7 +2296,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
+        hDevice = zes_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnEnumLeds( hDevice, pCount, phLed );
@@ -2318,8 +2308,7 @@ namespace loader
         {
             // convert driver handles to loader handles
             for( size_t i = 0; ( nullptr != phLed ) && ( i < *pCount ); ++i )
-                phLed[ i ] = reinterpret_cast<zes_led_handle_t>(
-                    zes_led_factory.getInstance( phLed[ i ], dditable ) );
+                phLed[ i ] = zes_led_object_t::wrap( zes_led_factory, phLed[ i ], dditable );
         }
         catch( std::bad_alloc& )
         {
@@ -2346,7 +2335,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hLed = reinterpret_cast<zes_led_object_t*>( hLed )->handle;
+        hLed = zes_led_object_t::unwrap( hLed, dditable );
 
         // forward to device-driver
         result = pfnGetProperties( hLed, pProperties );
@@ -2371,7 +2360,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hLed = reinterpret_cast<zes_led_object_t*>( hLed )->handle;
+        hLed = zes_led_object_t::unwrap( hLed, dditable );
 
         // forward to device-driver
         result = pfnGetState( hLed, pState );
@@ -2396,7 +2385,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hLed = reinterpret_cast<zes_led_object_t*>( hLed )->handle;
+        hLed = zes_led_object_t::unwrap( hLed, dditable );
 
         // forward to device-driver
         result = pfnSetState( hLed, enable );
@@ -2421,7 +2410,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hLed = reinterpret_cast<zes_led_object_t*>( hLed )->handle;
+        hLed = zes_led_object_t::unwrap( hLed, dditable );
 
         // forward to device-driver
         result = pfnSetColor( hLed, pColor );
@@ -2456,7 +2445,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
+        hDevice = zes_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnEnumMemoryModules( hDevice, pCount, phMemory );
@@ -2468,8 +2457,7 @@ namespace loader
         {
             // convert driver handles to loader handles
             for( size_t i = 0; ( nullptr != phMemory ) && ( i < *pCount ); ++i )
-                phMemory[ i ] = reinterpret_cast<zes_mem_handle_t>(
-                    zes_mem_factory.getInstance( phMemory[ i ], dditable ) );
+                phMemory[ i ] = zes_mem_object_t::wrap( zes_mem_factory, phMemory[ i ], dditable );
         }
         catch( std::bad_alloc& )
         {
@@ -2496,7 +2484,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hMemory = reinterpret_cast<zes_mem_object_t*>( hMemory )->handle;
+        hMemory = zes_mem_object_t::unwrap( hMemory, dditable );
 
         // forward to device-driver
         result = pfnGetProperties( hMemory, pProperties );
@@ -2521,7 +2509,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hMemory = reinterpret_cast<zes_mem_object_t*>( hMemory )->handle;
+        hMemory = zes_mem_object_t::unwrap( hMemory, dditable );
 
         // forward to device-driver
         result = pfnGetState( hMemory, pState );
@@ -2547,7 +2535,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hMemory = reinterpret_cast<zes_mem_object_t*>( hMemory )->handle;
+        hMemory = zes_mem_object_t::unwrap( hMemory, dditable );
 
         // forward to device-driver
         result = pfnGetBandwidth( hMemory, pBandwidth );
@@ -2582,7 +2570,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
+        hDevice = zes_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnEnumPerformanceFactorDomains( hDevice, pCount, phPerf );
@@ -2594,8 +2582,7 @@ namespace loader
         {
             // convert driver handles to loader handles
             for( size_t i = 0; ( nullptr != phPerf ) && ( i < *pCount ); ++i )
-                phPerf[ i ] = reinterpret_cast<zes_perf_handle_t>(
-                    zes_perf_factory.getInstance( phPerf[ i ], dditable ) );
+                phPerf[ i ] = zes_perf_object_t::wrap( zes_perf_factory, phPerf[ i ], dditable );
         }
         catch( std::bad_alloc& )
         {
@@ -2623,7 +2610,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hPerf = reinterpret_cast<zes_perf_object_t*>( hPerf )->handle;
+        hPerf = zes_perf_object_t::unwrap( hPerf, dditable );
 
         // forward to device-driver
         result = pfnGetProperties( hPerf, pProperties );
@@ -2649,7 +2636,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hPerf = reinterpret_cast<zes_perf_object_t*>( hPerf )->handle;
+        hPerf = zes_perf_object_t::unwrap( hPerf, dditable );
 
         // forward to device-driver
         result = pfnGetConfig( hPerf, pFactor );
@@ -2674,7 +2661,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hPerf = reinterpret_cast<zes_perf_object_t*>( hPerf )->handle;
+        hPerf = zes_perf_object_t::unwrap( hPerf, dditable );
 
         // forward to device-driver
         result = pfnSetConfig( hPerf, factor );
@@ -2709,7 +2696,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
+        hDevice = zes_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnEnumPowerDomains( hDevice, pCount, phPower );
@@ -2721,8 +2708,7 @@ namespace loader
         {
             // convert driver handles to loader handles
             for( size_t i = 0; ( nullptr != phPower ) && ( i < *pCount ); ++i )
-                phPower[ i ] = reinterpret_cast<zes_pwr_handle_t>(
-                    zes_pwr_factory.getInstance( phPower[ i ], dditable ) );
+                phPower[ i ] = zes_pwr_object_t::wrap( zes_pwr_factory, phPower[ i ], dditable );
         }
         catch( std::bad_alloc& )
         {
@@ -2749,7 +2735,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
+        hDevice = zes_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnGetCardPowerDomain( hDevice, phPower );
@@ -2760,8 +2746,7 @@ namespace loader
         try
         {
             // convert driver handle to loader handle
-            *phPower = reinterpret_cast<zes_pwr_handle_t>(
-                zes_pwr_factory.getInstance( *phPower, dditable ) );
+            *phPower = zes_pwr_object_t::wrap( zes_pwr_factory, *phPower, dditable );
         }
         catch( std::bad_alloc& )
         {
@@ -2788,7 +2773,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hPower = reinterpret_cast<zes_pwr_object_t*>( hPower )->handle;
+        hPower = zes_pwr_object_t::unwrap( hPower, dditable );
 
         // forward to device-driver
         result = pfnGetProperties( hPower, pProperties );
@@ -2814,7 +2799,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hPower = reinterpret_cast<zes_pwr_object_t*>( hPower )->handle;
+        hPower = zes_pwr_object_t::unwrap( hPower, dditable );
 
         // forward to device-driver
         result = pfnGetEnergyCounter( hPower, pEnergy );
@@ -2844,7 +2829,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hPower = reinterpret_cast<zes_pwr_object_t*>( hPower )->handle;
+        hPower = zes_pwr_object_t::unwrap( hPower, dditable );
 
         // forward to device-driver
         result = pfnGetLimits( hPower, pSustained, pBurst, pPeak );
@@ -2874,7 +2859,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hPower = reinterpret_cast<zes_pwr_object_t*>( hPower )->handle;
+        hPower = zes_pwr_object_t::unwrap( hPower, dditable );
 
         // forward to device-driver
         result = pfnSetLimits( hPower, pSustained, pBurst, pPeak );
@@ -2900,7 +2885,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hPower = reinterpret_cast<zes_pwr_object_t*>( hPower )->handle;
+        hPower = zes_pwr_object_t::unwrap( hPower, dditable );
 
         // forward to device-driver
         result = pfnGetEnergyThreshold( hPower, pThreshold );
@@ -2925,7 +2910,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hPower = reinterpret_cast<zes_pwr_object_t*>( hPower )->handle;
+        hPower = zes_pwr_object_t::unwrap( hPower, dditable );
 
         // forward to device-driver
         result = pfnSetEnergyThreshold( hPower, threshold );
@@ -2960,7 +2945,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
+        hDevice = zes_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnEnumPsus( hDevice, pCount, phPsu );
@@ -2972,8 +2957,7 @@ namespace loader
         {
             // convert driver handles to loader handles
             for( size_t i = 0; ( nullptr != phPsu ) && ( i < *pCount ); ++i )
-                phPsu[ i ] = reinterpret_cast<zes_psu_handle_t>(
-                    zes_psu_factory.getInstance( phPsu[ i ], dditable ) );
+                phPsu[ i ] = zes_psu_object_t::wrap( zes_psu_factory, phPsu[ i ], dditable );
         }
         catch( std::bad_alloc& )
         {
@@ -3000,7 +2984,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hPsu = reinterpret_cast<zes_psu_object_t*>( hPsu )->handle;
+        hPsu = zes_psu_object_t::unwrap( hPsu, dditable );
 
         // forward to device-driver
         result = pfnGetProperties( hPsu, pProperties );
@@ -3025,7 +3009,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hPsu = reinterpret_cast<zes_psu_object_t*>( hPsu )->handle;
+        hPsu = zes_psu_object_t::unwrap( hPsu, dditable );
 
         // forward to device-driver
         result = pfnGetState( hPsu, pState );
@@ -3060,7 +3044,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
+        hDevice = zes_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnEnumRasErrorSets( hDevice, pCount, phRas );
@@ -3072,8 +3056,7 @@ namespace loader
         {
             // convert driver handles to loader handles
             for( size_t i = 0; ( nullptr != phRas ) && ( i < *pCount ); ++i )
-                phRas[ i ] = reinterpret_cast<zes_ras_handle_t>(
-                    zes_ras_factory.getInstance( phRas[ i ], dditable ) );
+                phRas[ i ] = zes_ras_object_t::wrap( zes_ras_factory, phRas[ i ], dditable );
         }
         catch( std::bad_alloc& )
         {
@@ -3100,7 +3083,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hRas = reinterpret_cast<zes_ras_object_t*>( hRas )->handle;
+        hRas = zes_ras_object_t::unwrap( hRas, dditable );
 
         // forward to device-driver
         result = pfnGetProperties( hRas, pProperties );
@@ -3126,7 +3109,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hRas = reinterpret_cast<zes_ras_object_t*>( hRas )->handle;
+        hRas = zes_ras_object_t::unwrap( hRas, dditable );
 
         // forward to device-driver
         result = pfnGetConfig( hRas, pConfig );
@@ -3151,7 +3134,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hRas = reinterpret_cast<zes_ras_object_t*>( hRas )->handle;
+        hRas = zes_ras_object_t::unwrap( hRas, dditable );
 
         // forward to device-driver
         result = pfnSetConfig( hRas, pConfig );
@@ -3177,7 +3160,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hRas = reinterpret_cast<zes_ras_object_t*>( hRas )->handle;
+        hRas = zes_ras_object_t::unwrap( hRas, dditable );
 
         // forward to device-driver
         result = pfnGetState( hRas, clear, pState );
@@ -3212,7 +3195,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
+        hDevice = zes_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnEnumSchedulers( hDevice, pCount, phScheduler );
@@ -3224,8 +3207,7 @@ namespace loader
         {
             // convert driver handles to loader handles
             for( size_t i = 0; ( nullptr != phScheduler ) && ( i < *pCount ); ++i )
-                phScheduler[ i ] = reinterpret_cast<zes_sched_handle_t>(
-                    zes_sched_factory.getInstance( phScheduler[ i ], dditable ) );
+                phScheduler[ i ] = zes_sched_object_t::wrap( zes_sched_factory, phScheduler[ i ], dditable );
         }
         catch( std::bad_alloc& )
         {
@@ -3252,7 +3234,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hScheduler = reinterpret_cast<zes_sched_object_t*>( hScheduler )->handle;
+        hScheduler = zes_sched_object_t::unwrap( hScheduler, dditable );
 
         // forward to device-driver
         result = pfnGetProperties( hScheduler, pProperties );
@@ -3277,7 +3259,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hScheduler = reinterpret_cast<zes_sched_object_t*>( hScheduler )->handle;
+        hScheduler = zes_sched_object_t::unwrap( hScheduler, dditable );
 
         // forward to device-driver
         result = pfnGetCurrentMode( hScheduler, pMode );
@@ -3304,7 +3286,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hScheduler = reinterpret_cast<zes_sched_object_t*>( hScheduler )->handle;
+        hScheduler = zes_sched_object_t::unwrap( hScheduler, dditable );
 
         // forward to device-driver
         result = pfnGetTimeoutModeProperties( hScheduler, getDefaults, pConfig );
@@ -3331,7 +3313,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hScheduler = reinterpret_cast<zes_sched_object_t*>( hScheduler )->handle;
+        hScheduler = zes_sched_object_t::unwrap( hScheduler, dditable );
 
         // forward to device-driver
         result = pfnGetTimesliceModeProperties( hScheduler, getDefaults, pConfig );
@@ -3358,7 +3340,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hScheduler = reinterpret_cast<zes_sched_object_t*>( hScheduler )->handle;
+        hScheduler = zes_sched_object_t::unwrap( hScheduler, dditable );
 
         // forward to device-driver
         result = pfnSetTimeoutMode( hScheduler, pProperties, pNeedReload );
@@ -3385,7 +3367,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hScheduler = reinterpret_cast<zes_sched_object_t*>( hScheduler )->handle;
+        hScheduler = zes_sched_object_t::unwrap( hScheduler, dditable );
 
         // forward to device-driver
         result = pfnSetTimesliceMode( hScheduler, pProperties, pNeedReload );
@@ -3411,7 +3393,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hScheduler = reinterpret_cast<zes_sched_object_t*>( hScheduler )->handle;
+        hScheduler = zes_sched_object_t::unwrap( hScheduler, dditable );
 
         // forward to device-driver
         result = pfnSetExclusiveMode( hScheduler, pNeedReload );
@@ -3437,7 +3419,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hScheduler = reinterpret_cast<zes_sched_object_t*>( hScheduler )->handle;
+        hScheduler = zes_sched_object_t::unwrap( hScheduler, dditable );
 
         // forward to device-driver
         result = pfnSetComputeUnitDebugMode( hScheduler, pNeedReload );
@@ -3472,7 +3454,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
+        hDevice = zes_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnEnumStandbyDomains( hDevice, pCount, phStandby );
@@ -3484,8 +3466,7 @@ namespace loader
         {
             // convert driver handles to loader handles
             for( size_t i = 0; ( nullptr != phStandby ) && ( i < *pCount ); ++i )
-                phStandby[ i ] = reinterpret_cast<zes_standby_handle_t>(
-                    zes_standby_factory.getInstance( phStandby[ i ], dditable ) );
+                phStandby[ i ] = zes_standby_object_t::wrap( zes_standby_factory, phStandby[ i ], dditable );
         }
         catch( std::bad_alloc& )
         {
@@ -3512,7 +3493,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hStandby = reinterpret_cast<zes_standby_object_t*>( hStandby )->handle;
+        hStandby = zes_standby_object_t::unwrap( hStandby, dditable );
 
         // forward to device-driver
         result = pfnGetProperties( hStandby, pProperties );
@@ -3537,7 +3518,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hStandby = reinterpret_cast<zes_standby_object_t*>( hStandby )->handle;
+        hStandby = zes_standby_object_t::unwrap( hStandby, dditable );
 
         // forward to device-driver
         result = pfnGetMode( hStandby, pMode );
@@ -3562,7 +3543,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hStandby = reinterpret_cast<zes_standby_object_t*>( hStandby )->handle;
+        hStandby = zes_standby_object_t::unwrap( hStandby, dditable );
 
         // forward to device-driver
         result = pfnSetMode( hStandby, mode );
@@ -3597,7 +3578,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
+        hDevice = zes_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnEnumTemperatureSensors( hDevice, pCount, phTemperature );
@@ -3609,8 +3590,7 @@ namespace loader
         {
             // convert driver handles to loader handles
             for( size_t i = 0; ( nullptr != phTemperature ) && ( i < *pCount ); ++i )
-                phTemperature[ i ] = reinterpret_cast<zes_temp_handle_t>(
-                    zes_temp_factory.getInstance( phTemperature[ i ], dditable ) );
+                phTemperature[ i ] = zes_temp_object_t::wrap( zes_temp_factory, phTemperature[ i ], dditable );
         }
         catch( std::bad_alloc& )
         {
@@ -3637,7 +3617,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hTemperature = reinterpret_cast<zes_temp_object_t*>( hTemperature )->handle;
+        hTemperature = zes_temp_object_t::unwrap( hTemperature, dditable );
 
         // forward to device-driver
         result = pfnGetProperties( hTemperature, pProperties );
@@ -3662,7 +3642,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hTemperature = reinterpret_cast<zes_temp_object_t*>( hTemperature )->handle;
+        hTemperature = zes_temp_object_t::unwrap( hTemperature, dditable );
 
         // forward to device-driver
         result = pfnGetConfig( hTemperature, pConfig );
@@ -3687,7 +3667,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hTemperature = reinterpret_cast<zes_temp_object_t*>( hTemperature )->handle;
+        hTemperature = zes_temp_object_t::unwrap( hTemperature, dditable );
 
         // forward to device-driver
         result = pfnSetConfig( hTemperature, pConfig );
@@ -3713,7 +3693,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hTemperature = reinterpret_cast<zes_temp_object_t*>( hTemperature )->handle;
+        hTemperature = zes_temp_object_t::unwrap( hTemperature, dditable );
 
         // forward to device-driver
         result = pfnGetState( hTemperature, pTemperature );
@@ -3746,7 +3726,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hPower = reinterpret_cast<zes_pwr_object_t*>( hPower )->handle;
+        hPower = zes_pwr_object_t::unwrap( hPower, dditable );
 
         // forward to device-driver
         result = pfnGetLimitsExt( hPower, pCount, pSustained );
@@ -3772,7 +3752,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hPower = reinterpret_cast<zes_pwr_object_t*>( hPower )->handle;
+        hPower = zes_pwr_object_t::unwrap( hPower, dditable );
 
         // forward to device-driver
         result = pfnSetLimitsExt( hPower, pCount, pSustained );
@@ -3780,6 +3760,155 @@ namespace loader
         return result;
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// fills the zes tables of a driver through its optional bulk export, once,
+    /// when they are first requested; tables of drivers without it are looked
+    /// up one by one
+    static void zesLoadAllDriverTables( driver_t& drv )
+    {
+        if( drv.zesAllTablesRequested )
+            return;
+        drv.zesAllTablesRequested = true;
+
+        auto getAllTables = reinterpret_cast<zel_pfnGetAllProcAddrTables_t>(
+            GET_FUNCTION_PTR( drv.handle, "zesGetAllProcAddrTables") );
+        if( !getAllTables )
+            return;
+
+        const char *tableNames[] = {
+            "zesGetGlobalProcAddrTable",
+            "zesGetDeviceProcAddrTable",
+            "zesGetDriverProcAddrTable",
+            "zesGetDiagnosticsProcAddrTable",
+            "zesGetEngineProcAddrTable",
+            "zesGetFabricPortProcAddrTable",
+            "zesGetFanProcAddrTable",
+            "zesGetFirmwareProcAddrTable",
+            "zesGetFrequencyProcAddrTable",
+            "zesGetLedProcAddrTable",
+            "zesGetMemoryProcAddrTable",
+            "zesGetOverclockProcAddrTable",
+            "zesGetPerformanceFactorProcAddrTable",
+            "zesGetPowerProcAddrTable",
+            "zesGetPsuProcAddrTable",
+            "zesGetRasProcAddrTable",
+            "zesGetSchedulerProcAddrTable",
+            "zesGetStandbyProcAddrTable",
+            "zesGetTemperatureProcAddrTable",
+        };
+        void *tables[] = {
+            &drv.dditable.zes.Global,
+            &drv.dditable.zes.Device,
+            &drv.dditable.zes.Driver,
+            &drv.dditable.zes.Diagnostics,
+            &drv.dditable.zes.Engine,
+            &drv.dditable.zes.FabricPort,
+            &drv.dditable.zes.Fan,
+            &drv.dditable.zes.Firmware,
+            &drv.dditable.zes.Frequency,
+            &drv.dditable.zes.Led,
+            &drv.dditable.zes.Memory,
+            &drv.dditable.zes.Overclock,
+            &drv.dditable.zes.PerformanceFactor,
+            &drv.dditable.zes.Power,
+            &drv.dditable.zes.Psu,
+            &drv.dditable.zes.Ras,
+            &drv.dditable.zes.Scheduler,
+            &drv.dditable.zes.Standby,
+            &drv.dditable.zes.Temperature,
+        };
+        auto count = static_cast<uint32_t>( sizeof( tables ) / sizeof( tables[ 0 ] ) );
+        drv.zesTablesLoaded = ( ZE_RESULT_SUCCESS == getAllTables( loader::context->version, count, tableNames, tables ) );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// fills the tables of a driver loaded by a later zeInit, after the
+    /// exports below may already have run
+    void zesLoadDriverTables( driver_t& drv )
+    {
+        zesLoadAllDriverTables( drv );
+        if( drv.zesTablesLoaded )
+            return;
+
+        auto getGlobalTable = reinterpret_cast<zes_pfnGetGlobalProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zesGetGlobalProcAddrTable") );
+        if( getGlobalTable )
+            getGlobalTable( loader::context->version, &drv.dditable.zes.Global );
+        auto getDeviceTable = reinterpret_cast<zes_pfnGetDeviceProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zesGetDeviceProcAddrTable") );
+        if( getDeviceTable )
+            getDeviceTable( loader::context->version, &drv.dditable.zes.Device );
+        auto getDriverTable = reinterpret_cast<zes_pfnGetDriverProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zesGetDriverProcAddrTable") );
+        if( getDriverTable )
+            getDriverTable( loader::context->version, &drv.dditable.zes.Driver );
+        auto getDiagnosticsTable = reinterpret_cast<zes_pfnGetDiagnosticsProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zesGetDiagnosticsProcAddrTable") );
+        if( getDiagnosticsTable )
+            getDiagnosticsTable( loader::context->version, &drv.dditable.zes.Diagnostics );
+        auto getEngineTable = reinterpret_cast<zes_pfnGetEngineProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zesGetEngineProcAddrTable") );
+        if( getEngineTable )
+            getEngineTable( loader::context->version, &drv.dditable.zes.Engine );
+        auto getFabricPortTable = reinterpret_cast<zes_pfnGetFabricPortProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zesGetFabricPortProcAddrTable") );
+        if( getFabricPortTable )
+            getFabricPortTable( loader::context->version, &drv.dditable.zes.FabricPort );
+        auto getFanTable = reinterpret_cast<zes_pfnGetFanProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zesGetFanProcAddrTable") );
+        if( getFanTable )
+            getFanTable( loader::context->version, &drv.dditable.zes.Fan );
+        auto getFirmwareTable = reinterpret_cast<zes_pfnGetFirmwareProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zesGetFirmwareProcAddrTable") );
+        if( getFirmwareTable )
+            getFirmwareTable( loader::context->version, &drv.dditable.zes.Firmware );
+        auto getFrequencyTable = reinterpret_cast<zes_pfnGetFrequencyProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zesGetFrequencyProcAddrTable") );
+        if( getFrequencyTable )
+            getFrequencyTable( loader::context->version, &drv.dditable.zes.Frequency );
+        auto getLedTable = reinterpret_cast<zes_pfnGetLedProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zesGetLedProcAddrTable") );
+        if( getLedTable )
+            getLedTable( loader::context->version, &drv.dditable.zes.Led );
+        auto getMemoryTable = reinterpret_cast<zes_pfnGetMemoryProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zesGetMemoryProcAddrTable") );
+        if( getMemoryTable )
+            getMemoryTable( loader::context->version, &drv.dditable.zes.Memory );
+        auto getOverclockTable = reinterpret_cast<zes_pfnGetOverclockProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zesGetOverclockProcAddrTable") );
+        if( getOverclockTable )
+            getOverclockTable( loader::context->version, &drv.dditable.zes.Overclock );
+        auto getPerformanceFactorTable = reinterpret_cast<zes_pfnGetPerformanceFactorProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zesGetPerformanceFactorProcAddrTable") );
+        if( getPerformanceFactorTable )
+            getPerformanceFactorTable( loader::context->version, &drv.dditable.zes.PerformanceFactor );
+        auto getPowerTable = reinterpret_cast<zes_pfnGetPowerProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zesGetPowerProcAddrTable") );
+        if( getPowerTable )
+            getPowerTable( loader::context->version, &drv.dditable.zes.Power );
+        auto getPsuTable = reinterpret_cast<zes_pfnGetPsuProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zesGetPsuProcAddrTable") );
+        if( getPsuTable )
+            getPsuTable( loader::context->version, &drv.dditable.zes.Psu );
+        auto getRasTable = reinterpret_cast<zes_pfnGetRasProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zesGetRasProcAddrTable") );
+        if( getRasTable )
+            getRasTable( loader::context->version, &drv.dditable.zes.Ras );
+        auto getSchedulerTable = reinterpret_cast<zes_pfnGetSchedulerProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zesGetSchedulerProcAddrTable") );
+        if( getSchedulerTable )
+            getSchedulerTable( loader::context->version, &drv.dditable.zes.Scheduler );
+        auto getStandbyTable = reinterpret_cast<zes_pfnGetStandbyProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zesGetStandbyProcAddrTable") );
+        if( getStandbyTable )
+            getStandbyTable( loader::context->version, &drv.dditable.zes.Standby );
+        auto getTemperatureTable = reinterpret_cast<zes_pfnGetTemperatureProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zesGetTemperatureProcAddrTable") );
+        if( getTemperatureTable )
+            getTemperatureTable( loader::context->version, &drv.dditable.zes.Temperature );
+        drv.zesTablesLoaded = true;
+    }
+
 } // namespace loader
 
 #if defined(__cplusplus)
@@ -3818,6 +3947,13 @@ zesGetGlobalProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zesLoadAllDriverTables( drv );
+        if(drv.zesTablesLoaded)
+        {
+            // already filled by the driver's zesGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<zes_pfnGetGlobalProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zesGetGlobalProcAddrTable") );
         if(!getTable) 
@@ -3840,7 +3976,7 @@ zesGetGlobalProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnInit                                     = loader::zesInit;
@@ -3897,6 +4033,13 @@ zesGetDeviceProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zesLoadAllDriverTables( drv );
+        if(drv.zesTablesLoaded)
+        {
+            // already filled by the driver's zesGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<zes_pfnGetDeviceProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zesGetDeviceProcAddrTable") );
         if(!getTable) 
@@ -3915,7 +4058,7 @@ zesGetDeviceProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnGetProperties                            = loader::zesDeviceGetProperties;
@@ -4007,6 +4150,13 @@ zesGetDriverProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zesLoadAllDriverTables( drv );
+        if(drv.zesTablesLoaded)
+        {
+            // already filled by the driver's zesGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<zes_pfnGetDriverProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zesGetDriverProcAddrTable") );
         if(!getTable) 
@@ -4025,7 +4175,7 @@ zesGetDriverProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnEventListen                              = loader::zesDriverEventListen;
@@ -4084,6 +4234,13 @@ zesGetDiagnosticsProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zesLoadAllDriverTables( drv );
+        if(drv.zesTablesLoaded)
+        {
+            // already filled by the driver's zesGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<zes_pfnGetDiagnosticsProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zesGetDiagnosticsProcAddrTable") );
         if(!getTable) 
@@ -4102,7 +4259,7 @@ zesGetDiagnosticsProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnGetProperties                            = loader::zesDiagnosticsGetProperties;
@@ -4161,6 +4318,13 @@ zesGetEngineProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zesLoadAllDriverTables( drv );
+        if(drv.zesTablesLoaded)
+        {
+            // already filled by the driver's zesGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<zes_pfnGetEngineProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zesGetEngineProcAddrTable") );
         if(!getTable) 
@@ -4179,7 +4343,7 @@ zesGetEngineProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnGetProperties                            = loader::zesEngineGetProperties;
@@ -4237,6 +4401,13 @@ zesGetFabricPortProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zesLoadAllDriverTables( drv );
+        if(drv.zesTablesLoaded)
+        {
+            // already filled by the driver's zesGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<zes_pfnGetFabricPortProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zesGetFabricPortProcAddrTable") );
         if(!getTable) 
@@ -4255,7 +4426,7 @@ zesGetFabricPortProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnGetProperties                            = loader::zesFabricPortGetProperties;
@@ -4317,6 +4488,13 @@ zesGetFanProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zesLoadAllDriverTables( drv );
+        if(drv.zesTablesLoaded)
+        {
+            // already filled by the driver's zesGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<zes_pfnGetFanProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zesGetFanProcAddrTable") );
         if(!getTable) 
@@ -4335,7 +4513,7 @@ zesGetFanProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnGetProperties                            = loader::zesFanGetProperties;
@@ -4397,6 +4575,13 @@ zesGetFirmwareProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zesLoadAllDriverTables( drv );
+        if(drv.zesTablesLoaded)
+        {
+            // already filled by the driver's zesGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<zes_pfnGetFirmwareProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zesGetFirmwareProcAddrTable") );
         if(!getTable) 
@@ -4415,7 +4600,7 @@ zesGetFirmwareProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnGetProperties                            = loader::zesFirmwareGetProperties;
@@ -4473,6 +4658,13 @@ zesGetFrequencyProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zesLoadAllDriverTables( drv );
+        if(drv.zesTablesLoaded)
+        {
+            // already filled by the driver's zesGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<zes_pfnGetFrequencyProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zesGetFrequencyProcAddrTable") );
         if(!getTable) 
@@ -4491,7 +4683,7 @@ zesGetFrequencyProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnGetProperties                            = loader::zesFrequencyGetProperties;
@@ -4564,6 +4756,13 @@ zesGetLedProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zesLoadAllDriverTables( drv );
+        if(drv.zesTablesLoaded)
+        {
+            // already filled by the driver's zesGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<zes_pfnGetLedProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zesGetLedProcAddrTable") );
         if(!getTable) 
@@ -4582,7 +4781,7 @@ zesGetLedProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnGetProperties                            = loader::zesLedGetProperties;
@@ -4642,6 +4841,13 @@ zesGetMemoryProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zesLoadAllDriverTables( drv );
+        if(drv.zesTablesLoaded)
+        {
+            // already filled by the driver's zesGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<zes_pfnGetMemoryProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zesGetMemoryProcAddrTable") );
         if(!getTable) 
@@ -4660,7 +4866,7 @@ zesGetMemoryProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnGetProperties                            = loader::zesMemoryGetProperties;
@@ -4719,6 +4925,13 @@ zesGetOverclockProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zesLoadAllDriverTables( drv );
+        if(drv.zesTablesLoaded)
+        {
+            // already filled by the driver's zesGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<zes_pfnGetOverclockProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zesGetOverclockProcAddrTable") );
         if(!getTable) 
@@ -4741,7 +4954,7 @@ zesGetOverclockProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnGetDomainProperties                      = loader::zesOverclockGetDomainProperties;
@@ -4806,6 +5019,13 @@ zesGetPerformanceFactorProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zesLoadAllDriverTables( drv );
+        if(drv.zesTablesLoaded)
+        {
+            // already filled by the driver's zesGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<zes_pfnGetPerformanceFactorProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zesGetPerformanceFactorProcAddrTable") );
         if(!getTable) 
@@ -4824,7 +5044,7 @@ zesGetPerformanceFactorProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnGetProperties                            = loader::zesPerformanceFactorGetProperties;
@@ -4883,6 +5103,13 @@ zesGetPowerProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zesLoadAllDriverTables( drv );
+        if(drv.zesTablesLoaded)
+        {
+            // already filled by the driver's zesGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<zes_pfnGetPowerProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zesGetPowerProcAddrTable") );
         if(!getTable) 
@@ -4901,7 +5128,7 @@ zesGetPowerProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnGetProperties                            = loader::zesPowerGetProperties;
@@ -4965,6 +5192,13 @@ zesGetPsuProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zesLoadAllDriverTables( drv );
+        if(drv.zesTablesLoaded)
+        {
+            // already filled by the driver's zesGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<zes_pfnGetPsuProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zesGetPsuProcAddrTable") );
         if(!getTable) 
@@ -4983,7 +5217,7 @@ zesGetPsuProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnGetProperties                            = loader::zesPsuGetProperties;
@@ -5041,6 +5275,13 @@ zesGetRasProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zesLoadAllDriverTables( drv );
+        if(drv.zesTablesLoaded)
+        {
+            // already filled by the driver's zesGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<zes_pfnGetRasProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zesGetRasProcAddrTable") );
         if(!getTable) 
@@ -5059,7 +5300,7 @@ zesGetRasProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnGetProperties                            = loader::zesRasGetProperties;
@@ -5119,6 +5360,13 @@ zesGetSchedulerProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zesLoadAllDriverTables( drv );
+        if(drv.zesTablesLoaded)
+        {
+            // already filled by the driver's zesGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<zes_pfnGetSchedulerProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zesGetSchedulerProcAddrTable") );
         if(!getTable) 
@@ -5137,7 +5385,7 @@ zesGetSchedulerProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnGetProperties                            = loader::zesSchedulerGetProperties;
@@ -5201,6 +5449,13 @@ zesGetStandbyProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zesLoadAllDriverTables( drv );
+        if(drv.zesTablesLoaded)
+        {
+            // already filled by the driver's zesGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<zes_pfnGetStandbyProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zesGetStandbyProcAddrTable") );
         if(!getTable) 
@@ -5219,7 +5474,7 @@ zesGetStandbyProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnGetProperties                            = loader::zesStandbyGetProperties;
@@ -5278,6 +5533,13 @@ zesGetTemperatureProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zesLoadAllDriverTables( drv );
+        if(drv.zesTablesLoaded)
+        {
+            // already filled by the driver's zesGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<zes_pfnGetTemperatureProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zesGetTemperatureProcAddrTable") );
         if(!getTable) 
@@ -5296,7 +5558,7 @@ zesGetTemperatureProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnGetProperties                            = loader::zesTemperatureGetProperties;
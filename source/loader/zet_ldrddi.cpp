@@ -45,7 +45,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hModule = reinterpret_cast<zet_module_object_t*>( hModule )->handle;
+        hModule = zet_module_object_t::unwrap( hModule, dditable );
 
         // forward to device-driver
         result = pfnGetDebugInfo( hModule, format, pSize, pDebugInfo );
@@ -70,7 +70,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zet_device_object_t*>( hDevice )->handle;
+        hDevice = zet_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnGetDebugProperties( hDevice, pDebugProperties );
@@ -96,7 +96,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zet_device_object_t*>( hDevice )->handle;
+        hDevice = zet_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnAttach( hDevice, config, phDebug );
@@ -107,8 +107,7 @@ namespace loader
         try
         {
             // convert driver handle to loader handle
-            *phDebug = reinterpret_cast<zet_debug_session_handle_t>(
-                zet_debug_session_factory.getInstance( *phDebug, dditable ) );
+            *phDebug = zet_debug_session_object_t::wrap( zet_debug_session_factory, *phDebug, dditable );
         }
         catch( std::bad_alloc& )
         {
@@ -133,8 +132,11 @@ namespace loader
         if( nullptr == pfnDetach )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // keep the loader handle, which tracks the loader handles created under it
+        auto hDebugLoader = hDebug;
+
         // convert loader handle to driver handle
-        hDebug = reinterpret_cast<zet_debug_session_object_t*>( hDebug )->handle;
+        hDebug = zet_debug_session_object_t::unwrap( hDebug, dditable );
 
         // forward to device-driver
         result = pfnDetach( hDebug );
@@ -143,7 +145,7 @@ namespace loader
             return result;
 
         // release loader handle
-        zet_debug_session_factory.release( hDebug );
+        zet_debug_session_object_t::release( zet_debug_session_factory, hDebugLoader, dditable );
 
         return result;
     }
@@ -172,7 +174,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDebug = reinterpret_cast<zet_debug_session_object_t*>( hDebug )->handle;
+        hDebug = zet_debug_session_object_t::unwrap( hDebug, dditable );
 
         // forward to device-driver
         result = pfnReadEvent( hDebug, timeout, event );
@@ -197,7 +199,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDebug = reinterpret_cast<zet_debug_session_object_t*>( hDebug )->handle;
+        hDebug = zet_debug_session_object_t::unwrap( hDebug, dditable );
 
         // forward to device-driver
         result = pfnAcknowledgeEvent( hDebug, event );
@@ -222,7 +224,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDebug = reinterpret_cast<zet_debug_session_object_t*>( hDebug )->handle;
+        hDebug = zet_debug_session_object_t::unwrap( hDebug, dditable );
 
         // forward to device-driver
         result = pfnInterrupt( hDebug, thread );
@@ -247,7 +249,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDebug = reinterpret_cast<zet_debug_session_object_t*>( hDebug )->handle;
+        hDebug = zet_debug_session_object_t::unwrap( hDebug, dditable );
 
         // forward to device-driver
         result = pfnResume( hDebug, thread );
@@ -275,7 +277,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDebug = reinterpret_cast<zet_debug_session_object_t*>( hDebug )->handle;
+        hDebug = zet_debug_session_object_t::unwrap( hDebug, dditable );
 
         // forward to device-driver
         result = pfnReadMemory( hDebug, thread, desc, size, buffer );
@@ -303,7 +305,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDebug = reinterpret_cast<zet_debug_session_object_t*>( hDebug )->handle;
+        hDebug = zet_debug_session_object_t::unwrap( hDebug, dditable );
 
         // forward to device-driver
         result = pfnWriteMemory( hDebug, thread, desc, size, buffer );
@@ -337,7 +339,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zet_device_object_t*>( hDevice )->handle;
+        hDevice = zet_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnGetRegisterSetProperties( hDevice, pCount, pRegisterSetProperties );
@@ -372,7 +374,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDebug = reinterpret_cast<zet_debug_session_object_t*>( hDebug )->handle;
+        hDebug = zet_debug_session_object_t::unwrap( hDebug, dditable );
 
         // forward to device-driver
         result = pfnGetThreadRegisterSetProperties( hDebug, thread, pCount, pRegisterSetProperties );
@@ -403,7 +405,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDebug = reinterpret_cast<zet_debug_session_object_t*>( hDebug )->handle;
+        hDebug = zet_debug_session_object_t::unwrap( hDebug, dditable );
 
         // forward to device-driver
         result = pfnReadRegisters( hDebug, thread, type, start, count, pRegisterValues );
@@ -434,7 +436,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDebug = reinterpret_cast<zet_debug_session_object_t*>( hDebug )->handle;
+        hDebug = zet_debug_session_object_t::unwrap( hDebug, dditable );
 
         // forward to device-driver
         result = pfnWriteRegisters( hDebug, thread, type, start, count, pRegisterValues );
@@ -467,7 +469,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zet_device_object_t*>( hDevice )->handle;
+        hDevice = zet_device_object_t::unwrap( hDevice, dditable );
 
         // forward to device-driver
         result = pfnGet( hDevice, pCount, phMetricGroups );
@@ -479,8 +481,7 @@ namespace loader
         {
             // convert driver handles to loader handles
             for( size_t i = 0; ( nullptr != phMetricGroups ) && ( i < *pCount ); ++i )
-                phMetricGroups[ i ] = reinterpret_cast<zet_metric_group_handle_t>(
-                    zet_metric_group_factory.getInstance( phMetricGroups[ i ], dditable ) );
+                phMetricGroups[ i ] = zet_metric_group_object_t::wrap( zet_metric_group_factory, phMetricGroups[ i ], dditable );
         }
         catch( std::bad_alloc& )
         {
@@ -507,7 +508,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hMetricGroup = reinterpret_cast<zet_metric_group_object_t*>( hMetricGroup )->handle;
+        hMetricGroup = zet_metric_group_object_t::unwrap( hMetricGroup, dditable );
 
         // forward to device-driver
         result = pfnGetProperties( hMetricGroup, pProperties );
@@ -543,7 +544,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hMetricGroup = reinterpret_cast<zet_metric_group_object_t*>( hMetricGroup )->handle;
+        hMetricGroup = zet_metric_group_object_t::unwrap( hMetricGroup, dditable );
 
         // forward to device-driver
         result = pfnCalculateMetricValues( hMetricGroup, type, rawDataSize, pRawData, pMetricValueCount, pMetricValues );
@@ -575,7 +576,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hMetricGroup = reinterpret_cast<zet_metric_group_object_t*>( hMetricGroup )->handle;
+        hMetricGroup = zet_metric_group_object_t::unwrap( hMetricGroup, dditable );
 
         // forward to device-driver
         result = pfnGet( hMetricGroup, pCount, phMetrics );
@@ -587,8 +588,7 @@ namespace loader
         {
             // convert driver handles to loader handles
             for( size_t i = 0; ( nullptr != phMetrics ) && ( i < *pCount ); ++i )
-                phMetrics[ i ] = reinterpret_cast<zet_metric_handle_t>(
-                    zet_metric_factory.getInstance( phMetrics[ i ], dditable ) );
+                phMetrics[ i ] = zet_metric_object_t::wrap( zet_metric_factory, phMetrics[ i ], dditable );
         }
         catch( std::bad_alloc& )
         {
@@ -615,7 +615,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hMetric = reinterpret_cast<zet_metric_object_t*>( hMetric )->handle;
+        hMetric = zet_metric_object_t::unwrap( hMetric, dditable );
 
         // forward to device-driver
         result = pfnGetProperties( hMetric, pProperties );
@@ -646,19 +646,18 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<zet_context_object_t*>( hContext )->handle;
+        hContext = zet_context_object_t::unwrap( hContext, dditable );
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zet_device_object_t*>( hDevice )->handle;
+        hDevice = zet_device_object_t::unwrap( hDevice, dditable );
 
         // convert loader handles to driver handles
-        auto phMetricGroupsLocal = new zet_metric_group_handle_t [count];
+        handle_array_t<zet_metric_group_handle_t> phMetricGroupsLocal( count );
         for( size_t i = 0; ( nullptr != phMetricGroups ) && ( i < count ); ++i )
-            phMetricGroupsLocal[ i ] = reinterpret_cast<zet_metric_group_object_t*>( phMetricGroups[ i ] )->handle;
+            phMetricGroupsLocal[ i ] = zet_metric_group_object_t::unwrap( phMetricGroups[ i ], dditable );
 
         // forward to device-driver
         result = pfnActivateMetricGroups( hContext, hDevice, count, phMetricGroupsLocal );
-        delete []phMetricGroupsLocal;
 
         return result;
     }
@@ -683,17 +682,20 @@ namespace loader
         if( nullptr == pfnOpen )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // keep the loader handle, which tracks the loader handles created under it
+        auto hContextLoader = hContext;
+
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<zet_context_object_t*>( hContext )->handle;
+        hContext = zet_context_object_t::unwrap( hContext, dditable );
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zet_device_object_t*>( hDevice )->handle;
+        hDevice = zet_device_object_t::unwrap( hDevice, dditable );
 
         // convert loader handle to driver handle
-        hMetricGroup = reinterpret_cast<zet_metric_group_object_t*>( hMetricGroup )->handle;
+        hMetricGroup = zet_metric_group_object_t::unwrap( hMetricGroup, dditable );
 
         // convert loader handle to driver handle
-        hNotificationEvent = ( hNotificationEvent ) ? reinterpret_cast<ze_event_object_t*>( hNotificationEvent )->handle : nullptr;
+        hNotificationEvent = ( hNotificationEvent ) ? ze_event_object_t::unwrap( hNotificationEvent, dditable ) : nullptr;
 
         // forward to device-driver
         result = pfnOpen( hContext, hDevice, hMetricGroup, desc, hNotificationEvent, phMetricStreamer );
@@ -704,8 +706,7 @@ namespace loader
         try
         {
             // convert driver handle to loader handle
-            *phMetricStreamer = reinterpret_cast<zet_metric_streamer_handle_t>(
-                zet_metric_streamer_factory.getInstance( *phMetricStreamer, dditable ) );
+            *phMetricStreamer = zet_metric_streamer_object_t::wrap( zet_metric_streamer_factory, *phMetricStreamer, dditable, zet_context_object_t::owner( hContextLoader, dditable ) );
         }
         catch( std::bad_alloc& )
         {
@@ -733,10 +734,10 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hCommandList = reinterpret_cast<zet_command_list_object_t*>( hCommandList )->handle;
+        hCommandList = zet_command_list_object_t::unwrap( hCommandList, dditable );
 
         // convert loader handle to driver handle
-        hMetricStreamer = reinterpret_cast<zet_metric_streamer_object_t*>( hMetricStreamer )->handle;
+        hMetricStreamer = zet_metric_streamer_object_t::unwrap( hMetricStreamer, dditable );
 
         // forward to device-driver
         result = pfnAppendMetricStreamerMarker( hCommandList, hMetricStreamer, value );
@@ -759,8 +760,11 @@ namespace loader
         if( nullptr == pfnClose )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // keep the loader handle, which tracks the loader handles created under it
+        auto hMetricStreamerLoader = hMetricStreamer;
+
         // convert loader handle to driver handle
-        hMetricStreamer = reinterpret_cast<zet_metric_streamer_object_t*>( hMetricStreamer )->handle;
+        hMetricStreamer = zet_metric_streamer_object_t::unwrap( hMetricStreamer, dditable );
 
         // forward to device-driver
         result = pfnClose( hMetricStreamer );
@@ -769,7 +773,7 @@ namespace loader
             return result;
 
         // release loader handle
-        zet_metric_streamer_factory.release( hMetricStreamer );
+        zet_metric_streamer_object_t::release( zet_metric_streamer_factory, hMetricStreamerLoader, dditable );
 
         return result;
     }
@@ -801,7 +805,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hMetricStreamer = reinterpret_cast<zet_metric_streamer_object_t*>( hMetricStreamer )->handle;
+        hMetricStreamer = zet_metric_streamer_object_t::unwrap( hMetricStreamer, dditable );
 
         // forward to device-driver
         result = pfnReadData( hMetricStreamer, maxReportCount, pRawDataSize, pRawData );
@@ -828,14 +832,17 @@ namespace loader
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // keep the loader handle, which tracks the loader handles created under it
+        auto hContextLoader = hContext;
+
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<zet_context_object_t*>( hContext )->handle;
+        hContext = zet_context_object_t::unwrap( hContext, dditable );
 
         // convert loader handle to driver handle
-        hDevice = reinterpret_cast<zet_device_object_t*>( hDevice )->handle;
+        hDevice = zet_device_object_t::unwrap( hDevice, dditable );
 
         // convert loader handle to driver handle
-        hMetricGroup = reinterpret_cast<zet_metric_group_object_t*>( hMetricGroup )->handle;
+        hMetricGroup = zet_metric_group_object_t::unwrap( hMetricGroup, dditable );
 
         // forward to device-driver
         result = pfnCreate( hContext, hDevice, hMetricGroup, desc, phMetricQueryPool );
@@ -846,8 +853,7 @@ namespace loader
         try
         {
             // convert driver handle to loader handle
-            *phMetricQueryPool = reinterpret_cast<zet_metric_query_pool_handle_t>(
-                zet_metric_query_pool_factory.getInstance( *phMetricQueryPool, dditable ) );
+            *phMetricQueryPool = zet_metric_query_pool_object_t::wrap( zet_metric_query_pool_factory, *phMetricQueryPool, dditable, zet_context_object_t::owner( hContextLoader, dditable ) );
         }
         catch( std::bad_alloc& )
         {
@@ -872,8 +878,11 @@ namespace loader
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // keep the loader handle, which tracks the loader handles created under it
+        auto hMetricQueryPoolLoader = hMetricQueryPool;
+
         // convert loader handle to driver handle
-        hMetricQueryPool = reinterpret_cast<zet_metric_query_pool_object_t*>( hMetricQueryPool )->handle;
+        hMetricQueryPool = zet_metric_query_pool_object_t::unwrap( hMetricQueryPool, dditable );
 
         // forward to device-driver
         result = pfnDestroy( hMetricQueryPool );
@@ -882,7 +891,7 @@ namespace loader
             return result;
 
         // release loader handle
-        zet_metric_query_pool_factory.release( hMetricQueryPool );
+        zet_metric_query_pool_object_t::release( zet_metric_query_pool_factory, hMetricQueryPoolLoader, dditable );
 
         return result;
     }
@@ -904,8 +913,11 @@ namespace loader
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // keep the loader handle, which tracks the loader handles created under it
+        auto hMetricQueryPoolLoader = hMetricQueryPool;
+
         // convert loader handle to driver handle
-        hMetricQueryPool = reinterpret_cast<zet_metric_query_pool_object_t*>( hMetricQueryPool )->handle;
+        hMetricQueryPool = zet_metric_query_pool_object_t::unwrap( hMetricQueryPool, dditable );
 
         // forward to device-driver
         result = pfnCreate( hMetricQueryPool, index, phMetricQuery );
@@ -916,8 +928,7 @@ namespace loader
         try
         {
             // convert driver handle to loader handle
-            *phMetricQuery = reinterpret_cast<zet_metric_query_handle_t>(
-                zet_metric_query_factory.getInstance( *phMetricQuery, dditable ) );
+            *phMetricQuery = zet_metric_query_object_t::wrap( zet_metric_query_factory, *phMetricQuery, dditable, zet_metric_query_pool_object_t::owner( hMetricQueryPoolLoader, dditable ) );
         }
         catch( std::bad_alloc& )
         {
@@ -942,8 +953,11 @@ namespace loader
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // keep the loader handle, which tracks the loader handles created under it
+        auto hMetricQueryLoader = hMetricQuery;
+
         // convert loader handle to driver handle
-        hMetricQuery = reinterpret_cast<zet_metric_query_object_t*>( hMetricQuery )->handle;
+        hMetricQuery = zet_metric_query_object_t::unwrap( hMetricQuery, dditable );
 
         // forward to device-driver
         result = pfnDestroy( hMetricQuery );
@@ -952,7 +966,7 @@ namespace loader
             return result;
 
         // release loader handle
-        zet_metric_query_factory.release( hMetricQuery );
+        zet_metric_query_object_t::release( zet_metric_query_factory, hMetricQueryLoader, dditable );
 
         return result;
     }
@@ -973,7 +987,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hMetricQuery = reinterpret_cast<zet_metric_query_object_t*>( hMetricQuery )->handle;
+        hMetricQuery = zet_metric_query_object_t::unwrap( hMetricQuery, dditable );
 
         // forward to device-driver
         result = pfnReset( hMetricQuery );
@@ -998,10 +1012,10 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hCommandList = reinterpret_cast<zet_command_list_object_t*>( hCommandList )->handle;
+        hCommandList = zet_command_list_object_t::unwrap( hCommandList, dditable );
 
         // convert loader handle to driver handle
-        hMetricQuery = reinterpret_cast<zet_metric_query_object_t*>( hMetricQuery )->handle;
+        hMetricQuery = zet_metric_query_object_t::unwrap( hMetricQuery, dditable );
 
         // forward to device-driver
         result = pfnAppendMetricQueryBegin( hCommandList, hMetricQuery );
@@ -1029,13 +1043,13 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hCommandList = reinterpret_cast<zet_command_list_object_t*>( hCommandList )->handle;
+        hCommandList = zet_command_list_object_t::unwrap( hCommandList, dditable );
 
         // convert loader handle to driver handle
-        hMetricQuery = reinterpret_cast<zet_metric_query_object_t*>( hMetricQuery )->handle;
+        hMetricQuery = zet_metric_query_object_t::unwrap( hMetricQuery, dditable );
 
         // convert loader handle to driver handle
-        hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
+        hSignalEvent = ( hSignalEvent ) ? ze_event_object_t::unwrap( hSignalEvent, dditable ) : nullptr;
 
         // forward to device-driver
         result = pfnAppendMetricQueryEnd( hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents );
@@ -1059,7 +1073,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hCommandList = reinterpret_cast<zet_command_list_object_t*>( hCommandList )->handle;
+        hCommandList = zet_command_list_object_t::unwrap( hCommandList, dditable );
 
         // forward to device-driver
         result = pfnAppendMetricMemoryBarrier( hCommandList );
@@ -1092,7 +1106,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hMetricQuery = reinterpret_cast<zet_metric_query_object_t*>( hMetricQuery )->handle;
+        hMetricQuery = zet_metric_query_object_t::unwrap( hMetricQuery, dditable );
 
         // forward to device-driver
         result = pfnGetData( hMetricQuery, pRawDataSize, pRawData );
@@ -1117,7 +1131,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hKernel = reinterpret_cast<zet_kernel_object_t*>( hKernel )->handle;
+        hKernel = zet_kernel_object_t::unwrap( hKernel, dditable );
 
         // forward to device-driver
         result = pfnGetProfileInfo( hKernel, pProfileProperties );
@@ -1142,8 +1156,11 @@ namespace loader
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // keep the loader handle, which tracks the loader handles created under it
+        auto hContextLoader = hContext;
+
         // convert loader handle to driver handle
-        hContext = reinterpret_cast<zet_context_object_t*>( hContext )->handle;
+        hContext = zet_context_object_t::unwrap( hContext, dditable );
 
         // forward to device-driver
         result = pfnCreate( hContext, desc, phTracer );
@@ -1154,8 +1171,7 @@ namespace loader
         try
         {
             // convert driver handle to loader handle
-            *phTracer = reinterpret_cast<zet_tracer_exp_handle_t>(
-                zet_tracer_exp_factory.getInstance( *phTracer, dditable ) );
+            *phTracer = zet_tracer_exp_object_t::wrap( zet_tracer_exp_factory, *phTracer, dditable, zet_context_object_t::owner( hContextLoader, dditable ) );
         }
         catch( std::bad_alloc& )
         {
@@ -1180,8 +1196,11 @@ namespace loader
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
+        // keep the loader handle, which tracks the loader handles created under it
+        auto hTracerLoader = hTracer;
+
         // convert loader handle to driver handle
-        hTracer = reinterpret_cast<zet_tracer_exp_object_t*>( hTracer )->handle;
+        hTracer = zet_tracer_exp_object_t::unwrap( hTracer, dditable );
 
         // forward to device-driver
         result = pfnDestroy( hTracer );
@@ -1190,7 +1209,7 @@ namespace loader
             return result;
 
         // release loader handle
-        zet_tracer_exp_factory.release( hTracer );
+        zet_tracer_exp_object_t::release( zet_tracer_exp_factory, hTracerLoader, dditable );
 
         return result;
     }
@@ -1212,7 +1231,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hTracer = reinterpret_cast<zet_tracer_exp_object_t*>( hTracer )->handle;
+        hTracer = zet_tracer_exp_object_t::unwrap( hTracer, dditable );
 
         // forward to device-driver
         result = pfnSetPrologues( hTracer, pCoreCbs );
@@ -1237,7 +1256,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hTracer = reinterpret_cast<zet_tracer_exp_object_t*>( hTracer )->handle;
+        hTracer = zet_tracer_exp_object_t::unwrap( hTracer, dditable );
 
         // forward to device-driver
         result = pfnSetEpilogues( hTracer, pCoreCbs );
@@ -1262,7 +1281,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hTracer = reinterpret_cast<zet_tracer_exp_object_t*>( hTracer )->handle;
+        hTracer = zet_tracer_exp_object_t::unwrap( hTracer, dditable );
 
         // forward to device-driver
         result = pfnSetEnabled( hTracer, enable );
@@ -1308,7 +1327,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hMetricGroup = reinterpret_cast<zet_metric_group_object_t*>( hMetricGroup )->handle;
+        hMetricGroup = zet_metric_group_object_t::unwrap( hMetricGroup, dditable );
 
         // forward to device-driver
         result = pfnCalculateMultipleMetricValuesExp( hMetricGroup, type, rawDataSize, pRawData, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
@@ -1335,7 +1354,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
 
         // convert loader handle to driver handle
-        hMetricGroup = reinterpret_cast<zet_metric_group_object_t*>( hMetricGroup )->handle;
+        hMetricGroup = zet_metric_group_object_t::unwrap( hMetricGroup, dditable );
 
         // forward to device-driver
         result = pfnGetGlobalTimestampsExp( hMetricGroup, synchronizedWithHost, globalTimestamp, metricTimestamp );
@@ -1343,6 +1362,119 @@ namespace loader
         return result;
     }
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// fills the zet tables of a driver through its optional bulk export, once,
+    /// when they are first requested; tables of drivers without it are looked
+    /// up one by one
+    static void zetLoadAllDriverTables( driver_t& drv )
+    {
+        if( drv.zetAllTablesRequested )
+            return;
+        drv.zetAllTablesRequested = true;
+
+        auto getAllTables = reinterpret_cast<zel_pfnGetAllProcAddrTables_t>(
+            GET_FUNCTION_PTR( drv.handle, "zetGetAllProcAddrTables") );
+        if( !getAllTables )
+            return;
+
+        const char *tableNames[] = {
+            "zetGetDeviceProcAddrTable",
+            "zetGetContextProcAddrTable",
+            "zetGetCommandListProcAddrTable",
+            "zetGetKernelProcAddrTable",
+            "zetGetModuleProcAddrTable",
+            "zetGetDebugProcAddrTable",
+            "zetGetMetricProcAddrTable",
+            "zetGetMetricGroupProcAddrTable",
+            "zetGetMetricGroupExpProcAddrTable",
+            "zetGetMetricQueryProcAddrTable",
+            "zetGetMetricQueryPoolProcAddrTable",
+            "zetGetMetricStreamerProcAddrTable",
+            "zetGetTracerExpProcAddrTable",
+        };
+        void *tables[] = {
+            &drv.dditable.zet.Device,
+            &drv.dditable.zet.Context,
+            &drv.dditable.zet.CommandList,
+            &drv.dditable.zet.Kernel,
+            &drv.dditable.zet.Module,
+            &drv.dditable.zet.Debug,
+            &drv.dditable.zet.Metric,
+            &drv.dditable.zet.MetricGroup,
+            &drv.dditable.zet.MetricGroupExp,
+            &drv.dditable.zet.MetricQuery,
+            &drv.dditable.zet.MetricQueryPool,
+            &drv.dditable.zet.MetricStreamer,
+            &drv.dditable.zet.TracerExp,
+        };
+        auto count = static_cast<uint32_t>( sizeof( tables ) / sizeof( tables[ 0 ] ) );
+        drv.zetTablesLoaded = ( ZE_RESULT_SUCCESS == getAllTables( loader::context->version, count, tableNames, tables ) );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// fills the tables of a driver loaded by a later zeInit, after the
+    /// exports below may already have run
+    void zetLoadDriverTables( driver_t& drv )
+    {
+        zetLoadAllDriverTables( drv );
+        if( drv.zetTablesLoaded )
+            return;
+
+        auto getDeviceTable = reinterpret_cast<zet_pfnGetDeviceProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zetGetDeviceProcAddrTable") );
+        if( getDeviceTable )
+            getDeviceTable( loader::context->version, &drv.dditable.zet.Device );
+        auto getContextTable = reinterpret_cast<zet_pfnGetContextProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zetGetContextProcAddrTable") );
+        if( getContextTable )
+            getContextTable( loader::context->version, &drv.dditable.zet.Context );
+        auto getCommandListTable = reinterpret_cast<zet_pfnGetCommandListProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zetGetCommandListProcAddrTable") );
+        if( getCommandListTable )
+            getCommandListTable( loader::context->version, &drv.dditable.zet.CommandList );
+        auto getKernelTable = reinterpret_cast<zet_pfnGetKernelProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zetGetKernelProcAddrTable") );
+        if( getKernelTable )
+            getKernelTable( loader::context->version, &drv.dditable.zet.Kernel );
+        auto getModuleTable = reinterpret_cast<zet_pfnGetModuleProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zetGetModuleProcAddrTable") );
+        if( getModuleTable )
+            getModuleTable( loader::context->version, &drv.dditable.zet.Module );
+        auto getDebugTable = reinterpret_cast<zet_pfnGetDebugProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zetGetDebugProcAddrTable") );
+        if( getDebugTable )
+            getDebugTable( loader::context->version, &drv.dditable.zet.Debug );
+        auto getMetricTable = reinterpret_cast<zet_pfnGetMetricProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zetGetMetricProcAddrTable") );
+        if( getMetricTable )
+            getMetricTable( loader::context->version, &drv.dditable.zet.Metric );
+        auto getMetricGroupTable = reinterpret_cast<zet_pfnGetMetricGroupProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zetGetMetricGroupProcAddrTable") );
+        if( getMetricGroupTable )
+            getMetricGroupTable( loader::context->version, &drv.dditable.zet.MetricGroup );
+        auto getMetricGroupExpTable = reinterpret_cast<zet_pfnGetMetricGroupExpProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zetGetMetricGroupExpProcAddrTable") );
+        if( getMetricGroupExpTable )
+            getMetricGroupExpTable( loader::context->version, &drv.dditable.zet.MetricGroupExp );
+        auto getMetricQueryTable = reinterpret_cast<zet_pfnGetMetricQueryProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zetGetMetricQueryProcAddrTable") );
+        if( getMetricQueryTable )
+            getMetricQueryTable( loader::context->version, &drv.dditable.zet.MetricQuery );
+        auto getMetricQueryPoolTable = reinterpret_cast<zet_pfnGetMetricQueryPoolProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zetGetMetricQueryPoolProcAddrTable") );
+        if( getMetricQueryPoolTable )
+            getMetricQueryPoolTable( loader::context->version, &drv.dditable.zet.MetricQueryPool );
+        auto getMetricStreamerTable = reinterpret_cast<zet_pfnGetMetricStreamerProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zetGetMetricStreamerProcAddrTable") );
+        if( getMetricStreamerTable )
+            getMetricStreamerTable( loader::context->version, &drv.dditable.zet.MetricStreamer );
+        auto getTracerExpTable = reinterpret_cast<zet_pfnGetTracerExpProcAddrTable_t>(
+            GET_FUNCTION_PTR( drv.handle, "zetGetTracerExpProcAddrTable") );
+        if( getTracerExpTable )
+            getTracerExpTable( loader::context->version, &drv.dditable.zet.TracerExp );
+        drv.zetTablesLoaded = true;
+    }
+
 } // namespace loader
 
 #if defined(__cplusplus)
@@ -1381,6 +1513,13 @@ zetGetDeviceProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zetLoadAllDriverTables( drv );
+        if(drv.zetTablesLoaded)
+        {
+            // already filled by the driver's zetGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<zet_pfnGetDeviceProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zetGetDeviceProcAddrTable") );
         if(!getTable) 
@@ -1399,7 +1538,7 @@ zetGetDeviceProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnGetDebugProperties                       = loader::zetDeviceGetDebugProperties;
@@ -1456,6 +1595,13 @@ zetGetContextProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zetLoadAllDriverTables( drv );
+        if(drv.zetTablesLoaded)
+        {
+            // already filled by the driver's zetGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<zet_pfnGetContextProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zetGetContextProcAddrTable") );
         if(!getTable) 
@@ -1474,7 +1620,7 @@ zetGetContextProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnActivateMetricGroups                     = loader::zetContextActivateMetricGroups;
@@ -1531,6 +1677,13 @@ zetGetCommandListProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zetLoadAllDriverTables( drv );
+        if(drv.zetTablesLoaded)
+        {
+            // already filled by the driver's zetGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<zet_pfnGetCommandListProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zetGetCommandListProcAddrTable") );
         if(!getTable) 
@@ -1549,7 +1702,7 @@ zetGetCommandListProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnAppendMetricStreamerMarker               = loader::zetCommandListAppendMetricStreamerMarker;
@@ -1609,6 +1762,13 @@ zetGetKernelProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zetLoadAllDriverTables( drv );
+        if(drv.zetTablesLoaded)
+        {
+            // already filled by the driver's zetGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<zet_pfnGetKernelProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zetGetKernelProcAddrTable") );
         if(!getTable) 
@@ -1627,7 +1787,7 @@ zetGetKernelProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnGetProfileInfo                           = loader::zetKernelGetProfileInfo;
@@ -1684,6 +1844,13 @@ zetGetModuleProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zetLoadAllDriverTables( drv );
+        if(drv.zetTablesLoaded)
+        {
+            // already filled by the driver's zetGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<zet_pfnGetModuleProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zetGetModuleProcAddrTable") );
         if(!getTable) 
@@ -1702,7 +1869,7 @@ zetGetModuleProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnGetDebugInfo                             = loader::zetModuleGetDebugInfo;
@@ -1759,6 +1926,13 @@ zetGetDebugProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zetLoadAllDriverTables( drv );
+        if(drv.zetTablesLoaded)
+        {
+            // already filled by the driver's zetGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<zet_pfnGetDebugProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zetGetDebugProcAddrTable") );
         if(!getTable) 
@@ -1777,7 +1951,7 @@ zetGetDebugProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnAttach                                   = loader::zetDebugAttach;
@@ -1845,6 +2019,13 @@ zetGetMetricProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zetLoadAllDriverTables( drv );
+        if(drv.zetTablesLoaded)
+        {
+            // already filled by the driver's zetGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<zet_pfnGetMetricProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zetGetMetricProcAddrTable") );
         if(!getTable) 
@@ -1863,7 +2044,7 @@ zetGetMetricProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnGet                                      = loader::zetMetricGet;
@@ -1921,6 +2102,13 @@ zetGetMetricGroupProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zetLoadAllDriverTables( drv );
+        if(drv.zetTablesLoaded)
+        {
+            // already filled by the driver's zetGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<zet_pfnGetMetricGroupProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zetGetMetricGroupProcAddrTable") );
         if(!getTable) 
@@ -1939,7 +2127,7 @@ zetGetMetricGroupProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnGet                                      = loader::zetMetricGroupGet;
@@ -1998,6 +2186,13 @@ zetGetMetricGroupExpProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zetLoadAllDriverTables( drv );
+        if(drv.zetTablesLoaded)
+        {
+            // already filled by the driver's zetGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<zet_pfnGetMetricGroupExpProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zetGetMetricGroupExpProcAddrTable") );
         if(!getTable) 
@@ -2010,7 +2205,7 @@ zetGetMetricGroupExpProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnCalculateMultipleMetricValuesExp         = loader::zetMetricGroupCalculateMultipleMetricValuesExp;
@@ -2068,6 +2263,13 @@ zetGetMetricQueryProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zetLoadAllDriverTables( drv );
+        if(drv.zetTablesLoaded)
+        {
+            // already filled by the driver's zetGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<zet_pfnGetMetricQueryProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zetGetMetricQueryProcAddrTable") );
         if(!getTable) 
@@ -2086,7 +2288,7 @@ zetGetMetricQueryProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnCreate                                   = loader::zetMetricQueryCreate;
@@ -2146,6 +2348,13 @@ zetGetMetricQueryPoolProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zetLoadAllDriverTables( drv );
+        if(drv.zetTablesLoaded)
+        {
+            // already filled by the driver's zetGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<zet_pfnGetMetricQueryPoolProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zetGetMetricQueryPoolProcAddrTable") );
         if(!getTable) 
@@ -2164,7 +2373,7 @@ zetGetMetricQueryPoolProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnCreate                                   = loader::zetMetricQueryPoolCreate;
@@ -2222,6 +2431,13 @@ zetGetMetricStreamerProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zetLoadAllDriverTables( drv );
+        if(drv.zetTablesLoaded)
+        {
+            // already filled by the driver's zetGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<zet_pfnGetMetricStreamerProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zetGetMetricStreamerProcAddrTable") );
         if(!getTable) 
@@ -2240,7 +2456,7 @@ zetGetMetricStreamerProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnOpen                                     = loader::zetMetricStreamerOpen;
@@ -2299,6 +2515,13 @@ zetGetTracerExpProcAddrTable(
     {
         if(drv.initStatus != ZE_RESULT_SUCCESS)
             continue;
+        loader::zetLoadAllDriverTables( drv );
+        if(drv.zetTablesLoaded)
+        {
+            // already filled by the driver's zetGetAllProcAddrTables
+            atLeastOneDriverValid = true;
+            continue;
+        }
         auto getTable = reinterpret_cast<zet_pfnGetTracerExpProcAddrTable_t>(
             GET_FUNCTION_PTR( drv.handle, "zetGetTracerExpProcAddrTable") );
         if(!getTable) 
@@ -2317,7 +2540,7 @@ zetGetTracerExpProcAddrTable(
 
     if( ZE_RESULT_SUCCESS == result )
     {
-        if( ( loader::context->drivers.size() > 1 ) || loader::context->forceIntercept )
+        if( loader::context->intercept_enabled )
         {
             // return pointers to loader's DDIs
             pDdiTable->pfnCreate                                   = loader::zetTracerExpCreate;
@@ -0,0 +1,130 @@
+/*
+ *
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// TEST DESCRIPTION: the driver-discovery cache forgets drivers that appear
+//
+// Runs itself as child processes that call zeInit with the loader's driver
+// cache enabled and report how many drivers they found. A driver library
+// that was missing is recorded in the cache, and must be loaded again as soon
+// as it appears, whether at the path it was enabled by or in a directory
+// added to the library search path.
+
+#include "test_util.h"
+
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+//////////////////////////////////////////////////////////////////////////
+static std::string program;
+static std::string cachePath;
+static std::string driverDirectory;
+static std::string searchPath;
+
+//////////////////////////////////////////////////////////////////////////
+static void set_env( const char *name, const std::string &value )
+{
+    setenv( name, value.c_str(), 1 );
+}
+
+static std::string read_file( const std::string &path )
+{
+    std::ifstream file( path, std::ios::binary );
+    return std::string( std::istreambuf_iterator<char>( file ), std::istreambuf_iterator<char>() );
+}
+
+static void copy_file( const std::string &from, const std::string &to )
+{
+    std::ofstream file( to, std::ios::binary | std::ios::trunc );
+    file << read_file( from );
+    TEST_CHECK( file.flush() );
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// number of drivers found by a child process
+static int child_drivers()
+{
+    int status = system( ( "\"" + program + "\" child" ).c_str() );
+    TEST_CHECK( WIFEXITED( status ) );
+    TEST_CHECK( WEXITSTATUS( status ) < 100 );
+    return WEXITSTATUS( status );
+}
+
+static int run_child()
+{
+    if( ZE_RESULT_SUCCESS != zeInit( 0 ) )
+        return 100;
+    uint32_t count = 0;
+    if( ZE_RESULT_SUCCESS != zeDriverGet( &count, nullptr ) )
+        return 100;
+    return static_cast<int>( count );
+}
+
+//////////////////////////////////////////////////////////////////////////
+static void test_path_appears()
+{
+    auto lateDriver = driverDirectory + "/libze_null_late.so";
+    remove( cachePath.c_str() );
+    remove( lateDriver.c_str() );
+    set_env( "ZE_ENABLE_ALT_DRIVERS", std::string( NULL_DRIVER_PATH ) + "," + lateDriver );
+
+    TEST_CHECK( child_drivers() == 1 );
+    TEST_CHECK( read_file( cachePath ).find( lateDriver ) != std::string::npos );
+    TEST_CHECK( child_drivers() == 1 );
+
+    copy_file( NULL_DRIVER_PATH, lateDriver );
+    TEST_CHECK( child_drivers() == 2 );
+    TEST_CHECK( child_drivers() == 2 );
+
+    remove( lateDriver.c_str() );
+    TEST_CHECK( child_drivers() == 1 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+static void test_search_path_changes()
+{
+    remove( cachePath.c_str() );
+    copy_file( NULL_DRIVER_PATH, driverDirectory + "/libze_null_late.so" );
+    set_env( "ZE_ENABLE_ALT_DRIVERS", std::string( NULL_DRIVER_PATH ) + ",libze_null_late.so" );
+
+    TEST_CHECK( child_drivers() == 1 );
+    TEST_CHECK( read_file( cachePath ).find( "libze_null_late.so" ) != std::string::npos );
+
+    set_env( "LD_LIBRARY_PATH", driverDirectory + ":" + searchPath );
+    TEST_CHECK( child_drivers() == 2 );
+
+    set_env( "LD_LIBRARY_PATH", searchPath );
+    remove( ( driverDirectory + "/libze_null_late.so" ).c_str() );
+}
+
+int main( int argc, char *argv[] )
+{
+    if( argc > 1 && std::string( argv[ 1 ] ) == "child" )
+        return run_child();
+
+    program = argv[ 0 ];
+    cachePath = program + ".driver_cache";
+    driverDirectory = program + ".drivers";
+    mkdir( driverDirectory.c_str(), 0700 );
+    const char *libraryPath = getenv( "LD_LIBRARY_PATH" );
+    searchPath = libraryPath ? libraryPath : "";
+
+    set_env( "ZE_ENABLE_NULL_DRIVER", "0" );
+    set_env( "ZE_ENABLE_LOADER_DRIVER_CACHE", "1" );
+    set_env( "ZE_LOADER_DRIVER_CACHE_PATH", cachePath );
+
+    test_path_appears();
+    test_search_path_changes();
+
+    remove( cachePath.c_str() );
+    rmdir( driverDirectory.c_str() );
+    std::cout << "PASSED" << std::endl;
+    return 0;
+}
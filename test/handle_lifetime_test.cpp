@@ -0,0 +1,172 @@
+/*
+ *
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// TEST DESCRIPTION: the validation layer tracks handle lifetimes across threads
+//
+// Run with the validation layer checking handle lifetimes. Destroyed handles
+// and closed command lists must be rejected. Threads creating, using and
+// destroying events and command lists at once must never see one of their
+// live handles rejected, nor a handle shared by all threads for the whole
+// run, however many destroyed handles the lifetime tables went through, and
+// command lists must keep their open or closed state as the tables grow.
+
+#include "test_util.h"
+
+#include <thread>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////
+static ze_event_handle_t create_event( ze_event_pool_handle_t pool, uint32_t index )
+{
+    ze_event_desc_t eventDesc = { ZE_STRUCTURE_TYPE_EVENT_DESC, nullptr, index, 0, 0 };
+    ze_event_handle_t event = nullptr;
+    TEST_SUCCESS( zeEventCreate( pool, &eventDesc, &event ) );
+    return event;
+}
+
+static ze_event_pool_handle_t create_pool( test_context_t &test, uint32_t count )
+{
+    ze_event_pool_desc_t poolDesc = { ZE_STRUCTURE_TYPE_EVENT_POOL_DESC, nullptr, 0, count };
+    ze_event_pool_handle_t pool = nullptr;
+    TEST_SUCCESS( zeEventPoolCreate( test.context, &poolDesc, 1, &test.device, &pool ) );
+    return pool;
+}
+
+static ze_command_list_handle_t create_command_list( test_context_t &test )
+{
+    ze_command_list_desc_t listDesc = { ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC, nullptr, 0, 0 };
+    ze_command_list_handle_t commandList = nullptr;
+    TEST_SUCCESS( zeCommandListCreate( test.context, test.device, &listDesc, &commandList ) );
+    return commandList;
+}
+
+//////////////////////////////////////////////////////////////////////////
+static void test_rejected( test_context_t &test )
+{
+    auto pool = create_pool( test, 1 );
+    auto event = create_event( pool, 0 );
+    TEST_SUCCESS( zeEventHostSignal( event ) );
+    TEST_SUCCESS( zeEventDestroy( event ) );
+    TEST_CHECK( ZE_RESULT_ERROR_INVALID_NULL_HANDLE == zeEventHostSignal( event ) );
+
+    event = create_event( pool, 0 );
+    auto commandList = create_command_list( test );
+    TEST_SUCCESS( zeCommandListAppendSignalEvent( commandList, event ) );
+    TEST_SUCCESS( zeCommandListClose( commandList ) );
+    TEST_CHECK( ZE_RESULT_ERROR_INVALID_ARGUMENT == zeCommandListAppendSignalEvent( commandList, event ) );
+    TEST_SUCCESS( zeCommandListDestroy( commandList ) );
+    TEST_CHECK( ZE_RESULT_ERROR_INVALID_NULL_HANDLE == zeCommandListClose( commandList ) );
+
+    TEST_SUCCESS( zeEventDestroy( event ) );
+    TEST_SUCCESS( zeEventPoolDestroy( pool ) );
+    TEST_CHECK( ZE_RESULT_ERROR_INVALID_NULL_HANDLE == zeEventPoolDestroy( pool ) );
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// the lifetime tables recycle the slots of destroyed handles and move live
+/// handles along with their state when they grow
+static void test_table_reuse( test_context_t &test )
+{
+    auto pool = create_pool( test, 1 );
+    auto event = create_event( pool, 0 );
+    auto openList = create_command_list( test );
+    auto closedList = create_command_list( test );
+    TEST_SUCCESS( zeCommandListClose( closedList ) );
+
+    for( int i = 0; i < 20000; ++i )
+    {
+        auto commandList = create_command_list( test );
+        TEST_SUCCESS( zeCommandListAppendSignalEvent( commandList, event ) );
+        TEST_SUCCESS( zeCommandListDestroy( commandList ) );
+        TEST_CHECK( ZE_RESULT_ERROR_INVALID_NULL_HANDLE == zeCommandListClose( commandList ) );
+    }
+
+    std::vector<ze_command_list_handle_t> commandLists;
+    for( int i = 0; i < 4096; ++i )
+        commandLists.push_back( create_command_list( test ) );
+    for( auto commandList : commandLists )
+        TEST_SUCCESS( zeCommandListAppendSignalEvent( commandList, event ) );
+    for( auto commandList : commandLists )
+        TEST_SUCCESS( zeCommandListDestroy( commandList ) );
+
+    TEST_SUCCESS( zeCommandListAppendSignalEvent( openList, event ) );
+    TEST_CHECK( ZE_RESULT_ERROR_INVALID_ARGUMENT == zeCommandListAppendSignalEvent( closedList, event ) );
+
+    TEST_SUCCESS( zeCommandListDestroy( closedList ) );
+    TEST_SUCCESS( zeCommandListDestroy( openList ) );
+    TEST_SUCCESS( zeEventDestroy( event ) );
+    TEST_SUCCESS( zeEventPoolDestroy( pool ) );
+}
+
+//////////////////////////////////////////////////////////////////////////
+static void test_concurrent_destroy( test_context_t &test )
+{
+    const int threadCount = 8;
+    const int iterations = 2000;
+    const uint32_t eventsPerThread = 8;
+
+    // shared by all threads while the tables fill up with destroyed handles
+    auto sharedPool = create_pool( test, eventsPerThread );
+    std::vector<ze_event_handle_t> sharedEvents;
+    for( uint32_t e = 0; e < eventsPerThread; ++e )
+        sharedEvents.push_back( create_event( sharedPool, e ) );
+
+    std::vector<std::thread> threads;
+    for( int t = 0; t < threadCount; ++t )
+    {
+        threads.emplace_back( [&] {
+            auto pool = create_pool( test, eventsPerThread );
+            for( int i = 0; i < iterations; ++i )
+            {
+                ze_event_handle_t events[ eventsPerThread ];
+                for( uint32_t e = 0; e < eventsPerThread; ++e )
+                    events[ e ] = create_event( pool, e );
+
+                auto commandList = create_command_list( test );
+                for( uint32_t e = 0; e < eventsPerThread; ++e )
+                {
+                    TEST_SUCCESS( zeCommandListAppendSignalEvent( commandList, events[ e ] ) );
+                    TEST_SUCCESS( zeCommandListAppendWaitOnEvents( commandList, 1, &sharedEvents[ e ] ) );
+                }
+                TEST_SUCCESS( zeCommandListClose( commandList ) );
+                TEST_SUCCESS( zeCommandListDestroy( commandList ) );
+
+                for( auto event : events )
+                {
+                    TEST_SUCCESS( zeEventHostSignal( event ) );
+                    TEST_SUCCESS( zeEventDestroy( event ) );
+                    TEST_CHECK( ZE_RESULT_ERROR_INVALID_NULL_HANDLE == zeEventHostSignal( event ) );
+                }
+                TEST_SUCCESS( zeEventHostSignal( sharedEvents[ i % eventsPerThread ] ) );
+            }
+            TEST_SUCCESS( zeEventPoolDestroy( pool ) );
+        } );
+    }
+    for( auto &thread : threads )
+        thread.join();
+
+    for( auto event : sharedEvents )
+    {
+        TEST_SUCCESS( zeEventHostSignal( event ) );
+        TEST_SUCCESS( zeEventDestroy( event ) );
+    }
+    TEST_SUCCESS( zeEventPoolDestroy( sharedPool ) );
+}
+
+int main( int argc, char *argv[] )
+{
+    test_context_t test = test_init();
+
+    test_rejected( test );
+    test_table_reuse( test );
+    test_concurrent_destroy( test );
+
+    test_fini( test );
+    std::cout << "PASSED" << std::endl;
+    return 0;
+}
@@ -0,0 +1,126 @@
+/*
+ *
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// TEST DESCRIPTION: loader handles stay unique and map to their driver handle
+//
+// Run with the loader intercepting calls, so that every handle the test sees
+// is a loader handle made by the loader's sharded, slab-backed factories.
+// Handles recycled after a destroy must map to the new driver handle, and
+// handles created and destroyed from several threads at once must never be
+// shared by two live objects.
+
+#include "test_util.h"
+#include "loader/ze_loader.h"
+
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////
+static void *driver_handle( zel_handle_type_t type, void *handle )
+{
+    void *driverHandle = nullptr;
+    TEST_SUCCESS( zelLoaderTranslateHandle( type, handle, &driverHandle ) );
+    TEST_CHECK( driverHandle != nullptr );
+    return driverHandle;
+}
+
+//////////////////////////////////////////////////////////////////////////
+static ze_event_handle_t create_event( ze_event_pool_handle_t pool, uint32_t index )
+{
+    ze_event_desc_t eventDesc = { ZE_STRUCTURE_TYPE_EVENT_DESC, nullptr, index, 0, 0 };
+    ze_event_handle_t event = nullptr;
+    TEST_SUCCESS( zeEventCreate( pool, &eventDesc, &event ) );
+    return event;
+}
+
+//////////////////////////////////////////////////////////////////////////
+static void test_reuse( test_context_t &test )
+{
+    ze_event_pool_desc_t poolDesc = { ZE_STRUCTURE_TYPE_EVENT_POOL_DESC, nullptr, 0, 1 };
+    ze_event_pool_handle_t pool;
+    TEST_SUCCESS( zeEventPoolCreate( test.context, &poolDesc, 1, &test.device, &pool ) );
+
+    std::set<void *> driverHandles;
+    for( int i = 0; i < 1000; ++i )
+    {
+        auto event = create_event( pool, 0 );
+        auto driverHandle = driver_handle( ZEL_HANDLE_EVENT, event );
+        TEST_CHECK( driverHandles.insert( driverHandle ).second );
+        TEST_SUCCESS( zeEventHostSignal( event ) );
+        TEST_SUCCESS( zeEventDestroy( event ) );
+    }
+
+    TEST_SUCCESS( zeEventPoolDestroy( pool ) );
+}
+
+//////////////////////////////////////////////////////////////////////////
+static void test_concurrent( test_context_t &test )
+{
+    const int threadCount = 8;
+    const int iterations = 2000;
+    const uint32_t eventsPerThread = 8;
+
+    std::mutex liveMutex;
+    std::set<ze_event_handle_t> live;
+
+    std::vector<std::thread> threads;
+    for( int t = 0; t < threadCount; ++t )
+    {
+        threads.emplace_back( [&] {
+            ze_event_pool_desc_t poolDesc = { ZE_STRUCTURE_TYPE_EVENT_POOL_DESC, nullptr, 0, eventsPerThread };
+            ze_event_pool_handle_t pool;
+            TEST_SUCCESS( zeEventPoolCreate( test.context, &poolDesc, 1, &test.device, &pool ) );
+
+            for( int i = 0; i < iterations; ++i )
+            {
+                ze_event_handle_t events[ eventsPerThread ];
+                for( uint32_t e = 0; e < eventsPerThread; ++e )
+                {
+                    events[ e ] = create_event( pool, e );
+                    TEST_CHECK( driver_handle( ZEL_HANDLE_EVENT, events[ e ] ) != events[ e ] );
+                }
+                {
+                    std::lock_guard<std::mutex> lock( liveMutex );
+                    for( auto event : events )
+                        TEST_CHECK( live.insert( event ).second );
+                }
+
+                for( auto event : events )
+                    TEST_SUCCESS( zeEventHostSignal( event ) );
+
+                {
+                    std::lock_guard<std::mutex> lock( liveMutex );
+                    for( auto event : events )
+                        live.erase( event );
+                }
+                for( auto event : events )
+                    TEST_SUCCESS( zeEventDestroy( event ) );
+            }
+
+            TEST_SUCCESS( zeEventPoolDestroy( pool ) );
+        } );
+    }
+    for( auto &thread : threads )
+        thread.join();
+
+    TEST_CHECK( live.empty() );
+}
+
+int main( int argc, char *argv[] )
+{
+    test_context_t test = test_init();
+
+    test_reuse( test );
+    test_concurrent( test );
+
+    test_fini( test );
+    std::cout << "PASSED" << std::endl;
+    return 0;
+}
@@ -0,0 +1,216 @@
+/*
+ *
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// TEST DESCRIPTION: releasing a loader handle releases the handles under it
+//
+// Builds loader handles for a context, event pools and events directly from
+// the loader's object_t, without a driver, and checks that releasing the
+// context releases every handle created under it exactly once: after some
+// children were released on their own, when a child is destroyed while its
+// owner's release already took it over, and after children were created and
+// destroyed under several owners from several threads at once.
+
+#include "ze_ddi.h"
+#include "zet_ddi.h"
+#include "zes_ddi.h"
+#include "ze_util.h"
+#include "ze_object.h"
+
+#include "test_util.h"
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <thread>
+#include <vector>
+
+using context_object_t = object_t < ze_context_handle_t, object_owner_link_t >;
+using event_pool_object_t = object_t < ze_event_pool_handle_t, object_owner_link_t >;
+using event_object_t = object_t < ze_event_handle_t, object_link_t >;
+
+//////////////////////////////////////////////////////////////////////////
+/// factory counting its live loader handles
+template<typename _object_t>
+struct counted_factory_t : _object_t::factory_t
+{
+    size_t live()
+    {
+        size_t count = 0;
+        for( auto &shard : this->shards )
+        {
+            std::lock_guard<std::mutex> lock( shard.mut );
+            count += shard.count;
+        }
+        return count;
+    }
+};
+
+static dditable_t dditable = {};
+static counted_factory_t<context_object_t> contexts;
+static counted_factory_t<event_pool_object_t> eventPools;
+static counted_factory_t<event_object_t> events;
+
+//////////////////////////////////////////////////////////////////////////
+/// unique driver handles
+template<typename _handle_t>
+static _handle_t driver_handle()
+{
+    static std::atomic<uintptr_t> next{ 0 };
+    return reinterpret_cast<_handle_t>( ( ++next ) * 64 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// counts how often each event's loader handle is released by its owner
+static std::mutex releasesMutex;
+static std::map<object_link_t *, int> releases;
+static void ( *onRelease )( object_link_t * ) = nullptr;
+
+static void countingRelease( object_link_t *link )
+{
+    {
+        std::lock_guard<std::mutex> lock( releasesMutex );
+        ++releases[ link ];
+    }
+    if( onRelease )
+        onRelease( link );
+    event_object_t::releaseLink( link );
+}
+
+//////////////////////////////////////////////////////////////////////////
+static ze_context_handle_t create_context()
+{
+    return context_object_t::wrap( contexts, driver_handle<ze_context_handle_t>(), &dditable );
+}
+
+static ze_event_pool_handle_t create_pool( ze_context_handle_t context )
+{
+    return event_pool_object_t::wrap( eventPools, driver_handle<ze_event_pool_handle_t>(), &dditable,
+        context_object_t::owner( context, &dditable ) );
+}
+
+static ze_event_handle_t create_event( ze_event_pool_handle_t pool )
+{
+    return event_object_t::wrap( events, driver_handle<ze_event_handle_t>(), &dditable,
+        event_pool_object_t::owner( pool, &dditable ), countingRelease );
+}
+
+static object_link_t *link_of( ze_event_handle_t event )
+{
+    return &reinterpret_cast<event_object_t *>( event )->link;
+}
+
+//////////////////////////////////////////////////////////////////////////
+static void check_all_released()
+{
+    TEST_CHECK( contexts.live() == 0 );
+    TEST_CHECK( eventPools.live() == 0 );
+    TEST_CHECK( events.live() == 0 );
+
+    std::lock_guard<std::mutex> lock( releasesMutex );
+    for( auto &release : releases )
+        TEST_CHECK( release.second == 1 );
+    releases.clear();
+}
+
+//////////////////////////////////////////////////////////////////////////
+static void test_release_children()
+{
+    auto context = create_context();
+    std::vector<ze_event_handle_t> created;
+    for( int p = 0; p < 4; ++p )
+    {
+        auto pool = create_pool( context );
+        for( int e = 0; e < 16; ++e )
+            created.push_back( create_event( pool ) );
+    }
+    TEST_CHECK( events.live() == created.size() );
+
+    // children released on their own leave the list of their owner
+    for( size_t e = 0; e < created.size(); e += 3 )
+        event_object_t::release( events, created[ e ], &dditable );
+
+    context_object_t::release( contexts, context, &dditable );
+    check_all_released();
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// a child destroyed once its owner's release took it over, as by a
+/// zeEventDestroy racing with zeContextDestroy, is released by the owner
+static ze_event_handle_t victim = nullptr;
+
+static void destroyVictim( object_link_t *link )
+{
+    if( ( nullptr == victim ) || ( link_of( victim ) == link ) )
+        return;
+    auto event = victim;
+    victim = nullptr;
+    event_object_t::release( events, event, &dditable );
+}
+
+static void test_claimed_child()
+{
+    auto context = create_context();
+    auto pool = create_pool( context );
+    std::vector<ze_event_handle_t> created;
+    for( int e = 0; e < 8; ++e )
+        created.push_back( create_event( pool ) );
+
+    // the newest child is released first, so the oldest one is still listed
+    victim = created.front();
+    onRelease = destroyVictim;
+    context_object_t::release( contexts, context, &dditable );
+    onRelease = nullptr;
+
+    TEST_CHECK( victim == nullptr );
+    TEST_CHECK( releases.size() == created.size() );
+    check_all_released();
+}
+
+//////////////////////////////////////////////////////////////////////////
+static void test_concurrent_owners()
+{
+    const size_t threadCount = 8;
+    const int iterations = 2000;
+
+    auto context = create_context();
+    std::vector<std::thread> threads;
+    for( size_t t = 0; t < threadCount; ++t )
+    {
+        threads.emplace_back( [&] {
+            auto pool = create_pool( context );
+            for( int i = 0; i < iterations; ++i )
+            {
+                ze_event_handle_t batch[ 8 ];
+                for( auto &event : batch )
+                    event = create_event( pool );
+                for( auto &event : batch )
+                    event_object_t::release( events, event, &dditable );
+            }
+
+            // leave some events to the release of the context
+            for( int e = 0; e < 8; ++e )
+                create_event( pool );
+        } );
+    }
+    for( auto &thread : threads )
+        thread.join();
+
+    TEST_CHECK( events.live() == threadCount * 8 );
+    context_object_t::release( contexts, context, &dditable );
+    check_all_released();
+}
+
+int main( int argc, char *argv[] )
+{
+    test_release_children();
+    test_claimed_child();
+    test_concurrent_owners();
+
+    std::cout << "PASSED" << std::endl;
+    return 0;
+}
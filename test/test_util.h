@@ -0,0 +1,56 @@
+/*
+ *
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#pragma once
+#include <cstdlib>
+#include <iostream>
+
+#include "ze_api.h"
+
+//////////////////////////////////////////////////////////////////////////
+/// Fails the test, which ctest sees from the exit code
+#define TEST_CHECK( condition )                                            \
+    do {                                                                   \
+        if( !( condition ) ) {                                             \
+            std::cout << __FILE__ << ":" << __LINE__ << ": check failed: " \
+                      << #condition << std::endl;                          \
+            std::exit( 1 );                                                \
+        }                                                                  \
+    } while( 0 )
+
+#define TEST_SUCCESS( call )                                               \
+    TEST_CHECK( ZE_RESULT_SUCCESS == ( call ) )
+
+//////////////////////////////////////////////////////////////////////////
+/// Driver, device and context of the null driver, which the tests are
+/// registered to run against
+struct test_context_t
+{
+    ze_driver_handle_t driver = nullptr;
+    ze_device_handle_t device = nullptr;
+    ze_context_handle_t context = nullptr;
+};
+
+inline test_context_t test_init( void )
+{
+    TEST_SUCCESS( zeInit( 0 ) );
+
+    test_context_t test;
+    uint32_t count = 1;
+    TEST_SUCCESS( zeDriverGet( &count, &test.driver ) );
+    count = 1;
+    TEST_SUCCESS( zeDeviceGet( test.driver, &count, &test.device ) );
+
+    ze_context_desc_t contextDesc = { ZE_STRUCTURE_TYPE_CONTEXT_DESC, nullptr, 0 };
+    TEST_SUCCESS( zeContextCreate( test.driver, &contextDesc, &test.context ) );
+    return test;
+}
+
+inline void test_fini( test_context_t &test )
+{
+    TEST_SUCCESS( zeContextDestroy( test.context ) );
+}
@@ -0,0 +1,206 @@
+/*
+ *
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// TEST DESCRIPTION: calls are traced exactly while a tracer is enabled
+//
+// Run with the tracing layer loaded. The exported functions switch between
+// the pass-through and the traced tables as tracers are enabled and
+// disabled, so each tracer must see the calls made while it is enabled and
+// none of the others; that holds for the tables returned by the loader's
+// zeGet*ProcAddrTable exports as well, and while tracers are switched from
+// another thread.
+
+#include "test_util.h"
+#include "ze_ddi.h"
+#include "layers/zel_tracing_api.h"
+#include "layers/zel_tracing_register_cb.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////
+/// tracer counting the zeEventHostSignal calls it sees
+struct counting_tracer_t
+{
+    zel_tracer_handle_t tracer = nullptr;
+    bool enabled = false;
+    std::atomic<uint64_t> prologues{ 0 };
+    std::atomic<uint64_t> epilogues{ 0 };
+
+    static void prologue( ze_event_host_signal_params_t *params, ze_result_t result, void *pTracerUserData, void **ppTracerInstanceUserData )
+    {
+        ++static_cast<counting_tracer_t *>( pTracerUserData )->prologues;
+    }
+
+    static void epilogue( ze_event_host_signal_params_t *params, ze_result_t result, void *pTracerUserData, void **ppTracerInstanceUserData )
+    {
+        ++static_cast<counting_tracer_t *>( pTracerUserData )->epilogues;
+    }
+
+    counting_tracer_t()
+    {
+        zel_tracer_desc_t tracerDesc = { ZEL_STRUCTURE_TYPE_TRACER_EXP_DESC, nullptr, this };
+        TEST_SUCCESS( zelTracerCreate( &tracerDesc, &tracer ) );
+        TEST_SUCCESS( zelTracerEventHostSignalRegisterCallback( tracer, ZEL_REGISTER_PROLOGUE, prologue ) );
+        TEST_SUCCESS( zelTracerEventHostSignalRegisterCallback( tracer, ZEL_REGISTER_EPILOGUE, epilogue ) );
+    }
+
+    ~counting_tracer_t()
+    {
+        destroy();
+    }
+
+    /// once disabled, a tracer can only be enabled again when no call is
+    /// still running its callbacks; destroying it waits for those calls
+    void destroy()
+    {
+        if( nullptr == tracer )
+            return;
+        enable( false );
+        TEST_SUCCESS( zelTracerDestroy( tracer ) );
+        tracer = nullptr;
+    }
+
+    void enable( bool enable )
+    {
+        if( enable == enabled )
+            return;
+        TEST_SUCCESS( zelTracerSetEnabled( tracer, enable ) );
+        enabled = enable;
+    }
+
+    /// checks the calls seen since the last check
+    void check( uint64_t calls )
+    {
+        TEST_CHECK( prologues.exchange( 0 ) == calls );
+        TEST_CHECK( epilogues.exchange( 0 ) == calls );
+    }
+};
+
+//////////////////////////////////////////////////////////////////////////
+static void signal( ze_event_handle_t event, int calls )
+{
+    for( int i = 0; i < calls; ++i )
+        TEST_SUCCESS( zeEventHostSignal( event ) );
+}
+
+//////////////////////////////////////////////////////////////////////////
+static void test_switching( ze_event_handle_t event )
+{
+    counting_tracer_t first;
+    counting_tracer_t second;
+
+    // created disabled
+    signal( event, 10 );
+    first.check( 0 );
+
+    first.enable( true );
+    signal( event, 10 );
+    first.check( 10 );
+
+    first.enable( false );
+    signal( event, 10 );
+    first.check( 0 );
+
+    // enabling again switches back to the traced tables
+    first.enable( true );
+    second.enable( true );
+    signal( event, 10 );
+    first.check( 10 );
+    second.check( 10 );
+
+    // the remaining tracer keeps the calls traced
+    first.enable( false );
+    signal( event, 10 );
+    first.check( 0 );
+    second.check( 10 );
+
+    second.enable( false );
+    signal( event, 10 );
+    second.check( 0 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+static void test_exported_table( ze_event_handle_t event )
+{
+    ze_event_dditable_t eventTable = {};
+    TEST_SUCCESS( zeGetEventProcAddrTable( ZE_API_VERSION_CURRENT, &eventTable ) );
+    TEST_CHECK( eventTable.pfnHostSignal != nullptr );
+
+    counting_tracer_t tracer;
+    TEST_SUCCESS( eventTable.pfnHostSignal( event ) );
+    tracer.check( 0 );
+
+    tracer.enable( true );
+    TEST_SUCCESS( eventTable.pfnHostSignal( event ) );
+    tracer.check( 1 );
+
+    tracer.enable( false );
+    TEST_SUCCESS( eventTable.pfnHostSignal( event ) );
+    tracer.check( 0 );
+}
+
+//////////////////////////////////////////////////////////////////////////
+static void test_concurrent_switching( ze_event_handle_t event )
+{
+    const int threadCount = 4;
+    const int calls = 200000;
+
+    std::atomic<int> running{ threadCount };
+
+    std::vector<std::thread> threads;
+    for( int t = 0; t < threadCount; ++t )
+    {
+        threads.emplace_back( [&] {
+            signal( event, calls );
+            --running;
+        } );
+    }
+
+    // calls made while switching are traced whole or not at all
+    uint64_t traced = 0;
+    while( running > 0 )
+    {
+        counting_tracer_t tracer;
+        tracer.enable( true );
+        tracer.enable( false );
+        tracer.destroy();
+        TEST_CHECK( tracer.prologues == tracer.epilogues );
+        traced += tracer.prologues;
+    }
+    for( auto &thread : threads )
+        thread.join();
+    TEST_CHECK( traced <= uint64_t( threadCount ) * calls );
+
+    counting_tracer_t tracer;
+    signal( event, 10 );
+    tracer.check( 0 );
+}
+
+int main( int argc, char *argv[] )
+{
+    test_context_t test = test_init();
+
+    ze_event_pool_desc_t poolDesc = { ZE_STRUCTURE_TYPE_EVENT_POOL_DESC, nullptr, 0, 1 };
+    ze_event_pool_handle_t pool;
+    TEST_SUCCESS( zeEventPoolCreate( test.context, &poolDesc, 1, &test.device, &pool ) );
+    ze_event_desc_t eventDesc = { ZE_STRUCTURE_TYPE_EVENT_DESC, nullptr, 0, 0, 0 };
+    ze_event_handle_t event;
+    TEST_SUCCESS( zeEventCreate( pool, &eventDesc, &event ) );
+
+    test_switching( event );
+    test_exported_table( event );
+    test_concurrent_switching( event );
+
+    TEST_SUCCESS( zeEventDestroy( event ) );
+    TEST_SUCCESS( zeEventPoolDestroy( pool ) );
+    test_fini( test );
+    std::cout << "PASSED" << std::endl;
+    return 0;
+}